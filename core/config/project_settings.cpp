@@ -921,7 +921,99 @@ Error ProjectSettings::_load_settings_binary(const String &p_path) {
 	return OK;
 }
 
-Error ProjectSettings::_load_settings_text(const String &p_path) {
+// Cache of the parsed project.godot, written next to it in the project data
+// directory after a successful text parse. It only holds the assignments the
+// text file actually made (not registered defaults), and is considered valid
+// only for the exact engine build and source file modification time it was
+// generated from, so it can never go stale. This mostly matters for headless
+// fleets cold-starting many processes from the same project.
+static const uint32_t SETTINGS_CACHE_FORMAT_VERSION = 1;
+
+String ProjectSettings::_get_settings_cache_path(const String &p_text_path) {
+	return p_text_path.get_base_dir().path_join(".godot").path_join("project_settings.cache");
+}
+
+Error ProjectSettings::_load_settings_cache(const String &p_text_path) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(_get_settings_cache_path(p_text_path), FileAccess::READ, &err);
+	if (err != OK) {
+		return err;
+	}
+
+	uint8_t hdr[4];
+	f->get_buffer(hdr, 4);
+	if (hdr[0] != 'E' || hdr[1] != 'C' || hdr[2] != 'F' || hdr[3] != 'C') {
+		return ERR_FILE_UNRECOGNIZED;
+	}
+	if (f->get_32() != SETTINGS_CACHE_FORMAT_VERSION) {
+		return ERR_FILE_UNRECOGNIZED;
+	}
+	if (f->get_pascal_string() != String(GODOT_VERSION_FULL_BUILD) + GODOT_VERSION_HASH) {
+		return ERR_FILE_UNRECOGNIZED;
+	}
+	uint64_t mtime = f->get_64();
+	if (mtime != FileAccess::get_modified_time(p_text_path)) {
+		// project.godot changed since the cache was written.
+		return ERR_FILE_UNRECOGNIZED;
+	}
+
+	uint32_t count = f->get_32();
+	for (uint32_t i = 0; i < count; i++) {
+		String key = f->get_pascal_string();
+		uint32_t vlen = f->get_32();
+		Vector<uint8_t> d;
+		d.resize(vlen);
+		f->get_buffer(d.ptrw(), vlen);
+		Variant value;
+		err = decode_variant(value, d.ptr(), d.size(), nullptr, true);
+		ERR_FAIL_COND_V_MSG(err != OK, ERR_FILE_CORRUPT, vformat("Error decoding cached property: '%s'.", key));
+		set(key, value);
+	}
+
+	last_save_time = mtime;
+	return OK;
+}
+
+void ProjectSettings::_save_settings_cache(const String &p_text_path, const LocalVector<Pair<String, Variant>> &p_assignments) {
+	const String dir = p_text_path.get_base_dir().path_join(".godot");
+	if (!DirAccess::exists(dir)) {
+		Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+		if (da.is_null() || da->make_dir_recursive(dir) != OK) {
+			return; // Read-only or inaccessible location; caching is best effort.
+		}
+	}
+
+	Ref<FileAccess> f = FileAccess::open(_get_settings_cache_path(p_text_path), FileAccess::WRITE);
+	if (f.is_null()) {
+		return;
+	}
+
+	const uint8_t hdr[4] = { 'E', 'C', 'F', 'C' };
+	f->store_buffer(hdr, 4);
+	f->store_32(SETTINGS_CACHE_FORMAT_VERSION);
+	f->store_pascal_string(String(GODOT_VERSION_FULL_BUILD) + GODOT_VERSION_HASH);
+	f->store_64(FileAccess::get_modified_time(p_text_path));
+
+	f->store_32(p_assignments.size());
+	for (const Pair<String, Variant> &E : p_assignments) {
+		f->store_pascal_string(E.first);
+		int len;
+		Error err = encode_variant(E.second, nullptr, len, true);
+		if (err != OK) {
+			// Unencodable value; drop the half-written cache.
+			f.unref();
+			DirAccess::remove_absolute(_get_settings_cache_path(p_text_path));
+			return;
+		}
+		Vector<uint8_t> buff;
+		buff.resize(len);
+		encode_variant(E.second, buff.ptrw(), len, true);
+		f->store_32(len);
+		f->store_buffer(buff.ptr(), buff.size());
+	}
+}
+
+Error ProjectSettings::_load_settings_text(const String &p_path, LocalVector<Pair<String, Variant>> *r_assignments) {
 	Error err;
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
 
@@ -953,6 +1045,11 @@ Error ProjectSettings::_load_settings_text(const String &p_path) {
 			// If we're loading a project.godot from source code, we can operate some
 			// ProjectSettings conversions if need be.
 			_convert_to_last_version(config_version);
+			if (r_assignments && config_version < CONFIG_VERSION) {
+				// Conversions may have rewritten settings, so the raw
+				// assignments must not be cached.
+				r_assignments->clear();
+			}
 			last_save_time = FileAccess::get_modified_time(get_resource_path().path_join("project.godot"));
 			return OK;
 		}
@@ -963,10 +1060,10 @@ Error ProjectSettings::_load_settings_text(const String &p_path) {
 				config_version = value;
 				ERR_FAIL_COND_V_MSG(config_version > CONFIG_VERSION, ERR_FILE_CANT_OPEN, vformat("Can't open project at '%s', its `config_version` (%d) is from a more recent and incompatible version of the engine. Expected config version: %d.", p_path, config_version, CONFIG_VERSION));
 			} else {
-				if (section.is_empty()) {
-					set(assign, value);
-				} else {
-					set(section + "/" + assign, value);
+				const String key = section.is_empty() ? assign : section + "/" + assign;
+				set(key, value);
+				if (r_assignments) {
+					r_assignments->push_back(Pair<String, Variant>(key, value));
 				}
 			}
 		} else if (!next_tag.name.is_empty()) {
@@ -985,9 +1082,18 @@ Error ProjectSettings::_load_settings_text_or_binary(const String &p_text_path,
 		ERR_PRINT(vformat("Couldn't load file '%s', error code %d.", p_bin_path, err));
 	}
 
+	// Next, try the cache generated from a previous parse of the text file.
+	if (_load_settings_cache(p_text_path) == OK) {
+		return OK;
+	}
+
 	// Fallback to text-based project.godot file if binary was not found.
-	err = _load_settings_text(p_text_path);
+	LocalVector<Pair<String, Variant>> assignments;
+	err = _load_settings_text(p_text_path, &assignments);
 	if (err == OK) {
+		if (!assignments.is_empty()) {
+			_save_settings_cache(p_text_path, assignments);
+		}
 		return OK;
 	} else if (err != ERR_FILE_NOT_FOUND) {
 		ERR_PRINT(vformat("Couldn't load file '%s', error code %d.", p_text_path, err));
@@ -1774,6 +1880,7 @@ ProjectSettings::ProjectSettings() {
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/rendering_device/staging_buffer/max_size_mb", PROPERTY_HINT_RANGE, "1,1024,1,or_greater"), 128);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/rendering_device/staging_buffer/texture_upload_region_size_px", PROPERTY_HINT_RANGE, "1,256,1,or_greater"), 64);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/rendering_device/staging_buffer/texture_download_region_size_px", PROPERTY_HINT_RANGE, "1,256,1,or_greater"), 64);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/rendering_device/secondary_command_buffers_per_frame", PROPERTY_HINT_RANGE, "0,16,1,or_greater"), 0);
 	GLOBAL_DEF_RST(PropertyInfo(Variant::BOOL, "rendering/rendering_device/pipeline_cache/enable"), true);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/rendering_device/pipeline_cache/save_chunk_size_mb", PROPERTY_HINT_RANGE, "0.000001,64.0,0.001,or_greater"), 3.0);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/rendering_device/vulkan/max_descriptors_per_pool", PROPERTY_HINT_RANGE, "1,256,1,or_greater"), 64);
@@ -127,9 +127,12 @@ protected:
 
 	static inline ProjectSettings *singleton = nullptr;
 
-	Error _load_settings_text(const String &p_path);
+	Error _load_settings_text(const String &p_path, LocalVector<Pair<String, Variant>> *r_assignments = nullptr);
 	Error _load_settings_binary(const String &p_path);
 	Error _load_settings_text_or_binary(const String &p_text_path, const String &p_bin_path);
+	static String _get_settings_cache_path(const String &p_text_path);
+	Error _load_settings_cache(const String &p_text_path);
+	void _save_settings_cache(const String &p_text_path, const LocalVector<Pair<String, Variant>> &p_assignments);
 
 	Error _save_settings_text(const String &p_file, const RBMap<String, List<String>> &props, const CustomMap &p_custom = CustomMap(), const String &p_custom_features = String());
 	Error _save_settings_binary(const String &p_file, const RBMap<String, List<String>> &props, const CustomMap &p_custom = CustomMap(), const String &p_custom_features = String());
@@ -598,6 +598,20 @@ Dictionary OS::get_memory_info() const {
 	return ::OS::get_singleton()->get_memory_info();
 }
 
+Dictionary OS::get_tagged_memory_info() const {
+	Dictionary info;
+	for (int i = 0; i < Memory::ALLOC_TAG_MAX; i++) {
+		Memory::AllocTag tag = (Memory::AllocTag)i;
+		Dictionary tag_info;
+		tag_info["usage"] = Memory::get_tag_mem_usage(tag);
+		tag_info["peak"] = Memory::get_tag_mem_max_usage(tag);
+		tag_info["alloc_count"] = Memory::get_tag_alloc_count(tag);
+		tag_info["alloc_bytes"] = Memory::get_tag_alloc_bytes(tag);
+		info[String(Memory::get_alloc_tag_name(tag))] = tag_info;
+	}
+	return info;
+}
+
 /** This method uses a signed argument for better error reporting as it's used from the scripting API. */
 void OS::delay_usec(int p_usec) const {
 	ERR_FAIL_COND_MSG(
@@ -818,6 +832,7 @@ void OS::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_static_memory_usage"), &OS::get_static_memory_usage);
 	ClassDB::bind_method(D_METHOD("get_static_memory_peak_usage"), &OS::get_static_memory_peak_usage);
 	ClassDB::bind_method(D_METHOD("get_memory_info"), &OS::get_memory_info);
+	ClassDB::bind_method(D_METHOD("get_tagged_memory_info"), &OS::get_tagged_memory_info);
 
 	ClassDB::bind_method(D_METHOD("move_to_trash", "path"), &OS::move_to_trash);
 	ClassDB::bind_method(D_METHOD("get_user_data_dir"), &OS::get_user_data_dir);
@@ -47,6 +47,11 @@ static ZSTD_DCtx *current_zstd_d_ctx = nullptr;
 static bool current_zstd_long_distance_matching;
 static int current_zstd_window_log_size;
 
+static BinaryMutex c_mutex;
+static ZSTD_CCtx *current_zstd_c_ctx = nullptr;
+static bool current_zstd_c_long_distance_matching;
+static int current_zstd_c_window_log_size;
+
 int64_t Compression::compress(uint8_t *p_dst, const uint8_t *p_src, int64_t p_src_size, Mode p_mode) {
 	switch (p_mode) {
 		case MODE_BROTLI: {
@@ -91,15 +96,27 @@ int64_t Compression::compress(uint8_t *p_dst, const uint8_t *p_src, int64_t p_sr
 
 		} break;
 		case MODE_ZSTD: {
-			ZSTD_CCtx *cctx = ZSTD_createCCtx();
-			ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, zstd_level);
-			if (zstd_long_distance_matching) {
-				ZSTD_CCtx_setParameter(cctx, ZSTD_c_enableLongDistanceMatching, 1);
-				ZSTD_CCtx_setParameter(cctx, ZSTD_c_windowLog, zstd_window_log_size);
+			MutexLock lock(c_mutex);
+
+			// Reuse the compression context across calls; creating one per call
+			// dominates the cost of compressing small payloads.
+			if (!current_zstd_c_ctx || current_zstd_c_long_distance_matching != zstd_long_distance_matching || current_zstd_c_window_log_size != zstd_window_log_size) {
+				if (current_zstd_c_ctx) {
+					ZSTD_freeCCtx(current_zstd_c_ctx);
+				}
+
+				current_zstd_c_ctx = ZSTD_createCCtx();
+				ZSTD_CCtx_setParameter(current_zstd_c_ctx, ZSTD_c_compressionLevel, zstd_level);
+				if (zstd_long_distance_matching) {
+					ZSTD_CCtx_setParameter(current_zstd_c_ctx, ZSTD_c_enableLongDistanceMatching, 1);
+					ZSTD_CCtx_setParameter(current_zstd_c_ctx, ZSTD_c_windowLog, zstd_window_log_size);
+				}
+				current_zstd_c_long_distance_matching = zstd_long_distance_matching;
+				current_zstd_c_window_log_size = zstd_window_log_size;
 			}
+
 			const int64_t max_dst_size = get_max_compressed_buffer_size(p_src_size, MODE_ZSTD);
-			const size_t ret = ZSTD_compressCCtx(cctx, p_dst, max_dst_size, p_src, p_src_size, zstd_level);
-			ZSTD_freeCCtx(cctx);
+			const size_t ret = ZSTD_compressCCtx(current_zstd_c_ctx, p_dst, max_dst_size, p_src, p_src_size, zstd_level);
 			return (int64_t)ret;
 		} break;
 	}
@@ -583,6 +583,53 @@ PackedStringArray DirAccess::get_directories_at(const String &p_path) {
 	return da->get_directories();
 }
 
+PackedStringArray DirAccess::get_files_recursive(const String &p_pattern) {
+	PackedStringArray ret;
+	_get_contents_recursive(String(), p_pattern, ret);
+	ret.sort();
+	return ret;
+}
+
+PackedStringArray DirAccess::get_files_recursive_at(const String &p_path, const String &p_pattern) {
+	Ref<DirAccess> da = DirAccess::open(p_path);
+	ERR_FAIL_COND_V_MSG(da.is_null(), PackedStringArray(), vformat("Couldn't open directory at path \"%s\".", p_path));
+	return da->get_files_recursive(p_pattern);
+}
+
+Error DirAccess::_get_contents_recursive(const String &p_prefix, const String &p_pattern, PackedStringArray &r_files) {
+	// The whole walk runs in a single call, so scanning a large tree doesn't
+	// pay per-entry call overhead and the pattern is matched during
+	// enumeration instead of on a returned copy.
+	List<String> dirs;
+
+	list_dir_begin();
+	String n = _get_next();
+	while (!n.is_empty()) {
+		if (current_is_dir()) {
+			dirs.push_back(n);
+		} else if (p_pattern.is_empty() || n.matchn(p_pattern)) {
+			r_files.append(p_prefix + n);
+		}
+		n = _get_next();
+	}
+	list_dir_end();
+
+	for (const String &rel_path : dirs) {
+		Error err = change_dir(rel_path);
+		ERR_FAIL_COND_V_MSG(err != OK, err, vformat("Cannot change current directory to '%s'.", rel_path));
+
+		err = _get_contents_recursive(p_prefix + rel_path + "/", p_pattern, r_files);
+		if (err) {
+			change_dir("..");
+			ERR_FAIL_V_MSG(err, "Failed to list recursively.");
+		}
+		err = change_dir("..");
+		ERR_FAIL_COND_V_MSG(err != OK, err, "Failed to go back.");
+	}
+
+	return OK;
+}
+
 PackedStringArray DirAccess::_get_contents(bool p_directories) {
 	PackedStringArray ret;
 
@@ -644,6 +691,8 @@ void DirAccess::_bind_methods() {
 	ClassDB::bind_static_method("DirAccess", D_METHOD("get_files_at", "path"), &DirAccess::get_files_at);
 	ClassDB::bind_method(D_METHOD("get_directories"), &DirAccess::get_directories);
 	ClassDB::bind_static_method("DirAccess", D_METHOD("get_directories_at", "path"), &DirAccess::get_directories_at);
+	ClassDB::bind_method(D_METHOD("get_files_recursive", "pattern"), &DirAccess::get_files_recursive, DEFVAL(String()));
+	ClassDB::bind_static_method("DirAccess", D_METHOD("get_files_recursive_at", "path", "pattern"), &DirAccess::get_files_recursive_at, DEFVAL(String()));
 	ClassDB::bind_static_method("DirAccess", D_METHOD("get_drive_count"), &DirAccess::_get_drive_count);
 	ClassDB::bind_static_method("DirAccess", D_METHOD("get_drive_name", "idx"), &DirAccess::get_drive_name);
 	ClassDB::bind_method(D_METHOD("get_current_drive"), &DirAccess::get_current_drive);
@@ -55,6 +55,7 @@ private:
 
 	Error _copy_dir(Ref<DirAccess> &p_target_da, const String &p_to, int p_chmod_flags, bool p_copy_links);
 	PackedStringArray _get_contents(bool p_directories);
+	Error _get_contents_recursive(const String &p_prefix, const String &p_pattern, PackedStringArray &r_files);
 
 	static inline thread_local Error last_dir_open_error = OK;
 	bool include_navigational = false;
@@ -159,6 +160,8 @@ public:
 	static PackedStringArray get_files_at(const String &p_path);
 	PackedStringArray get_directories();
 	static PackedStringArray get_directories_at(const String &p_path);
+	PackedStringArray get_files_recursive(const String &p_pattern = String());
+	static PackedStringArray get_files_recursive_at(const String &p_path, const String &p_pattern = String());
 	String _get_next();
 
 	void set_include_navigational(bool p_enable);
@@ -75,6 +75,22 @@ Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 	return ret == -1 ? ERR_FILE_CORRUPT : OK;
 }
 
+Error FileAccessCompressed::open_and_write(Ref<FileAccess> p_base) {
+	ERR_FAIL_COND_V(p_base.is_null(), ERR_INVALID_PARAMETER);
+	_close();
+
+	f = p_base;
+	buffer.clear();
+	writing = true;
+	write_pos = 0;
+	write_buffer_size = 256;
+	buffer.resize(256);
+	write_max = 0;
+	write_ptr = buffer.ptrw();
+
+	return OK;
+}
+
 Error FileAccessCompressed::open_internal(const String &p_path, int p_mode_flags) {
 	ERR_FAIL_COND_V(p_mode_flags == READ_WRITE, ERR_UNAVAILABLE);
 	_close();
@@ -119,6 +135,10 @@ void FileAccessCompressed::_close() {
 	if (writing) {
 		//save block table and all compressed blocks
 
+		// Nothing was written to the base file yet, so its position is where the stream begins.
+		// It is not necessarily 0; the stream may be embedded in a larger file (e.g. a PCK).
+		const uint64_t stream_begin = f->get_position();
+
 		CharString mgc = magic.utf8();
 		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //write header 4
 		f->store_32(cmode); //write compression mode 4
@@ -150,7 +170,7 @@ void FileAccessCompressed::_close() {
 			block_sizes.push_back(compressed_size);
 		}
 
-		f->seek(16); //ok write block sizes
+		f->seek(stream_begin + 16); //ok write block sizes
 		for (uint32_t i = 0; i < bc; i++) {
 			f->store_32(block_sizes[i]);
 		}
@@ -0,0 +1,331 @@
+/**************************************************************************/
+/*  http_client_pool.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "http_client_pool.h"
+
+#include "core/os/os.h"
+
+Error HTTPClientPool::connect_to_host(const String &p_host, int p_port, Ref<TLSOptions> p_tls_options) {
+	ERR_FAIL_COND_V(p_host.is_empty(), ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V(p_port < -1 || p_port > 65535, ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V_MSG(!host.is_empty(), ERR_ALREADY_IN_USE, "Pool is already connected to a host, call close() first.");
+
+	host = p_host;
+	port = p_port;
+	tls_options = p_tls_options;
+
+	// Connections are created lazily as requests come in; see _poll_internal().
+
+	if (use_threads.is_set()) {
+		thread_request_quit.clear();
+		thread.start(_thread_func, this);
+	}
+
+	return OK;
+}
+
+int HTTPClientPool::request(HTTPClient::Method p_method, const String &p_url, const Vector<String> &p_headers, const PackedByteArray &p_body, const Callable &p_callback) {
+	ERR_FAIL_COND_V_MSG(host.is_empty(), -1, "Pool is not connected to a host, call connect_to_host() first.");
+	ERR_FAIL_INDEX_V(p_method, HTTPClient::METHOD_MAX, -1);
+	ERR_FAIL_COND_V(!p_callback.is_valid(), -1);
+
+	MutexLock lock(mutex);
+
+	Request req;
+	req.id = next_request_id++;
+	req.method = p_method;
+	req.url = p_url;
+	req.headers = p_headers;
+	req.body = p_body;
+	req.callback = p_callback;
+	pending_requests.push_back(req);
+
+	return req.id;
+}
+
+bool HTTPClientPool::cancel_request(int p_id) {
+	MutexLock lock(mutex);
+
+	for (List<Request>::Element *E = pending_requests.front(); E; E = E->next()) {
+		if (E->get().id == p_id) {
+			pending_requests.erase(E);
+			return true;
+		}
+	}
+
+	for (Connection *conn : connections) {
+		if (conn->busy && conn->active.id == p_id) {
+			// Abort the connection; it will be re-established for the next request.
+			conn->client->close();
+			conn->busy = false;
+			conn->active = Request();
+			conn->response_body.clear();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int HTTPClientPool::get_pending_request_count() const {
+	MutexLock lock(mutex);
+
+	int count = pending_requests.size();
+	for (const Connection *conn : connections) {
+		if (conn->busy) {
+			count++;
+		}
+	}
+	return count;
+}
+
+void HTTPClientPool::set_max_connections(int p_count) {
+	ERR_FAIL_COND(p_count < 1);
+	MutexLock lock(mutex);
+	max_connections = p_count;
+}
+
+int HTTPClientPool::get_max_connections() const {
+	return max_connections;
+}
+
+void HTTPClientPool::set_use_threads(bool p_enable) {
+	ERR_FAIL_COND_MSG(!host.is_empty(), "Threading can't be changed while connected to a host.");
+	use_threads.set_to(p_enable);
+}
+
+bool HTTPClientPool::is_using_threads() const {
+	return use_threads.is_set();
+}
+
+void HTTPClientPool::_thread_func(void *p_userdata) {
+	HTTPClientPool *pool = static_cast<HTTPClientPool *>(p_userdata);
+
+	while (!pool->thread_request_quit.is_set()) {
+		{
+			MutexLock lock(pool->mutex);
+			pool->_poll_internal();
+		}
+		OS::get_singleton()->delay_usec(100);
+	}
+}
+
+Error HTTPClientPool::poll() {
+	ERR_FAIL_COND_V_MSG(host.is_empty(), ERR_UNCONFIGURED, "Pool is not connected to a host, call connect_to_host() first.");
+	if (use_threads.is_set()) {
+		return OK; // Serviced by the pool thread.
+	}
+
+	MutexLock lock(mutex);
+	_poll_internal();
+	return OK;
+}
+
+void HTTPClientPool::_poll_internal() {
+	// Grow the pool while there is queued work for it, up to the limit.
+	while ((int)connections.size() < max_connections && (int)pending_requests.size() > 0) {
+		int idle = 0;
+		for (const Connection *conn : connections) {
+			if (!conn->busy) {
+				idle++;
+			}
+		}
+		if (idle >= (int)pending_requests.size()) {
+			break;
+		}
+		Connection *conn = memnew(Connection);
+		conn->client = Ref<HTTPClient>(HTTPClient::create());
+		conn->client->set_blocking_mode(false);
+		connections.push_back(conn);
+	}
+
+	for (Connection *conn : connections) {
+		_poll_connection(conn);
+	}
+}
+
+void HTTPClientPool::_poll_connection(Connection *p_conn) {
+	HTTPClient::Status status = p_conn->client->get_status();
+
+	switch (status) {
+		case HTTPClient::STATUS_DISCONNECTED: {
+			if (p_conn->busy) {
+				// The server dropped the keep-alive connection mid-request.
+				_complete(p_conn, RESULT_CONNECTION_ERROR);
+				return;
+			}
+			if (pending_requests.is_empty()) {
+				return; // Stay idle.
+			}
+			Error err = p_conn->client->connect_to_host(host, port, tls_options);
+			if (err != OK) {
+				_complete(p_conn, RESULT_CANT_CONNECT);
+			}
+		} break;
+		case HTTPClient::STATUS_RESOLVING:
+		case HTTPClient::STATUS_CONNECTING:
+		case HTTPClient::STATUS_REQUESTING: {
+			p_conn->client->poll();
+		} break;
+		case HTTPClient::STATUS_CANT_RESOLVE: {
+			_complete(p_conn, RESULT_CANT_RESOLVE);
+		} break;
+		case HTTPClient::STATUS_CANT_CONNECT: {
+			_complete(p_conn, RESULT_CANT_CONNECT);
+		} break;
+		case HTTPClient::STATUS_TLS_HANDSHAKE_ERROR: {
+			_complete(p_conn, RESULT_TLS_HANDSHAKE_ERROR);
+		} break;
+		case HTTPClient::STATUS_CONNECTION_ERROR: {
+			_complete(p_conn, RESULT_CONNECTION_ERROR);
+		} break;
+		case HTTPClient::STATUS_CONNECTED: {
+			if (p_conn->busy) {
+				// Response fully received (a bodyless one goes straight back to CONNECTED).
+				_complete(p_conn, RESULT_SUCCESS);
+			}
+			if (!p_conn->busy && !pending_requests.is_empty()) {
+				p_conn->active = pending_requests.front()->get();
+				pending_requests.pop_front();
+				p_conn->busy = true;
+				p_conn->response_body.clear();
+
+				Error err = p_conn->client->request(p_conn->active.method, p_conn->active.url, p_conn->active.headers, p_conn->active.body.ptr(), p_conn->active.body.size());
+				if (err != OK) {
+					_complete(p_conn, RESULT_REQUEST_FAILED);
+				}
+			}
+		} break;
+		case HTTPClient::STATUS_BODY: {
+			p_conn->client->poll();
+			PackedByteArray chunk = p_conn->client->read_response_body_chunk();
+			if (!chunk.is_empty()) {
+				p_conn->response_body.append_array(chunk);
+			}
+			HTTPClient::Status after = p_conn->client->get_status();
+			if (after != HTTPClient::STATUS_BODY && after != HTTPClient::STATUS_CONNECTION_ERROR) {
+				_complete(p_conn, RESULT_SUCCESS);
+			}
+		} break;
+	}
+}
+
+void HTTPClientPool::_complete(Connection *p_conn, Result p_result) {
+	if (!p_conn->busy) {
+		// Connection failures with no request assigned fail the whole queue,
+		// as every queued request would hit the same unreachable host.
+		if (p_result != RESULT_SUCCESS) {
+			p_conn->client->close();
+			while (!pending_requests.is_empty()) {
+				Request req = pending_requests.front()->get();
+				pending_requests.pop_front();
+				_complete_request(req, p_result, 0, PackedStringArray(), PackedByteArray());
+			}
+		}
+		return;
+	}
+
+	int code = 0;
+	PackedStringArray headers;
+	PackedByteArray body;
+
+	if (p_result == RESULT_SUCCESS) {
+		code = p_conn->client->get_response_code();
+		List<String> hl;
+		p_conn->client->get_response_headers(&hl);
+		for (const String &h : hl) {
+			headers.push_back(h);
+		}
+		body = p_conn->response_body;
+	} else {
+		p_conn->client->close();
+	}
+
+	Request req = p_conn->active;
+	p_conn->busy = false;
+	p_conn->active = Request();
+	p_conn->response_body.clear();
+
+	_complete_request(req, p_result, code, headers, body);
+}
+
+void HTTPClientPool::_complete_request(const Request &p_request, Result p_result, int p_code, const PackedStringArray &p_headers, const PackedByteArray &p_body) {
+	if (use_threads.is_set()) {
+		// Deliver on the main thread, the callback likely touches scene state.
+		p_request.callback.call_deferred((int)p_result, p_code, p_headers, p_body);
+	} else {
+		p_request.callback.call((int)p_result, p_code, p_headers, p_body);
+	}
+}
+
+void HTTPClientPool::close() {
+	if (use_threads.is_set() && thread.is_started()) {
+		thread_request_quit.set();
+		thread.wait_to_finish();
+	}
+
+	MutexLock lock(mutex);
+	pending_requests.clear();
+	for (Connection *conn : connections) {
+		conn->client->close();
+		memdelete(conn);
+	}
+	connections.clear();
+	host = String();
+	port = -1;
+	tls_options.unref();
+}
+
+void HTTPClientPool::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("connect_to_host", "host", "port", "tls_options"), &HTTPClientPool::connect_to_host, DEFVAL(-1), DEFVAL(Ref<TLSOptions>()));
+	ClassDB::bind_method(D_METHOD("request", "method", "url", "headers", "body", "callback"), &HTTPClientPool::request);
+	ClassDB::bind_method(D_METHOD("cancel_request", "id"), &HTTPClientPool::cancel_request);
+	ClassDB::bind_method(D_METHOD("get_pending_request_count"), &HTTPClientPool::get_pending_request_count);
+	ClassDB::bind_method(D_METHOD("set_max_connections", "count"), &HTTPClientPool::set_max_connections);
+	ClassDB::bind_method(D_METHOD("get_max_connections"), &HTTPClientPool::get_max_connections);
+	ClassDB::bind_method(D_METHOD("set_use_threads", "enable"), &HTTPClientPool::set_use_threads);
+	ClassDB::bind_method(D_METHOD("is_using_threads"), &HTTPClientPool::is_using_threads);
+	ClassDB::bind_method(D_METHOD("poll"), &HTTPClientPool::poll);
+	ClassDB::bind_method(D_METHOD("close"), &HTTPClientPool::close);
+
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_connections"), "set_max_connections", "get_max_connections");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_threads"), "set_use_threads", "is_using_threads");
+
+	BIND_ENUM_CONSTANT(RESULT_SUCCESS);
+	BIND_ENUM_CONSTANT(RESULT_CANT_CONNECT);
+	BIND_ENUM_CONSTANT(RESULT_CANT_RESOLVE);
+	BIND_ENUM_CONSTANT(RESULT_CONNECTION_ERROR);
+	BIND_ENUM_CONSTANT(RESULT_TLS_HANDSHAKE_ERROR);
+	BIND_ENUM_CONSTANT(RESULT_REQUEST_FAILED);
+}
+
+HTTPClientPool::~HTTPClientPool() {
+	close();
+}
@@ -0,0 +1,114 @@
+/**************************************************************************/
+/*  http_client_pool.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/http_client.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/list.h"
+#include "core/templates/local_vector.h"
+
+class HTTPClientPool : public RefCounted {
+	GDCLASS(HTTPClientPool, RefCounted);
+
+public:
+	enum Result {
+		RESULT_SUCCESS,
+		RESULT_CANT_CONNECT,
+		RESULT_CANT_RESOLVE,
+		RESULT_CONNECTION_ERROR,
+		RESULT_TLS_HANDSHAKE_ERROR,
+		RESULT_REQUEST_FAILED,
+	};
+
+private:
+	struct Request {
+		int id = -1;
+		HTTPClient::Method method = HTTPClient::METHOD_GET;
+		String url;
+		Vector<String> headers;
+		PackedByteArray body;
+		Callable callback;
+	};
+
+	struct Connection {
+		Ref<HTTPClient> client;
+		Request active;
+		bool busy = false;
+		PackedByteArray response_body;
+	};
+
+	String host;
+	int port = -1;
+	Ref<TLSOptions> tls_options;
+
+	int max_connections = 4;
+	int next_request_id = 1;
+
+	List<Request> pending_requests;
+	LocalVector<Connection *> connections;
+
+	SafeFlag use_threads;
+	SafeFlag thread_request_quit;
+	Thread thread;
+	mutable BinaryMutex mutex; // Guards pending_requests and connections when threaded.
+
+	static void _thread_func(void *p_userdata);
+
+	void _poll_internal();
+	void _poll_connection(Connection *p_conn);
+	void _complete(Connection *p_conn, Result p_result);
+	void _complete_request(const Request &p_request, Result p_result, int p_code, const PackedStringArray &p_headers, const PackedByteArray &p_body);
+
+protected:
+	static void _bind_methods();
+
+public:
+	Error connect_to_host(const String &p_host, int p_port = -1, Ref<TLSOptions> p_tls_options = Ref<TLSOptions>());
+
+	int request(HTTPClient::Method p_method, const String &p_url, const Vector<String> &p_headers, const PackedByteArray &p_body, const Callable &p_callback);
+	bool cancel_request(int p_id);
+	int get_pending_request_count() const;
+
+	void set_max_connections(int p_count);
+	int get_max_connections() const;
+
+	void set_use_threads(bool p_enable);
+	bool is_using_threads() const;
+
+	Error poll();
+	void close();
+
+	HTTPClientPool() {}
+	~HTTPClientPool();
+};
+
+VARIANT_ENUM_CAST(HTTPClientPool::Result);
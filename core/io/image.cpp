@@ -35,6 +35,7 @@
 #include "core/io/image_loader.h"
 #include "core/io/resource_loader.h"
 #include "core/math/math_funcs.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/hash_map.h"
 #include "core/variant/dictionary.h"
 
@@ -1952,19 +1953,32 @@ static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint3
 	uint32_t dst_w = MAX(p_width >> 1, 1u);
 	uint32_t dst_h = MAX(p_height >> 1, 1u);
 
-	int right_step = (p_width == 1) ? 0 : CC;
-	int down_step = (p_height == 1) ? 0 : (p_width * CC);
-
-	for (uint32_t i = 0; i < dst_h; i++) {
-		const Component *rup_ptr = &p_src[i * 2 * down_step];
-		const Component *rdown_ptr = rup_ptr + down_step;
-		Component *dst_ptr = &p_dst[i * dst_w * CC];
-		uint32_t count = dst_w;
+	struct MipmapJob {
+		const Component *src;
+		Component *dst;
+		uint32_t dst_w;
+		int right_step;
+		int down_step;
+	} job;
+
+	job.src = p_src;
+	job.dst = p_dst;
+	job.dst_w = dst_w;
+	job.right_step = (p_width == 1) ? 0 : CC;
+	job.down_step = (p_height == 1) ? 0 : (p_width * CC);
+
+	// Destination rows are independent.
+	void (*process_row)(void *, uint32_t) = [](void *p_userdata, uint32_t p_index) {
+		const MipmapJob &mj = *(const MipmapJob *)p_userdata;
+		const Component *rup_ptr = &mj.src[p_index * 2 * mj.down_step];
+		const Component *rdown_ptr = rup_ptr + mj.down_step;
+		Component *dst_ptr = &mj.dst[p_index * mj.dst_w * CC];
+		uint32_t count = mj.dst_w;
 
 		while (count) {
 			count--;
 			for (int j = 0; j < CC; j++) {
-				average_func(dst_ptr[j], rup_ptr[j], rup_ptr[j + right_step], rdown_ptr[j], rdown_ptr[j + right_step]);
+				average_func(dst_ptr[j], rup_ptr[j], rup_ptr[j + mj.right_step], rdown_ptr[j], rdown_ptr[j + mj.right_step]);
 			}
 
 			if constexpr (renormalize) {
@@ -1972,8 +1986,20 @@ static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint3
 			}
 
 			dst_ptr += CC;
-			rup_ptr += right_step * 2;
-			rdown_ptr += right_step * 2;
+			rup_ptr += mj.right_step * 2;
+			rdown_ptr += mj.right_step * 2;
+		}
+	};
+
+	// Only large mips are worth dispatching; the pool may not exist yet when
+	// images are processed during early engine setup.
+	WorkerThreadPool *wtp = WorkerThreadPool::get_singleton();
+	if (dst_h >= 128 && dst_w >= 128 && wtp && wtp->get_thread_count() > 1) {
+		WorkerThreadPool::GroupID group = wtp->add_native_group_task(process_row, &job, dst_h, -1, true, "Image mipmap generation");
+		wtp->wait_for_group_task_completion(group);
+	} else {
+		for (uint32_t i = 0; i < dst_h; i++) {
+			process_row(&job, i);
 		}
 	}
 }
@@ -3170,23 +3196,19 @@ void Image::blit_rect_mask(const Ref<Image> &p_src, const Ref<Image> &p_mask, co
 
 	int pixel_size = get_format_pixel_size(format);
 
-	Ref<Image> msk = p_mask;
+	const uint8_t *mask_data_ptr = p_mask->data.ptr();
 
+	// Rects are already clipped against the source (and thus the mask), so the
+	// pixels can be read through the offset accessors directly instead of paying
+	// the per-pixel bounds checks of get_pixel().
 	for (int i = 0; i < dest_rect.size.y; i++) {
-		for (int j = 0; j < dest_rect.size.x; j++) {
-			int src_x = src_rect.position.x + j;
-			int src_y = src_rect.position.y + i;
-
-			if (msk->get_pixel(src_x, src_y).a != 0) {
-				int dst_x = dest_rect.position.x + j;
-				int dst_y = dest_rect.position.y + i;
+		const uint32_t src_row_ofs = (src_rect.position.y + i) * p_src->width + src_rect.position.x;
+		const uint8_t *src = &src_data_ptr[src_row_ofs * pixel_size];
+		uint8_t *dst = &dst_data_ptr[((dest_rect.position.y + i) * width + dest_rect.position.x) * pixel_size];
 
-				const uint8_t *src = &src_data_ptr[(src_y * p_src->width + src_x) * pixel_size];
-				uint8_t *dst = &dst_data_ptr[(dst_y * width + dst_x) * pixel_size];
-
-				for (int k = 0; k < pixel_size; k++) {
-					dst[k] = src[k];
-				}
+		for (int j = 0; j < dest_rect.size.x; j++) {
+			if (p_mask->_get_color_at_ofs(mask_data_ptr, src_row_ofs + j).a != 0) {
+				memcpy(dst + j * pixel_size, src + j * pixel_size, pixel_size);
 			}
 		}
 	}
@@ -3207,21 +3229,21 @@ void Image::blend_rect(const Ref<Image> &p_src, const Rect2i &p_src_rect, const
 		return;
 	}
 
-	Ref<Image> img = p_src;
+	uint8_t *dst_data_ptr = data.ptrw();
+	const uint8_t *src_data_ptr = p_src->data.ptr();
 
+	// Rects are already clipped, so the pixels can be read and written through
+	// the offset accessors directly instead of paying the per-pixel bounds
+	// checks of get_pixel()/set_pixel().
 	for (int i = 0; i < dest_rect.size.y; i++) {
-		for (int j = 0; j < dest_rect.size.x; j++) {
-			int src_x = src_rect.position.x + j;
-			int src_y = src_rect.position.y + i;
+		const uint32_t src_row_ofs = (src_rect.position.y + i) * p_src->width + src_rect.position.x;
+		const uint32_t dst_row_ofs = (dest_rect.position.y + i) * width + dest_rect.position.x;
 
-			int dst_x = dest_rect.position.x + j;
-			int dst_y = dest_rect.position.y + i;
-
-			Color sc = img->get_pixel(src_x, src_y);
+		for (int j = 0; j < dest_rect.size.x; j++) {
+			const Color sc = p_src->_get_color_at_ofs(src_data_ptr, src_row_ofs + j);
 			if (sc.a != 0) {
-				Color dc = get_pixel(dst_x, dst_y);
-				dc = dc.blend(sc);
-				set_pixel(dst_x, dst_y, dc);
+				const Color dc = _get_color_at_ofs(dst_data_ptr, dst_row_ofs + j);
+				_set_color_at_ofs(dst_data_ptr, dst_row_ofs + j, dc.blend(sc));
 			}
 		}
 	}
@@ -3247,26 +3269,24 @@ void Image::blend_rect_mask(const Ref<Image> &p_src, const Ref<Image> &p_mask, c
 		return;
 	}
 
-	Ref<Image> img = p_src;
-	Ref<Image> msk = p_mask;
+	uint8_t *dst_data_ptr = data.ptrw();
+	const uint8_t *src_data_ptr = p_src->data.ptr();
+	const uint8_t *mask_data_ptr = p_mask->data.ptr();
 
+	// Rects are already clipped against the source (and thus the mask), so the
+	// pixels can be read and written through the offset accessors directly
+	// instead of paying the per-pixel bounds checks of get_pixel()/set_pixel().
 	for (int i = 0; i < dest_rect.size.y; i++) {
-		for (int j = 0; j < dest_rect.size.x; j++) {
-			int src_x = src_rect.position.x + j;
-			int src_y = src_rect.position.y + i;
+		const uint32_t src_row_ofs = (src_rect.position.y + i) * p_src->width + src_rect.position.x;
+		const uint32_t dst_row_ofs = (dest_rect.position.y + i) * width + dest_rect.position.x;
 
+		for (int j = 0; j < dest_rect.size.x; j++) {
 			// If the mask's pixel is transparent then we skip it
-			//Color c = msk->get_pixel(src_x, src_y);
-			//if (c.a == 0) continue;
-			if (msk->get_pixel(src_x, src_y).a != 0) {
-				int dst_x = dest_rect.position.x + j;
-				int dst_y = dest_rect.position.y + i;
-
-				Color sc = img->get_pixel(src_x, src_y);
+			if (p_mask->_get_color_at_ofs(mask_data_ptr, src_row_ofs + j).a != 0) {
+				const Color sc = p_src->_get_color_at_ofs(src_data_ptr, src_row_ofs + j);
 				if (sc.a != 0) {
-					Color dc = get_pixel(dst_x, dst_y);
-					dc = dc.blend(sc);
-					set_pixel(dst_x, dst_y, dc);
+					const Color dc = _get_color_at_ofs(dst_data_ptr, dst_row_ofs + j);
+					_set_color_at_ofs(dst_data_ptr, dst_row_ofs + j, dc.blend(sc));
 				}
 			}
 		}
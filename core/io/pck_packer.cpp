@@ -32,6 +32,7 @@
 
 #include "core/crypto/crypto_core.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
 #include "core/version.h"
@@ -48,7 +49,7 @@ static int _get_pad(int p_alignment, int p_n) {
 
 void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pck_start", "pck_path", "alignment", "key", "encrypt_directory"), &PCKPacker::pck_start, DEFVAL(32), DEFVAL("0000000000000000000000000000000000000000000000000000000000000000"), DEFVAL(false));
-	ClassDB::bind_method(D_METHOD("add_file", "target_path", "source_path", "encrypt"), &PCKPacker::add_file, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("add_file", "target_path", "source_path", "encrypt", "compress"), &PCKPacker::add_file, DEFVAL(false), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("add_file_removal", "target_path"), &PCKPacker::add_file_removal);
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
 }
@@ -145,7 +146,7 @@ Error PCKPacker::add_file_removal(const String &p_target_path) {
 	return OK;
 }
 
-Error PCKPacker::add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt) {
+Error PCKPacker::add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt, bool p_compress) {
 	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
 
 	Ref<FileAccess> f = FileAccess::open(p_source_path, FileAccess::READ);
@@ -171,6 +172,7 @@ Error PCKPacker::add_file(const String &p_target_path, const String &p_source_pa
 		}
 	}
 	pf.encrypted = p_encrypt;
+	pf.compressed = p_compress;
 
 	Ref<FileAccess> ftmp = file;
 
@@ -184,8 +186,23 @@ Error PCKPacker::add_file(const String &p_target_path, const String &p_source_pa
 		ftmp = fae;
 	}
 
+	Ref<FileAccessCompressed> fac;
+	if (p_compress) {
+		fac.instantiate();
+		ERR_FAIL_COND_V(fac.is_null(), ERR_CANT_CREATE);
+
+		fac->configure(PCK_COMPRESSED_FILE_MAGIC);
+		Error err = fac->open_and_write(ftmp);
+		ERR_FAIL_COND_V(err != OK, ERR_CANT_CREATE);
+		ftmp = fac;
+	}
+
 	ftmp->store_buffer(data);
 
+	if (fac.is_valid()) {
+		ftmp.unref();
+		fac.unref(); // Compresses and writes the blocks into the file (or the encryption wrapper) below.
+	}
 	if (fae.is_valid()) {
 		ftmp.unref();
 		fae.unref();
@@ -250,6 +267,9 @@ Error PCKPacker::flush(bool p_verbose) {
 		if (files[i].encrypted) {
 			flags |= PACK_FILE_ENCRYPTED;
 		}
+		if (files[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		if (files[i].removal) {
 			flags |= PACK_FILE_REMOVAL;
 		}
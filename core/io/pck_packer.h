@@ -55,6 +55,7 @@ class PCKPacker : public RefCounted {
 		uint64_t ofs = 0;
 		uint64_t size = 0;
 		bool encrypted = false;
+		bool compressed = false;
 		bool removal = false;
 		Vector<uint8_t> md5;
 	};
@@ -62,7 +63,7 @@ class PCKPacker : public RefCounted {
 
 public:
 	Error pck_start(const String &p_pck_path, int p_alignment = 32, const String &p_key = "0000000000000000000000000000000000000000000000000000000000000000", bool p_encrypt_directory = false);
-	Error add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt = false);
+	Error add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt = false, bool p_compress = false);
 	Error add_file_removal(const String &p_target_path);
 	Error flush(bool p_verbose = false);
 
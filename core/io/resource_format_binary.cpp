@@ -610,7 +610,10 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			uint32_t len = f->get_32();
 
 			Vector<Vector2> array;
-			array.resize(len);
+			// Uninitialized resize; every element is overwritten right below,
+			// and the default zero-construction is a full extra pass over what
+			// can be a very large vertex blob.
+			array.resize_uninitialized(len);
 			Vector2 *w = array.ptrw();
 			static_assert(sizeof(Vector2) == 2 * sizeof(real_t));
 			const Error err = read_reals(reinterpret_cast<real_t *>(w), f, len * 2);
@@ -623,7 +626,10 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			uint32_t len = f->get_32();
 
 			Vector<Vector3> array;
-			array.resize(len);
+			// Uninitialized resize; every element is overwritten right below,
+			// and the default zero-construction is a full extra pass over what
+			// can be a very large vertex blob.
+			array.resize_uninitialized(len);
 			Vector3 *w = array.ptrw();
 			static_assert(sizeof(Vector3) == 3 * sizeof(real_t));
 			const Error err = read_reals(reinterpret_cast<real_t *>(w), f, len * 3);
@@ -636,7 +642,10 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			uint32_t len = f->get_32();
 
 			Vector<Color> array;
-			array.resize(len);
+			// Uninitialized resize; every element is overwritten right below,
+			// and the default zero-construction is a full extra pass over what
+			// can be a very large vertex blob.
+			array.resize_uninitialized(len);
 			Color *w = array.ptrw();
 			// Colors always use `float` even with double-precision support enabled
 			static_assert(sizeof(Color) == 4 * sizeof(float));
@@ -657,7 +666,10 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			uint32_t len = f->get_32();
 
 			Vector<Vector4> array;
-			array.resize(len);
+			// Uninitialized resize; every element is overwritten right below,
+			// and the default zero-construction is a full extra pass over what
+			// can be a very large vertex blob.
+			array.resize_uninitialized(len);
 			Vector4 *w = array.ptrw();
 			static_assert(sizeof(Vector4) == 4 * sizeof(real_t));
 			const Error err = read_reals(reinterpret_cast<real_t *>(w), f, len * 4);
@@ -158,6 +158,7 @@ private:
 	static DependencyErrorNotify dep_err_notify;
 	static bool abort_on_missing_resource;
 	static bool create_missing_resources_if_class_unavailable;
+	static bool distribute_sub_loads;
 	static HashMap<String, Vector<String>> translation_remaps;
 
 	static String _path_remap(const String &p_path, bool *r_translation_remapped = nullptr);
@@ -283,6 +284,9 @@ public:
 	static void set_abort_on_missing_resources(bool p_abort) { abort_on_missing_resource = p_abort; }
 	static bool get_abort_on_missing_resources() { return abort_on_missing_resource; }
 
+	static void set_distribute_sub_loads(bool p_distribute) { distribute_sub_loads = p_distribute; }
+	static bool get_distribute_sub_loads() { return distribute_sub_loads; }
+
 	static String path_remap(const String &p_path);
 	static String import_remap(const String &p_path);
 
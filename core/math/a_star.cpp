@@ -385,6 +385,76 @@ bool AStar3D::_solve(Point *begin_point, Point *end_point, bool p_allow_partial_
 	return found_route;
 }
 
+void AStar3D::_solve_to_many(Point *p_begin_point, const LocalVector<Point *> &p_end_points) {
+	last_closest_point = nullptr;
+	pass++;
+
+	// One Dijkstra flood (no heuristic) finalizes optimal paths to every target at once.
+	HashSet<Point *> pending;
+	for (Point *end_point : p_end_points) {
+		if (end_point->enabled && end_point != p_begin_point) {
+			pending.insert(end_point);
+		}
+	}
+
+	LocalVector<Point *> open_list;
+	SortArray<Point *, SortPoints> sorter;
+
+	p_begin_point->g_score = 0;
+	p_begin_point->f_score = 0;
+	p_begin_point->abs_g_score = 0;
+	p_begin_point->abs_f_score = 0;
+	open_list.push_back(p_begin_point);
+
+	while (!open_list.is_empty() && !pending.is_empty()) {
+		Point *p = open_list[0]; // The currently processed point.
+
+		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
+		open_list.remove_at(open_list.size() - 1);
+		p->closed_pass = pass; // Mark the point as closed; its g_score is now final.
+		pending.erase(p);
+
+		for (const KeyValue<int64_t, Point *> &kv : p->neighbors) {
+			Point *e = kv.value; // The neighbor point.
+
+			if (!e->enabled || e->closed_pass == pass) {
+				continue;
+			}
+
+			if (neighbor_filter_enabled) {
+				bool filtered;
+				if (GDVIRTUAL_CALL(_filter_neighbor, p->id, e->id, filtered) && filtered) {
+					continue;
+				}
+			}
+
+			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
+
+			bool new_point = false;
+
+			if (e->open_pass != pass) { // The point wasn't inside the open list.
+				e->open_pass = pass;
+				open_list.push_back(e);
+				new_point = true;
+			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
+				continue;
+			}
+
+			e->prev_point = p;
+			e->g_score = tentative_g_score;
+			e->f_score = tentative_g_score;
+			e->abs_g_score = tentative_g_score;
+			e->abs_f_score = 0;
+
+			if (new_point) { // The position of the new points is already known.
+				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
+			} else {
+				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
+			}
+		}
+	}
+}
+
 real_t AStar3D::_estimate_cost(int64_t p_from_id, int64_t p_end_id) {
 	real_t scost;
 	if (GDVIRTUAL_CALL(_estimate_cost, p_from_id, p_end_id, scost)) {
@@ -531,6 +601,71 @@ Vector<int64_t> AStar3D::get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_
 	return path;
 }
 
+TypedArray<PackedInt64Array> AStar3D::get_id_paths(int64_t p_from_id, const PackedInt64Array &p_to_ids) {
+	Point **from_entry = points.getptr(p_from_id);
+	ERR_FAIL_COND_V_MSG(!from_entry, TypedArray<PackedInt64Array>(), vformat("Can't get id paths. Point with id: %d doesn't exist.", p_from_id));
+	Point *begin_point = *from_entry;
+
+	LocalVector<Point *> end_points;
+	end_points.reserve(p_to_ids.size());
+	for (const int64_t to_id : p_to_ids) {
+		Point **to_entry = points.getptr(to_id);
+		ERR_FAIL_COND_V_MSG(!to_entry, TypedArray<PackedInt64Array>(), vformat("Can't get id paths. Point with id: %d doesn't exist.", to_id));
+		end_points.push_back(*to_entry);
+	}
+
+	TypedArray<PackedInt64Array> paths;
+	paths.resize(end_points.size());
+
+	if (!begin_point->enabled) {
+		return paths; // All paths empty.
+	}
+
+	_solve_to_many(begin_point, end_points);
+
+	for (uint32_t i = 0; i < end_points.size(); i++) {
+		Point *end_point = end_points[i];
+
+		if (end_point == begin_point) {
+			PackedInt64Array path;
+			path.push_back(begin_point->id);
+			paths[i] = path;
+			continue;
+		}
+
+		if (end_point->closed_pass != pass) {
+			continue; // Not reached by the flood; leave the path empty.
+		}
+
+		Point *p = end_point;
+		int64_t pc = 1; // Begin point
+		while (p != begin_point) {
+			pc++;
+			p = p->prev_point;
+		}
+
+		PackedInt64Array path;
+		path.resize(pc);
+
+		{
+			int64_t *w = path.ptrw();
+
+			p = end_point;
+			int64_t idx = pc - 1;
+			while (p != begin_point) {
+				w[idx--] = p->id;
+				p = p->prev_point;
+			}
+
+			w[0] = p->id; // Assign first
+		}
+
+		paths[i] = path;
+	}
+
+	return paths;
+}
+
 bool AStar3D::is_neighbor_filter_enabled() const {
 	return neighbor_filter_enabled;
 }
@@ -587,6 +722,7 @@ void AStar3D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id", "allow_partial_path"), &AStar3D::get_point_path, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id", "allow_partial_path"), &AStar3D::get_id_path, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("get_id_paths", "from_id", "to_ids"), &AStar3D::get_id_paths);
 
 	GDVIRTUAL_BIND(_filter_neighbor, "from_id", "neighbor_id")
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "end_id")
@@ -919,6 +1055,141 @@ bool AStar2D::_solve(AStar3D::Point *begin_point, AStar3D::Point *end_point, boo
 	return found_route;
 }
 
+TypedArray<PackedInt64Array> AStar2D::get_id_paths(int64_t p_from_id, const PackedInt64Array &p_to_ids) {
+	AStar3D::Point **from_entry = astar.points.getptr(p_from_id);
+	ERR_FAIL_COND_V_MSG(!from_entry, TypedArray<PackedInt64Array>(), vformat("Can't get id paths. Point with id: %d doesn't exist.", p_from_id));
+	AStar3D::Point *begin_point = *from_entry;
+
+	LocalVector<AStar3D::Point *> end_points;
+	end_points.reserve(p_to_ids.size());
+	for (const int64_t to_id : p_to_ids) {
+		AStar3D::Point **to_entry = astar.points.getptr(to_id);
+		ERR_FAIL_COND_V_MSG(!to_entry, TypedArray<PackedInt64Array>(), vformat("Can't get id paths. Point with id: %d doesn't exist.", to_id));
+		end_points.push_back(*to_entry);
+	}
+
+	TypedArray<PackedInt64Array> paths;
+	paths.resize(end_points.size());
+
+	if (!begin_point->enabled) {
+		return paths; // All paths empty.
+	}
+
+	_solve_to_many(begin_point, end_points);
+
+	for (uint32_t i = 0; i < end_points.size(); i++) {
+		AStar3D::Point *end_point = end_points[i];
+
+		if (end_point == begin_point) {
+			PackedInt64Array path;
+			path.push_back(begin_point->id);
+			paths[i] = path;
+			continue;
+		}
+
+		if (end_point->closed_pass != astar.pass) {
+			continue; // Not reached by the flood; leave the path empty.
+		}
+
+		AStar3D::Point *p = end_point;
+		int64_t pc = 1; // Begin point
+		while (p != begin_point) {
+			pc++;
+			p = p->prev_point;
+		}
+
+		PackedInt64Array path;
+		path.resize(pc);
+
+		{
+			int64_t *w = path.ptrw();
+
+			p = end_point;
+			int64_t idx = pc - 1;
+			while (p != begin_point) {
+				w[idx--] = p->id;
+				p = p->prev_point;
+			}
+
+			w[0] = p->id; // Assign first
+		}
+
+		paths[i] = path;
+	}
+
+	return paths;
+}
+
+void AStar2D::_solve_to_many(AStar3D::Point *p_begin_point, const LocalVector<AStar3D::Point *> &p_end_points) {
+	astar.last_closest_point = nullptr;
+	astar.pass++;
+
+	// One Dijkstra flood (no heuristic) finalizes optimal paths to every target at once.
+	HashSet<AStar3D::Point *> pending;
+	for (AStar3D::Point *end_point : p_end_points) {
+		if (end_point->enabled && end_point != p_begin_point) {
+			pending.insert(end_point);
+		}
+	}
+
+	LocalVector<AStar3D::Point *> open_list;
+	SortArray<AStar3D::Point *, AStar3D::SortPoints> sorter;
+
+	p_begin_point->g_score = 0;
+	p_begin_point->f_score = 0;
+	p_begin_point->abs_g_score = 0;
+	p_begin_point->abs_f_score = 0;
+	open_list.push_back(p_begin_point);
+
+	while (!open_list.is_empty() && !pending.is_empty()) {
+		AStar3D::Point *p = open_list[0]; // The currently processed point.
+
+		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
+		open_list.remove_at(open_list.size() - 1);
+		p->closed_pass = astar.pass; // Mark the point as closed; its g_score is now final.
+		pending.erase(p);
+
+		for (const KeyValue<int64_t, AStar3D::Point *> &kv : p->neighbors) {
+			AStar3D::Point *e = kv.value; // The neighbor point.
+
+			if (!e->enabled || e->closed_pass == astar.pass) {
+				continue;
+			}
+
+			if (astar.neighbor_filter_enabled) {
+				bool filtered;
+				if (GDVIRTUAL_CALL(_filter_neighbor, p->id, e->id, filtered) && filtered) {
+					continue;
+				}
+			}
+
+			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
+
+			bool new_point = false;
+
+			if (e->open_pass != astar.pass) { // The point wasn't inside the open list.
+				e->open_pass = astar.pass;
+				open_list.push_back(e);
+				new_point = true;
+			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
+				continue;
+			}
+
+			e->prev_point = p;
+			e->g_score = tentative_g_score;
+			e->f_score = tentative_g_score;
+			e->abs_g_score = tentative_g_score;
+			e->abs_f_score = 0;
+
+			if (new_point) { // The position of the new points is already known.
+				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
+			} else {
+				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
+			}
+		}
+	}
+}
+
 void AStar2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_available_point_id"), &AStar2D::get_available_point_id);
 	ClassDB::bind_method(D_METHOD("add_point", "id", "position", "weight_scale"), &AStar2D::add_point, DEFVAL(1.0));
@@ -951,6 +1222,7 @@ void AStar2D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id", "allow_partial_path"), &AStar2D::get_point_path, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id", "allow_partial_path"), &AStar2D::get_id_path, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("get_id_paths", "from_id", "to_ids"), &AStar2D::get_id_paths);
 
 	GDVIRTUAL_BIND(_filter_neighbor, "from_id", "neighbor_id")
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "end_id")
@@ -33,6 +33,7 @@
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
 #include "core/templates/a_hash_map.h"
+#include "core/variant/typed_array.h"
 
 /**
 	A* pathfinding algorithm.
@@ -116,6 +117,7 @@ class AStar3D : public RefCounted {
 	bool neighbor_filter_enabled = false;
 
 	bool _solve(Point *begin_point, Point *end_point, bool p_allow_partial_path);
+	void _solve_to_many(Point *p_begin_point, const LocalVector<Point *> &p_end_points);
 
 protected:
 	static void _bind_methods();
@@ -166,6 +168,7 @@ public:
 
 	Vector<Vector3> get_point_path(int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path = false);
 	Vector<int64_t> get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path = false);
+	TypedArray<PackedInt64Array> get_id_paths(int64_t p_from_id, const PackedInt64Array &p_to_ids);
 
 	AStar3D() {}
 	~AStar3D();
@@ -176,6 +179,7 @@ class AStar2D : public RefCounted {
 	AStar3D astar;
 
 	bool _solve(AStar3D::Point *begin_point, AStar3D::Point *end_point, bool p_allow_partial_path);
+	void _solve_to_many(AStar3D::Point *p_begin_point, const LocalVector<AStar3D::Point *> &p_end_points);
 
 protected:
 	static void _bind_methods();
@@ -226,6 +230,7 @@ public:
 
 	Vector<Vector2> get_point_path(int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path = false);
 	Vector<int64_t> get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path = false);
+	TypedArray<PackedInt64Array> get_id_paths(int64_t p_from_id, const PackedInt64Array &p_to_ids);
 
 	AStar2D() {}
 	~AStar2D() {}
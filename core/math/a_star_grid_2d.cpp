@@ -31,6 +31,7 @@
 #include "a_star_grid_2d.h"
 #include "a_star_grid_2d.compat.inc"
 
+#include "core/templates/hash_set.h"
 #include "core/variant/typed_array.h"
 
 static real_t heuristic_euclidean(const Vector2i &p_from, const Vector2i &p_to) {
@@ -577,6 +578,71 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_
 	return found_route;
 }
 
+void AStarGrid2D::_solve_to_many(Point *p_begin_point, const LocalVector<Point *> &p_end_points) {
+	last_closest_point = nullptr;
+	pass++;
+
+	// One Dijkstra flood (no heuristic) finalizes optimal paths to every target at once.
+	// Jumping (JPS) is not used here since its pruning assumes a single goal.
+	HashSet<Point *> pending;
+	for (Point *end_point : p_end_points) {
+		if (!_get_solid_unchecked(end_point->id) && end_point != p_begin_point) {
+			pending.insert(end_point);
+		}
+	}
+
+	LocalVector<Point *> open_list;
+	SortArray<Point *, SortPoints> sorter;
+	LocalVector<Point *> nbors;
+
+	p_begin_point->g_score = 0;
+	p_begin_point->f_score = 0;
+	p_begin_point->abs_g_score = 0;
+	p_begin_point->abs_f_score = 0;
+	open_list.push_back(p_begin_point);
+
+	while (!open_list.is_empty() && !pending.is_empty()) {
+		Point *p = open_list[0]; // The currently processed point.
+
+		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
+		open_list.remove_at(open_list.size() - 1);
+		p->closed_pass = pass; // Mark the point as closed; its g_score is now final.
+		pending.erase(p);
+
+		nbors.clear();
+		_get_nbors(p, nbors);
+
+		for (Point *e : nbors) {
+			if (_get_solid_unchecked(e->id) || e->closed_pass == pass) {
+				continue;
+			}
+
+			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
+			bool new_point = false;
+
+			if (e->open_pass != pass) { // The point wasn't inside the open list.
+				e->open_pass = pass;
+				open_list.push_back(e);
+				new_point = true;
+			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
+				continue;
+			}
+
+			e->prev_point = p;
+			e->g_score = tentative_g_score;
+			e->f_score = tentative_g_score;
+			e->abs_g_score = tentative_g_score;
+			e->abs_f_score = 0;
+
+			if (new_point) { // The position of the new points is already known.
+				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
+			} else {
+				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
+			}
+		}
+	}
+}
+
 real_t AStarGrid2D::_estimate_cost(const Vector2i &p_from_id, const Vector2i &p_end_id) {
 	real_t scost;
 	if (GDVIRTUAL_CALL(_estimate_cost, p_from_id, p_end_id, scost)) {
@@ -684,6 +750,72 @@ Vector<Vector2> AStarGrid2D::get_point_path(const Vector2i &p_from_id, const Vec
 	return path;
 }
 
+TypedArray<PackedVector2Array> AStarGrid2D::get_point_paths(const Vector2i &p_from_id, const TypedArray<Vector2i> &p_to_ids) {
+	ERR_FAIL_COND_V_MSG(dirty, TypedArray<PackedVector2Array>(), "Grid is not initialized. Call the update method.");
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_from_id), TypedArray<PackedVector2Array>(), vformat("Can't get point paths. Point %s out of bounds %s.", p_from_id, region));
+
+	LocalVector<Point *> end_points;
+	end_points.reserve(p_to_ids.size());
+	for (int i = 0; i < p_to_ids.size(); i++) {
+		const Vector2i to_id = p_to_ids[i];
+		ERR_FAIL_COND_V_MSG(!is_in_boundsv(to_id), TypedArray<PackedVector2Array>(), vformat("Can't get point paths. Point %s out of bounds %s.", to_id, region));
+		end_points.push_back(_get_point_unchecked(to_id));
+	}
+
+	Point *begin_point = _get_point(p_from_id.x, p_from_id.y);
+
+	TypedArray<PackedVector2Array> paths;
+	paths.resize(end_points.size());
+
+	if (_get_solid_unchecked(begin_point->id)) {
+		return paths; // All paths empty.
+	}
+
+	_solve_to_many(begin_point, end_points);
+
+	for (uint32_t i = 0; i < end_points.size(); i++) {
+		Point *end_point = end_points[i];
+
+		if (end_point == begin_point) {
+			PackedVector2Array path;
+			path.push_back(begin_point->pos);
+			paths[i] = path;
+			continue;
+		}
+
+		if (end_point->closed_pass != pass) {
+			continue; // Not reached by the flood; leave the path empty.
+		}
+
+		Point *p = end_point;
+		int32_t pc = 1;
+		while (p != begin_point) {
+			pc++;
+			p = p->prev_point;
+		}
+
+		PackedVector2Array path;
+		path.resize(pc);
+
+		{
+			Vector2 *w = path.ptrw();
+
+			p = end_point;
+			int32_t idx = pc - 1;
+			while (p != begin_point) {
+				w[idx--] = p->pos;
+				p = p->prev_point;
+			}
+
+			w[0] = p->pos;
+		}
+
+		paths[i] = path;
+	}
+
+	return paths;
+}
+
 TypedArray<Vector2i> AStarGrid2D::get_id_path(const Vector2i &p_from_id, const Vector2i &p_to_id, bool p_allow_partial_path) {
 	ERR_FAIL_COND_V_MSG(dirty, TypedArray<Vector2i>(), "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_from_id), TypedArray<Vector2i>(), vformat("Can't get id path. Point %s out of bounds %s.", p_from_id, region));
@@ -769,6 +901,7 @@ void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_point_position", "id"), &AStarGrid2D::get_point_position);
 	ClassDB::bind_method(D_METHOD("get_point_data_in_region", "region"), &AStarGrid2D::get_point_data_in_region);
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id", "allow_partial_path"), &AStarGrid2D::get_point_path, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("get_point_paths", "from_id", "to_ids"), &AStarGrid2D::get_point_paths);
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id", "allow_partial_path"), &AStarGrid2D::get_id_path, DEFVAL(false));
 
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "end_id")
@@ -1165,7 +1165,7 @@ Expression::ENode *Expression::_parse_expression() {
 				op->nodes[0] = expression_nodes[i + 1].node;
 				op->nodes[1] = nullptr;
 				expression_nodes.write[i].is_op = false;
-				expression_nodes.write[i].node = op;
+				expression_nodes.write[i].node = _fold_constant_operator(op);
 				expression_nodes.remove_at(i + 1);
 			}
 
@@ -1197,7 +1197,7 @@ Expression::ENode *Expression::_parse_expression() {
 			op->nodes[1] = expression_nodes[next_op + 1].node; //next expression goes as right
 
 			//replace all 3 nodes by this operator and make it an expression
-			expression_nodes.write[next_op - 1].node = op;
+			expression_nodes.write[next_op - 1].node = _fold_constant_operator(op);
 			expression_nodes.remove_at(next_op);
 			expression_nodes.remove_at(next_op);
 		}
@@ -1206,6 +1206,33 @@ Expression::ENode *Expression::_parse_expression() {
 	return expression_nodes[0].node;
 }
 
+Expression::ENode *Expression::_fold_constant_operator(OperatorNode *p_op) {
+	if (p_op->nodes[0]->type != ENode::TYPE_CONSTANT) {
+		return p_op;
+	}
+	if (p_op->nodes[1] && p_op->nodes[1]->type != ENode::TYPE_CONSTANT) {
+		return p_op;
+	}
+
+	const Variant &a = static_cast<ConstantNode *>(p_op->nodes[0])->value;
+	Variant b;
+	if (p_op->nodes[1]) {
+		b = static_cast<ConstantNode *>(p_op->nodes[1])->value;
+	}
+
+	Variant result;
+	bool valid = true;
+	Variant::evaluate(p_op->op, a, b, result, valid);
+	if (!valid) {
+		// Keep the operator node, so the error is still reported on execute().
+		return p_op;
+	}
+
+	ConstantNode *folded = alloc_node<ConstantNode>();
+	folded->value = result;
+	return folded;
+}
+
 bool Expression::_compile_expression() {
 	if (!expression_dirty) {
 		return error_set;
@@ -253,6 +253,9 @@ private:
 	ENode *root = nullptr;
 	ENode *nodes = nullptr;
 
+	// Replaces an operator applied to constant operands with the evaluated constant.
+	ENode *_fold_constant_operator(OperatorNode *p_op);
+
 	Vector<String> input_names;
 
 	bool execution_error = false;
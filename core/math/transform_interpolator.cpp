@@ -348,6 +348,14 @@ bool TransformInterpolator::_basis_is_orthogonal(const Basis &p_basis, real_t p_
 	return true;
 }
 
+void TransformInterpolator::interpolate_float_array(const float *p_prev, const float *p_curr, float *r_result, int64_t p_count, float p_fraction) {
+	// Written as a branchless fused form (prev + fraction * (curr - prev)) over
+	// raw pointers so the compiler can auto-vectorize the loop.
+	for (int64_t i = 0; i < p_count; i++) {
+		r_result[i] = p_prev[i] + p_fraction * (p_curr[i] - p_prev[i]);
+	}
+}
+
 real_t TransformInterpolator::checksum_transform_3d(const Transform3D &p_transform) {
 	// just a really basic checksum, this can probably be improved
 	real_t sum = _vec3_sum(p_transform.origin);
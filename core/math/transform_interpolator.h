@@ -89,4 +89,10 @@ public:
 	static real_t checksum_transform_3d(const Transform3D &p_transform);
 
 	static Method find_method(const Basis &p_a, const Basis &p_b);
+
+	// Batch kernel for interpolating contiguous float data (e.g. packed
+	// transform / color / custom data buffers). Kept as a flat loop over the
+	// whole buffer so compilers can vectorize it, which is considerably faster
+	// than interpolating element by element.
+	static void interpolate_float_array(const float *p_prev, const float *p_curr, float *r_result, int64_t p_count, float p_fraction);
 };
@@ -66,6 +66,9 @@ HashMap<StringName, ClassDB::ClassInfo> ClassDB::classes;
 HashMap<StringName, StringName> ClassDB::resource_base_extensions;
 HashMap<StringName, StringName> ClassDB::compat_classes;
 
+// Start at 1 so freshly created ClassInfo caches (generation 0) are always stale.
+uint32_t ClassDB::property_setget_generation = 1;
+
 #ifdef TOOLS_ENABLED
 HashMap<StringName, ObjectGDExtension> ClassDB::placeholder_extensions;
 
@@ -1541,6 +1544,10 @@ void ClassDB::add_property(const StringName &p_class, const PropertyInfo &p_pinf
 	psg.type = p_pinfo.type;
 
 	type->property_setget[p_pinfo.name] = psg;
+
+	// A derived class may have cached a miss (or an ancestor's accessor that this
+	// property now shadows) for this name.
+	property_setget_generation++;
 }
 
 void ClassDB::set_property_default_value(const StringName &p_class, const StringName &p_name, const Variant &p_default) {
@@ -1630,50 +1637,115 @@ bool ClassDB::get_property_info(const StringName &p_class, const StringName &p_p
 	return false;
 }
 
-bool ClassDB::set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid) {
-	ERR_FAIL_NULL_V(p_object, false);
+bool ClassDB::_get_property_setget(const StringName &p_class, const StringName &p_property, PropertySetGet &r_setget) {
+	// Evaluate before taking the read lock; an already held read lock can't be upgraded.
+	const bool can_cache = Locker::thread_can_write_lock();
 
-	ClassInfo *type = classes.getptr(p_object->get_class_name());
-	ClassInfo *check = type;
+	{
+		Locker::Lock lock(Locker::STATE_READ);
+
+		const ClassInfo *type = classes.getptr(p_class);
+		if (!type) {
+			return false;
+		}
+
+		if (type->property_setget_cache_generation == property_setget_generation) {
+			const ClassInfo::PropertySetGetCached *cached = type->property_setget_cache.getptr(p_property);
+			if (cached) {
+				if (!cached->found) {
+					return false;
+				}
+				r_setget = cached->setget;
+				return true;
+			}
+		}
+
+		if (!can_cache) {
+			// Can't fill the cache on this thread; resolve directly.
+			const ClassInfo *check = type;
+			while (check) {
+				const PropertySetGet *psg = check->property_setget.getptr(p_property);
+				if (psg) {
+					r_setget = *psg;
+					return true;
+				}
+				check = check->inherits_ptr;
+			}
+			return false;
+		}
+	}
+
+	Locker::Lock lock(Locker::STATE_WRITE);
+
+	ClassInfo *type = classes.getptr(p_class);
+	if (!type) {
+		return false;
+	}
+
+	if (type->property_setget_cache_generation != property_setget_generation) {
+		type->property_setget_cache.clear();
+		type->property_setget_cache_generation = property_setget_generation;
+	}
+
+	ClassInfo::PropertySetGetCached entry;
+	const ClassInfo *check = type;
 	while (check) {
 		const PropertySetGet *psg = check->property_setget.getptr(p_property);
 		if (psg) {
-			if (!psg->setter) {
-				if (r_valid) {
-					*r_valid = false;
-				}
-				return true; //return true but do nothing
-			}
+			entry.setget = *psg;
+			entry.found = true;
+			break;
+		}
+		check = check->inherits_ptr;
+	}
+	type->property_setget_cache.insert(p_property, entry);
 
-			Callable::CallError ce;
+	if (!entry.found) {
+		return false;
+	}
+	r_setget = entry.setget;
+	return true;
+}
 
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[2] = { &index, &p_value };
-				//p_object->call(psg->setter,arg,2,ce);
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 2, ce);
-				} else {
-					p_object->callp(psg->setter, arg, 2, ce);
-				}
+bool ClassDB::set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid) {
+	ERR_FAIL_NULL_V(p_object, false);
+
+	PropertySetGet setget;
+	if (_get_property_setget(p_object->get_class_name(), p_property, setget)) {
+		const PropertySetGet *psg = &setget;
+		if (!psg->setter) {
+			if (r_valid) {
+				*r_valid = false;
+			}
+			return true; //return true but do nothing
+		}
 
+		Callable::CallError ce;
+
+		if (psg->index >= 0) {
+			Variant index = psg->index;
+			const Variant *arg[2] = { &index, &p_value };
+			//p_object->call(psg->setter,arg,2,ce);
+			if (psg->_setptr) {
+				psg->_setptr->call(p_object, arg, 2, ce);
 			} else {
-				const Variant *arg[1] = { &p_value };
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 1, ce);
-				} else {
-					p_object->callp(psg->setter, arg, 1, ce);
-				}
+				p_object->callp(psg->setter, arg, 2, ce);
 			}
 
-			if (r_valid) {
-				*r_valid = ce.error == Callable::CallError::CALL_OK;
+		} else {
+			const Variant *arg[1] = { &p_value };
+			if (psg->_setptr) {
+				psg->_setptr->call(p_object, arg, 1, ce);
+			} else {
+				p_object->callp(psg->setter, arg, 1, ce);
 			}
+		}
 
-			return true;
+		if (r_valid) {
+			*r_valid = ce.error == Callable::CallError::CALL_OK;
 		}
 
-		check = check->inherits_ptr;
+		return true;
 	}
 
 	return false;
@@ -1682,34 +1754,35 @@ bool ClassDB::set_property(Object *p_object, const StringName &p_property, const
 bool ClassDB::get_property(Object *p_object, const StringName &p_property, Variant &r_value) {
 	ERR_FAIL_NULL_V(p_object, false);
 
-	ClassInfo *type = classes.getptr(p_object->get_class_name());
-	ClassInfo *check = type;
-	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
-		if (psg) {
-			if (!psg->getter) {
-				return true; //return true but do nothing
-			}
+	PropertySetGet setget;
+	if (_get_property_setget(p_object->get_class_name(), p_property, setget)) {
+		const PropertySetGet *psg = &setget;
+		if (!psg->getter) {
+			return true; //return true but do nothing
+		}
 
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[1] = { &index };
-				Callable::CallError ce;
-				const Variant value = p_object->callp(psg->getter, arg, 1, ce);
-				r_value = (ce.error == Callable::CallError::CALL_OK) ? value : Variant();
+		if (psg->index >= 0) {
+			Variant index = psg->index;
+			const Variant *arg[1] = { &index };
+			Callable::CallError ce;
+			const Variant value = p_object->callp(psg->getter, arg, 1, ce);
+			r_value = (ce.error == Callable::CallError::CALL_OK) ? value : Variant();
 
+		} else {
+			Callable::CallError ce;
+			if (psg->_getptr) {
+				r_value = psg->_getptr->call(p_object, nullptr, 0, ce);
 			} else {
-				Callable::CallError ce;
-				if (psg->_getptr) {
-					r_value = psg->_getptr->call(p_object, nullptr, 0, ce);
-				} else {
-					const Variant value = p_object->callp(psg->getter, nullptr, 0, ce);
-					r_value = (ce.error == Callable::CallError::CALL_OK) ? value : Variant();
-				}
+				const Variant value = p_object->callp(psg->getter, nullptr, 0, ce);
+				r_value = (ce.error == Callable::CallError::CALL_OK) ? value : Variant();
 			}
-			return true;
 		}
+		return true;
+	}
 
+	ClassInfo *type = classes.getptr(p_object->get_class_name());
+	ClassInfo *check = type;
+	while (check) {
 		const int64_t *c = check->constant_map.getptr(p_property); //constants count
 		if (c) {
 			r_value = *c;
@@ -1927,7 +2000,9 @@ MethodBind *ClassDB::_bind_vararg_method(MethodBind *p_bind, const StringName &p
 	bind->set_name(p_name);
 	bind->set_default_arguments(p_default_args);
 
-	String instance_type = bind->get_instance_class();
+	// Keep this a StringName; converting to String would re-hash the name on
+	// every class map lookup during registration.
+	StringName instance_type = bind->get_instance_class();
 
 	ClassInfo *type = classes.getptr(instance_type);
 	if (!type) {
@@ -1960,14 +2035,16 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, bool p_
 	StringName mdname = method_name.name;
 #else
 MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, bool p_compatibility, const char *method_name, const Variant **p_defs, int p_defcount) {
-	StringName mdname = StringName(method_name);
+	// Method names come from string literals that outlive the process, so
+	// register them as static to skip refcounting on every later use.
+	StringName mdname = StringName(method_name, true);
 #endif // DEBUG_ENABLED
 
 	Locker::Lock lock(Locker::STATE_WRITE);
 	ERR_FAIL_NULL_V(p_bind, nullptr);
 	p_bind->set_name(mdname);
 
-	String instance_type = p_bind->get_instance_class();
+	StringName instance_type = p_bind->get_instance_class();
 
 #ifdef DEBUG_ENABLED
 
@@ -2366,6 +2443,8 @@ void ClassDB::unregister_extension_class(const StringName &p_class, bool p_free_
 	classes.erase(p_class);
 	default_values_cached.erase(p_class);
 	default_values.erase(p_class);
+	// Cached accessor entries may hold copies of this class' MethodBind pointers.
+	property_setget_generation++;
 #ifdef TOOLS_ENABLED
 	placeholder_extensions.erase(p_class);
 #endif
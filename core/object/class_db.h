@@ -126,7 +126,7 @@ public:
 
 		ObjectGDExtension *gdextension = nullptr;
 
-		HashMap<StringName, MethodBind *> method_map;
+		AHashMap<StringName, MethodBind *> method_map;
 		HashMap<StringName, LocalVector<MethodBind *>> method_map_compatibility;
 		AHashMap<StringName, int64_t> constant_map;
 		struct EnumInfo {
@@ -137,7 +137,7 @@ public:
 		HashMap<StringName, EnumInfo> enum_map;
 		AHashMap<StringName, MethodInfo> signal_map;
 		List<PropertyInfo> property_list;
-		HashMap<StringName, PropertyInfo> property_map;
+		AHashMap<StringName, PropertyInfo> property_map;
 
 #ifdef DEBUG_ENABLED
 		List<StringName> constant_order;
@@ -154,6 +154,17 @@ public:
 #endif
 
 		AHashMap<StringName, PropertySetGet> property_setget;
+		// Flattened view of property_setget across the inheritance chain, built lazily by
+		// set_property()/get_property() so repeated dynamic property accesses resolve with a
+		// single probe instead of walking every ancestor. Misses are cached too. Entries are
+		// copies, so they stay valid while the class is registered; the generation check
+		// invalidates them when properties are registered or classes unregistered later.
+		struct PropertySetGetCached {
+			PropertySetGet setget;
+			bool found = false;
+		};
+		AHashMap<StringName, PropertySetGetCached> property_setget_cache;
+		uint32_t property_setget_cache_generation = 0;
 		HashMap<StringName, Vector<uint32_t>> virtual_methods_compat;
 
 		StringName inherits;
@@ -202,12 +213,22 @@ public:
 			explicit Lock(State p_state);
 			~Lock();
 		};
+
+		// Whether taking a write lock on this thread is allowed (it can't be upgraded from
+		// an already held read lock).
+		static bool thread_can_write_lock() { return thread_state != STATE_READ; }
 	};
 
 	static HashMap<StringName, ClassInfo> classes;
 	static HashMap<StringName, StringName> resource_base_extensions;
 	static HashMap<StringName, StringName> compat_classes;
 
+	// Bumped whenever resolved property accessors may change, invalidating every
+	// per-class property_setget_cache.
+	static uint32_t property_setget_generation;
+
+	static bool _get_property_setget(const StringName &p_class, const StringName &p_property, PropertySetGet &r_setget);
+
 #ifdef TOOLS_ENABLED
 	static HashMap<StringName, ObjectGDExtension> placeholder_extensions;
 #endif
@@ -1,5 +1,8 @@
 script_call = """ScriptInstance *_script_instance = ((Object *)(this))->get_script_instance();\\
-		if (_script_instance) {\\
+		/* Check has_method() before boxing the arguments into Variants, so scripts that */\\
+		/* don't implement the virtual don't pay for a boxed call that can only fail, and */\\
+		/* extension classes with an attached script still reach the ptrcall path cheaply. */\\
+		if (_script_instance && _script_instance->has_method(_gdvirtual_##$VARNAME##_sn)) {\\
 			Callable::CallError ce;\\
 			$CALLSIARGS\\
 			$CALLSIBEGIN_script_instance->callp(_gdvirtual_##$VARNAME##_sn, $CALLSIARGPASS, ce);\\
@@ -71,10 +71,18 @@ Error CallQueue::push_callp(ObjectID p_id, const StringName &p_method, const Var
 	return push_callablep(Callable(p_id, p_method), p_args, p_argcount, p_show_error);
 }
 
+Error CallQueue::push_callp(ObjectID p_id, const StringName &p_method, Variant *p_args, int p_argcount, bool p_show_error) {
+	return push_callablep(Callable(p_id, p_method), p_args, p_argcount, p_show_error);
+}
+
 Error CallQueue::push_callp(Object *p_object, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
 	return push_callp(p_object->get_instance_id(), p_method, p_args, p_argcount, p_show_error);
 }
 
+Error CallQueue::push_callp(Object *p_object, const StringName &p_method, Variant *p_args, int p_argcount, bool p_show_error) {
+	return push_callp(p_object->get_instance_id(), p_method, p_args, p_argcount, p_show_error);
+}
+
 Error CallQueue::push_notification(Object *p_object, int p_notification) {
 	return push_notification(p_object->get_instance_id(), p_notification);
 }
@@ -83,7 +91,7 @@ Error CallQueue::push_set(Object *p_object, const StringName &p_prop, const Vari
 	return push_set(p_object->get_instance_id(), p_prop, p_value);
 }
 
-Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
+Error CallQueue::_start_push_call(const Callable &p_callable, int p_argcount, bool p_show_error, Message *&r_msg, Variant *&r_args) {
 	uint32_t room_needed = sizeof(Message) + sizeof(Variant) * p_argcount;
 
 	ERR_FAIL_COND_V_MSG(room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
@@ -106,7 +114,21 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 
 	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
 
+	// Only reserve and default-construct the message under the mutex; the
+	// Callable and Variant copies below can be expensive (refcounting, COW)
+	// and would otherwise serialize every pushing thread on the lock.
 	Message *msg = memnew_placement(buffer_end, Message);
+	buffer_end += sizeof(Message);
+
+	for (int i = 0; i < p_argcount; i++) {
+		memnew_placement(buffer_end, Variant);
+		buffer_end += sizeof(Variant);
+	}
+
+	page_bytes[pages_used - 1] += room_needed;
+
+	UNLOCK_MUTEX;
+
 	msg->args = p_argcount;
 	msg->callable = p_callable;
 	msg->type = TYPE_CALL;
@@ -118,17 +140,42 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 		msg->type |= FLAG_NULL_IS_OK;
 	}
 
-	buffer_end += sizeof(Message);
+	r_msg = msg;
+	r_args = (Variant *)(msg + 1);
+
+	return OK;
+}
+
+Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
+	Message *msg = nullptr;
+	Variant *args = nullptr;
+	Error err = _start_push_call(p_callable, p_argcount, p_show_error, msg, args);
+	if (err != OK) {
+		return err;
+	}
 
 	for (int i = 0; i < p_argcount; i++) {
-		Variant *v = memnew_placement(buffer_end, Variant);
-		buffer_end += sizeof(Variant);
-		*v = *p_args[i];
+		args[i] = *p_args[i];
 	}
 
-	page_bytes[pages_used - 1] += room_needed;
+	msg->ready.store(1, std::memory_order_release);
 
-	UNLOCK_MUTEX;
+	return OK;
+}
+
+Error CallQueue::push_callablep(const Callable &p_callable, Variant *p_args, int p_argcount, bool p_show_error) {
+	Message *msg = nullptr;
+	Variant *args = nullptr;
+	Error err = _start_push_call(p_callable, p_argcount, p_show_error, msg, args);
+	if (err != OK) {
+		return err;
+	}
+
+	for (int i = 0; i < p_argcount; i++) {
+		args[i] = std::move(p_args[i]);
+	}
+
+	msg->ready.store(1, std::memory_order_release);
 
 	return OK;
 }
@@ -158,18 +205,19 @@ Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant
 	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
 
 	Message *msg = memnew_placement(buffer_end, Message);
-	msg->args = 1;
-	msg->callable = Callable(p_id, p_prop);
-	msg->type = TYPE_SET;
-
 	buffer_end += sizeof(Message);
-
 	Variant *v = memnew_placement(buffer_end, Variant);
-	*v = p_value;
 
 	page_bytes[pages_used - 1] += room_needed;
 	UNLOCK_MUTEX;
 
+	msg->args = 1;
+	msg->callable = Callable(p_id, p_prop);
+	msg->type = TYPE_SET;
+	*v = p_value;
+
+	msg->ready.store(1, std::memory_order_release);
+
 	return OK;
 }
 
@@ -195,13 +243,15 @@ Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 
 	Message *msg = memnew_placement(buffer_end, Message);
 
+	page_bytes[pages_used - 1] += room_needed;
+	UNLOCK_MUTEX;
+
 	msg->type = TYPE_NOTIFICATION;
 	msg->callable = Callable(p_id, CoreStringName(notification)); //name is meaningless but callable needs it
 	//msg->target;
 	msg->notification = p_notification;
 
-	page_bytes[pages_used - 1] += room_needed;
-	UNLOCK_MUTEX;
+	msg->ready.store(1, std::memory_order_release);
 
 	return OK;
 }
@@ -248,6 +298,7 @@ Error CallQueue::flush() {
 		//lock on each iteration, so a call can re-add itself to the message queue
 
 		Message *message = (Message *)&page->data[offset];
+		_wait_for_message(message);
 
 		uint32_t advance = sizeof(Message);
 		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
@@ -321,6 +372,7 @@ void CallQueue::clear() {
 			//lock on each iteration, so a call can re-add itself to the message queue
 
 			Message *message = (Message *)&page->data[offset];
+			_wait_for_message(message);
 
 			uint32_t advance = sizeof(Message);
 			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
@@ -361,6 +413,7 @@ void CallQueue::statistics() {
 			//lock on each iteration, so a call can re-add itself to the message queue
 
 			Message *message = (Message *)&page->data[offset];
+			_wait_for_message(message);
 
 			uint32_t advance = sizeof(Message);
 			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
@@ -475,9 +528,7 @@ CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const
 CallQueue::~CallQueue() {
 	clear();
 	// Let go of pages.
-	for (uint32_t i = 0; i < pages.size(); i++) {
-		allocator->free(pages[i]);
-	}
+	allocator->free_batch(pages.ptr(), pages.size());
 	if (!allocator_is_custom) {
 		memdelete(allocator);
 	}
@@ -36,6 +36,8 @@
 #include "core/templates/paged_allocator.h"
 #include "core/variant/variant.h"
 
+#include <atomic>
+
 class Object;
 
 class CallQueue {
@@ -81,6 +83,11 @@ private:
 #endif
 
 	struct Message {
+		// Pushing threads only hold the mutex to reserve room for the message;
+		// the message itself (and its arguments) are constructed outside the
+		// critical section and published by storing to this flag. Readers must
+		// acquire it before touching any other field.
+		std::atomic<uint32_t> ready = 0;
 		Callable callable;
 		int16_t type;
 		union {
@@ -89,6 +96,13 @@ private:
 		};
 	};
 
+	_FORCE_INLINE_ static void _wait_for_message(const Message *p_message) {
+		while (!p_message->ready.load(std::memory_order_acquire)) {
+			// The pushing thread already released the mutex but is still
+			// writing the message; the window is a handful of stores.
+		}
+	}
+
 	_FORCE_INLINE_ void _ensure_first_page() {
 		if (unlikely(pages.is_empty())) {
 			pages.push_back(allocator->alloc());
@@ -99,45 +113,43 @@ private:
 
 	void _add_page();
 
+	// Reserves room for a call message and fills in everything but its arguments.
+	// On success, the caller must write r_args and then publish via r_msg->ready.
+	Error _start_push_call(const Callable &p_callable, int p_argcount, bool p_show_error, Message *&r_msg, Variant *&r_args);
+
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
 
 	String error_text;
 
 public:
 	Error push_callp(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error = false);
+	// Same as above, but moves the arguments out of p_args instead of copying them.
+	Error push_callp(ObjectID p_id, const StringName &p_method, Variant *p_args, int p_argcount, bool p_show_error = false);
 	template <typename... VarArgs>
 	Error push_call(ObjectID p_id, const StringName &p_method, VarArgs... p_args) {
 		Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
-		const Variant *argptrs[sizeof...(p_args) + 1];
-		for (uint32_t i = 0; i < sizeof...(p_args); i++) {
-			argptrs[i] = &args[i];
-		}
-		return push_callp(p_id, p_method, sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
+		return push_callp(p_id, p_method, args, sizeof...(p_args)); // Moves the arguments into the queue.
 	}
 
 	Error push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error = false);
+	// Same as above, but moves the arguments out of p_args instead of copying them.
+	Error push_callablep(const Callable &p_callable, Variant *p_args, int p_argcount, bool p_show_error = false);
 	Error push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value);
 	Error push_notification(ObjectID p_id, int p_notification);
 
 	template <typename... VarArgs>
 	Error push_callable(const Callable &p_callable, VarArgs... p_args) {
 		Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
-		const Variant *argptrs[sizeof...(p_args) + 1];
-		for (uint32_t i = 0; i < sizeof...(p_args); i++) {
-			argptrs[i] = &args[i];
-		}
-		return push_callablep(p_callable, sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
+		return push_callablep(p_callable, args, sizeof...(p_args)); // Moves the arguments into the queue.
 	}
 
 	Error push_callp(Object *p_object, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error = false);
+	// Same as above, but moves the arguments out of p_args instead of copying them.
+	Error push_callp(Object *p_object, const StringName &p_method, Variant *p_args, int p_argcount, bool p_show_error = false);
 	template <typename... VarArgs>
 	Error push_call(Object *p_object, const StringName &p_method, VarArgs... p_args) {
 		Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
-		const Variant *argptrs[sizeof...(p_args) + 1];
-		for (uint32_t i = 0; i < sizeof...(p_args); i++) {
-			argptrs[i] = &args[i];
-		}
-		return push_callp(p_object, p_method, sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
+		return push_callp(p_object, p_method, args, sizeof...(p_args)); // Moves the arguments into the queue.
 	}
 
 	Error push_notification(Object *p_object, int p_notification);
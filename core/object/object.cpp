@@ -2429,9 +2429,10 @@ void postinitialize_handler(Object *p_object) {
 void ObjectDB::debug_objects(DebugFunc p_func, void *p_user_data) {
 	spin_lock.lock();
 
-	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object, p_user_data);
+	for (uint32_t i = 0, count = slot_count, max = slot_max.load(std::memory_order_relaxed); i < max && count != 0; i++) {
+		ObjectSlot &entry = _get_slot(i);
+		if (entry.validator_and_flags.load(std::memory_order_relaxed) & OBJECTDB_VALIDATOR_MASK) {
+			p_func(entry.object.load(std::memory_order_relaxed), p_user_data);
 			count--;
 		}
 	}
@@ -2486,8 +2487,8 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 
 SpinLock ObjectDB::spin_lock;
 uint32_t ObjectDB::slot_count = 0;
-uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
+std::atomic<uint32_t> ObjectDB::slot_max = 0;
+ObjectDB::ObjectSlot *ObjectDB::slot_pages[OBJECTDB_MAX_PAGES] = {};
 uint64_t ObjectDB::validator_counter = 0;
 
 int ObjectDB::get_object_count() {
@@ -2496,32 +2497,41 @@ int ObjectDB::get_object_count() {
 
 ObjectID ObjectDB::add_instance(Object *p_object) {
 	spin_lock.lock();
-	if (unlikely(slot_count == slot_max)) {
+	uint32_t current_max = slot_max.load(std::memory_order_relaxed);
+	if (unlikely(slot_count == current_max)) {
 		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_ref_counted = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+		// Pages are grow-only and never relocated, so readers can keep indexing
+		// them without taking the lock.
+		ObjectSlot *page = (ObjectSlot *)memalloc(sizeof(ObjectSlot) * OBJECTDB_PAGE_SIZE);
+		for (uint32_t i = 0; i < OBJECTDB_PAGE_SIZE; i++) {
+			page[i].validator_and_flags.store(uint64_t(current_max + i) << OBJECTDB_SLOT_NEXT_FREE_SHIFT, std::memory_order_relaxed);
+			page[i].object.store(nullptr, std::memory_order_relaxed);
 		}
-		slot_max = new_slot_max;
+		slot_pages[current_max >> OBJECTDB_PAGE_BITS] = page;
+		// Publish the page before making its slots addressable.
+		slot_max.store(current_max + OBJECTDB_PAGE_SIZE, std::memory_order_release);
 	}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
+	uint32_t slot = uint32_t(_get_slot(slot_count).validator_and_flags.load(std::memory_order_relaxed) >> OBJECTDB_SLOT_NEXT_FREE_SHIFT) & OBJECTDB_SLOT_MAX_COUNT_MASK;
+	ObjectSlot &entry = _get_slot(slot);
+	if (entry.object.load(std::memory_order_relaxed) != nullptr) {
 		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
+		ERR_FAIL_V(ObjectID());
 	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_ref_counted = p_object->is_ref_counted();
+	entry.object.store(p_object, std::memory_order_relaxed);
 	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
 	if (unlikely(validator_counter == 0)) {
 		validator_counter = 1;
 	}
-	object_slots[slot].validator = validator_counter;
+	uint64_t packed = entry.validator_and_flags.load(std::memory_order_relaxed) & ~(OBJECTDB_VALIDATOR_MASK | OBJECTDB_SLOT_IS_REF_COUNTED_BIT);
+	packed |= validator_counter;
+	if (p_object->is_ref_counted()) {
+		packed |= OBJECTDB_SLOT_IS_REF_COUNTED_BIT;
+	}
+	// Publish the validator after the pointer, so a matching validator implies
+	// the pointer is visible to lock-free readers.
+	entry.validator_and_flags.store(packed, std::memory_order_release);
 
 	uint64_t id = validator_counter;
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
@@ -2544,17 +2554,19 @@ void ObjectDB::remove_instance(Object *p_object) {
 
 	spin_lock.lock();
 
+	ObjectSlot &entry = _get_slot(slot);
+
 #ifdef DEBUG_ENABLED
 
-	if (object_slots[slot].object != p_object) {
+	if (entry.object.load(std::memory_order_relaxed) != p_object) {
 		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
+		ERR_FAIL_MSG("Object not found in ObjectDB slot.");
 	}
 	{
 		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
+		if ((entry.validator_and_flags.load(std::memory_order_relaxed) & OBJECTDB_VALIDATOR_MASK) != validator) {
 			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
+			ERR_FAIL_MSG("ObjectDB slot validator mismatch.");
 		}
 	}
 
@@ -2562,11 +2574,15 @@ void ObjectDB::remove_instance(Object *p_object) {
 	//decrease slot count
 	slot_count--;
 	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
-	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_ref_counted = false;
-	object_slots[slot].object = nullptr;
+	ObjectSlot &free_list_entry = _get_slot(slot_count);
+	uint64_t free_list_packed = free_list_entry.validator_and_flags.load(std::memory_order_relaxed);
+	free_list_packed &= ~(OBJECTDB_SLOT_MAX_COUNT_MASK << OBJECTDB_SLOT_NEXT_FREE_SHIFT);
+	free_list_packed |= uint64_t(slot) << OBJECTDB_SLOT_NEXT_FREE_SHIFT;
+	free_list_entry.validator_and_flags.store(free_list_packed, std::memory_order_relaxed);
+	//invalidate, so checks against it fail; clear the validator before the
+	//pointer so lock-free readers never pair a stale pointer with a valid id
+	entry.validator_and_flags.store(entry.validator_and_flags.load(std::memory_order_relaxed) & ~(OBJECTDB_VALIDATOR_MASK | OBJECTDB_SLOT_IS_REF_COUNTED_BIT), std::memory_order_release);
+	entry.object.store(nullptr, std::memory_order_relaxed);
 
 	spin_lock.unlock();
 }
@@ -2588,9 +2604,11 @@ void ObjectDB::cleanup() {
 			MethodBind *resource_get_path = ClassDB::get_method("Resource", "get_path");
 			Callable::CallError call_error;
 
-			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
+			for (uint32_t i = 0, count = slot_count, max = slot_max.load(std::memory_order_relaxed); i < max && count != 0; i++) {
+				ObjectSlot &entry = _get_slot(i);
+				uint64_t packed = entry.validator_and_flags.load(std::memory_order_relaxed);
+				if (packed & OBJECTDB_VALIDATOR_MASK) {
+					Object *obj = entry.object.load(std::memory_order_relaxed);
 
 					String extra_info;
 					if (obj->is_class("Node")) {
@@ -2603,7 +2621,7 @@ void ObjectDB::cleanup() {
 						extra_info = " - Reference count: " + itos((static_cast<RefCounted *>(obj))->get_reference_count());
 					}
 
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
+					uint64_t id = uint64_t(i) | ((packed & OBJECTDB_VALIDATOR_MASK) << OBJECTDB_SLOT_MAX_COUNT_BITS) | ((packed & OBJECTDB_SLOT_IS_REF_COUNTED_BIT) ? OBJECTDB_REFERENCE_BIT : 0);
 					DEV_ASSERT(id == (uint64_t)obj->get_instance_id()); // We could just use the id from the object, but this check may help catching memory corruption catastrophes.
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + uitos(id) + extra_info);
 
@@ -2614,9 +2632,11 @@ void ObjectDB::cleanup() {
 		}
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	for (uint32_t i = 0, pages = slot_max.load(std::memory_order_relaxed) >> OBJECTDB_PAGE_BITS; i < pages; i++) {
+		memfree(slot_pages[i]);
+		slot_pages[i] = nullptr;
 	}
+	slot_max.store(0, std::memory_order_relaxed);
 
 	spin_lock.unlock();
 }
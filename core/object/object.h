@@ -35,6 +35,7 @@
 #include "core/object/message_queue.h"
 #include "core/object/object_id.h"
 #include "core/os/spin_lock.h"
+#include "core/templates/a_hash_map.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
@@ -637,12 +638,12 @@ private:
 		};
 
 		MethodInfo user;
-		HashMap<Callable, Slot> slot_map;
+		AHashMap<Callable, Slot> slot_map;
 		bool removable = false;
 	};
 	friend struct _ObjectSignalLock;
 	mutable Mutex *signal_mutex = nullptr;
-	HashMap<StringName, SignalData> signal_map;
+	AHashMap<StringName, SignalData> signal_map;
 	List<Connection> connections;
 #ifdef DEBUG_ENABLED
 	SafeRefCount _lock_index;
@@ -1070,20 +1071,33 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_BITS 24
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
+// Slot word layout: validator in the low bits, free-list link above it, ref-counted flag on top.
+#define OBJECTDB_SLOT_NEXT_FREE_SHIFT OBJECTDB_VALIDATOR_BITS
+#define OBJECTDB_SLOT_IS_REF_COUNTED_BIT (uint64_t(1) << (OBJECTDB_VALIDATOR_BITS + OBJECTDB_SLOT_MAX_COUNT_BITS))
+// Slots are allocated in fixed pages that are never moved or freed while running,
+// so the lock-free read path can index them without reclamation concerns.
+#define OBJECTDB_PAGE_BITS 12
+#define OBJECTDB_PAGE_SIZE (uint32_t(1) << OBJECTDB_PAGE_BITS)
+#define OBJECTDB_PAGE_MASK (OBJECTDB_PAGE_SIZE - 1)
+#define OBJECTDB_MAX_PAGES (uint32_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_PAGE_BITS))
 
 	struct ObjectSlot { // 128 bits per slot.
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_ref_counted : 1;
-		Object *object = nullptr;
+		// Packs validator, next_free and is_ref_counted in a single atomic word so
+		// the lock-free read path can snapshot the validator consistently.
+		std::atomic<uint64_t> validator_and_flags;
+		std::atomic<Object *> object;
 	};
 
 	static SpinLock spin_lock;
 	static uint32_t slot_count;
-	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
+	static std::atomic<uint32_t> slot_max;
+	static ObjectSlot *slot_pages[OBJECTDB_MAX_PAGES];
 	static uint64_t validator_counter;
 
+	_ALWAYS_INLINE_ static ObjectSlot &_get_slot(uint32_t p_slot) {
+		return slot_pages[p_slot >> OBJECTDB_PAGE_BITS][p_slot & OBJECTDB_PAGE_MASK];
+	}
+
 	friend class Object;
 	friend void unregister_core_types();
 	static void cleanup();
@@ -1101,20 +1115,24 @@ public:
 		uint64_t id = p_instance_id;
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
 
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); // This should never happen unless RID is corrupted.
-
-		spin_lock.lock();
+		// Acquire pairs with the release publishing the page in add_instance().
+		ERR_FAIL_COND_V(slot >= slot_max.load(std::memory_order_acquire), nullptr); // This should never happen unless RID is corrupted.
 
 		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		ObjectSlot &entry = _get_slot(slot);
+
+		if (unlikely((entry.validator_and_flags.load(std::memory_order_acquire) & OBJECTDB_VALIDATOR_MASK) != validator)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = entry.object.load(std::memory_order_acquire);
 
-		spin_lock.unlock();
+		// Re-check after reading the pointer; slot reuse always goes through a
+		// different validator, so a stable validator means the pointer matches the ID.
+		if (unlikely((entry.validator_and_flags.load(std::memory_order_acquire) & OBJECTDB_VALIDATOR_MASK) != validator)) {
+			return nullptr;
+		}
 
 		return object;
 	}
@@ -0,0 +1,180 @@
+/**************************************************************************/
+/*  typed_signal.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/object.h"
+#include "core/templates/local_vector.h"
+
+#include <type_traits>
+
+// A signal with a compile-time checked argument list, for engine-internal use.
+// Unlike Object signals, connections are validated by the C++ type system once
+// at connect time and emission dispatches as direct calls, without packing
+// arguments into Variants. Targets must be Objects; their instance id is used
+// to skip connections whose target was freed, like Callable does.
+//
+// Like Object signal connection, this is not thread-safe. Disconnecting (but
+// not freeing the signal) from within a handler is supported.
+template <typename... P>
+class TypedSignal {
+	class ConnectionBase {
+	public:
+		uint64_t object_id = 0;
+		bool disconnected = false;
+
+		virtual void call(P... p_args) const = 0;
+		virtual const uint8_t *get_comp_data(uint32_t &r_size) const = 0;
+		virtual ~ConnectionBase() {}
+	};
+
+	template <typename T>
+	class MethodConnection : public ConnectionBase {
+	public:
+		struct Data {
+			T *instance;
+			void (T::*method)(P...);
+		} data;
+
+		virtual void call(P... p_args) const override {
+			(data.instance->*data.method)(p_args...);
+		}
+
+		virtual const uint8_t *get_comp_data(uint32_t &r_size) const override {
+			r_size = sizeof(Data);
+			return (const uint8_t *)&data;
+		}
+
+		MethodConnection(T *p_instance, void (T::*p_method)(P...)) {
+			memset(&data, 0, sizeof(Data)); // Clear beforehand, may have padding bytes.
+			data.instance = p_instance;
+			data.method = p_method;
+			this->object_id = p_instance->get_instance_id();
+		}
+	};
+
+	LocalVector<ConnectionBase *> connections;
+	bool emitting = false;
+	bool pending_prune = false;
+
+	template <typename T>
+	int64_t _find(T *p_instance, void (T::*p_method)(P...)) const {
+		MethodConnection<T> needle(p_instance, p_method);
+		uint32_t needle_size = 0;
+		const uint8_t *needle_data = needle.get_comp_data(needle_size);
+		for (uint32_t i = 0; i < connections.size(); i++) {
+			if (connections[i]->disconnected) {
+				continue;
+			}
+			uint32_t size = 0;
+			const uint8_t *data = connections[i]->get_comp_data(size);
+			if (size == needle_size && memcmp(data, needle_data, size) == 0) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	void _prune_invalid() {
+		pending_prune = false;
+		for (uint32_t i = 0; i < connections.size();) {
+			if (connections[i]->disconnected || ObjectDB::get_instance(ObjectID(connections[i]->object_id)) == nullptr) {
+				memdelete(connections[i]);
+				connections.remove_at(i);
+			} else {
+				i++;
+			}
+		}
+	}
+
+public:
+	template <typename T>
+	void connect(T *p_instance, void (T::*p_method)(P...)) {
+		static_assert(std::is_base_of_v<Object, T>, "TypedSignal targets must derive from Object.");
+		ERR_FAIL_NULL(p_instance);
+		ERR_FAIL_COND_MSG(_find(p_instance, p_method) != -1, "Signal is already connected to the given method.");
+		connections.push_back(memnew(MethodConnection<T>(p_instance, p_method)));
+	}
+
+	template <typename T>
+	void disconnect(T *p_instance, void (T::*p_method)(P...)) {
+		int64_t idx = _find(p_instance, p_method);
+		ERR_FAIL_COND_MSG(idx == -1, "Signal is not connected to the given method.");
+		if (emitting) {
+			// Marking instead of removing keeps indices stable for the emitting loop;
+			// the entry is pruned once the outermost emission finishes.
+			connections[idx]->disconnected = true;
+			pending_prune = true;
+		} else {
+			memdelete(connections[idx]);
+			connections.remove_at(idx);
+		}
+	}
+
+	template <typename T>
+	bool is_connected(T *p_instance, void (T::*p_method)(P...)) const {
+		return _find(p_instance, p_method) != -1;
+	}
+
+	bool has_connections() const {
+		return !connections.is_empty();
+	}
+
+	void emit(P... p_args) {
+		bool was_emitting = emitting;
+		emitting = true;
+
+		// Connections made from within a handler are not called during this
+		// emission, matching Object signal behavior.
+		uint32_t count = connections.size();
+		for (uint32_t i = 0; i < count; i++) {
+			const ConnectionBase *c = connections[i];
+			if (c->disconnected) {
+				continue;
+			}
+			if (ObjectDB::get_instance(ObjectID(c->object_id)) == nullptr) {
+				pending_prune = true;
+				continue;
+			}
+			c->call(p_args...);
+		}
+
+		emitting = was_emitting;
+		if (!emitting && pending_prune) {
+			_prune_invalid();
+		}
+	}
+
+	~TypedSignal() {
+		for (uint32_t i = 0; i < connections.size(); i++) {
+			memdelete(connections[i]);
+		}
+	}
+};
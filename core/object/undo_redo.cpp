@@ -30,6 +30,7 @@
 
 #include "undo_redo.h"
 
+#include "core/io/compression.h"
 #include "core/io/resource.h"
 #include "core/os/os.h"
 #include "core/templates/local_vector.h"
@@ -200,6 +201,125 @@ void UndoRedo::add_undo_method(const Callable &p_callable) {
 	actions.write[current_action + 1].undo_ops.push_back(undo_op);
 }
 
+// Snapshots above this payload size are stored compressed. Large packed-array
+// properties (terrain heightmaps, image data, ...) dominate undo history memory
+// and typically compress very well, while small values aren't worth the work.
+static const int64_t COMPRESS_SNAPSHOT_MIN_SIZE = 256 * 1024;
+
+static bool _get_packed_array_span(const Variant &p_value, const uint8_t *&r_ptr, int64_t &r_size) {
+	switch (p_value.get_type()) {
+		case Variant::PACKED_BYTE_ARRAY: {
+			PackedByteArray arr = p_value;
+			r_ptr = arr.ptr();
+			r_size = arr.size();
+		} break;
+		case Variant::PACKED_INT32_ARRAY: {
+			PackedInt32Array arr = p_value;
+			r_ptr = (const uint8_t *)arr.ptr();
+			r_size = arr.size() * sizeof(int32_t);
+		} break;
+		case Variant::PACKED_INT64_ARRAY: {
+			PackedInt64Array arr = p_value;
+			r_ptr = (const uint8_t *)arr.ptr();
+			r_size = arr.size() * sizeof(int64_t);
+		} break;
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			PackedFloat32Array arr = p_value;
+			r_ptr = (const uint8_t *)arr.ptr();
+			r_size = arr.size() * sizeof(float);
+		} break;
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			PackedFloat64Array arr = p_value;
+			r_ptr = (const uint8_t *)arr.ptr();
+			r_size = arr.size() * sizeof(double);
+		} break;
+		case Variant::PACKED_VECTOR2_ARRAY: {
+			PackedVector2Array arr = p_value;
+			r_ptr = (const uint8_t *)arr.ptr();
+			r_size = arr.size() * sizeof(Vector2);
+		} break;
+		case Variant::PACKED_VECTOR3_ARRAY: {
+			PackedVector3Array arr = p_value;
+			r_ptr = (const uint8_t *)arr.ptr();
+			r_size = arr.size() * sizeof(Vector3);
+		} break;
+		case Variant::PACKED_VECTOR4_ARRAY: {
+			PackedVector4Array arr = p_value;
+			r_ptr = (const uint8_t *)arr.ptr();
+			r_size = arr.size() * sizeof(Vector4);
+		} break;
+		case Variant::PACKED_COLOR_ARRAY: {
+			PackedColorArray arr = p_value;
+			r_ptr = (const uint8_t *)arr.ptr();
+			r_size = arr.size() * sizeof(Color);
+		} break;
+		default: {
+			return false;
+		}
+	}
+	return true;
+}
+
+template <typename T>
+static Variant _packed_array_from_data(const uint8_t *p_data, int64_t p_size) {
+	Vector<T> arr;
+	arr.resize(p_size / sizeof(T));
+	memcpy((uint8_t *)arr.ptrw(), p_data, p_size);
+	return arr;
+}
+
+void UndoRedo::_compress_property_value(Operation &r_op) {
+	const uint8_t *src = nullptr;
+	int64_t src_size = 0;
+	if (!_get_packed_array_span(r_op.value, src, src_size) || src_size < COMPRESS_SNAPSHOT_MIN_SIZE) {
+		return;
+	}
+
+	Vector<uint8_t> compressed;
+	compressed.resize(Compression::get_max_compressed_buffer_size(src_size, Compression::MODE_ZSTD));
+	int64_t compressed_size = Compression::compress(compressed.ptrw(), src, src_size, Compression::MODE_ZSTD);
+	if (compressed_size <= 0 || compressed_size >= src_size) {
+		// Incompressible; keep the plain snapshot.
+		return;
+	}
+	compressed.resize(compressed_size);
+
+	r_op.value_packed_type = r_op.value.get_type();
+	r_op.value_uncompressed_size = src_size;
+	r_op.value = compressed;
+}
+
+Variant UndoRedo::_decompress_property_value(const Operation &p_op) {
+	PackedByteArray compressed = p_op.value;
+	Vector<uint8_t> data;
+	data.resize(p_op.value_uncompressed_size);
+	int64_t decompressed_size = Compression::decompress(data.ptrw(), p_op.value_uncompressed_size, compressed.ptr(), compressed.size(), Compression::MODE_ZSTD);
+	ERR_FAIL_COND_V_MSG(decompressed_size != p_op.value_uncompressed_size, Variant(), "Failed to decompress undo history snapshot.");
+
+	switch (p_op.value_packed_type) {
+		case Variant::PACKED_BYTE_ARRAY:
+			return data;
+		case Variant::PACKED_INT32_ARRAY:
+			return _packed_array_from_data<int32_t>(data.ptr(), data.size());
+		case Variant::PACKED_INT64_ARRAY:
+			return _packed_array_from_data<int64_t>(data.ptr(), data.size());
+		case Variant::PACKED_FLOAT32_ARRAY:
+			return _packed_array_from_data<float>(data.ptr(), data.size());
+		case Variant::PACKED_FLOAT64_ARRAY:
+			return _packed_array_from_data<double>(data.ptr(), data.size());
+		case Variant::PACKED_VECTOR2_ARRAY:
+			return _packed_array_from_data<Vector2>(data.ptr(), data.size());
+		case Variant::PACKED_VECTOR3_ARRAY:
+			return _packed_array_from_data<Vector3>(data.ptr(), data.size());
+		case Variant::PACKED_VECTOR4_ARRAY:
+			return _packed_array_from_data<Vector4>(data.ptr(), data.size());
+		case Variant::PACKED_COLOR_ARRAY:
+			return _packed_array_from_data<Color>(data.ptr(), data.size());
+		default:
+			ERR_FAIL_V_MSG(Variant(), "Invalid compressed undo history snapshot type.");
+	}
+}
+
 void UndoRedo::add_do_property(Object *p_object, const StringName &p_property, const Variant &p_value) {
 	ERR_FAIL_NULL(p_object);
 	ERR_FAIL_COND(action_level <= 0);
@@ -213,6 +333,7 @@ void UndoRedo::add_do_property(Object *p_object, const StringName &p_property, c
 	do_op.type = Operation::TYPE_PROPERTY;
 	do_op.name = p_property;
 	do_op.value = p_value;
+	_compress_property_value(do_op);
 	actions.write[current_action + 1].do_ops.push_back(do_op);
 }
 
@@ -236,6 +357,7 @@ void UndoRedo::add_undo_property(Object *p_object, const StringName &p_property,
 	undo_op.force_keep_in_merge_ends = force_keep_in_merge_ends;
 	undo_op.name = p_property;
 	undo_op.value = p_value;
+	_compress_property_value(undo_op);
 	actions.write[current_action + 1].undo_ops.push_back(undo_op);
 }
 
@@ -398,8 +520,13 @@ void UndoRedo::_process_operation_list(List<Operation>::Element *E, bool p_execu
 				}
 			} break;
 			case Operation::TYPE_PROPERTY: {
+				Variant value;
+				if (p_execute || property_callback) {
+					value = op.value_packed_type != Variant::NIL ? _decompress_property_value(op) : op.value;
+				}
+
 				if (p_execute) {
-					obj->set(op.name, op.value);
+					obj->set(op.name, value);
 #ifdef TOOLS_ENABLED
 					Resource *res = Object::cast_to<Resource>(obj);
 					if (res) {
@@ -409,7 +536,7 @@ void UndoRedo::_process_operation_list(List<Operation>::Element *E, bool p_execu
 				}
 
 				if (property_callback) {
-					property_callback(prop_callback_ud, obj, op.name, op.value);
+					property_callback(prop_callback_ud, obj, op.name, value);
 				}
 			} break;
 			case Operation::TYPE_REFERENCE: {
@@ -63,6 +63,10 @@ private:
 		StringName name;
 		Callable callable;
 		Variant value;
+		// When different from NIL, value holds a compressed snapshot of a large
+		// packed array of this type, reinflated when the operation is applied.
+		Variant::Type value_packed_type = Variant::NIL;
+		int64_t value_uncompressed_size = 0;
 
 		void delete_reference();
 	};
@@ -90,6 +94,9 @@ private:
 	void _discard_redo();
 	bool _redo(bool p_execute);
 
+	static void _compress_property_value(Operation &r_op);
+	static Variant _decompress_property_value(const Operation &p_op);
+
 	CommitNotifyCallback callback = nullptr;
 	void *callback_ud = nullptr;
 	void *method_callback_ud = nullptr;
@@ -92,22 +92,27 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		// Handling a group
 		bool do_post = false;
 
+		uint32_t chunk_size = p_task->group->chunk_size;
+
 		while (true) {
-			uint32_t work_index = p_task->group->index.postincrement();
+			uint32_t work_index = p_task->group->index.postadd(chunk_size);
 
 			if (work_index >= p_task->group->max) {
 				break;
 			}
-			if (p_task->native_group_func) {
-				p_task->native_group_func(p_task->native_func_userdata, work_index);
-			} else if (p_task->template_userdata) {
-				p_task->template_userdata->callback_indexed(work_index);
-			} else {
-				p_task->callable.call(work_index);
+			uint32_t work_end = MIN(work_index + chunk_size, p_task->group->max);
+			for (uint32_t i = work_index; i < work_end; i++) {
+				if (p_task->native_group_func) {
+					p_task->native_group_func(p_task->native_func_userdata, i);
+				} else if (p_task->template_userdata) {
+					p_task->template_userdata->callback_indexed(i);
+				} else {
+					p_task->callable.call(i);
+				}
 			}
 
 			// This is the only way to ensure posting is done when all tasks are really complete.
-			uint32_t completed_amount = p_task->group->completed_index.increment();
+			uint32_t completed_amount = p_task->group->completed_index.add(work_end - work_index);
 
 			if (completed_amount == p_task->group->max) {
 				do_post = true;
@@ -676,6 +681,9 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 
 	} else {
 		group->tasks_used = p_tasks;
+		// Let each thread claim several elements per atomic fetch, while still
+		// leaving enough chunks per task for the load to balance.
+		group->chunk_size = MAX(1u, (uint32_t)p_elements / ((uint32_t)p_tasks * 8));
 		tasks_posted = (Task **)alloca(sizeof(Task *) * p_tasks);
 		for (int i = 0; i < p_tasks; i++) {
 			Task *task = task_allocator.alloc();
@@ -806,7 +814,7 @@ void WorkerThreadPool::thread_exit_unlock_allowance_zone(uint32_t p_zone_id) {
 }
 #endif
 
-void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio) {
+void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio, uint64_t p_cpu_affinity) {
 	ERR_FAIL_COND(threads.size() > 0);
 
 	runlevel = RUNLEVEL_NORMAL;
@@ -826,10 +834,13 @@ void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio)
 #endif
 	threads.resize(p_thread_count);
 
+	Thread::Settings settings;
+	settings.affinity_mask = p_cpu_affinity;
+
 	for (uint32_t i = 0; i < threads.size(); i++) {
 		threads[i].index = i;
 		threads[i].pool = this;
-		threads[i].thread.start(&WorkerThreadPool::_thread_function, &threads[i]);
+		threads[i].thread.start(&WorkerThreadPool::_thread_function, &threads[i], settings);
 		thread_ids.insert(threads[i].thread.get_id(), i);
 	}
 }
@@ -65,6 +65,9 @@ private:
 		SafeNumeric<uint32_t> index;
 		SafeNumeric<uint32_t> completed_index;
 		uint32_t max = 0;
+		// How many elements a thread claims per atomic fetch; computed from the
+		// element/task ratio so cheap callbacks don't contend per element.
+		uint32_t chunk_size = 1;
 		Semaphore done_semaphore;
 		SafeFlag completed;
 		SafeNumeric<uint32_t> finished;
@@ -295,7 +298,7 @@ public:
 	static void thread_exit_unlock_allowance_zone(uint32_t p_zone_id) {}
 #endif
 
-	void init(int p_thread_count = -1, float p_low_priority_task_ratio = 0.3);
+	void init(int p_thread_count = -1, float p_low_priority_task_ratio = 0.3, uint64_t p_cpu_affinity = 0);
 	void exit_languages_threads();
 	void finish();
 	WorkerThreadPool(bool p_singleton = true);
@@ -59,6 +59,17 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 #ifdef DEBUG_ENABLED
 static SafeNumeric<uint64_t> _current_mem_usage;
 static SafeNumeric<uint64_t> _max_mem_usage;
+
+static thread_local Memory::AllocTag _current_alloc_tag = Memory::ALLOC_TAG_NONE;
+static SafeNumeric<uint64_t> _tag_mem_usage[Memory::ALLOC_TAG_MAX];
+static SafeNumeric<uint64_t> _tag_max_mem_usage[Memory::ALLOC_TAG_MAX];
+static SafeNumeric<uint64_t> _tag_alloc_count[Memory::ALLOC_TAG_MAX];
+static SafeNumeric<uint64_t> _tag_alloc_bytes[Memory::ALLOC_TAG_MAX];
+
+// The owning tag rides in the top byte of the prepad size word, so frees and
+// reallocs attribute to the subsystem that allocated the block.
+static constexpr uint64_t ALLOC_TAG_SHIFT = 56;
+static constexpr uint64_t ALLOC_SIZE_MASK = ((uint64_t)1 << ALLOC_TAG_SHIFT) - 1;
 #endif
 
 void *Memory::alloc_aligned_static(size_t p_bytes, size_t p_alignment) {
@@ -119,6 +130,13 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 #ifdef DEBUG_ENABLED
 		uint64_t new_mem_usage = _current_mem_usage.add(p_bytes);
 		_max_mem_usage.exchange_if_greater(new_mem_usage);
+
+		Memory::AllocTag tag = _current_alloc_tag;
+		*s = p_bytes | ((uint64_t)tag << ALLOC_TAG_SHIFT);
+		uint64_t new_tag_usage = _tag_mem_usage[tag].add(p_bytes);
+		_tag_max_mem_usage[tag].exchange_if_greater(new_tag_usage);
+		_tag_alloc_count[tag].increment();
+		_tag_alloc_bytes[tag].add(p_bytes);
 #endif
 		return s8 + DATA_OFFSET;
 	} else {
@@ -145,13 +163,21 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 	if (prepad) {
 		mem -= DATA_OFFSET;
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
+		uint64_t size_word = p_bytes;
 
 #ifdef DEBUG_ENABLED
-		if (p_bytes > *s) {
-			uint64_t new_mem_usage = _current_mem_usage.add(p_bytes - *s);
+		Memory::AllocTag tag = (Memory::AllocTag)(*s >> ALLOC_TAG_SHIFT);
+		uint64_t prev_bytes = *s & ALLOC_SIZE_MASK;
+		size_word = p_bytes | ((uint64_t)tag << ALLOC_TAG_SHIFT);
+		if (p_bytes > prev_bytes) {
+			uint64_t new_mem_usage = _current_mem_usage.add(p_bytes - prev_bytes);
 			_max_mem_usage.exchange_if_greater(new_mem_usage);
+			uint64_t new_tag_usage = _tag_mem_usage[tag].add(p_bytes - prev_bytes);
+			_tag_max_mem_usage[tag].exchange_if_greater(new_tag_usage);
+			_tag_alloc_bytes[tag].add(p_bytes - prev_bytes);
 		} else {
-			_current_mem_usage.sub(*s - p_bytes);
+			_current_mem_usage.sub(prev_bytes - p_bytes);
+			_tag_mem_usage[tag].sub(prev_bytes - p_bytes);
 		}
 #endif
 
@@ -159,14 +185,14 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 			free(mem);
 			return nullptr;
 		} else {
-			*s = p_bytes;
+			*s = size_word;
 
 			mem = (uint8_t *)realloc(mem, p_bytes + DATA_OFFSET);
 			ERR_FAIL_NULL_V(mem, nullptr);
 
 			s = (uint64_t *)(mem + SIZE_OFFSET);
 
-			*s = p_bytes;
+			*s = size_word;
 
 			return mem + DATA_OFFSET;
 		}
@@ -195,7 +221,10 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 
 #ifdef DEBUG_ENABLED
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
-		_current_mem_usage.sub(*s);
+		Memory::AllocTag tag = (Memory::AllocTag)(*s >> ALLOC_TAG_SHIFT);
+		uint64_t bytes = *s & ALLOC_SIZE_MASK;
+		_current_mem_usage.sub(bytes);
+		_tag_mem_usage[tag].sub(bytes);
 #endif
 
 		free(mem);
@@ -224,6 +253,71 @@ uint64_t Memory::get_mem_max_usage() {
 #endif
 }
 
+void Memory::set_alloc_tag(AllocTag p_tag) {
+#ifdef DEBUG_ENABLED
+	DEV_ASSERT(p_tag < ALLOC_TAG_MAX);
+	_current_alloc_tag = p_tag;
+#else
+	(void)p_tag;
+#endif
+}
+
+Memory::AllocTag Memory::get_alloc_tag() {
+#ifdef DEBUG_ENABLED
+	return _current_alloc_tag;
+#else
+	return ALLOC_TAG_NONE;
+#endif
+}
+
+const char *Memory::get_alloc_tag_name(AllocTag p_tag) {
+	static const char *tag_names[ALLOC_TAG_MAX] = {
+		"none",
+		"rendering",
+		"physics",
+		"script",
+		"audio",
+	};
+	ERR_FAIL_UNSIGNED_INDEX_V((uint32_t)p_tag, (uint32_t)ALLOC_TAG_MAX, "");
+	return tag_names[p_tag];
+}
+
+uint64_t Memory::get_tag_mem_usage(AllocTag p_tag) {
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_UNSIGNED_INDEX_V((uint32_t)p_tag, (uint32_t)ALLOC_TAG_MAX, 0);
+	return _tag_mem_usage[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_tag_mem_max_usage(AllocTag p_tag) {
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_UNSIGNED_INDEX_V((uint32_t)p_tag, (uint32_t)ALLOC_TAG_MAX, 0);
+	return _tag_max_mem_usage[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_tag_alloc_count(AllocTag p_tag) {
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_UNSIGNED_INDEX_V((uint32_t)p_tag, (uint32_t)ALLOC_TAG_MAX, 0);
+	return _tag_alloc_count[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_tag_alloc_bytes(AllocTag p_tag) {
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_UNSIGNED_INDEX_V((uint32_t)p_tag, (uint32_t)ALLOC_TAG_MAX, 0);
+	return _tag_alloc_bytes[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
@@ -231,3 +325,65 @@ _GlobalNil::_GlobalNil() {
 }
 
 _GlobalNil _GlobalNilClass::_nil;
+
+FrameArena::Block *FrameArena::_add_block(uint64_t p_min_size) {
+	uint64_t size = MAX(default_block_size, p_min_size);
+	Block *block = (Block *)Memory::alloc_static(sizeof(Block) + size);
+	block->size = size;
+
+	if (current_block) {
+		// Insert after the current block so reset() keeps walking the chain
+		// in allocation order.
+		block->next = current_block->next;
+		current_block->next = block;
+	} else {
+		block->next = nullptr;
+		first_block = block;
+	}
+	current_block = block;
+	current_offset = 0;
+	return block;
+}
+
+void *FrameArena::alloc(size_t p_bytes) {
+	uint64_t bytes = Memory::get_aligned_address(p_bytes, alignof(max_align_t));
+
+	while (current_block) {
+		if (current_offset + bytes <= current_block->size) {
+			uint8_t *ptr = (uint8_t *)(current_block + 1) + current_offset;
+			current_offset += bytes;
+			return ptr;
+		}
+		// Move on to a retained block from an earlier frame, if it can hold
+		// the allocation; otherwise insert a fresh one.
+		if (current_block->next && current_block->next->size >= bytes) {
+			current_block = current_block->next;
+			current_offset = 0;
+		} else {
+			break;
+		}
+	}
+
+	_add_block(bytes);
+	uint8_t *ptr = (uint8_t *)(current_block + 1);
+	current_offset = bytes;
+	return ptr;
+}
+
+void FrameArena::reset() {
+	current_block = first_block;
+	current_offset = 0;
+}
+
+FrameArena::FrameArena(uint64_t p_block_size) {
+	default_block_size = Memory::get_aligned_address(p_block_size, alignof(max_align_t));
+}
+
+FrameArena::~FrameArena() {
+	Block *block = first_block;
+	while (block) {
+		Block *next = block->next;
+		Memory::free_static(block);
+		block = next;
+	}
+}
@@ -87,14 +87,77 @@ void free_aligned_static(void *p_memory);
 uint64_t get_mem_available();
 uint64_t get_mem_usage();
 uint64_t get_mem_max_usage();
+
+// Optional per-subsystem attribution for the static allocator. Allocations
+// made while a tag is active (see ScopedAllocTag) are accounted against it,
+// including on free/realloc. Only tracked in debug builds, like the global
+// usage counters; the getters return 0 in release builds.
+enum AllocTag : uint8_t {
+	ALLOC_TAG_NONE,
+	ALLOC_TAG_RENDERING,
+	ALLOC_TAG_PHYSICS,
+	ALLOC_TAG_SCRIPT,
+	ALLOC_TAG_AUDIO,
+	ALLOC_TAG_MAX,
+};
+
+void set_alloc_tag(AllocTag p_tag);
+AllocTag get_alloc_tag();
+const char *get_alloc_tag_name(AllocTag p_tag);
+uint64_t get_tag_mem_usage(AllocTag p_tag);
+uint64_t get_tag_mem_max_usage(AllocTag p_tag);
+uint64_t get_tag_alloc_count(AllocTag p_tag);
+uint64_t get_tag_alloc_bytes(AllocTag p_tag);
 }; //namespace Memory
 
+// Applies an allocation tag to the current thread for the duration of a scope.
+class ScopedAllocTag {
+	Memory::AllocTag previous_tag;
+
+public:
+	_FORCE_INLINE_ explicit ScopedAllocTag(Memory::AllocTag p_tag) {
+		previous_tag = Memory::get_alloc_tag();
+		Memory::set_alloc_tag(p_tag);
+	}
+	_FORCE_INLINE_ ~ScopedAllocTag() {
+		Memory::set_alloc_tag(previous_tag);
+	}
+};
+
 class DefaultAllocator {
 public:
 	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_static(p_memory, false); }
 	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_static(p_ptr, false); }
 };
 
+// Bump allocator for short-lived scratch memory (sort buffers, temporary
+// arrays) whose lifetime is bounded by a frame or a pass. Allocations are only
+// released wholesale through reset(); blocks are retained and reused across
+// frames, so steady-state use performs no heap allocation at all.
+// Not thread safe: the owning system must allocate and reset from the same
+// thread, and must not call reset() while any allocation is still in use.
+class FrameArena {
+	struct Block {
+		Block *next = nullptr;
+		uint64_t size = 0;
+		// Data follows the header.
+	};
+
+	Block *first_block = nullptr;
+	Block *current_block = nullptr;
+	uint64_t current_offset = 0;
+	uint64_t default_block_size;
+
+	Block *_add_block(uint64_t p_min_size);
+
+public:
+	void *alloc(size_t p_bytes);
+	void reset();
+
+	explicit FrameArena(uint64_t p_block_size = 256 * 1024);
+	~FrameArena();
+};
+
 // Works around an issue where memnew_placement (char *) would call the p_description version.
 inline void *operator new(size_t p_size, char *p_dest) {
 	return operator new(p_size, (void *)p_dest);
@@ -51,9 +51,12 @@ void Thread::_set_platform_functions(const PlatformFunctions &p_functions) {
 #ifdef THREADS_ENABLED
 void Thread::callback(ID p_caller_id, const Settings &p_settings, Callback p_callback, void *p_userdata) {
 	Thread::caller_id = p_caller_id;
-	if (platform_functions.set_priority) {
+	if (p_settings.priority != PRIORITY_NORMAL && platform_functions.set_priority) {
 		platform_functions.set_priority(p_settings.priority);
 	}
+	if (p_settings.affinity_mask != 0 && platform_functions.set_affinity) {
+		platform_functions.set_affinity(p_settings.affinity_mask);
+	}
 	if (platform_functions.init) {
 		platform_functions.init();
 	}
@@ -96,6 +99,22 @@ Error Thread::set_name(const String &p_name) {
 	return ERR_UNAVAILABLE;
 }
 
+Error Thread::set_affinity(uint64_t p_mask) {
+	if (platform_functions.set_affinity) {
+		return platform_functions.set_affinity(p_mask);
+	}
+
+	return ERR_UNAVAILABLE;
+}
+
+Error Thread::set_priority(Priority p_priority) {
+	if (platform_functions.set_priority) {
+		return platform_functions.set_priority(p_priority);
+	}
+
+	return ERR_UNAVAILABLE;
+}
+
 Thread::Thread() {
 }
 
@@ -75,17 +75,20 @@ public:
 	enum Priority {
 		PRIORITY_LOW,
 		PRIORITY_NORMAL,
-		PRIORITY_HIGH
+		PRIORITY_HIGH,
+		PRIORITY_TIME_CRITICAL // Reserved for latency-bound threads such as audio mixing; use sparingly.
 	};
 
 	struct Settings {
 		Priority priority;
+		uint64_t affinity_mask = 0; // Bitmask of logical CPUs to pin to; zero leaves the OS scheduler free.
 		Settings() { priority = PRIORITY_NORMAL; }
 	};
 
 	struct PlatformFunctions {
 		Error (*set_name)(const String &) = nullptr;
-		void (*set_priority)(Thread::Priority) = nullptr;
+		Error (*set_affinity)(uint64_t) = nullptr;
+		Error (*set_priority)(Thread::Priority) = nullptr;
 		void (*init)() = nullptr;
 		void (*wrapper)(Thread::Callback, void *) = nullptr;
 		void (*term)() = nullptr;
@@ -132,6 +135,8 @@ public:
 	_FORCE_INLINE_ static bool is_main_thread() { return caller_id == MAIN_ID; } // Gain a tiny bit of perf here because there is no need to validate caller_id here, because only main thread will be set as 1.
 
 	static Error set_name(const String &p_name);
+	static Error set_affinity(uint64_t p_mask); // Applies to the calling thread.
+	static Error set_priority(Priority p_priority); // Applies to the calling thread.
 
 	ID start(Thread::Callback p_callback, void *p_user, const Settings &p_settings = Settings());
 	bool is_started() const;
@@ -162,17 +167,20 @@ public:
 	enum Priority {
 		PRIORITY_LOW,
 		PRIORITY_NORMAL,
-		PRIORITY_HIGH
+		PRIORITY_HIGH,
+		PRIORITY_TIME_CRITICAL // Reserved for latency-bound threads such as audio mixing; use sparingly.
 	};
 
 	struct Settings {
 		Priority priority;
+		uint64_t affinity_mask = 0; // Bitmask of logical CPUs to pin to; zero leaves the OS scheduler free.
 		Settings() { priority = PRIORITY_NORMAL; }
 	};
 
 	struct PlatformFunctions {
 		Error (*set_name)(const String &) = nullptr;
-		void (*set_priority)(Thread::Priority) = nullptr;
+		Error (*set_affinity)(uint64_t) = nullptr;
+		Error (*set_priority)(Thread::Priority) = nullptr;
 		void (*init)() = nullptr;
 		void (*wrapper)(Thread::Callback, void *) = nullptr;
 		void (*term)() = nullptr;
@@ -196,6 +204,8 @@ public:
 	_FORCE_INLINE_ static bool is_main_thread() { return true; }
 
 	static Error set_name(const String &p_name) { return ERR_UNAVAILABLE; }
+	static Error set_affinity(uint64_t p_mask) { return ERR_UNAVAILABLE; }
+	static Error set_priority(Priority p_priority) { return ERR_UNAVAILABLE; }
 
 	void start(Thread::Callback p_callback, void *p_user, const Settings &p_settings = Settings()) {}
 	bool is_started() const { return false; }
@@ -42,6 +42,8 @@
 // Define tracing macros.
 #define GodotProfileFrameMark FrameMark
 #define GodotProfileZone(m_zone_name) ZoneScopedN(m_zone_name)
+// The plot name must be a stable pointer (plots are identified by it).
+#define GodotProfilePlot(m_plot_name, m_value) TracyPlot(m_plot_name, m_value)
 #define GodotProfileZoneGroupedFirst(m_group_name, m_zone_name) ZoneNamedN(__godot_tracy_zone_##m_group_name, m_zone_name, true)
 #define GodotProfileZoneGroupedEndEarly(m_group_name, m_zone_name) __godot_tracy_zone_##m_group_name.~ScopedZone();
 #ifndef TRACY_CALLSTACK
@@ -80,6 +82,8 @@ struct PerfettoGroupedEventEnder {
 
 #define GodotProfileFrameMark // TODO
 #define GodotProfileZone(m_zone_name) TRACE_EVENT("godot", m_zone_name);
+// The plot name must be a stable pointer (plots are identified by it).
+#define GodotProfilePlot(m_plot_name, m_value) TRACE_COUNTER("godot", m_plot_name, m_value);
 #define GodotProfileZoneGroupedFirst(m_group_name, m_zone_name) \
 	TRACE_EVENT_BEGIN("godot", m_zone_name);                    \
 	PerfettoGroupedEventEnder __godot_perfetto_zone_##m_group_name
@@ -100,5 +104,6 @@ void godot_init_profiler();
 #define GodotProfileZoneGroupedFirst(m_group_name, m_zone_name)
 #define GodotProfileZoneGroupedEndEarly(m_group_name, m_zone_name)
 #define GodotProfileZoneGrouped(m_group_name, m_zone_name)
+#define GodotProfilePlot(m_plot_name, m_value)
 
 #endif
@@ -48,6 +48,7 @@
 #include "core/io/dtls_server.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/http_client.h"
+#include "core/io/http_client_pool.h"
 #include "core/io/image_loader.h"
 #include "core/io/json.h"
 #include "core/io/marshalls.h"
@@ -58,6 +59,7 @@
 #include "core/io/pck_packer.h"
 #include "core/io/resource_format_binary.h"
 #include "core/io/resource_importer.h"
+#include "core/io/resource_loader.h"
 #include "core/io/resource_uid.h"
 #include "core/io/stream_peer_gzip.h"
 #include "core/io/stream_peer_tls.h"
@@ -221,6 +223,7 @@ void register_core_types() {
 	GDREGISTER_ABSTRACT_CLASS(WorkerThreadPool);
 
 	ClassDB::register_custom_instance_class<HTTPClient>();
+	GDREGISTER_CLASS(HTTPClientPool);
 
 	// Crypto
 	GDREGISTER_CLASS(HashingContext);
@@ -352,6 +355,9 @@ void register_core_settings() {
 
 	GLOBAL_DEF("threading/worker_pool/max_threads", -1);
 	GLOBAL_DEF("threading/worker_pool/low_priority_thread_ratio", 0.3);
+	GLOBAL_DEF("threading/worker_pool/cpu_affinity", 0);
+
+	ResourceLoader::set_distribute_sub_loads(GLOBAL_DEF("threading/resource_loading/distribute_sub_loads", false));
 }
 
 void register_early_core_singletons() {
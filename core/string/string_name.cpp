@@ -39,9 +39,34 @@ struct StringName::Table {
 	constexpr static uint32_t TABLE_LEN = 1 << TABLE_BITS;
 	constexpr static uint32_t TABLE_MASK = TABLE_LEN - 1;
 
+	// The table is sharded on the low bits of the bucket index, so threads
+	// interning different names (parallel resource loads, script threads)
+	// don't serialize on a single global mutex. All mutations of a bucket go
+	// through its shard mutex; the allocator is shared across shards and thus
+	// needs to be thread-safe itself.
+	constexpr static uint32_t SHARD_BITS = 6;
+	constexpr static uint32_t SHARD_COUNT = 1 << SHARD_BITS;
+	constexpr static uint32_t SHARD_MASK = SHARD_COUNT - 1;
+
 	static inline _Data *table[TABLE_LEN];
-	static inline BinaryMutex mutex;
-	static inline PagedAllocator<_Data> allocator;
+	static inline BinaryMutex mutexes[SHARD_COUNT];
+	static inline PagedAllocator<_Data, true> allocator;
+
+	static _ALWAYS_INLINE_ BinaryMutex &get_mutex(uint32_t p_idx) {
+		return mutexes[p_idx & SHARD_MASK];
+	}
+
+	static void lock_all() {
+		for (uint32_t i = 0; i < SHARD_COUNT; i++) {
+			mutexes[i].lock();
+		}
+	}
+
+	static void unlock_all() {
+		for (uint32_t i = 0; i < SHARD_COUNT; i++) {
+			mutexes[i].unlock();
+		}
+	}
 };
 
 void StringName::setup() {
@@ -53,7 +78,7 @@ void StringName::setup() {
 }
 
 void StringName::cleanup() {
-	MutexLock lock(Table::mutex);
+	Table::lock_all();
 
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
@@ -104,13 +129,15 @@ void StringName::cleanup() {
 		print_verbose(vformat("StringName: %d unclaimed string names at exit.", lost_strings));
 	}
 	configured = false;
+
+	Table::unlock_all();
 }
 
 void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(Table::mutex);
+		MutexLock lock(Table::get_mutex(_data->hash & Table::TABLE_MASK));
 
 		if (CoreGlobals::leak_reporting_enabled && _data->static_count.get() > 0) {
 			ERR_PRINT("BUG: Unreferenced static string to 0: " + _data->name);
@@ -213,7 +240,7 @@ StringName::StringName(const char *p_name, bool p_static) {
 	const uint32_t hash = String::hash(p_name);
 	const uint32_t idx = hash & Table::TABLE_MASK;
 
-	MutexLock lock(Table::mutex);
+	MutexLock lock(Table::get_mutex(idx));
 	_data = Table::table[idx];
 
 	while (_data) {
@@ -270,7 +297,7 @@ StringName::StringName(const String &p_name, bool p_static) {
 	const uint32_t hash = p_name.hash();
 	const uint32_t idx = hash & Table::TABLE_MASK;
 
-	MutexLock lock(Table::mutex);
+	MutexLock lock(Table::get_mutex(idx));
 	_data = Table::table[idx];
 
 	while (_data) {
@@ -197,48 +197,64 @@ bool TranslationDomain::_is_placeholder(const String &p_message, int p_index) co
 					p_message[p_index + 1] == 'o' || p_message[p_index + 1] == 'x' || p_message[p_index + 1] == 'X' || p_message[p_index + 1] == 'f');
 }
 
-StringName TranslationDomain::get_message_from_translations(const String &p_locale, const StringName &p_message, const StringName &p_context) const {
-	StringName res;
-	int best_score = 0;
+const LocalVector<Ref<Translation>> &TranslationDomain::_get_locale_chain(const String &p_locale) const {
+	{
+		const LocalVector<Ref<Translation>> *chain = locale_chain_cache.getptr(p_locale);
+		if (chain) {
+			return *chain;
+		}
+	}
+
+	struct ScoredTranslation {
+		Ref<Translation> translation;
+		int score = 0;
+		uint32_t order = 0;
 
+		bool operator<(const ScoredTranslation &p_other) const {
+			// Walking the chain takes the first hit, while the uncached lookup
+			// kept the last hit of equal score, so ties are broken by reverse
+			// insertion order to preserve the result.
+			return score != p_other.score ? score > p_other.score : order > p_other.order;
+		}
+	};
+
+	LocalVector<ScoredTranslation> scored;
+	uint32_t order = 0;
 	for (const Ref<Translation> &E : translations) {
-		int score = TranslationServer::get_singleton()->compare_locales(p_locale, E->get_locale());
-		if (score > 0 && score >= best_score) {
-			const StringName r = E->get_message(p_message, p_context);
-			if (!r) {
-				continue;
-			}
-			res = r;
-			best_score = score;
-			if (score == 10) {
-				break; // Exact match, skip the rest.
-			}
+		const int score = TranslationServer::get_singleton()->compare_locales(p_locale, E->get_locale());
+		if (score > 0) {
+			scored.push_back({ E, score, order });
 		}
+		order++;
 	}
+	scored.sort();
 
-	return res;
+	LocalVector<Ref<Translation>> &chain = locale_chain_cache[p_locale];
+	chain.reserve(scored.size());
+	for (const ScoredTranslation &E : scored) {
+		chain.push_back(E.translation);
+	}
+	return chain;
 }
 
-StringName TranslationDomain::get_message_from_translations(const String &p_locale, const StringName &p_message, const StringName &p_message_plural, int p_n, const StringName &p_context) const {
-	StringName res;
-	int best_score = 0;
-
-	for (const Ref<Translation> &E : translations) {
-		int score = TranslationServer::get_singleton()->compare_locales(p_locale, E->get_locale());
-		if (score > 0 && score >= best_score) {
-			const StringName r = E->get_plural_message(p_message, p_message_plural, p_n, p_context);
-			if (!r) {
-				continue;
-			}
-			res = r;
-			best_score = score;
-			if (score == 10) {
-				break; // Exact match, skip the rest.
-			}
+StringName TranslationDomain::get_message_from_translations(const String &p_locale, const StringName &p_message, const StringName &p_context) const {
+	for (const Ref<Translation> &E : _get_locale_chain(p_locale)) {
+		const StringName r = E->get_message(p_message, p_context);
+		if (r) {
+			return r;
 		}
 	}
+	return StringName();
+}
 
-	return res;
+StringName TranslationDomain::get_message_from_translations(const String &p_locale, const StringName &p_message, const StringName &p_message_plural, int p_n, const StringName &p_context) const {
+	for (const Ref<Translation> &E : _get_locale_chain(p_locale)) {
+		const StringName r = E->get_plural_message(p_message, p_message_plural, p_n, p_context);
+		if (r) {
+			return r;
+		}
+	}
+	return StringName();
 }
 
 PackedStringArray TranslationDomain::get_loaded_locales() const {
@@ -293,14 +309,17 @@ Ref<Translation> TranslationDomain::get_translation_object(const String &p_local
 void TranslationDomain::add_translation(const Ref<Translation> &p_translation) {
 	ERR_FAIL_COND_MSG(p_translation.is_null(), "Invalid translation provided.");
 	translations.insert(p_translation);
+	locale_chain_cache.clear();
 }
 
 void TranslationDomain::remove_translation(const Ref<Translation> &p_translation) {
 	translations.erase(p_translation);
+	locale_chain_cache.clear();
 }
 
 void TranslationDomain::clear() {
 	translations.clear();
+	locale_chain_cache.clear();
 }
 
 StringName TranslationDomain::translate(const StringName &p_message, const StringName &p_context) const {
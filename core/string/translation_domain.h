@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 
 class Translation;
 
@@ -55,6 +56,15 @@ class TranslationDomain : public RefCounted {
 	HashSet<Ref<Translation>> translations;
 	PseudolocalizationConfig pseudolocalization;
 
+	// Per-locale cache of the translations that can serve that locale, sorted
+	// by descending locale match score, so message lookups don't re-score
+	// every loaded translation. Invalidated whenever the translation set
+	// changes; changing the locale of an already added translation requires
+	// re-adding it.
+	mutable HashMap<String, LocalVector<Ref<Translation>>> locale_chain_cache;
+
+	const LocalVector<Ref<Translation>> &_get_locale_chain(const String &p_locale) const;
+
 	String _get_override_string(const String &p_message) const;
 	String _double_vowels(const String &p_message) const;
 	String _replace_with_accented_string(const String &p_message) const;
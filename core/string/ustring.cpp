@@ -41,6 +41,7 @@ STATIC_ASSERT_INCOMPLETE_TYPE(class, Object);
 #include "core/os/memory.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
+#include "core/string/string_buffer.h"
 #include "core/string/string_name.h"
 #include "core/string/translation_server.h"
 #include "core/string/ucaps.h"
@@ -5377,7 +5378,20 @@ String String::sprintf(const Span<Variant> &values, bool *error) const {
 	static const String MINUS("-");
 	static const String PLUS("+");
 
-	String formatted;
+	// Format strings without any placeholder don't need to be composed at all.
+	if (!contains_char('%')) {
+		if (!values.is_empty()) {
+			return "not all arguments converted during string formatting";
+		}
+		if (error) {
+			*error = false;
+		}
+		return *this;
+	}
+
+	// Short formatted strings (the common case for logging/UI text) are composed
+	// entirely in the StringBuffer's stack storage and allocated only once at the end.
+	StringBuffer<> formatted;
 	char32_t *self = (char32_t *)get_data();
 	bool in_format = false;
 	uint64_t value_index = 0;
@@ -5733,8 +5747,15 @@ String String::sprintf(const Span<Variant> &values, bool *error) const {
 					show_sign = false;
 					in_decimals = false;
 					break;
-				default:
-					formatted += c;
+				default: {
+					// Copy the whole literal run up to the next placeholder in one go
+					// instead of dispatching per character.
+					const char32_t *run_begin = self;
+					while (self[1] && self[1] != '%') {
+						self++;
+					}
+					formatted.append(run_begin, self - run_begin + 1);
+				}
 			}
 		}
 	}
@@ -5750,7 +5771,7 @@ String String::sprintf(const Span<Variant> &values, bool *error) const {
 	if (error) {
 		*error = false;
 	}
-	return formatted;
+	return formatted.as_string();
 }
 
 String String::quote(const String &quotechar) const {
@@ -30,6 +30,8 @@
 
 #include "command_queue_mt.h"
 
+thread_local CommandQueueMT::BatchBuffer CommandQueueMT::batch_buffer;
+
 CommandQueueMT::CommandQueueMT() {
 	command_mem.reserve(DEFAULT_COMMAND_MEM_SIZE_KB * 1024);
 }
@@ -115,22 +115,64 @@ class CommandQueueMT {
 	uint64_t flush_read_ptr = 0;
 	std::atomic<bool> pending{ false };
 
+	// Per-thread staging buffer for batched submission. Commands staged here
+	// use the same layout as command_mem and are appended to it in one go.
+	struct BatchBuffer {
+		CommandQueueMT *owner = nullptr;
+		LocalVector<uint8_t> mem;
+	};
+	static thread_local BatchBuffer batch_buffer;
+
 	template <typename T, typename... Args>
-	_FORCE_INLINE_ void create_command(Args &&...p_args) {
+	_FORCE_INLINE_ void create_command_in(LocalVector<uint8_t> &p_mem, Args &&...p_args) {
 		// alloc size is size+T+safeguard
 		constexpr uint64_t alloc_size = ((sizeof(T) + 8U - 1U) & ~(8U - 1U));
 		static_assert(alloc_size < UINT32_MAX, "Type too large to fit in the command queue.");
 
-		uint64_t size = command_mem.size();
-		command_mem.resize(size + alloc_size + sizeof(uint64_t));
-		*(uint64_t *)&command_mem[size] = alloc_size;
-		void *cmd = &command_mem[size + sizeof(uint64_t)];
+		uint64_t size = p_mem.size();
+		p_mem.resize(size + alloc_size + sizeof(uint64_t));
+		*(uint64_t *)&p_mem[size] = alloc_size;
+		void *cmd = &p_mem[size + sizeof(uint64_t)];
 		new (cmd) T(std::forward<Args>(p_args)...);
+	}
+
+	template <typename T, typename... Args>
+	_FORCE_INLINE_ void create_command(Args &&...p_args) {
+		create_command_in<T>(command_mem, std::forward<Args>(p_args)...);
 		pending.store(true);
 	}
 
+	void _flush_batch() {
+		LocalVector<uint8_t> &mem = batch_buffer.mem;
+		if (mem.size()) {
+			MutexLock mlock(mutex);
+			// Commands are trivially relocatable (the queue already moves them
+			// around when command_mem reallocates), so a byte copy transfers
+			// ownership from the staging buffer.
+			uint64_t size = command_mem.size();
+			command_mem.resize(size + mem.size());
+			memcpy(&command_mem[size], mem.ptr(), mem.size());
+			pending.store(true);
+
+			if (pump_task_id != WorkerThreadPool::INVALID_TASK_ID) {
+				WorkerThreadPool::get_singleton()->notify_yield_over(pump_task_id);
+			}
+		}
+		mem.clear();
+	}
+
 	template <typename T, bool NeedsSync, typename... Args>
 	_FORCE_INLINE_ void _push_internal(Args &&...args) {
+		if (unlikely(batch_buffer.owner == this)) {
+			if constexpr (NeedsSync) {
+				// Hand over what was staged so far to preserve ordering.
+				_flush_batch();
+			} else {
+				create_command_in<T>(batch_buffer.mem, std::forward<Args>(args)...);
+				return;
+			}
+		}
+
 		MutexLock mlock(mutex);
 		create_command<T>(std::forward<Args>(args)...);
 
@@ -227,6 +269,21 @@ public:
 		_push_internal<CommandType, true>(p_instance, p_method, r_ret, std::forward<Args>(p_args)...);
 	}
 
+	// Between begin_batch() and end_batch(), plain push()es from the calling
+	// thread are staged locally and handed to the consumer with a single
+	// lock/notify instead of one per command. Sync pushes flush the staged
+	// commands first, so ordering is preserved.
+	void begin_batch() {
+		ERR_FAIL_COND_MSG(batch_buffer.owner != nullptr, "Already batching commands on this thread.");
+		batch_buffer.owner = this;
+	}
+
+	void end_batch() {
+		ERR_FAIL_COND_MSG(batch_buffer.owner != this, "Not batching commands for this queue on this thread.");
+		_flush_batch();
+		batch_buffer.owner = nullptr;
+	}
+
 	_FORCE_INLINE_ void flush_if_pending() {
 		if (unlikely(pending.load())) {
 			_flush();
@@ -83,10 +83,12 @@ public:
 	}
 
 	void free(T *p_mem) {
+		// Destruct outside the lock; the slot only becomes reusable for other
+		// threads once it is returned to the pool below.
+		p_mem->~T();
 		if constexpr (thread_safe) {
 			spin_lock.lock();
 		}
-		p_mem->~T();
 		available_pool[allocs_available >> page_shift][allocs_available & page_mask] = p_mem;
 		allocs_available++;
 		if constexpr (thread_safe) {
@@ -94,6 +96,24 @@ public:
 		}
 	}
 
+	// Return a batch of elements with a single lock acquisition, for systems
+	// that release many elements at once (per-frame or per-step teardown).
+	void free_batch(T *const *p_elems, uint32_t p_count) {
+		for (uint32_t i = 0; i < p_count; i++) {
+			p_elems[i]->~T();
+		}
+		if constexpr (thread_safe) {
+			spin_lock.lock();
+		}
+		for (uint32_t i = 0; i < p_count; i++) {
+			available_pool[allocs_available >> page_shift][allocs_available & page_mask] = p_elems[i];
+			allocs_available++;
+		}
+		if constexpr (thread_safe) {
+			spin_lock.unlock();
+		}
+	}
+
 	template <typename... Args>
 	T *new_allocation(Args &&...p_args) { return alloc(p_args...); }
 	void delete_allocation(T *p_mem) { free(p_mem); }
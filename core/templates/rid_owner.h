@@ -116,21 +116,15 @@ class RID_Alloc : public RID_AllocBase {
 
 	mutable Mutex mutex;
 
-	_FORCE_INLINE_ RID _allocate_rid() {
-		if constexpr (THREAD_SAFE) {
-			mutex.lock();
-		}
-
+	// Must be called with the mutex held in thread-safe mode. Returns a null
+	// RID when the element limit is reached; the caller reports the error
+	// after unlocking.
+	_FORCE_INLINE_ RID _allocate_rid_unlocked() {
 		if (alloc_count == max_alloc) {
 			//allocate a new chunk
 			uint32_t chunk_count = alloc_count == 0 ? 0 : (max_alloc / elements_in_chunk);
 			if (THREAD_SAFE && chunk_count == chunk_limit) {
-				mutex.unlock();
-				if (description != nullptr) {
-					ERR_FAIL_V_MSG(RID(), vformat("Element limit for RID of type '%s' reached.", String(description)));
-				} else {
-					ERR_FAIL_V_MSG(RID(), "Element limit reached.");
-				}
+				return RID();
 			}
 
 			//grow chunks
@@ -174,11 +168,29 @@ class RID_Alloc : public RID_AllocBase {
 
 		alloc_count++;
 
+		return _make_from_id(id);
+	}
+
+	_FORCE_INLINE_ RID _allocate_rid() {
+		if constexpr (THREAD_SAFE) {
+			mutex.lock();
+		}
+
+		RID rid = _allocate_rid_unlocked();
+
 		if constexpr (THREAD_SAFE) {
 			mutex.unlock();
 		}
 
-		return _make_from_id(id);
+		if (unlikely(rid == RID())) {
+			if (description != nullptr) {
+				ERR_FAIL_V_MSG(RID(), vformat("Element limit for RID of type '%s' reached.", String(description)));
+			} else {
+				ERR_FAIL_V_MSG(RID(), "Element limit reached.");
+			}
+		}
+
+		return rid;
 	}
 
 public:
@@ -198,6 +210,38 @@ public:
 		return _allocate_rid();
 	}
 
+	// Batch variant of allocate_rid(), taking the allocator lock only once.
+	// Returns the number of RIDs actually allocated, which is less than
+	// p_count only if the element limit is reached.
+	uint32_t allocate_rids(uint32_t p_count, RID *r_rids) {
+		if constexpr (THREAD_SAFE) {
+			mutex.lock();
+		}
+
+		uint32_t allocated = 0;
+		while (allocated < p_count) {
+			RID rid = _allocate_rid_unlocked();
+			if (unlikely(rid == RID())) {
+				break;
+			}
+			r_rids[allocated++] = rid;
+		}
+
+		if constexpr (THREAD_SAFE) {
+			mutex.unlock();
+		}
+
+		if (unlikely(allocated != p_count)) {
+			if (description != nullptr) {
+				ERR_FAIL_V_MSG(allocated, vformat("Element limit for RID of type '%s' reached.", String(description)));
+			} else {
+				ERR_FAIL_V_MSG(allocated, "Element limit reached.");
+			}
+		}
+
+		return allocated;
+	}
+
 	_FORCE_INLINE_ T *get_or_null(const RID &p_rid, bool p_initialize = false) {
 		if (p_rid == RID()) {
 			return nullptr;
@@ -504,6 +548,10 @@ public:
 		return alloc.allocate_rid();
 	}
 
+	_FORCE_INLINE_ uint32_t allocate_rids(uint32_t p_count, RID *r_rids) {
+		return alloc.allocate_rids(p_count, r_rids);
+	}
+
 	_FORCE_INLINE_ void initialize_rid(RID p_rid, T *p_ptr) {
 		alloc.initialize_rid(p_rid, p_ptr);
 	}
@@ -566,6 +614,10 @@ public:
 		return alloc.allocate_rid();
 	}
 
+	_FORCE_INLINE_ uint32_t allocate_rids(uint32_t p_count, RID *r_rids) {
+		return alloc.allocate_rids(p_count, r_rids);
+	}
+
 	_FORCE_INLINE_ void initialize_rid(RID p_rid) {
 		alloc.initialize_rid(p_rid);
 	}
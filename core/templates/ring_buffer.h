@@ -128,6 +128,18 @@ public:
 		return -1;
 	}
 
+	// Direct pointer to the next unread element. Only the next
+	// contiguous_data_left() elements are readable through it; the pointer is
+	// invalidated by writes once the reader advances past them.
+	inline const T *read_ptr() const {
+		return data.ptr() + read_pos;
+	}
+
+	// Amount of pending data readable through read_ptr() without wrapping.
+	inline int contiguous_data_left() const {
+		return MIN(data_left(), size() - read_pos);
+	}
+
 	inline int advance_read(int p_n) {
 		p_n = MIN(p_n, data_left());
 		inc(read_pos, p_n);
@@ -236,13 +236,22 @@ public:
 
 		ERR_FAIL_COND_V(begin > end, result);
 
+		if (begin == 0 && end == s) {
+			// Whole-range slice; share the COW allocation instead of copying.
+			return *this;
+		}
+
 		Size result_size = end - begin;
 		result.resize(result_size);
 
 		const T *const r = ptr();
 		T *const w = result.ptrw();
-		for (Size i = 0; i < result_size; ++i) {
-			w[i] = r[begin + i];
+		if constexpr (std::is_trivially_copyable_v<T>) {
+			memcpy((void *)w, r + begin, result_size * sizeof(T));
+		} else {
+			for (Size i = 0; i < result_size; ++i) {
+				w[i] = r[begin + i];
+			}
 		}
 
 		return result;
@@ -40,6 +40,10 @@ void Callable::call_deferredp(const Variant **p_arguments, int p_argcount) const
 	MessageQueue::get_singleton()->push_callablep(*this, p_arguments, p_argcount, true);
 }
 
+void Callable::call_deferredp(Variant *p_arguments, int p_argcount) const {
+	MessageQueue::get_singleton()->push_callablep(*this, p_arguments, p_argcount, true);
+}
+
 void Callable::callp(const Variant **p_arguments, int p_argcount, Variant &r_return_value, CallError &r_call_error) const {
 	if (is_null()) {
 		r_call_error.error = CallError::CALL_ERROR_INSTANCE_IS_NULL;
@@ -122,13 +126,27 @@ Error Callable::rpcp(int p_id, const Variant **p_arguments, int p_argcount, Call
 	}
 }
 
+// Collapses bind() chains into a single custom callable, so invocations pay
+// one call hop regardless of how many times the callable was bound. The new
+// binds go first, as they sit between the call arguments and the older binds.
+static Callable _make_bind(const Callable &p_callable, Vector<Variant> &p_binds) {
+	if (p_callable.is_custom()) {
+		CallableCustomBind *ccb = dynamic_cast<CallableCustomBind *>(p_callable.get_custom());
+		if (ccb) {
+			p_binds.append_array(ccb->get_binds());
+			return Callable(memnew(CallableCustomBind(ccb->get_callable(), p_binds)));
+		}
+	}
+	return Callable(memnew(CallableCustomBind(p_callable, p_binds)));
+}
+
 Callable Callable::bindp(const Variant **p_arguments, int p_argcount) const {
 	Vector<Variant> args;
 	args.resize(p_argcount);
 	for (int i = 0; i < p_argcount; i++) {
 		args.write[i] = *p_arguments[i];
 	}
-	return Callable(memnew(CallableCustomBind(*this, args)));
+	return _make_bind(*this, args);
 }
 
 Callable Callable::bindv(const Array &p_arguments) {
@@ -141,11 +159,19 @@ Callable Callable::bindv(const Array &p_arguments) {
 	for (int i = 0; i < p_arguments.size(); i++) {
 		args.write[i] = p_arguments[i];
 	}
-	return Callable(memnew(CallableCustomBind(*this, args)));
+	return _make_bind(*this, args);
 }
 
 Callable Callable::unbind(int p_argcount) const {
 	ERR_FAIL_COND_V_MSG(p_argcount <= 0, Callable(*this), "Amount of unbind() arguments must be 1 or greater.");
+
+	if (is_custom()) {
+		// Collapse unbind() chains, like bind() does.
+		CallableCustomUnbind *ccu = dynamic_cast<CallableCustomUnbind *>(get_custom());
+		if (ccu) {
+			return Callable(memnew(CallableCustomUnbind(ccu->get_callable(), ccu->get_unbinds() + p_argcount)));
+		}
+	}
 	return Callable(memnew(CallableCustomUnbind(*this, p_argcount)));
 }
 
@@ -72,16 +72,14 @@ public:
 	Variant call(VarArgs... p_args) const;
 	void callp(const Variant **p_arguments, int p_argcount, Variant &r_return_value, CallError &r_call_error) const;
 	void call_deferredp(const Variant **p_arguments, int p_argcount) const;
+	// Same as above, but moves the arguments out of p_arguments instead of copying them.
+	void call_deferredp(Variant *p_arguments, int p_argcount) const;
 	Variant callv(const Array &p_arguments) const;
 
 	template <typename... VarArgs>
 	void call_deferred(VarArgs... p_args) const {
 		Variant args[sizeof...(p_args) + 1] = { p_args..., 0 }; // +1 makes sure zero sized arrays are also supported.
-		const Variant *argptrs[sizeof...(p_args) + 1];
-		for (uint32_t i = 0; i < sizeof...(p_args); i++) {
-			argptrs[i] = &args[i];
-		}
-		return call_deferredp(sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
+		return call_deferredp(args, sizeof...(p_args)); // Moves the arguments into the queue.
 	}
 
 	Error rpcp(int p_id, const Variant **p_arguments, int p_argcount, CallError &r_call_error) const;
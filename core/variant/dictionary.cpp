@@ -51,6 +51,14 @@ struct DictionaryPrivate {
 	ContainerTypeValidate typed_key;
 	ContainerTypeValidate typed_value;
 	Variant *typed_fallback = nullptr; // Allows a typed dictionary to return dummy values when attempting an invalid access.
+
+	// Cursor cache for next(), so that repeated next() calls while iterating cost one
+	// element hop instead of one hash lookup per step. Only trusted while the version
+	// matches; operations that can delete elements bump the version. Like the rest of
+	// Dictionary this is not thread-safe: next() writes the cache even on const access.
+	HashMap<Variant, Variant, HashMapHasherDefault, StringLikeVariantComparator>::Iterator next_iter;
+	uint32_t next_iter_version = UINT32_MAX;
+	uint32_t version = 0;
 };
 
 Dictionary::ConstIterator Dictionary::begin() const {
@@ -253,6 +261,7 @@ bool Dictionary::erase(const Variant &p_key) {
 	Variant key = p_key;
 	ERR_FAIL_COND_V(!_p->typed_key.validate(key, "erase"), false);
 	ERR_FAIL_COND_V_MSG(_p->read_only, false, "Dictionary is in read-only state.");
+	_p->version++;
 	return _p->variant_map.erase(key);
 }
 
@@ -313,6 +322,7 @@ void Dictionary::reserve(int p_new_capacity) {
 
 void Dictionary::clear() {
 	ERR_FAIL_COND_MSG(_p->read_only, "Dictionary is in read-only state.");
+	_p->version++;
 	_p->variant_map.clear();
 }
 
@@ -439,6 +449,7 @@ void Dictionary::assign(const Dictionary &p_dictionary) {
 		// From same to same or,
 		// from anything to variants or,
 		// from subclasses to base classes.
+		_p->version++;
 		_p->variant_map = p_dictionary._p->variant_map;
 		return;
 	}
@@ -564,6 +575,7 @@ void Dictionary::assign(const Dictionary &p_dictionary) {
 		variant_map.insert(key_data[i], value_data[i]);
 	}
 
+	_p->version++;
 	_p->variant_map = variant_map;
 }
 
@@ -571,13 +583,22 @@ const Variant *Dictionary::next(const Variant *p_key) const {
 	if (p_key == nullptr) {
 		// caller wants to get the first element
 		if (_p->variant_map.begin()) {
-			return &_p->variant_map.begin()->key;
+			_p->next_iter = _p->variant_map.begin();
+			_p->next_iter_version = _p->version;
+			return &_p->next_iter->key;
 		}
 		return nullptr;
 	}
 	Variant key = *p_key;
 	ERR_FAIL_COND_V(!_p->typed_key.validate(key, "next"), nullptr);
-	HashMap<Variant, Variant, HashMapHasherDefault, StringLikeVariantComparator>::Iterator E = _p->variant_map.find(key);
+
+	HashMap<Variant, Variant, HashMapHasherDefault, StringLikeVariantComparator>::Iterator E;
+	if (_p->next_iter_version == _p->version && _p->next_iter && StringLikeVariantComparator::compare(_p->next_iter->key, key)) {
+		// Continuing the iteration that produced the cached cursor; skip the hash lookup.
+		E = _p->next_iter;
+	} else {
+		E = _p->variant_map.find(key);
+	}
 
 	if (!E) {
 		return nullptr;
@@ -586,6 +607,8 @@ const Variant *Dictionary::next(const Variant *p_key) const {
 	++E;
 
 	if (E) {
+		_p->next_iter = E;
+		_p->next_iter_version = _p->version;
 		return &E->key;
 	}
 
@@ -1074,6 +1074,89 @@ void Variant::_register_variant_operators() {
 void Variant::_unregister_variant_operators() {
 }
 
+// Resolves the same-type pairs that dominate dynamic arithmetic inline instead of
+// going through the function pointer table. These are the same evaluator classes the
+// table is registered with, so the results are identical; everything else falls
+// through to the table. Returns false if the pair is not handled here.
+static _FORCE_INLINE_ bool _evaluate_hot_pair(Variant::Operator p_op, const Variant &p_a, const Variant &p_b, Variant *r_ret, bool &r_valid) {
+	switch (p_a.get_type()) {
+		case Variant::INT: {
+			switch (p_op) {
+				case Variant::OP_ADD:
+					OperatorEvaluatorAdd<int64_t, int64_t, int64_t>::evaluate(p_a, p_b, r_ret, r_valid);
+					return true;
+				case Variant::OP_SUBTRACT:
+					OperatorEvaluatorSub<int64_t, int64_t, int64_t>::evaluate(p_a, p_b, r_ret, r_valid);
+					return true;
+				case Variant::OP_MULTIPLY:
+					OperatorEvaluatorMul<int64_t, int64_t, int64_t>::evaluate(p_a, p_b, r_ret, r_valid);
+					return true;
+				case Variant::OP_EQUAL:
+					OperatorEvaluatorEqual<int64_t, int64_t>::evaluate(p_a, p_b, r_ret, r_valid);
+					return true;
+				case Variant::OP_LESS:
+					OperatorEvaluatorLess<int64_t, int64_t>::evaluate(p_a, p_b, r_ret, r_valid);
+					return true;
+				default:
+					return false;
+			}
+		}
+		case Variant::FLOAT: {
+			switch (p_op) {
+				case Variant::OP_ADD:
+					OperatorEvaluatorAdd<double, double, double>::evaluate(p_a, p_b, r_ret, r_valid);
+					return true;
+				case Variant::OP_SUBTRACT:
+					OperatorEvaluatorSub<double, double, double>::evaluate(p_a, p_b, r_ret, r_valid);
+					return true;
+				case Variant::OP_MULTIPLY:
+					OperatorEvaluatorMul<double, double, double>::evaluate(p_a, p_b, r_ret, r_valid);
+					return true;
+				case Variant::OP_EQUAL:
+					OperatorEvaluatorEqual<double, double>::evaluate(p_a, p_b, r_ret, r_valid);
+					return true;
+				case Variant::OP_LESS:
+					OperatorEvaluatorLess<double, double>::evaluate(p_a, p_b, r_ret, r_valid);
+					return true;
+				default:
+					return false;
+			}
+		}
+		case Variant::VECTOR2: {
+			switch (p_op) {
+				case Variant::OP_ADD:
+					OperatorEvaluatorAdd<Vector2, Vector2, Vector2>::evaluate(p_a, p_b, r_ret, r_valid);
+					return true;
+				case Variant::OP_SUBTRACT:
+					OperatorEvaluatorSub<Vector2, Vector2, Vector2>::evaluate(p_a, p_b, r_ret, r_valid);
+					return true;
+				case Variant::OP_MULTIPLY:
+					OperatorEvaluatorMul<Vector2, Vector2, Vector2>::evaluate(p_a, p_b, r_ret, r_valid);
+					return true;
+				default:
+					return false;
+			}
+		}
+		case Variant::VECTOR3: {
+			switch (p_op) {
+				case Variant::OP_ADD:
+					OperatorEvaluatorAdd<Vector3, Vector3, Vector3>::evaluate(p_a, p_b, r_ret, r_valid);
+					return true;
+				case Variant::OP_SUBTRACT:
+					OperatorEvaluatorSub<Vector3, Vector3, Vector3>::evaluate(p_a, p_b, r_ret, r_valid);
+					return true;
+				case Variant::OP_MULTIPLY:
+					OperatorEvaluatorMul<Vector3, Vector3, Vector3>::evaluate(p_a, p_b, r_ret, r_valid);
+					return true;
+				default:
+					return false;
+			}
+		}
+		default:
+			return false;
+	}
+}
+
 void Variant::evaluate(const Operator &p_op, const Variant &p_a,
 		const Variant &p_b, Variant &r_ret, bool &r_valid) {
 	ERR_FAIL_INDEX(p_op, Variant::OP_MAX);
@@ -1082,6 +1165,10 @@ void Variant::evaluate(const Operator &p_op, const Variant &p_a,
 	ERR_FAIL_INDEX(type_a, Variant::VARIANT_MAX);
 	ERR_FAIL_INDEX(type_b, Variant::VARIANT_MAX);
 
+	if (type_a == type_b && _evaluate_hot_pair(p_op, p_a, p_b, &r_ret, r_valid)) {
+		return;
+	}
+
 	VariantEvaluatorFunction ev = operator_evaluator_table[p_op][type_a][type_b];
 	if (unlikely(!ev)) {
 		r_valid = false;
@@ -62,6 +62,23 @@ bool VariantParser::Stream::is_eof() const {
 	return _is_eof();
 }
 
+uint32_t VariantParser::Stream::get_string_run(const char32_t *&r_run) {
+	// Bulk path for string literals: hands out and consumes the buffered run up
+	// to the next character the tokenizer has to look at individually. Unlike
+	// get_char(), this never refills the buffer; callers keep their per-character
+	// fallback for the terminator, escapes and buffer refills.
+	uint32_t start = readahead_pointer;
+	while (readahead_pointer < readahead_filled) {
+		char32_t c = readahead_buffer[readahead_pointer];
+		if (c == '"' || c == '\\' || c == '\n' || c == 0) {
+			break;
+		}
+		readahead_pointer++;
+	}
+	r_run = readahead_buffer + start;
+	return readahead_pointer - start;
+}
+
 bool VariantParser::StreamFile::is_utf8() const {
 	return true;
 }
@@ -274,9 +291,18 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 				[[fallthrough]];
 			}
 			case '"': {
-				String str;
+				StringBuffer<> string_buffer;
 				char32_t prev = 0;
 				while (true) {
+					if (prev == 0) {
+						// Consume plain characters in bulk; only terminators,
+						// escapes and refills drop to the per-character path.
+						const char32_t *run = nullptr;
+						uint32_t run_len = p_stream->get_string_run(run);
+						if (run_len > 0) {
+							string_buffer.append(run, run_len);
+						}
+					}
 					char32_t ch = p_stream->get_char();
 
 					if (ch == 0) {
@@ -377,7 +403,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 							r_token.type = TK_ERROR;
 							return ERR_PARSE_ERROR;
 						}
-						str += res;
+						string_buffer += res;
 					} else {
 						if (prev != 0) {
 							r_err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
@@ -387,7 +413,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 						if (ch == '\n') {
 							line++;
 						}
-						str += ch;
+						string_buffer += ch;
 					}
 				}
 				if (prev != 0) {
@@ -396,6 +422,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 					return ERR_PARSE_ERROR;
 				}
 
+				String str = string_buffer.as_string();
 				if (p_stream->is_utf8()) {
 					// Re-interpret the string we built as ascii.
 					CharString string_as_ascii = str.ascii(true);
@@ -53,6 +53,7 @@ public:
 		char32_t saved = 0;
 
 		char32_t get_char();
+		uint32_t get_string_run(const char32_t *&r_run);
 		virtual bool is_utf8() const = 0;
 		bool is_eof() const;
 
@@ -187,7 +187,9 @@ Error AudioDriverALSA::init() {
 
 	Error err = init_output_device();
 	if (err == OK) {
-		thread.start(AudioDriverALSA::thread_func, this);
+		Thread::Settings settings;
+		settings.priority = get_thread_priority();
+		thread.start(AudioDriverALSA::thread_func, this, settings);
 	}
 
 	return err;
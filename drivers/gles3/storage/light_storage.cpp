@@ -443,6 +443,13 @@ void LightStorage::light_instance_mark_visible(RID p_light_instance) {
 	light_instance->last_scene_pass = RasterizerSceneGLES3::get_singleton()->get_scene_pass();
 }
 
+void LightStorage::light_instance_mark_shadow_stale(RID p_light_instance) {
+	LightInstance *light_instance = light_instance_owner.get_or_null(p_light_instance);
+	ERR_FAIL_NULL(light_instance);
+
+	light_instance->shadow_cache_stale = true;
+}
+
 /* PROBE API */
 
 RID LightStorage::reflection_probe_allocate() {
@@ -1453,6 +1460,7 @@ bool LightStorage::shadow_atlas_update_light(RID p_atlas, RID p_light_instance,
 
 		if (!should_realloc) {
 			shadow_atlas->quadrants[old_quadrant].shadows.write[old_shadow].version = p_light_version;
+			li->shadow_cache_stale = false; // Either redrawn this pass or already valid.
 			// Already existing, see if it should redraw or it's just OK.
 			return should_redraw;
 		}
@@ -1487,6 +1495,7 @@ bool LightStorage::shadow_atlas_update_light(RID p_atlas, RID p_light_instance,
 		sh->version = p_light_version;
 
 		li->shadow_atlases.insert(p_atlas);
+		li->shadow_cache_stale = false; // The new slot gets rendered this pass.
 
 		// Update it in map.
 		shadow_atlas->shadow_owners[p_light_instance] = new_key;
@@ -1579,6 +1588,7 @@ bool LightStorage::_shadow_atlas_find_shadow(ShadowAtlas *shadow_atlas, int *p_i
 
 		int found_used_idx = -1; // Found existing one, must steal it.
 		uint64_t min_pass = 0; // Pass of the existing one, try to use the least recently used one (LRU fashion).
+		bool min_stale = false; // Whether the current victim's cached shadow is stale anyway.
 
 		for (int j = 0; j < sc; j++) {
 			if (sarr[j].owner_is_omni != is_omni) {
@@ -1599,9 +1609,12 @@ bool LightStorage::_shadow_atlas_find_shadow(ShadowAtlas *shadow_atlas, int *p_i
 					continue;
 				}
 
-				if (found_used_idx == -1 || sli->last_scene_pass < min_pass) {
+				// Prefer stealing slots whose cached shadow is stale, as those need a full
+				// re-render anyway, so evicting them loses nothing. Break ties by LRU.
+				if (found_used_idx == -1 || (sli->shadow_cache_stale && !min_stale) || (sli->shadow_cache_stale == min_stale && sli->last_scene_pass < min_pass)) {
 					found_used_idx = j;
 					min_pass = sli->last_scene_pass;
+					min_stale = sli->shadow_cache_stale;
 				}
 			}
 		}
@@ -99,6 +99,8 @@ struct LightInstance {
 	uint32_t cull_mask = 0;
 	uint32_t light_directional_index = 0;
 
+	bool shadow_cache_stale = false; // The cached shadow will be re-rendered before it is sampled again.
+
 	Rect2 directional_rect;
 
 	HashSet<RID> shadow_atlases; // Shadow atlases where this light is registered.
@@ -441,6 +443,7 @@ public:
 	virtual void light_instance_set_aabb(RID p_light_instance, const AABB &p_aabb) override;
 	virtual void light_instance_set_shadow_transform(RID p_light_instance, const Projection &p_projection, const Transform3D &p_transform, float p_far, float p_split, int p_pass, float p_shadow_texel_size, float p_bias_scale = 1.0, float p_range_begin = 0, const Vector2 &p_uv_scale = Vector2()) override;
 	virtual void light_instance_mark_visible(RID p_light_instance) override;
+	virtual void light_instance_mark_shadow_stale(RID p_light_instance) override;
 
 	virtual bool light_instance_is_shadow_visible_at_position(RID p_light_instance, const Vector3 &p_position) const override {
 		const LightInstance *light_instance = light_instance_owner.get_or_null(p_light_instance);
@@ -173,6 +173,7 @@ public:
 
 	virtual void visibility_notifier_set_aabb(RID p_notifier, const AABB &p_aabb) override;
 	virtual void visibility_notifier_set_callbacks(RID p_notifier, const Callable &p_enter_callbable, const Callable &p_exit_callable) override;
+	virtual Callable visibility_notifier_get_callback(RID p_notifier, bool p_enter) const override;
 
 	virtual AABB visibility_notifier_get_aabb(RID p_notifier) const override;
 	virtual void visibility_notifier_call(RID p_notifier, bool p_enter, bool p_deferred) override;
@@ -363,7 +363,9 @@ Error AudioDriverPulseAudio::init() {
 	}
 
 	init_output_device();
-	thread.start(AudioDriverPulseAudio::thread_func, this);
+	Thread::Settings settings;
+	settings.priority = get_thread_priority();
+	thread.start(AudioDriverPulseAudio::thread_func, this, settings);
 
 	return OK;
 }
@@ -44,6 +44,13 @@ void init_thread_posix() {
 #include <pthread_np.h>
 #endif
 
+#include <pthread.h>
+#include <sched.h>
+#ifdef __linux__
+#include <cerrno>
+#include <sys/resource.h>
+#endif
+
 static Error set_name(const String &p_name) {
 #ifdef PTHREAD_NO_RENAME
 	return ERR_UNAVAILABLE;
@@ -74,8 +81,92 @@ static Error set_name(const String &p_name) {
 #endif // PTHREAD_NO_RENAME
 }
 
+static Error set_affinity(uint64_t p_mask) {
+#ifdef __linux__
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	for (uint32_t i = 0; i < 64; i++) {
+		if (p_mask & (uint64_t(1) << i)) {
+			CPU_SET(i, &cpu_set);
+		}
+	}
+	int err = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+	return err == 0 ? OK : ERR_INVALID_PARAMETER;
+#else
+	// Other BSDs have incompatible cpuset APIs; not worth supporting for now.
+	return ERR_UNAVAILABLE;
+#endif
+}
+
+static Error set_priority(Thread::Priority p_priority) {
+#ifdef __linux__
+	// On Linux, SCHED_OTHER ignores sched_priority; per-thread nice values are
+	// the effective knob. setpriority() with a zero `who` targets the calling
+	// thread. Raising priority (negative nice) may fail without the
+	// CAP_SYS_NICE capability or a matching RLIMIT_NICE; treat that as
+	// unavailable rather than an error.
+	int nice_value = 0;
+	switch (p_priority) {
+		case Thread::PRIORITY_LOW: {
+			nice_value = 10;
+		} break;
+		case Thread::PRIORITY_NORMAL: {
+			nice_value = 0;
+		} break;
+		case Thread::PRIORITY_HIGH: {
+			nice_value = -10;
+		} break;
+		case Thread::PRIORITY_TIME_CRITICAL: {
+			// Try real-time round-robin scheduling first; it needs privileges,
+			// so fall back to the lowest nice value when refused.
+			sched_param param = {};
+			param.sched_priority = sched_get_priority_min(SCHED_RR);
+			if (pthread_setschedparam(pthread_self(), SCHED_RR, &param) == 0) {
+				return OK;
+			}
+			nice_value = -15;
+		} break;
+	}
+	errno = 0;
+	if (setpriority(PRIO_PROCESS, 0, nice_value) != 0 && errno != 0) {
+		return nice_value < 0 ? ERR_UNAVAILABLE : ERR_INVALID_PARAMETER;
+	}
+	return OK;
+#else
+	// Map onto the SCHED_OTHER priority range where the platform has one
+	// (e.g. macOS); time-critical additionally tries real-time round-robin.
+	if (p_priority == Thread::PRIORITY_TIME_CRITICAL) {
+		sched_param rt_param = {};
+		rt_param.sched_priority = sched_get_priority_min(SCHED_RR);
+		if (pthread_setschedparam(pthread_self(), SCHED_RR, &rt_param) == 0) {
+			return OK;
+		}
+	}
+	int prio_min = sched_get_priority_min(SCHED_OTHER);
+	int prio_max = sched_get_priority_max(SCHED_OTHER);
+	if (prio_min == prio_max) {
+		return ERR_UNAVAILABLE;
+	}
+	sched_param param = {};
+	switch (p_priority) {
+		case Thread::PRIORITY_LOW: {
+			param.sched_priority = prio_min;
+		} break;
+		case Thread::PRIORITY_NORMAL: {
+			param.sched_priority = prio_min + (prio_max - prio_min) / 2;
+		} break;
+		case Thread::PRIORITY_HIGH:
+		case Thread::PRIORITY_TIME_CRITICAL: {
+			param.sched_priority = prio_max;
+		} break;
+	}
+	int err = pthread_setschedparam(pthread_self(), SCHED_OTHER, &param);
+	return err == 0 ? OK : ERR_UNAVAILABLE;
+#endif
+}
+
 void init_thread_posix() {
-	Thread::_set_platform_functions({ .set_name = set_name });
+	Thread::_set_platform_functions({ .set_name = set_name, .set_affinity = set_affinity, .set_priority = set_priority });
 }
 
 #endif // PLATFORM_THREAD_OVERRIDE && __APPLE__
@@ -595,7 +595,9 @@ Error AudioDriverWASAPI::init() {
 	Error err = init_output_device();
 	ERR_FAIL_COND_V_MSG(err != OK, err, "WASAPI: init_output_device error.");
 
-	thread.start(thread_func, this);
+	Thread::Settings settings;
+	settings.priority = get_thread_priority();
+	thread.start(thread_func, this, settings);
 
 	return OK;
 }
@@ -50,10 +50,33 @@ static Error set_name(const String &p_name) {
 	return SUCCEEDED(res) ? OK : ERR_INVALID_PARAMETER;
 }
 
+static Error set_affinity(uint64_t p_mask) {
+	return SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)p_mask) != 0 ? OK : ERR_INVALID_PARAMETER;
+}
+
+static Error set_priority(Thread::Priority p_priority) {
+	int priority = THREAD_PRIORITY_NORMAL;
+	switch (p_priority) {
+		case Thread::PRIORITY_LOW: {
+			priority = THREAD_PRIORITY_BELOW_NORMAL;
+		} break;
+		case Thread::PRIORITY_NORMAL: {
+			priority = THREAD_PRIORITY_NORMAL;
+		} break;
+		case Thread::PRIORITY_HIGH: {
+			priority = THREAD_PRIORITY_ABOVE_NORMAL;
+		} break;
+		case Thread::PRIORITY_TIME_CRITICAL: {
+			priority = THREAD_PRIORITY_TIME_CRITICAL;
+		} break;
+	}
+	return SetThreadPriority(GetCurrentThread(), priority) != 0 ? OK : ERR_INVALID_PARAMETER;
+}
+
 void init_thread_win() {
 	w10_SetThreadDescription = (SetThreadDescriptionPtr)(void *)GetProcAddress(LoadLibraryW(L"kernel32.dll"), "SetThreadDescription");
 
-	Thread::_set_platform_functions({ set_name });
+	Thread::_set_platform_functions({ set_name, set_affinity, set_priority });
 }
 
 #endif // WINDOWS_ENABLED
@@ -74,7 +74,9 @@ Error AudioDriverXAudio2::init() {
 	hr = xaudio->CreateSourceVoice(&source_voice, &wave_format, 0, XAUDIO2_MAX_FREQ_RATIO, &voice_callback);
 	ERR_FAIL_COND_V_MSG(hr != S_OK, ERR_UNAVAILABLE, "Error creating XAudio2 source voice. Error code: " + itos(hr) + ".");
 
-	thread.start(AudioDriverXAudio2::thread_func, this);
+	Thread::Settings settings;
+	settings.priority = get_thread_priority();
+	thread.start(AudioDriverXAudio2::thread_func, this, settings);
 
 	return OK;
 }
@@ -245,7 +245,7 @@ void EditorFileSystem::_load_first_scan_root_dir() {
 	first_scan_root_dir = memnew(ScannedDirectory);
 	first_scan_root_dir->full_path = "res://";
 
-	nb_files_total = _scan_new_dir(first_scan_root_dir, d);
+	nb_files_total = _scan_new_dir_threaded(first_scan_root_dir, d);
 }
 
 void EditorFileSystem::scan_for_uid() {
@@ -510,7 +510,7 @@ void EditorFileSystem::_scan_filesystem() {
 		Ref<DirAccess> d = DirAccess::create(DirAccess::ACCESS_RESOURCES);
 		sd = memnew(ScannedDirectory);
 		sd->full_path = "res://";
-		nb_files_total = _scan_new_dir(sd, d);
+		nb_files_total = _scan_new_dir_threaded(sd, d);
 	}
 
 	_process_file_system(sd, new_filesystem, sp, processed_files);
@@ -570,15 +570,40 @@ bool EditorFileSystem::_is_test_for_reimport_needed(const String &p_path, uint64
 	return false;
 }
 
+String EditorFileSystem::_get_import_params_md5(const String &p_import_path) {
+	Ref<FileAccess> f = FileAccess::open(p_import_path, FileAccess::READ);
+	if (f.is_null()) {
+		return String();
+	}
+
+	// Digest only the [params] section, so edits to the rest of the .import
+	// file (uid, metadata, destination paths) don't count as a parameter change.
+	bool in_params = false;
+	String params_text;
+	while (!f->eof_reached()) {
+		String l = f->get_line().strip_edges();
+		if (l.begins_with("[")) {
+			in_params = l == "[params]";
+			continue;
+		}
+		if (in_params && !l.is_empty()) {
+			params_text += l;
+			params_text += "\n";
+		}
+	}
+
+	return params_text.md5_text();
+}
+
 bool EditorFileSystem::_test_for_reimport(const String &p_path, const String &p_expected_import_md5) {
 	if (p_expected_import_md5.is_empty()) {
 		// Marked as reimportation needed.
 		return true;
 	}
-	String new_md5 = FileAccess::get_md5(p_path + ".import");
-	if (p_expected_import_md5 != new_md5) {
-		return true;
-	}
+	// A changed .import file alone doesn't force a reimport; the content checks
+	// below tell whether the effective inputs (source bytes, importer
+	// parameters, destination files) actually differ.
+	const bool import_file_changed = p_expected_import_md5 != FileAccess::get_md5(p_path + ".import");
 
 	Error err;
 	Ref<FileAccess> f = FileAccess::open(p_path + ".import", FileAccess::READ, &err);
@@ -604,6 +629,7 @@ bool EditorFileSystem::_test_for_reimport(const String &p_path, const String &p_
 	String source_md5 = "";
 	Vector<String> dest_files;
 	String dest_md5 = "";
+	String params_md5 = "";
 	int version = 0;
 	bool found_uid = false;
 	Variant meta;
@@ -711,6 +737,8 @@ bool EditorFileSystem::_test_for_reimport(const String &p_path, const String &p_
 				source_md5 = value;
 			} else if (assign == "dest_md5") {
 				dest_md5 = value;
+			} else if (assign == "params_md5") {
+				params_md5 = value;
 			}
 		}
 	}
@@ -736,6 +764,15 @@ bool EditorFileSystem::_test_for_reimport(const String &p_path, const String &p_
 		}
 	}
 
+	if (import_file_changed) {
+		if (params_md5.is_empty()) {
+			return true; // Older import without a parameter digest, reimport to get one.
+		}
+		if (params_md5 != _get_import_params_md5(p_path + ".import")) {
+			return true; // Importer parameters changed.
+		}
+	}
+
 	return false; // Nothing changed.
 }
 
@@ -979,9 +1016,9 @@ bool EditorFileSystem::_update_scan_actions() {
 					// Update modified times, md5 and destination paths, to avoid reimport.
 					ia.dir->files[idx]->modified_time = FileAccess::get_modified_time(full_path);
 					ia.dir->files[idx]->import_modified_time = FileAccess::get_modified_time(full_path + ".import");
-					if (ia.dir->files[idx]->import_md5.is_empty()) {
-						ia.dir->files[idx]->import_md5 = FileAccess::get_md5(full_path + ".import");
-					}
+					// Refresh the cached .import hash, so a metadata-only change
+					// doesn't get content-tested again on every scan.
+					ia.dir->files[idx]->import_md5 = FileAccess::get_md5(full_path + ".import");
 					ia.dir->files[idx]->import_dest_paths = _get_import_dest_paths(full_path);
 				}
 
@@ -1130,7 +1167,7 @@ void EditorFileSystem::ScanProgress::increment() {
 	EditorFileSystem::singleton->scan_total = ratio;
 }
 
-int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da) {
+int EditorFileSystem::_list_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da) {
 	List<String> dirs;
 	List<String> files;
 
@@ -1168,8 +1205,6 @@ int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da)
 	dirs.sort_custom<FileNoCaseComparator>();
 	files.sort_custom<FileNoCaseComparator>();
 
-	int nb_files_total_scan = 0;
-
 	for (const String &dir : dirs) {
 		if (da->change_dir(dir) == OK) {
 			String d = da->get_current_dir();
@@ -1181,8 +1216,6 @@ int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da)
 				sd->name = dir;
 				sd->full_path = p_dir->full_path.path_join(sd->name);
 
-				nb_files_total_scan += _scan_new_dir(sd, da);
-
 				p_dir->subdirs.push_back(sd);
 
 				da->change_dir("..");
@@ -1193,11 +1226,79 @@ int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da)
 	}
 
 	p_dir->files = files;
-	nb_files_total_scan += files.size();
+
+	return files.size();
+}
+
+int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da) {
+	int nb_files_total_scan = _list_new_dir(p_dir, da);
+
+	for (ScannedDirectory *sd : p_dir->subdirs) {
+		if (da->change_dir(sd->name) == OK) {
+			nb_files_total_scan += _scan_new_dir(sd, da);
+			da->change_dir("..");
+		}
+	}
 
 	return nb_files_total_scan;
 }
 
+int EditorFileSystem::_scan_new_dir_threaded(ScannedDirectory *p_dir, Ref<DirAccess> &da) {
+	const uint32_t thread_count = WorkerThreadPool::get_singleton()->get_thread_count();
+	if (thread_count <= 1) {
+		return _scan_new_dir(p_dir, da);
+	}
+
+	// Expand the first levels on the calling thread until there are enough
+	// independent subtrees to keep the worker pool busy, then scan each
+	// remaining subtree as its own task. Subtrees don't overlap, so each task
+	// only touches its own part of the scan tree.
+	int nb_files_total_scan = 0;
+
+	LocalVector<ScannedDirectory *> frontier;
+	frontier.push_back(p_dir);
+	uint32_t expanded = 0;
+	while (expanded < frontier.size() && frontier.size() - expanded < thread_count * 4) {
+		ScannedDirectory *sd = frontier[expanded++];
+		if (da->change_dir(sd->full_path) != OK) {
+			ERR_PRINT("Cannot go into subdir '" + sd->full_path + "'.");
+			continue;
+		}
+		nb_files_total_scan += _list_new_dir(sd, da);
+		for (ScannedDirectory *sub : sd->subdirs) {
+			frontier.push_back(sub);
+		}
+	}
+
+	const uint32_t subtree_count = frontier.size() - expanded;
+	if (subtree_count > 0) {
+		LocalVector<ScanSubtree> subtrees;
+		subtrees.resize(subtree_count);
+		for (uint32_t i = 0; i < subtree_count; i++) {
+			subtrees[i].dir = frontier[expanded + i];
+		}
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&EditorFileSystem::_scan_subtree, subtrees.ptr(), subtree_count, -1, false, SNAME("EditorFileSystemScan"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		for (const ScanSubtree &subtree : subtrees) {
+			nb_files_total_scan += subtree.nb_files;
+		}
+	}
+
+	return nb_files_total_scan;
+}
+
+void EditorFileSystem::_scan_subtree(void *p_subtrees, uint32_t p_index) {
+	ScanSubtree &subtree = ((ScanSubtree *)p_subtrees)[p_index];
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_RESOURCES);
+	if (da->change_dir(subtree.dir->full_path) == OK) {
+		subtree.nb_files = _scan_new_dir(subtree.dir, da);
+	} else {
+		ERR_PRINT("Cannot go into subdir '" + subtree.dir->full_path + "'.");
+	}
+}
+
 void EditorFileSystem::_process_file_system(const ScannedDirectory *p_scan_dir, EditorFileSystemDirectory *p_dir, ScanProgress &p_progress, HashSet<String> *r_processed_files) {
 	p_dir->modified_time = FileAccess::get_modified_time(p_scan_dir->full_path);
 
@@ -1465,7 +1566,7 @@ void EditorFileSystem::_scan_fs_changes(EditorFileSystemDirectory *p_dir, ScanPr
 
 					Ref<DirAccess> d = DirAccess::create(DirAccess::ACCESS_RESOURCES);
 					d->change_dir(dir_path);
-					int nb_files_dir = _scan_new_dir(&sd, d);
+					int nb_files_dir = _scan_new_dir_threaded(&sd, d);
 					p_progress.hi += nb_files_dir;
 					diff_nb_files += nb_files_dir;
 					_process_file_system(&sd, efd, p_progress, nullptr);
@@ -2722,6 +2823,7 @@ Error EditorFileSystem::_reimport_group(const String &p_group_file, const Vector
 			ERR_FAIL_COND_V_MSG(md5s.is_null(), ERR_FILE_CANT_OPEN, "Cannot open MD5 file '" + base_path + ".md5'.");
 
 			md5s->store_line("source_md5=\"" + FileAccess::get_md5(file) + "\"");
+			md5s->store_line("params_md5=\"" + _get_import_params_md5(file + ".import") + "\"");
 			if (dest_paths.size()) {
 				md5s->store_line("dest_md5=\"" + FileAccess::get_multiple_md5(dest_paths) + "\"\n");
 			}
@@ -2995,6 +3097,7 @@ Error EditorFileSystem::_reimport_file(const String &p_file, const HashMap<Strin
 		ERR_FAIL_COND_V_MSG(md5s.is_null(), ERR_FILE_CANT_OPEN, "Cannot open MD5 file '" + base_path + ".md5'.");
 
 		md5s->store_line("source_md5=\"" + FileAccess::get_md5(p_file) + "\"");
+		md5s->store_line("params_md5=\"" + _get_import_params_md5(p_file + ".import") + "\"");
 		if (dest_paths.size()) {
 			md5s->store_line("dest_md5=\"" + FileAccess::get_multiple_md5(dest_paths) + "\"\n");
 		}
@@ -258,7 +258,15 @@ class EditorFileSystem : public Node {
 	HashSet<String> valid_extensions;
 	HashSet<String> import_extensions;
 
+	struct ScanSubtree {
+		ScannedDirectory *dir = nullptr;
+		int nb_files = 0;
+	};
+
+	static int _list_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da);
 	static int _scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da);
+	static int _scan_new_dir_threaded(ScannedDirectory *p_dir, Ref<DirAccess> &da);
+	static void _scan_subtree(void *p_subtrees, uint32_t p_index);
 	void _process_file_system(const ScannedDirectory *p_scan_dir, EditorFileSystemDirectory *p_dir, ScanProgress &p_progress, HashSet<String> *p_processed_files);
 
 	Thread thread_sources;
@@ -278,6 +286,7 @@ class EditorFileSystem : public Node {
 	Error _reimport_group(const String &p_group_file, const Vector<String> &p_files);
 
 	bool _test_for_reimport(const String &p_path, const String &p_expected_import_md5);
+	static String _get_import_params_md5(const String &p_import_path);
 	bool _is_test_for_reimport_needed(const String &p_path, uint64_t p_last_modification_time, uint64_t p_modification_time, uint64_t p_last_import_modification_time, uint64_t p_import_modification_time, const Vector<String> &p_import_dest_paths);
 	bool _can_import_file(const String &p_path);
 	Vector<String> _get_import_dest_paths(const String &p_path);
@@ -132,7 +132,7 @@ void EditorResourcePreview::_thread_func(void *ud) {
 	erp->_thread();
 }
 
-void EditorResourcePreview::_preview_ready(const String &p_path, int p_hash, const Ref<Texture2D> &p_texture, const Ref<Texture2D> &p_small_texture, const Callable &p_callback, const Dictionary &p_metadata) {
+void EditorResourcePreview::_preview_ready(const String &p_path, int p_hash, const Ref<Texture2D> &p_texture, const Ref<Texture2D> &p_small_texture, const LocalVector<Callable> &p_callbacks, const Dictionary &p_metadata) {
 	{
 		MutexLock lock(preview_mutex);
 
@@ -155,7 +155,9 @@ void EditorResourcePreview::_preview_ready(const String &p_path, int p_hash, con
 
 		cache[p_path] = item;
 	}
-	p_callback.call_deferred(p_path, p_texture, p_small_texture);
+	for (const Callable &callback : p_callbacks) {
+		callback.call_deferred(p_path, p_texture, p_small_texture);
+	}
 }
 
 void EditorResourcePreview::_generate_preview(Ref<ImageTexture> &r_texture, Ref<ImageTexture> &r_small_texture, const QueueItem &p_item, const String &cache_base, Dictionary &p_metadata) {
@@ -278,13 +280,16 @@ void EditorResourcePreview::_iterate() {
 		return;
 	}
 
-	QueueItem item = queue.front()->get();
-	queue.pop_front();
+	// Service the most recent request first, as it's the most likely to still
+	// be on screen.
+	QueueItem item = queue.back()->get();
+	queue.pop_back();
+	queued_items.erase(item.path);
 
 	if (cache.has(item.path)) {
 		Item cached_item = cache[item.path];
 		// Already has it because someone loaded it, just let it know it's ready.
-		_preview_ready(item.path, cached_item.last_hash, cached_item.preview, cached_item.small_preview, item.callback, cached_item.preview_metadata);
+		_preview_ready(item.path, cached_item.last_hash, cached_item.preview, cached_item.small_preview, item.callbacks, cached_item.preview_metadata);
 		preview_mutex.unlock();
 		return;
 	}
@@ -299,7 +304,7 @@ void EditorResourcePreview::_iterate() {
 	if (item.resource.is_valid()) {
 		Dictionary preview_metadata;
 		_generate_preview(texture, small_texture, item, String(), preview_metadata);
-		_preview_ready(item.path, item.resource->hash_edited_version_for_preview(), texture, small_texture, item.callback, preview_metadata);
+		_preview_ready(item.path, item.resource->hash_edited_version_for_preview(), texture, small_texture, item.callbacks, preview_metadata);
 		return;
 	}
 
@@ -387,7 +392,7 @@ void EditorResourcePreview::_iterate() {
 			_generate_preview(texture, small_texture, item, cache_base, preview_metadata);
 		}
 	}
-	_preview_ready(item.path, 0, texture, small_texture, item.callback, preview_metadata);
+	_preview_ready(item.path, 0, texture, small_texture, item.callbacks, preview_metadata);
 }
 
 void EditorResourcePreview::_write_preview_cache(Ref<FileAccess> p_file, int p_thumbnail_size, bool p_has_small_texture, uint64_t p_modified_time, const String &p_hash, const Dictionary &p_metadata) {
@@ -480,11 +485,19 @@ void EditorResourcePreview::queue_edited_resource_preview(const Ref<Resource> &p
 			cache.remove(I); // Erase if exists, since it will be regen.
 		}
 
+		HashMap<String, List<QueueItem>::Element *>::Iterator Q = queued_items.find(path_id);
+		if (Q) {
+			// Already queued; just add the callback and bump the priority.
+			Q->value->get().callbacks.push_back(p_callback);
+			queue.move_to_back(Q->value);
+			return;
+		}
+
 		QueueItem item;
 		item.resource = p_res;
 		item.path = path_id;
-		item.callback = p_callback;
-		queue.push_back(item);
+		item.callbacks.push_back(p_callback);
+		queued_items[path_id] = queue.push_back(item);
 	}
 	preview_sem.post();
 }
@@ -506,10 +519,19 @@ void EditorResourcePreview::queue_resource_preview(const String &p_path, const C
 			return;
 		}
 
+		HashMap<String, List<QueueItem>::Element *>::Iterator Q = queued_items.find(p_path);
+		if (Q) {
+			// Already queued; just add the callback and bump the priority, so
+			// the preview is only generated once.
+			Q->value->get().callbacks.push_back(p_callback);
+			queue.move_to_back(Q->value);
+			return;
+		}
+
 		QueueItem item;
 		item.path = p_path;
-		item.callback = p_callback;
-		queue.push_back(item);
+		item.callbacks.push_back(p_callback);
+		queued_items[p_path] = queue.push_back(item);
 	}
 	preview_sem.post();
 }
@@ -32,6 +32,7 @@
 
 #include "core/os/semaphore.h"
 #include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
@@ -79,10 +80,14 @@ class EditorResourcePreview : public Node {
 	struct QueueItem {
 		Ref<Resource> resource;
 		String path;
-		Callable callback;
+		LocalVector<Callable> callbacks;
 	};
 
+	// Serviced from the back, so the most recently requested (i.e. currently
+	// visible) previews are generated first. Repeated requests for a path that
+	// is still queued coalesce into the existing item and bump it to the back.
 	List<QueueItem> queue;
+	HashMap<String, List<QueueItem>::Element *> queued_items;
 
 	Mutex preview_mutex;
 	Semaphore preview_sem;
@@ -100,7 +105,7 @@ class EditorResourcePreview : public Node {
 
 	HashMap<String, Item> cache;
 
-	void _preview_ready(const String &p_path, int p_hash, const Ref<Texture2D> &p_texture, const Ref<Texture2D> &p_small_texture, const Callable &p_callback, const Dictionary &p_metadata);
+	void _preview_ready(const String &p_path, int p_hash, const Ref<Texture2D> &p_texture, const Ref<Texture2D> &p_small_texture, const LocalVector<Callable> &p_callbacks, const Dictionary &p_metadata);
 	void _generate_preview(Ref<ImageTexture> &r_texture, Ref<ImageTexture> &r_small_texture, const QueueItem &p_item, const String &cache_base, Dictionary &p_metadata);
 
 	int small_thumbnail_size = -1;
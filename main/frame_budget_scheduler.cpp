@@ -0,0 +1,150 @@
+/**************************************************************************/
+/*  frame_budget_scheduler.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "frame_budget_scheduler.h"
+
+#include "core/os/os.h"
+
+FrameBudgetScheduler *FrameBudgetScheduler::singleton = nullptr;
+
+FrameBudgetScheduler::TaskID FrameBudgetScheduler::add_task(const Callable &p_callable, int p_priority, uint64_t p_estimated_cost_usec) {
+	ERR_FAIL_COND_V(!p_callable.is_valid(), 0);
+
+	MutexLock lock(mutex);
+
+	Task task;
+	task.id = ++last_id;
+	task.callable = p_callable;
+	task.priority = p_priority;
+	task.estimated_cost_usec = MAX(p_estimated_cost_usec, MIN_SLICE_USEC);
+	tasks.push_back(task);
+
+	return task.id;
+}
+
+void FrameBudgetScheduler::remove_task(TaskID p_task_id) {
+	MutexLock lock(mutex);
+
+	for (uint32_t i = 0; i < tasks.size(); i++) {
+		if (tasks[i].id == p_task_id) {
+			tasks.remove_at(i);
+			return;
+		}
+	}
+}
+
+bool FrameBudgetScheduler::has_tasks() const {
+	MutexLock lock(mutex);
+	return tasks.size() > 0;
+}
+
+void FrameBudgetScheduler::process(uint64_t p_budget_usec) {
+	uint64_t remaining = p_budget_usec;
+	LocalVector<TaskID> ran;
+
+	while (true) {
+		Task run_task;
+		{
+			MutexLock lock(mutex);
+
+			// Pick the best candidate that fits in the remaining budget;
+			// starving tasks run regardless of their estimate.
+			int best = -1;
+			for (uint32_t i = 0; i < tasks.size(); i++) {
+				const Task &task = tasks[i];
+				if (ran.has(task.id)) {
+					continue;
+				}
+				if (task.estimated_cost_usec > remaining && task.frames_starved < STARVATION_FRAMES) {
+					continue;
+				}
+				if (best == -1 || task.priority > tasks[best].priority || (task.priority == tasks[best].priority && task.frames_starved > tasks[best].frames_starved)) {
+					best = i;
+				}
+			}
+
+			if (best == -1) {
+				// Nothing fits anymore; age whatever didn't get a slice.
+				for (Task &task : tasks) {
+					if (!ran.has(task.id)) {
+						task.frames_starved++;
+					}
+				}
+				return;
+			}
+
+			run_task = tasks[best];
+		}
+
+		const uint64_t slice = MAX(remaining, MIN_SLICE_USEC);
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		// Called unlocked; the task may register or remove tasks itself.
+		const bool finished = run_task.callable.call(slice).operator bool();
+		const uint64_t cost = OS::get_singleton()->get_ticks_usec() - begin;
+
+		ran.push_back(run_task.id);
+
+		{
+			MutexLock lock(mutex);
+
+			for (uint32_t i = 0; i < tasks.size(); i++) {
+				if (tasks[i].id != run_task.id) {
+					continue;
+				}
+				if (finished) {
+					tasks.remove_at(i);
+				} else {
+					tasks[i].estimated_cost_usec = MAX((tasks[i].estimated_cost_usec * 3 + cost) / 4, MIN_SLICE_USEC);
+					tasks[i].frames_starved = 0;
+				}
+				break;
+			}
+		}
+
+		remaining = cost < remaining ? remaining - cost : 0;
+		if (remaining < MIN_SLICE_USEC) {
+			MutexLock lock(mutex);
+			for (Task &task : tasks) {
+				if (!ran.has(task.id)) {
+					task.frames_starved++;
+				}
+			}
+			return;
+		}
+	}
+}
+
+FrameBudgetScheduler::FrameBudgetScheduler() {
+	singleton = this;
+}
+
+FrameBudgetScheduler::~FrameBudgetScheduler() {
+	singleton = nullptr;
+}
@@ -0,0 +1,79 @@
+/**************************************************************************/
+/*  frame_budget_scheduler.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+#include "core/variant/callable.h"
+
+// Runs registered incremental work (resource finalization, cache warming and
+// similar low-priority jobs) inside the slack left at the end of each frame,
+// so it makes steady progress without causing hitches. Driven from
+// Main::iteration with the measured remaining frame budget.
+class FrameBudgetScheduler {
+public:
+	typedef uint64_t TaskID;
+
+private:
+	struct Task {
+		TaskID id = 0;
+		// Receives the slice budget in usec; returns true when the task has
+		// finished and should be unregistered.
+		Callable callable;
+		int priority = 0;
+		uint64_t estimated_cost_usec = 0; // Rolling estimate of a slice's real cost.
+		uint32_t frames_starved = 0; // Frames since this task last got a slice.
+	};
+
+	mutable BinaryMutex mutex;
+	LocalVector<Task> tasks;
+	TaskID last_id = 0;
+
+	// Minimum slice handed to a task, so estimates larger than the remaining
+	// budget can't stall progress forever.
+	static const uint64_t MIN_SLICE_USEC = 250;
+	// A task skipped this many frames in a row runs regardless of its estimate.
+	static const uint32_t STARVATION_FRAMES = 60;
+
+	static FrameBudgetScheduler *singleton;
+
+public:
+	static FrameBudgetScheduler *get_singleton() { return singleton; }
+
+	TaskID add_task(const Callable &p_callable, int p_priority = 0, uint64_t p_estimated_cost_usec = 1000);
+	void remove_task(TaskID p_task_id);
+	bool has_tasks() const;
+
+	void process(uint64_t p_budget_usec);
+
+	FrameBudgetScheduler();
+	~FrameBudgetScheduler();
+};
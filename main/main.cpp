@@ -56,6 +56,7 @@
 #include "core/version.h"
 #include "drivers/register_driver_types.h"
 #include "main/app_icon.gen.h"
+#include "main/frame_budget_scheduler.h"
 #include "main/main_timer_sync.h"
 #include "main/performance.h"
 #include "main/splash.gen.h"
@@ -159,6 +160,7 @@ static Input *input = nullptr;
 static InputMap *input_map = nullptr;
 static TranslationServer *translation_server = nullptr;
 static Performance *performance = nullptr;
+static FrameBudgetScheduler *frame_budget_scheduler = nullptr;
 static PackedData *packed_data = nullptr;
 #ifdef MINIZIP_ENABLED
 static ZipArchive *zip_packed_data = nullptr;
@@ -1028,6 +1030,8 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	GDREGISTER_CLASS(Performance);
 	engine->add_singleton(Engine::Singleton("Performance", performance));
 
+	frame_budget_scheduler = memnew(FrameBudgetScheduler);
+
 	// Only flush stdout in debug builds by default, as spamming `print()` will
 	// decrease performance if this is enabled.
 	GLOBAL_DEF_RST("application/run/flush_stdout_on_print", false);
@@ -2034,7 +2038,8 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 		} else {
 			int worker_threads = GLOBAL_GET("threading/worker_pool/max_threads");
 			float low_priority_ratio = GLOBAL_GET("threading/worker_pool/low_priority_thread_ratio");
-			WorkerThreadPool::get_singleton()->init(worker_threads, low_priority_ratio);
+			uint64_t cpu_affinity = (uint64_t)(int64_t)GLOBAL_GET("threading/worker_pool/cpu_affinity");
+			WorkerThreadPool::get_singleton()->init(worker_threads, low_priority_ratio, cpu_affinity);
 		}
 #else
 		WorkerThreadPool::get_singleton()->init(0, 0);
@@ -2844,6 +2849,9 @@ error:
 
 	EngineDebugger::deinitialize();
 
+	if (frame_budget_scheduler) {
+		memdelete(frame_budget_scheduler);
+	}
 	if (performance) {
 		memdelete(performance);
 	}
@@ -4709,6 +4717,9 @@ bool Main::is_iterating() {
 static uint64_t physics_process_max = 0;
 static uint64_t process_max = 0;
 static uint64_t navigation_process_max = 0;
+static uint64_t frame_max = 0;
+static uint64_t render_max = 0;
+static uint64_t audio_prof_time_prev = 0;
 
 // Return false means iterating further, returning true means `OS::run`
 // will terminate the program. In case of failure, the OS exit code needs
@@ -4866,6 +4877,8 @@ bool Main::iteration() {
 	NavigationServer3D::get_singleton()->process(process_step * time_scale);
 #endif // NAVIGATION_3D_DISABLED
 
+	uint64_t render_begin = OS::get_singleton()->get_ticks_usec();
+
 	GodotProfileZoneGrouped(_profile_zone, "RenderingServer::sync");
 	RenderingServer::get_singleton()->sync(); //sync if still drawing from previous frames.
 
@@ -4889,9 +4902,11 @@ bool Main::iteration() {
 		}
 	}
 
+	render_max = MAX(OS::get_singleton()->get_ticks_usec() - render_begin, render_max);
 	process_ticks = OS::get_singleton()->get_ticks_usec() - process_begin;
 	process_max = MAX(process_ticks, process_max);
 	uint64_t frame_time = OS::get_singleton()->get_ticks_usec() - ticks;
+	frame_max = MAX(frame_time, frame_max);
 
 	GodotProfileZoneGrouped(_profile_zone, "GDExtensionManager::frame");
 	GDExtensionManager::get_singleton()->frame();
@@ -4929,9 +4944,21 @@ bool Main::iteration() {
 		performance->set_process_time(USEC_TO_SEC(process_max));
 		performance->set_physics_process_time(USEC_TO_SEC(physics_process_max));
 		performance->set_navigation_process_time(USEC_TO_SEC(navigation_process_max));
+		performance->set_frame_time(USEC_TO_SEC(frame_max));
+		performance->set_render_time(USEC_TO_SEC(render_max));
+		// Audio mix time is accumulated on the audio thread; publish the delta
+		// over the last second. The counter may be reset externally by the
+		// profiler, in which case the sample is skipped.
+		uint64_t audio_prof_time = AudioDriver::get_singleton() ? AudioDriver::get_singleton()->get_profiling_time() : 0;
+		if (audio_prof_time >= audio_prof_time_prev) {
+			performance->set_audio_mix_time(USEC_TO_SEC(audio_prof_time - audio_prof_time_prev));
+		}
+		audio_prof_time_prev = audio_prof_time;
 		process_max = 0;
 		physics_process_max = 0;
 		navigation_process_max = 0;
+		frame_max = 0;
+		render_max = 0;
 
 		frame %= 1000000;
 		frames = 0;
@@ -4964,6 +4991,21 @@ bool Main::iteration() {
 		return exit;
 	}
 
+	if (frame_budget_scheduler->has_tasks()) {
+		GodotProfileZoneGrouped(_profile_zone, "FrameBudgetScheduler::process");
+		// Drain deferred low-priority work with whatever is left of the frame.
+		int target_fps = Engine::get_singleton()->get_max_fps();
+		if (target_fps <= 0) {
+			target_fps = (int)DisplayServer::get_singleton()->screen_get_refresh_rate();
+		}
+		if (target_fps <= 0) {
+			target_fps = 60; // Headless, or the refresh rate is unknown.
+		}
+		const uint64_t target_usec = 1000000 / (uint64_t)target_fps;
+		const uint64_t elapsed_usec = OS::get_singleton()->get_ticks_usec() - ticks;
+		frame_budget_scheduler->process(elapsed_usec < target_usec ? target_usec - elapsed_usec : 0);
+	}
+
 	SceneTree *scene_tree = SceneTree::get_singleton();
 	bool wake_for_events = scene_tree && scene_tree->is_accessibility_enabled();
 
@@ -5132,6 +5174,9 @@ void Main::cleanup(bool p_force) {
 	if (packed_data) {
 		memdelete(packed_data);
 	}
+	if (frame_budget_scheduler) {
+		memdelete(frame_budget_scheduler);
+	}
 	if (performance) {
 		memdelete(performance);
 	}
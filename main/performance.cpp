@@ -133,6 +133,9 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
+	BIND_ENUM_CONSTANT(TIME_FRAME);
+	BIND_ENUM_CONSTANT(TIME_RENDER);
+	BIND_ENUM_CONSTANT(TIME_AUDIO_MIX);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 
 	BIND_ENUM_CONSTANT(MONITOR_TYPE_QUANTITY);
@@ -228,6 +231,9 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation_3d/edges_free"),
 		PNAME("navigation_3d/obstacles"),
 #endif // NAVIGATION_3D_DISABLED
+		PNAME("time/frame"),
+		PNAME("time/render"),
+		PNAME("time/audio_mix"),
 	};
 	static_assert(std_size(names) == MONITOR_MAX);
 
@@ -246,6 +252,12 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return _physics_process_time;
 		case TIME_NAVIGATION_PROCESS:
 			return _navigation_process_time;
+		case TIME_FRAME:
+			return _frame_time;
+		case TIME_RENDER:
+			return _render_time;
+		case TIME_AUDIO_MIX:
+			return _audio_mix_time;
 		case MEMORY_STATIC:
 			return Memory::get_mem_usage();
 		case MEMORY_STATIC_MAX:
@@ -525,7 +537,9 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 #endif // _3D_DISABLED
-
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
 
@@ -544,6 +558,18 @@ void Performance::set_navigation_process_time(double p_pt) {
 	_navigation_process_time = p_pt;
 }
 
+void Performance::set_frame_time(double p_pt) {
+	_frame_time = p_pt;
+}
+
+void Performance::set_render_time(double p_pt) {
+	_render_time = p_pt;
+}
+
+void Performance::set_audio_mix_time(double p_pt) {
+	_audio_mix_time = p_pt;
+}
+
 void Performance::add_custom_monitor(const StringName &p_id, const Callable &p_callable, const Vector<Variant> &p_args, MonitorType p_type) {
 	ERR_FAIL_COND_MSG(has_custom_monitor(p_id), "Custom monitor with id '" + String(p_id) + "' already exists.");
 	_monitor_map.insert(p_id, MonitorCall(p_type, p_callable, p_args));
@@ -605,6 +631,9 @@ Performance::Performance() {
 	_process_time = 0;
 	_physics_process_time = 0;
 	_navigation_process_time = 0;
+	_frame_time = 0;
+	_render_time = 0;
+	_audio_mix_time = 0;
 	_monitor_modification_time = 0;
 	singleton = this;
 }
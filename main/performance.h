@@ -56,6 +56,9 @@ class Performance : public Object {
 	double _process_time;
 	double _physics_process_time;
 	double _navigation_process_time;
+	double _frame_time;
+	double _render_time;
+	double _audio_mix_time;
 
 public:
 	enum Monitor {
@@ -121,6 +124,9 @@ public:
 		NAVIGATION_3D_EDGE_FREE_COUNT,
 		NAVIGATION_3D_OBSTACLE_COUNT,
 #endif // _3D_DISABLED
+		TIME_FRAME,
+		TIME_RENDER,
+		TIME_AUDIO_MIX,
 		MONITOR_MAX
 	};
 
@@ -139,6 +145,9 @@ public:
 	void set_process_time(double p_pt);
 	void set_physics_process_time(double p_pt);
 	void set_navigation_process_time(double p_pt);
+	void set_frame_time(double p_pt);
+	void set_render_time(double p_pt);
+	void set_audio_mix_time(double p_pt);
 
 	void add_custom_monitor(const StringName &p_id, const Callable &p_callable, const Vector<Variant> &p_args, MonitorType p_type = MONITOR_TYPE_QUANTITY);
 	void remove_custom_monitor(const StringName &p_id);
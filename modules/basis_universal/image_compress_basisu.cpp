@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/io/image.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 #include "servers/rendering/rendering_server.h"
@@ -272,6 +273,56 @@ Vector<uint8_t> basis_universal_packer(const Ref<Image> &p_image, Image::UsedCha
 }
 #endif // TOOLS_ENABLED
 
+// Mipmap levels transcode independently, so the work is spread over the worker
+// pool, with a thread-specific transcoder state per level as required by BasisU.
+struct BasisuKTX2DecodeTask {
+	basist::ktx2_transcoder *transcoder = nullptr;
+	basist::transcoder_texture_format basisu_format = basist::transcoder_texture_format::cTFTotalTextureFormats;
+	Image::Format image_format = Image::FORMAT_MAX;
+	uint8_t *dst = nullptr;
+
+	void transcode_level(uint32_t p_level, void *p_unused) {
+		basist::ktx2_image_level_info basisu_level;
+		transcoder->get_image_level_info(basisu_level, p_level, 0, 0);
+
+		uint32_t mip_block_or_pixel_count = Image::is_format_compressed(image_format) ? basisu_level.m_total_blocks : basisu_level.m_orig_width * basisu_level.m_orig_height;
+		int64_t ofs = Image::get_image_mipmap_offset(transcoder->get_width(), transcoder->get_height(), image_format, p_level);
+
+		basist::ktx2_transcoder_state state;
+		bool result = transcoder->transcode_image_level(p_level, 0, 0, dst + ofs, mip_block_or_pixel_count, basisu_format, 0, 0, 0, -1, -1, &state);
+
+		if (!result) {
+			print_line(vformat("BasisUniversal cannot unpack level %d.", p_level));
+		}
+	}
+};
+
+struct BasisuDecodeTask {
+	basist::basisu_transcoder *transcoder = nullptr;
+	const uint8_t *src_ptr = nullptr;
+	int src_size = 0;
+	basist::transcoder_texture_format basisu_format = basist::transcoder_texture_format::cTFTotalTextureFormats;
+	Image::Format image_format = Image::FORMAT_MAX;
+	uint32_t width = 0;
+	uint32_t height = 0;
+	uint8_t *dst = nullptr;
+
+	void transcode_level(uint32_t p_level, void *p_unused) {
+		basist::basisu_image_level_info basisu_level;
+		transcoder->get_image_level_info(src_ptr, src_size, basisu_level, 0, p_level);
+
+		uint32_t mip_block_or_pixel_count = Image::is_format_compressed(image_format) ? basisu_level.m_total_blocks : basisu_level.m_orig_width * basisu_level.m_orig_height;
+		int64_t ofs = Image::get_image_mipmap_offset(width, height, image_format, p_level);
+
+		basist::basisu_transcoder_state state;
+		bool result = transcoder->transcode_image_level(src_ptr, src_size, 0, p_level, dst + ofs, mip_block_or_pixel_count, basisu_format, 0, 0, &state);
+
+		if (!result) {
+			print_line(vformat("BasisUniversal cannot unpack level %d.", p_level));
+		}
+	}
+};
+
 Ref<Image> basis_universal_unpacker_ptr(const uint8_t *p_data, int p_size) {
 	uint64_t start_time = OS::get_singleton()->get_ticks_msec();
 
@@ -428,19 +479,17 @@ Ref<Image> basis_universal_unpacker_ptr(const uint8_t *p_data, int p_size) {
 		uint8_t *dst = out_data.ptrw();
 		memset(dst, 0, out_data.size());
 
-		for (uint32_t i = 0; i < transcoder.get_levels(); i++) {
-			basist::ktx2_image_level_info basisu_level;
-			transcoder.get_image_level_info(basisu_level, i, 0, 0);
+		BasisuKTX2DecodeTask task;
+		task.transcoder = &transcoder;
+		task.basisu_format = basisu_format;
+		task.image_format = image_format;
+		task.dst = dst;
 
-			uint32_t mip_block_or_pixel_count = Image::is_format_compressed(image_format) ? basisu_level.m_total_blocks : basisu_level.m_orig_width * basisu_level.m_orig_height;
-			int64_t ofs = Image::get_image_mipmap_offset(transcoder.get_width(), transcoder.get_height(), image_format, i);
-
-			bool result = transcoder.transcode_image_level(i, 0, 0, dst + ofs, mip_block_or_pixel_count, basisu_format);
-
-			if (!result) {
-				print_line(vformat("BasisUniversal cannot unpack level %d.", i));
-				break;
-			}
+		if (transcoder.get_levels() > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(&task, &BasisuKTX2DecodeTask::transcode_level, nullptr, transcoder.get_levels(), -1, false, SNAME("BasisUniversalTranscode"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			task.transcode_level(0, nullptr);
 		}
 
 		image = Image::create_from_data(transcoder.get_width(), transcoder.get_height(), transcoder.get_levels() > 1, image_format, out_data);
@@ -460,19 +509,21 @@ Ref<Image> basis_universal_unpacker_ptr(const uint8_t *p_data, int p_size) {
 		uint8_t *dst = out_data.ptrw();
 		memset(dst, 0, out_data.size());
 
-		for (uint32_t i = 0; i < basisu_info.m_total_levels; i++) {
-			basist::basisu_image_level_info basisu_level;
-			transcoder.get_image_level_info(src_ptr, src_size, basisu_level, 0, i);
-
-			uint32_t mip_block_or_pixel_count = Image::is_format_compressed(image_format) ? basisu_level.m_total_blocks : basisu_level.m_orig_width * basisu_level.m_orig_height;
-			int64_t ofs = Image::get_image_mipmap_offset(basisu_info.m_width, basisu_info.m_height, image_format, i);
-
-			bool result = transcoder.transcode_image_level(src_ptr, src_size, 0, i, dst + ofs, mip_block_or_pixel_count, basisu_format);
-
-			if (!result) {
-				print_line(vformat("BasisUniversal cannot unpack level %d.", i));
-				break;
-			}
+		BasisuDecodeTask task;
+		task.transcoder = &transcoder;
+		task.src_ptr = src_ptr;
+		task.src_size = src_size;
+		task.basisu_format = basisu_format;
+		task.image_format = image_format;
+		task.width = basisu_info.m_width;
+		task.height = basisu_info.m_height;
+		task.dst = dst;
+
+		if (basisu_info.m_total_levels > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(&task, &BasisuDecodeTask::transcode_level, nullptr, basisu_info.m_total_levels, -1, false, SNAME("BasisUniversalTranscode"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			task.transcode_level(0, nullptr);
 		}
 
 		image = Image::create_from_data(basisu_info.m_width, basisu_info.m_height, basisu_info.m_total_levels > 1, image_format, out_data);
@@ -229,10 +229,15 @@ void CSGShape3D::_make_dirty(bool p_parent_removing) {
 #ifndef PHYSICS_3D_DISABLED
 	else if (!dirty) {
 		callable_mp(this, &CSGShape3D::update_shape).call_deferred();
+	} else if (build_task != WorkerThreadPool::INVALID_TASK_ID) {
+		// Dirtied again while an asynchronous build is in flight; run another
+		// build once its result lands.
+		async_rebuild_pending = true;
 	}
 #endif // PHYSICS_3D_DISABLED
 
 	dirty = true;
+	dirty_serial++;
 }
 
 enum ManifoldProperty {
@@ -367,10 +372,8 @@ static String _export_meshgl_as_json(const manifold::MeshGL64 &p_mesh) {
 static void _pack_manifold(
 		const CSGBrush *const p_mesh_merge,
 		manifold::Manifold &r_manifold,
-		HashMap<int32_t, Ref<Material>> &p_mesh_materials,
-		CSGShape3D *p_csg_shape) {
+		HashMap<int32_t, Ref<Material>> &p_mesh_materials) {
 	ERR_FAIL_NULL_MSG(p_mesh_merge, "p_mesh_merge is null");
-	ERR_FAIL_NULL_MSG(p_csg_shape, "p_shape is null");
 	HashMap<uint32_t, Vector<CSGBrush::Face>> faces_by_material;
 	for (int face_i = 0; face_i < p_mesh_merge->faces.size(); face_i++) {
 		const CSGBrush::Face &face = p_mesh_merge->faces[face_i];
@@ -450,35 +453,98 @@ struct ManifoldOperation {
 			manifold(m), operation(op) {}
 };
 
-CSGBrush *CSGShape3D::_get_brush() {
+struct CSGShape3D::BuildJob {
+	struct Node {
+		ObjectID shape;
+		Operation operation = OPERATION_UNION;
+		Transform3D transform; // Relative to the parent shape.
+		uint32_t dirty_serial = 0;
+		CSGBrush brush; // The node's own base brush, replaced by the subtree result when evaluated.
+		bool valid = false;
+		bool from_cache = false;
+		AABB aabb;
+		LocalVector<uint32_t> children;
+	};
+
+	LocalVector<Node> nodes; // nodes[0] is the shape the job was started from.
+	bool calculate_tangents = true;
+	Callable done_callback;
+
+	// Written by the evaluation step.
+	Vector<ShapeUpdateSurface> surfaces;
+};
+
+uint32_t CSGShape3D::_snapshot_build_tree(BuildJob &r_job) {
+	uint32_t index = r_job.nodes.size();
+	{
+		BuildJob::Node node;
+		node.shape = get_instance_id();
+		node.operation = operation;
+		node.transform = get_transform();
+		node.dirty_serial = dirty_serial;
+		r_job.nodes.push_back(node);
+	}
+
 	if (!dirty) {
-		return brush;
+		// Cached subtree result; the children don't need to be visited at all.
+		BuildJob::Node &node = r_job.nodes[index];
+		node.from_cache = true;
+		node.valid = brush != nullptr;
+		if (brush) {
+			node.brush = *brush;
+		}
+		node.aabb = node_aabb;
+		return index;
 	}
-	if (brush) {
-		memdelete(brush);
+
+	CSGBrush *base = _build_brush();
+	if (base) {
+		r_job.nodes[index].valid = true;
+		r_job.nodes[index].brush = *base;
+		memdelete(base);
 	}
-	brush = nullptr;
-	CSGBrush *n = _build_brush();
-	HashMap<int32_t, Ref<Material>> mesh_materials;
-	manifold::Manifold root_manifold;
-	_pack_manifold(n, root_manifold, mesh_materials, this);
-	manifold::OpType current_op = ManifoldOperation::convert_csg_op(get_operation());
-	std::vector<manifold::Manifold> manifolds;
-	manifolds.push_back(root_manifold);
+
 	for (int i = 0; i < get_child_count(); i++) {
 		CSGShape3D *child = Object::cast_to<CSGShape3D>(get_child(i));
 		if (!child || !child->is_visible()) {
 			continue;
 		}
-		CSGBrush *child_brush = child->_get_brush();
-		if (!child_brush) {
+		uint32_t child_index = child->_snapshot_build_tree(r_job);
+		r_job.nodes[index].children.push_back(child_index);
+	}
+
+	return index;
+}
+
+void CSGShape3D::_evaluate_build_node(BuildJob &p_job, uint32_t p_index) {
+	if (p_job.nodes[p_index].from_cache) {
+		return;
+	}
+
+	for (const uint32_t child_index : p_job.nodes[p_index].children) {
+		_evaluate_build_node(p_job, child_index);
+	}
+
+	BuildJob::Node &node = p_job.nodes[p_index];
+
+	HashMap<int32_t, Ref<Material>> mesh_materials;
+	manifold::Manifold root_manifold;
+	if (node.valid) {
+		_pack_manifold(&node.brush, root_manifold, mesh_materials);
+	}
+	manifold::OpType current_op = ManifoldOperation::convert_csg_op(node.operation);
+	std::vector<manifold::Manifold> manifolds;
+	manifolds.push_back(root_manifold);
+	for (const uint32_t child_index : p_job.nodes[p_index].children) {
+		const BuildJob::Node &child = p_job.nodes[child_index];
+		if (!child.valid) {
 			continue;
 		}
 		CSGBrush transformed_brush;
-		transformed_brush.copy_from(*child_brush, child->get_transform());
+		transformed_brush.copy_from(child.brush, child.transform);
 		manifold::Manifold child_manifold;
-		_pack_manifold(&transformed_brush, child_manifold, mesh_materials, child);
-		manifold::OpType child_operation = ManifoldOperation::convert_csg_op(child->get_operation());
+		_pack_manifold(&transformed_brush, child_manifold, mesh_materials);
+		manifold::OpType child_operation = ManifoldOperation::convert_csg_op(child.operation);
 		if (child_operation != current_op) {
 			manifold::Manifold result = manifold::Manifold::BatchBoolean(manifolds, current_op);
 			manifolds.clear();
@@ -489,25 +555,96 @@ CSGBrush *CSGShape3D::_get_brush() {
 	}
 	if (!manifolds.empty()) {
 		manifold::Manifold manifold_result = manifold::Manifold::BatchBoolean(manifolds, current_op);
-		if (n) {
-			memdelete(n);
-		}
-		n = memnew(CSGBrush);
-		_unpack_manifold(manifold_result, mesh_materials, n);
+		node.brush = CSGBrush();
+		_unpack_manifold(manifold_result, mesh_materials, &node.brush);
+		node.valid = true;
 	}
+
 	AABB aabb;
-	if (n && !n->faces.is_empty()) {
-		aabb.position = n->faces[0].vertices[0];
-		for (const CSGBrush::Face &face : n->faces) {
+	if (node.valid && !node.brush.faces.is_empty()) {
+		aabb.position = node.brush.faces[0].vertices[0];
+		for (const CSGBrush::Face &face : node.brush.faces) {
 			for (int i = 0; i < 3; ++i) {
 				aabb.expand_to(face.vertices[i]);
 			}
 		}
 	}
-	node_aabb = aabb;
-	brush = n;
-	dirty = false;
-	update_configuration_warnings();
+	node.aabb = aabb;
+}
+
+void CSGShape3D::_evaluate_build_job(BuildJob &p_job) {
+	_evaluate_build_node(p_job, 0);
+	if (p_job.nodes[0].valid) {
+		_build_surfaces(p_job.nodes[0].brush, p_job.calculate_tangents, p_job.surfaces);
+	}
+}
+
+void CSGShape3D::_build_job_task(void *p_job) {
+	BuildJob *job = static_cast<BuildJob *>(p_job);
+	_evaluate_build_job(*job);
+	job->done_callback.call_deferred();
+}
+
+bool CSGShape3D::_apply_build_nodes(const BuildJob &p_job) {
+	bool root_applied = false;
+	for (uint32_t i = 0; i < p_job.nodes.size(); i++) {
+		const BuildJob::Node &node = p_job.nodes[i];
+		if (node.from_cache) {
+			root_applied = root_applied || i == 0;
+			continue;
+		}
+		CSGShape3D *shape = ObjectDB::get_instance<CSGShape3D>(node.shape);
+		if (!shape || shape->dirty_serial != node.dirty_serial) {
+			// Freed or edited again while the job was running; the pending rebuild
+			// picks the node up with its fresh state instead.
+			continue;
+		}
+		if (shape->brush) {
+			memdelete(shape->brush);
+		}
+		shape->brush = nullptr;
+		if (node.valid) {
+			shape->brush = memnew(CSGBrush(node.brush));
+		}
+		shape->node_aabb = node.aabb;
+		shape->dirty = false;
+		shape->update_configuration_warnings();
+		root_applied = root_applied || i == 0;
+	}
+	return root_applied;
+}
+
+void CSGShape3D::_finish_async_update() {
+	if (build_task == WorkerThreadPool::INVALID_TASK_ID) {
+		return;
+	}
+	// The task posted this callback, so this only reclaims the task slot.
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(build_task);
+	build_task = WorkerThreadPool::INVALID_TASK_ID;
+
+	bool root_applied = _apply_build_nodes(*build_job);
+	if (root_applied && build_job->nodes[0].valid) {
+		set_base(RID());
+		root_mesh.unref();
+		_update_mesh_from_surfaces(build_job->surfaces);
+	}
+
+	memdelete(build_job);
+	build_job = nullptr;
+
+	if (async_rebuild_pending) {
+		async_rebuild_pending = false;
+		update_shape();
+	}
+}
+
+CSGBrush *CSGShape3D::_get_brush() {
+	if (dirty) {
+		BuildJob job;
+		_snapshot_build_tree(job);
+		_evaluate_build_node(job, 0);
+		_apply_build_nodes(job);
+	}
 	return brush;
 }
 
@@ -570,12 +707,37 @@ void CSGShape3D::update_shape() {
 		return;
 	}
 
+	if (build_task != WorkerThreadPool::INVALID_TASK_ID) {
+		// A build is already in flight; run again once its result lands.
+		async_rebuild_pending = true;
+		return;
+	}
+
+	if (use_async_update && is_inside_tree() && dirty) {
+		// Snapshot the whole tree and evaluate it on a worker thread; the current
+		// mesh stays visible until the replacement is ready.
+		build_job = memnew(BuildJob);
+		build_job->calculate_tangents = calculate_tangents;
+		build_job->done_callback = callable_mp(this, &CSGShape3D::_finish_async_update);
+		_snapshot_build_tree(*build_job);
+		build_task = WorkerThreadPool::get_singleton()->add_native_task(&CSGShape3D::_build_job_task, build_job, false, "CSGShape3D async update");
+		return;
+	}
+
 	set_base(RID());
 	root_mesh.unref(); //byebye root mesh
 
 	CSGBrush *n = _get_brush();
 	ERR_FAIL_NULL_MSG(n, "Cannot get CSGBrush.");
 
+	Vector<ShapeUpdateSurface> surfaces;
+	_build_surfaces(*n, calculate_tangents, surfaces);
+	_update_mesh_from_surfaces(surfaces);
+}
+
+void CSGShape3D::_build_surfaces(const CSGBrush &p_brush, bool p_calculate_tangents, Vector<ShapeUpdateSurface> &r_surfaces) {
+	const CSGBrush *n = &p_brush;
+
 	AHashMap<Vector3, Vector3> vec_map;
 
 	Vector<int> face_count;
@@ -606,29 +768,27 @@ void CSGShape3D::update_shape() {
 		face_count.write[idx]++;
 	}
 
-	Vector<ShapeUpdateSurface> surfaces;
-
-	surfaces.resize(face_count.size());
+	r_surfaces.resize(face_count.size());
 
 	//create arrays
-	for (int i = 0; i < surfaces.size(); i++) {
-		surfaces.write[i].vertices.resize(face_count[i] * 3);
-		surfaces.write[i].normals.resize(face_count[i] * 3);
-		surfaces.write[i].uvs.resize(face_count[i] * 3);
-		if (calculate_tangents) {
-			surfaces.write[i].tans.resize(face_count[i] * 3 * 4);
+	for (int i = 0; i < r_surfaces.size(); i++) {
+		r_surfaces.write[i].vertices.resize(face_count[i] * 3);
+		r_surfaces.write[i].normals.resize(face_count[i] * 3);
+		r_surfaces.write[i].uvs.resize(face_count[i] * 3);
+		if (p_calculate_tangents) {
+			r_surfaces.write[i].tans.resize(face_count[i] * 3 * 4);
 		}
-		surfaces.write[i].last_added = 0;
+		r_surfaces.write[i].last_added = 0;
 
-		if (i != surfaces.size() - 1) {
-			surfaces.write[i].material = n->materials[i];
+		if (i != r_surfaces.size() - 1) {
+			r_surfaces.write[i].material = n->materials[i];
 		}
 
-		surfaces.write[i].verticesw = surfaces.write[i].vertices.ptrw();
-		surfaces.write[i].normalsw = surfaces.write[i].normals.ptrw();
-		surfaces.write[i].uvsw = surfaces.write[i].uvs.ptrw();
-		if (calculate_tangents) {
-			surfaces.write[i].tansw = surfaces.write[i].tans.ptrw();
+		r_surfaces.write[i].verticesw = r_surfaces.write[i].vertices.ptrw();
+		r_surfaces.write[i].normalsw = r_surfaces.write[i].normals.ptrw();
+		r_surfaces.write[i].uvsw = r_surfaces.write[i].uvs.ptrw();
+		if (p_calculate_tangents) {
+			r_surfaces.write[i].tansw = r_surfaces.write[i].tans.ptrw();
 		}
 	}
 
@@ -645,7 +805,7 @@ void CSGShape3D::update_shape() {
 			ERR_CONTINUE(mat < -1 || mat >= face_count.size());
 			int idx = mat == -1 ? face_count.size() - 1 : mat;
 
-			int last = surfaces[idx].last_added;
+			int last = r_surfaces[idx].last_added;
 
 			Plane p(n->faces[i].vertices[0], n->faces[i].vertices[1], n->faces[i].vertices[2]);
 
@@ -666,30 +826,27 @@ void CSGShape3D::update_shape() {
 				}
 
 				int k = last + order[j];
-				surfaces[idx].verticesw[k] = v;
-				surfaces[idx].uvsw[k] = n->faces[i].uvs[j];
-				surfaces[idx].normalsw[k] = normal;
+				r_surfaces[idx].verticesw[k] = v;
+				r_surfaces[idx].uvsw[k] = n->faces[i].uvs[j];
+				r_surfaces[idx].normalsw[k] = normal;
 
-				if (calculate_tangents) {
+				if (p_calculate_tangents) {
 					// zero out our tangents for now
 					k *= 4;
-					surfaces[idx].tansw[k++] = 0.0;
-					surfaces[idx].tansw[k++] = 0.0;
-					surfaces[idx].tansw[k++] = 0.0;
-					surfaces[idx].tansw[k++] = 0.0;
+					r_surfaces[idx].tansw[k++] = 0.0;
+					r_surfaces[idx].tansw[k++] = 0.0;
+					r_surfaces[idx].tansw[k++] = 0.0;
+					r_surfaces[idx].tansw[k++] = 0.0;
 				}
 			}
 
-			surfaces.write[idx].last_added += 3;
+			r_surfaces.write[idx].last_added += 3;
 		}
 	}
 
-	root_mesh.instantiate();
-	//create surfaces
-
-	for (int i = 0; i < surfaces.size(); i++) {
-		// calculate tangents for this surface
-		bool have_tangents = calculate_tangents;
+	//calculate tangents
+	for (int i = 0; i < r_surfaces.size(); i++) {
+		bool have_tangents = p_calculate_tangents;
 		if (have_tangents) {
 			SMikkTSpaceInterface mkif;
 			mkif.m_getNormal = mikktGetNormal;
@@ -702,11 +859,19 @@ void CSGShape3D::update_shape() {
 
 			SMikkTSpaceContext msc;
 			msc.m_pInterface = &mkif;
-			msc.m_pUserData = &surfaces.write[i];
+			msc.m_pUserData = &r_surfaces.write[i];
 			have_tangents = genTangSpaceDefault(&msc);
 		}
+		r_surfaces.write[i].tangents_valid = have_tangents;
+	}
+}
 
-		if (surfaces[i].last_added == 0) {
+void CSGShape3D::_update_mesh_from_surfaces(const Vector<ShapeUpdateSurface> &p_surfaces) {
+	root_mesh.instantiate();
+	//create surfaces
+
+	for (int i = 0; i < p_surfaces.size(); i++) {
+		if (p_surfaces[i].last_added == 0) {
 			continue;
 		}
 
@@ -714,16 +879,16 @@ void CSGShape3D::update_shape() {
 		Array array;
 		array.resize(Mesh::ARRAY_MAX);
 
-		array[Mesh::ARRAY_VERTEX] = surfaces[i].vertices;
-		array[Mesh::ARRAY_NORMAL] = surfaces[i].normals;
-		array[Mesh::ARRAY_TEX_UV] = surfaces[i].uvs;
-		if (have_tangents) {
-			array[Mesh::ARRAY_TANGENT] = surfaces[i].tans;
+		array[Mesh::ARRAY_VERTEX] = p_surfaces[i].vertices;
+		array[Mesh::ARRAY_NORMAL] = p_surfaces[i].normals;
+		array[Mesh::ARRAY_TEX_UV] = p_surfaces[i].uvs;
+		if (p_surfaces[i].tangents_valid) {
+			array[Mesh::ARRAY_TANGENT] = p_surfaces[i].tans;
 		}
 
 		int idx = root_mesh->get_surface_count();
 		root_mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, array);
-		root_mesh->surface_set_material(idx, surfaces[i].material);
+		root_mesh->surface_set_material(idx, p_surfaces[i].material);
 	}
 
 	set_base(root_mesh->get_rid());
@@ -994,6 +1159,14 @@ Ref<TriangleMesh> CSGShape3D::generate_triangle_mesh() const {
 	return Ref<TriangleMesh>();
 }
 
+void CSGShape3D::set_use_async_update(bool p_enable) {
+	use_async_update = p_enable;
+}
+
+bool CSGShape3D::is_using_async_update() const {
+	return use_async_update;
+}
+
 void CSGShape3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_root_shape"), &CSGShape3D::is_root_shape);
 
@@ -1033,6 +1206,9 @@ void CSGShape3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_calculate_tangents", "enabled"), &CSGShape3D::set_calculate_tangents);
 	ClassDB::bind_method(D_METHOD("is_calculating_tangents"), &CSGShape3D::is_calculating_tangents);
 
+	ClassDB::bind_method(D_METHOD("set_use_async_update", "enabled"), &CSGShape3D::set_use_async_update);
+	ClassDB::bind_method(D_METHOD("is_using_async_update"), &CSGShape3D::is_using_async_update);
+
 	ClassDB::bind_method(D_METHOD("get_meshes"), &CSGShape3D::get_meshes);
 
 	ClassDB::bind_method(D_METHOD("bake_static_mesh"), &CSGShape3D::bake_static_mesh);
@@ -1042,6 +1218,7 @@ void CSGShape3D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "snap", PROPERTY_HINT_RANGE, "0.000001,1,0.000001,suffix:m", PROPERTY_USAGE_NONE), "set_snap", "get_snap");
 #endif // DISABLE_DEPRECATED
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "calculate_tangents"), "set_calculate_tangents", "is_calculating_tangents");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_async_update"), "set_use_async_update", "is_using_async_update");
 
 #ifndef PHYSICS_3D_DISABLED
 	ADD_GROUP("Collision", "collision_");
@@ -1061,6 +1238,14 @@ CSGShape3D::CSGShape3D() {
 }
 
 CSGShape3D::~CSGShape3D() {
+	if (build_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(build_task);
+		build_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+	if (build_job) {
+		memdelete(build_job);
+		build_job = nullptr;
+	}
 	if (brush) {
 		memdelete(brush);
 		brush = nullptr;
@@ -32,6 +32,7 @@
 
 #include "csg.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "scene/3d/path_3d.h"
 #include "scene/3d/visual_instance_3d.h"
 
@@ -67,6 +68,16 @@ private:
 	bool last_visible = false;
 	float snap = 0.001;
 
+	// Bumped on every _make_dirty() call, so results computed from a snapshot of
+	// this node can be discarded if the node was edited again in the meantime.
+	uint32_t dirty_serial = 0;
+
+	struct BuildJob;
+	BuildJob *build_job = nullptr;
+	WorkerThreadPool::TaskID build_task = WorkerThreadPool::INVALID_TASK_ID;
+	bool use_async_update = false;
+	bool async_rebuild_pending = false;
+
 #ifndef PHYSICS_3D_DISABLED
 	bool use_collision = false;
 	uint32_t collision_layer = 1;
@@ -94,8 +105,19 @@ private:
 		Vector3 *normalsw = nullptr;
 		Vector2 *uvsw = nullptr;
 		real_t *tansw = nullptr;
+
+		bool tangents_valid = false;
 	};
 
+	uint32_t _snapshot_build_tree(BuildJob &r_job);
+	static void _evaluate_build_node(BuildJob &p_job, uint32_t p_index);
+	static void _evaluate_build_job(BuildJob &p_job);
+	static void _build_job_task(void *p_job);
+	static void _build_surfaces(const CSGBrush &p_brush, bool p_calculate_tangents, Vector<ShapeUpdateSurface> &r_surfaces);
+	void _update_mesh_from_surfaces(const Vector<ShapeUpdateSurface> &p_surfaces);
+	bool _apply_build_nodes(const BuildJob &p_job);
+	void _finish_async_update();
+
 	//mikktspace callbacks
 	static int mikktGetNumFaces(const SMikkTSpaceContext *pContext);
 	static int mikktGetNumVerticesOfFace(const SMikkTSpaceContext *pContext, const int iFace);
@@ -166,6 +188,9 @@ public:
 	void set_calculate_tangents(bool p_calculate_tangents);
 	bool is_calculating_tangents() const;
 
+	void set_use_async_update(bool p_enable);
+	bool is_using_async_update() const;
+
 	bool is_root_shape() const;
 
 	Ref<ArrayMesh> bake_static_mesh();
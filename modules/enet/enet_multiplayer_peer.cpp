@@ -30,6 +30,8 @@
 
 #include "enet_multiplayer_peer.h"
 
+#include "core/os/os.h"
+
 void ENetMultiplayerPeer::set_target_peer(int p_peer) {
 	target_peer = p_peer;
 }
@@ -71,6 +73,7 @@ Error ENetMultiplayerPeer::create_server(int p_port, int p_max_clients, int p_ma
 	unique_id = 1;
 	connection_status = CONNECTION_CONNECTED;
 	hosts[0] = host;
+	_start_thread();
 	return OK;
 }
 
@@ -102,6 +105,7 @@ Error ENetMultiplayerPeer::create_client(const String &p_address, int p_port, in
 	active_mode = MODE_CLIENT;
 	peers[1] = peer;
 	hosts[0] = host;
+	_start_thread();
 
 	return OK;
 }
@@ -112,6 +116,7 @@ Error ENetMultiplayerPeer::create_mesh(int p_id) {
 	active_mode = MODE_MESH;
 	unique_id = p_id;
 	connection_status = CONNECTION_CONNECTED;
+	_start_thread();
 	return OK;
 }
 
@@ -121,7 +126,10 @@ Error ENetMultiplayerPeer::add_mesh_peer(int p_id, Ref<ENetConnection> p_host) {
 	List<Ref<ENetPacketPeer>> host_peers;
 	p_host->get_peers(host_peers);
 	ERR_FAIL_COND_V_MSG(host_peers.size() != 1 || host_peers.front()->get()->get_state() != ENetPacketPeer::STATE_CONNECTED, ERR_INVALID_PARAMETER, "The provided host must have exactly one peer in the connected state.");
-	hosts[p_id] = p_host;
+	{
+		MutexLock lock(mutex);
+		hosts[p_id] = p_host;
+	}
 	peers[p_id] = host_peers.front()->get();
 	emit_signal(SNAME("peer_connected"), p_id);
 	return OK;
@@ -161,22 +169,65 @@ void ENetMultiplayerPeer::_disconnect_inactive_peers() {
 	}
 }
 
-void ENetMultiplayerPeer::poll() {
-	ERR_FAIL_COND_MSG(!_is_active(), "The multiplayer instance isn't currently active.");
+void ENetMultiplayerPeer::_thread_func(void *p_user) {
+	ENetMultiplayerPeer *mp = static_cast<ENetMultiplayerPeer *>(p_user);
+	while (!mp->thread_request_quit.is_set()) {
+		{
+			MutexLock lock(mp->mutex);
+			mp->_service(0);
+		}
+		// Servicing also pushes out queued sends, so acknowledgments, resends,
+		// and outgoing packets keep flowing between main loop iterations.
+		OS::delay_usec(200);
+	}
+}
 
-	_pop_current_packet();
+void ENetMultiplayerPeer::_start_thread() {
+	if (!use_threads.is_set()) {
+		return;
+	}
+	thread_request_quit.clear();
+	thread.start(_thread_func, this);
+}
 
-	_disconnect_inactive_peers();
+void ENetMultiplayerPeer::_service(int p_timeout) {
+	// Must be called with the mutex held while the service thread is running.
+	for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
+		HostEvent he;
+		he.host_key = E.key;
+		ENetConnection::EventType ret = E.value->service(p_timeout, he.event);
+		do {
+			if (ret == ENetConnection::EVENT_NONE) {
+				break;
+			}
+			he.type = ret;
+			pending_events.push_back(he);
+			if (ret == ENetConnection::EVENT_ERROR) {
+				break; // Let the main thread decide what to do with the host.
+			}
+			he = HostEvent();
+			he.host_key = E.key;
+		} while (E.value->check_events(ret, he.event) > 0);
+	}
+}
 
-	switch (active_mode) {
-		case MODE_CLIENT: {
-			if (!peers.has(1)) {
-				close();
-				return;
+bool ENetMultiplayerPeer::_process_pending_events() {
+	while (true) {
+		HostEvent he;
+		{
+			// Events are handled (and signals emitted) outside the lock, so
+			// handlers can safely call back into this peer.
+			MutexLock lock(mutex);
+			if (pending_events.is_empty()) {
+				break;
 			}
-			ENetConnection::Event event;
-			ENetConnection::EventType ret = hosts[0]->service(0, event);
-			do {
+			he = pending_events.front()->get();
+			pending_events.pop_front();
+		}
+		ENetConnection::EventType ret = he.type;
+		ENetConnection::Event &event = he.event;
+		switch (active_mode) {
+			case MODE_CLIENT: {
 				if (ret == ENetConnection::EVENT_CONNECT) {
 					connection_status = CONNECTION_CONNECTED;
 					emit_signal(SNAME("peer_connected"), 1);
@@ -185,25 +236,23 @@ void ENetMultiplayerPeer::poll() {
 						// Client just disconnected from server.
 						emit_signal(SNAME("peer_disconnected"), 1);
 					}
-					close();
+					return true;
 				} else if (ret == ENetConnection::EVENT_RECEIVE) {
 					_store_packet(1, event);
-				} else if (ret != ENetConnection::EVENT_NONE) {
-					close(); // Error.
+				} else {
+					return true; // Error.
 				}
-			} while (hosts.has(0) && hosts[0]->check_events(ret, event) > 0);
-		} break;
-		case MODE_SERVER: {
-			ENetConnection::Event event;
-			ENetConnection::EventType ret = hosts[0]->service(0, event);
-			do {
+			} break;
+			case MODE_SERVER: {
 				if (ret == ENetConnection::EVENT_CONNECT) {
 					if (is_refusing_new_connections()) {
+						MutexLock lock(mutex);
 						event.peer->reset();
 						continue;
 					}
 					// Client joined with invalid ID, probably trying to exploit us.
 					if (event.data < 2 || peers.has((int)event.data)) {
+						MutexLock lock(mutex);
 						event.peer->reset();
 						continue;
 					}
@@ -222,39 +271,63 @@ void ENetMultiplayerPeer::poll() {
 				} else if (ret == ENetConnection::EVENT_RECEIVE) {
 					int32_t source = event.peer->get_meta(SNAME("_net_id"));
 					_store_packet(source, event);
-				} else if (ret != ENetConnection::EVENT_NONE) {
-					close(); // Error
+				} else {
+					return true; // Error.
 				}
-			} while (hosts.has(0) && hosts[0]->check_events(ret, event) > 0);
-		} break;
-		case MODE_MESH: {
-			HashSet<int> to_drop;
-			for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
-				ENetConnection::Event event;
-				ENetConnection::EventType ret = E.value->service(0, event);
-				do {
-					if (ret == ENetConnection::EVENT_CONNECT) {
-						event.peer->reset();
-					} else if (ret == ENetConnection::EVENT_RECEIVE) {
-						_store_packet(E.key, event);
-					} else if (ret == ENetConnection::EVENT_NONE) {
-						break; // Keep polling the others.
-					} else {
-						to_drop.insert(E.key); // Error or disconnect.
-						break; // Keep polling the others.
+			} break;
+			case MODE_MESH: {
+				if (ret == ENetConnection::EVENT_CONNECT) {
+					MutexLock lock(mutex);
+					event.peer->reset();
+				} else if (ret == ENetConnection::EVENT_RECEIVE) {
+					_store_packet(he.host_key, event);
+				} else {
+					// Error or disconnect; drop the host.
+					{
+						MutexLock lock(mutex);
+						hosts.erase(he.host_key);
+					}
+					if (peers.has(he.host_key)) {
+						emit_signal(SNAME("peer_disconnected"), he.host_key);
+						peers.erase(he.host_key);
 					}
-				} while (E.value->check_events(ret, event) > 0);
-			}
-			for (const int &P : to_drop) {
-				if (peers.has(P)) {
-					emit_signal(SNAME("peer_disconnected"), P);
-					peers.erase(P);
 				}
-				hosts.erase(P);
-			}
-		} break;
-		default:
-			return;
+			} break;
+			default:
+				return false;
+		}
+	}
+	return false;
+}
+
+void ENetMultiplayerPeer::_clear_pending_events() {
+	for (HostEvent &E : pending_events) {
+		if (E.type == ENetConnection::EVENT_RECEIVE) {
+			_destroy_unused(E.event.packet);
+		}
+	}
+	pending_events.clear();
+}
+
+void ENetMultiplayerPeer::poll() {
+	ERR_FAIL_COND_MSG(!_is_active(), "The multiplayer instance isn't currently active.");
+
+	_pop_current_packet();
+
+	_disconnect_inactive_peers();
+
+	if (active_mode == MODE_CLIENT && !peers.has(1)) {
+		close();
+		return;
+	}
+
+	if (!use_threads.is_set()) {
+		MutexLock lock(mutex);
+		_service(0);
+	}
+
+	if (_process_pending_events()) {
+		close(); // Error, or the server disconnected us.
 	}
 }
 
@@ -268,23 +341,28 @@ bool ENetMultiplayerPeer::is_server_relay_supported() const {
 
 void ENetMultiplayerPeer::disconnect_peer(int p_peer, bool p_force) {
 	ERR_FAIL_COND(!_is_active() || !peers.has(p_peer));
-	peers[p_peer]->peer_disconnect(0); // Will be removed during next poll.
-	if (active_mode == MODE_CLIENT || active_mode == MODE_SERVER) {
-		hosts[0]->flush();
-	} else {
-		ERR_FAIL_COND(!hosts.has(p_peer));
-		hosts[p_peer]->flush();
-	}
-	if (p_force) {
-		peers.erase(p_peer);
-		if (hosts.has(p_peer)) {
-			hosts.erase(p_peer);
+	{
+		MutexLock lock(mutex);
+		peers[p_peer]->peer_disconnect(0); // Will be removed during next poll.
+		if (active_mode == MODE_CLIENT || active_mode == MODE_SERVER) {
+			hosts[0]->flush();
+		} else {
+			ERR_FAIL_COND(!hosts.has(p_peer));
+			hosts[p_peer]->flush();
 		}
-		if (active_mode == MODE_CLIENT) {
-			hosts.clear(); // Avoid flushing again.
-			close();
+		if (p_force) {
+			peers.erase(p_peer);
+			if (hosts.has(p_peer)) {
+				hosts.erase(p_peer);
+			}
+			if (active_mode == MODE_CLIENT) {
+				hosts.clear(); // Avoid flushing again.
+			}
 		}
 	}
+	if (p_force && active_mode == MODE_CLIENT) {
+		close();
+	}
 }
 
 void ENetMultiplayerPeer::close() {
@@ -292,7 +370,14 @@ void ENetMultiplayerPeer::close() {
 		return;
 	}
 
+	if (thread.is_started()) {
+		thread_request_quit.set();
+		thread.wait_to_finish();
+		thread_request_quit.clear();
+	}
+
 	_pop_current_packet();
+	_clear_pending_events();
 
 	for (KeyValue<int, Ref<ENetPacketPeer>> &E : peers) {
 		if (E.value.is_valid() && E.value->get_state() == ENetPacketPeer::STATE_CONNECTED) {
@@ -367,6 +452,11 @@ Error ENetMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size
 	ENetPacket *packet = enet_packet_create(nullptr, p_buffer_size, packet_flags);
 	memcpy(&packet->data[0], p_buffer, p_buffer_size);
 
+	// When threaded, skip flushing; the service thread pushes queued sends out
+	// shortly after, coalescing packets queued in the meantime into fewer datagrams.
+	const bool flush_sends = !use_threads.is_set();
+	MutexLock lock(mutex);
+
 	if (is_server()) {
 		if (target_peer == 0) {
 			hosts[0]->broadcast(channel, packet);
@@ -385,12 +475,16 @@ Error ENetMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size
 			peers[target_peer]->send(channel, packet);
 		}
 		ERR_FAIL_COND_V(!hosts.has(0), ERR_BUG);
-		hosts[0]->flush();
+		if (flush_sends) {
+			hosts[0]->flush();
+		}
 
 	} else if (active_mode == MODE_CLIENT) {
 		peers[1]->send(channel, packet); // Send to server for broadcast.
 		ERR_FAIL_COND_V(!hosts.has(0), ERR_BUG);
-		hosts[0]->flush();
+		if (flush_sends) {
+			hosts[0]->flush();
+		}
 
 	} else {
 		if (target_peer <= 0) {
@@ -401,13 +495,17 @@ Error ENetMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size
 				}
 				E.value->send(channel, packet);
 				ERR_CONTINUE(!hosts.has(E.key));
-				hosts[E.key]->flush();
+				if (flush_sends) {
+					hosts[E.key]->flush();
+				}
 			}
 			_destroy_unused(packet);
 		} else {
 			peers[target_peer]->send(channel, packet);
 			ERR_FAIL_COND_V(!hosts.has(target_peer), ERR_BUG);
-			hosts[target_peer]->flush();
+			if (flush_sends) {
+				hosts[target_peer]->flush();
+			}
 		}
 	}
 
@@ -440,6 +538,7 @@ int ENetMultiplayerPeer::get_unique_id() const {
 void ENetMultiplayerPeer::set_refuse_new_connections(bool p_enabled) {
 #ifdef GODOT_ENET
 	if (_is_active()) {
+		MutexLock lock(mutex);
 		for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
 			E.value->refuse_new_connections(p_enabled);
 		}
@@ -448,6 +547,15 @@ void ENetMultiplayerPeer::set_refuse_new_connections(bool p_enabled) {
 	MultiplayerPeer::set_refuse_new_connections(p_enabled);
 }
 
+void ENetMultiplayerPeer::set_use_threads(bool p_use) {
+	ERR_FAIL_COND_MSG(_is_active(), "The thread mode can't be changed while the multiplayer instance is active.");
+	use_threads.set_to(p_use);
+}
+
+bool ENetMultiplayerPeer::is_using_threads() const {
+	return use_threads.is_set();
+}
+
 Ref<ENetConnection> ENetMultiplayerPeer::get_host() const {
 	ERR_FAIL_COND_V(!_is_active(), nullptr);
 	ERR_FAIL_COND_V(active_mode == MODE_MESH, nullptr);
@@ -477,7 +585,11 @@ void ENetMultiplayerPeer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_host"), &ENetMultiplayerPeer::get_host);
 	ClassDB::bind_method(D_METHOD("get_peer", "id"), &ENetMultiplayerPeer::get_peer);
 
+	ClassDB::bind_method(D_METHOD("set_use_threads", "use_threads"), &ENetMultiplayerPeer::set_use_threads);
+	ClassDB::bind_method(D_METHOD("is_using_threads"), &ENetMultiplayerPeer::is_using_threads);
+
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "host", PROPERTY_HINT_RESOURCE_TYPE, "ENetConnection", PROPERTY_USAGE_NONE), "", "get_host");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_threads"), "set_use_threads", "is_using_threads");
 }
 
 ENetMultiplayerPeer::ENetMultiplayerPeer() {
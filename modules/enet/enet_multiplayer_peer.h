@@ -33,6 +33,9 @@
 #include "enet_connection.h"
 
 #include "core/crypto/crypto.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/main/multiplayer_peer.h"
 
 #include <enet/enet.h>
@@ -81,6 +84,26 @@ private:
 
 	Packet current_packet;
 
+	struct HostEvent {
+		int host_key = 0;
+		ENetConnection::EventType type = ENetConnection::EVENT_NONE;
+		ENetConnection::Event event;
+	};
+
+	// Events gathered by _service, consumed (on the main thread) during poll.
+	List<HostEvent> pending_events;
+
+	SafeFlag use_threads;
+	SafeFlag thread_request_quit;
+	Thread thread;
+	BinaryMutex mutex; // Guards the hosts and pending_events while the service thread runs.
+
+	static void _thread_func(void *p_user);
+	void _start_thread();
+	void _service(int p_timeout);
+	bool _process_pending_events(); // Returns true when the connection should be closed.
+	void _clear_pending_events();
+
 	void _store_packet(int32_t p_source, ENetConnection::Event &p_event);
 	void _pop_current_packet();
 	void _disconnect_inactive_peers();
@@ -125,6 +148,9 @@ public:
 
 	void set_bind_ip(const IPAddress &p_ip);
 
+	void set_use_threads(bool p_use);
+	bool is_using_threads() const;
+
 	Ref<ENetConnection> get_host() const;
 	Ref<ENetPacketPeer> get_peer(int p_id) const;
 
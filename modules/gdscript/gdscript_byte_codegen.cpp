@@ -602,8 +602,8 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 	}
 
 	if (valid) {
+		Variant::Type result_type = Variant::get_operator_return_type(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 		if (p_target.mode == Address::TEMPORARY) {
-			Variant::Type result_type = Variant::get_operator_return_type(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 			Variant::Type temp_type = temporaries[p_target.address].type;
 			if (result_type != temp_type) {
 				write_type_adjust(p_target, result_type);
@@ -613,6 +613,7 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
+		int operator_pos = opcodes.size();
 		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
 		append(p_left_operand);
 		append(p_right_operand);
@@ -621,6 +622,11 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 #ifdef DEBUG_ENABLED
 		add_debug_name(operator_names, get_operation_pos(op_func), Variant::get_operator_name(p_operator));
 #endif
+		if (result_type == Variant::BOOL && p_target.mode == Address::TEMPORARY) {
+			// A conditional jump on this result may fuse with the operator.
+			operator_jump_fusion_pos = operator_pos;
+			operator_jump_fusion_target = p_target;
+		}
 		return;
 	}
 
@@ -690,16 +696,35 @@ void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const A
 	}
 }
 
+bool GDScriptByteCodeGenerator::try_fuse_operator_jump(GDScriptFunction::Opcode p_fused_opcode, const Address &p_condition) {
+	if (operator_jump_fusion_pos < 0 || opcodes.size() != operator_jump_fusion_pos + 5) {
+		return false;
+	}
+	if (p_condition.mode != Address::TEMPORARY || p_condition.address != operator_jump_fusion_target.address) {
+		return false;
+	}
+	// Rewrite the operator in place into the fused operator+branch form; the
+	// caller appends the jump target. The instruction start doesn't move, so
+	// recorded jump targets and temporary patch positions stay valid.
+	opcodes.write[operator_jump_fusion_pos] = p_fused_opcode;
+	operator_jump_fusion_pos = -1;
+	return true;
+}
+
 void GDScriptByteCodeGenerator::write_and_left_operand(const Address &p_left_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_left_operand);
+	if (!try_fuse_operator_jump(GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT, p_left_operand)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_left_operand);
+	}
 	logic_op_jump_pos1.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
 
 void GDScriptByteCodeGenerator::write_and_right_operand(const Address &p_right_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_right_operand);
+	if (!try_fuse_operator_jump(GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT, p_right_operand)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_right_operand);
+	}
 	logic_op_jump_pos2.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -721,15 +746,19 @@ void GDScriptByteCodeGenerator::write_end_and(const Address &p_target) {
 }
 
 void GDScriptByteCodeGenerator::write_or_left_operand(const Address &p_left_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF);
-	append(p_left_operand);
+	if (!try_fuse_operator_jump(GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF, p_left_operand)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF);
+		append(p_left_operand);
+	}
 	logic_op_jump_pos1.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
 
 void GDScriptByteCodeGenerator::write_or_right_operand(const Address &p_right_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF);
-	append(p_right_operand);
+	if (!try_fuse_operator_jump(GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF, p_right_operand)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF);
+		append(p_right_operand);
+	}
 	logic_op_jump_pos2.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -1509,8 +1538,10 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (!try_fuse_operator_jump(GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT, p_condition)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
 }
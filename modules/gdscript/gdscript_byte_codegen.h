@@ -355,6 +355,14 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	CallTarget get_call_target(const Address &p_target, Variant::Type p_type = Variant::NIL);
 
+	// Position of the last emitted validated operator with a boolean result and
+	// a temporary target, for fusing with an immediately following conditional
+	// jump on that temporary. Reset by any other instruction.
+	int operator_jump_fusion_pos = -1;
+	Address operator_jump_fusion_target;
+
+	bool try_fuse_operator_jump(GDScriptFunction::Opcode p_fused_opcode, const Address &p_condition);
+
 	int address_of(const Address &p_address) {
 		switch (p_address.mode) {
 			case Address::SELF:
@@ -378,10 +386,12 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	}
 
 	void append_opcode(GDScriptFunction::Opcode p_code) {
+		operator_jump_fusion_pos = -1;
 		opcodes.push_back(p_code);
 	}
 
 	void append_opcode_and_argcount(GDScriptFunction::Opcode p_code, int p_argument_count) {
+		operator_jump_fusion_pos = -1;
 		opcodes.push_back(p_code);
 		opcodes.push_back(p_argument_count);
 		instr_args_max = MAX(instr_args_max, p_argument_count);
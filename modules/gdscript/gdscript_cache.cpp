@@ -36,6 +36,8 @@
 #include "gdscript_parser.h"
 
 #include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/vector.h"
 
 GDScriptParserRef::Status GDScriptParserRef::get_status() const {
@@ -68,6 +70,12 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 	ERR_FAIL_COND_V(clearing, ERR_BUG);
 	ERR_FAIL_COND_V(parser == nullptr && status != EMPTY, ERR_BUG);
 
+	// Parsing may run outside the global cache mutex (see
+	// GDScriptCache::finish_compiling()), so status transitions are serialized per
+	// reference. Threads raising past PARSED always hold the global mutex as well,
+	// so the analysis stages stay effectively single-threaded.
+	MutexLock lock(parse_mutex);
+
 	while (result == OK && p_new_status > status) {
 		switch (status) {
 			case EMPTY: {
@@ -111,6 +119,9 @@ void GDScriptParserRef::clear() {
 	if (clearing) {
 		return;
 	}
+
+	MutexLock lock(parse_mutex);
+
 	clearing = true;
 
 	GDScriptParser *lparser = parser;
@@ -418,6 +429,28 @@ Error GDScriptCache::finish_compiling(const String &p_owner) {
 
 	HashSet<String> depends = singleton->dependencies[p_owner];
 
+	// Parse unparsed dependencies in parallel before compiling them one by one.
+	// Parsing is the only stage that doesn't touch other scripts, so it's the
+	// only one that can run outside the global mutex (which is lifted while
+	// waiting, following the same tradeoff as the reload in get_full_script()).
+	if (depends.size() > 1) {
+		LocalVector<Ref<GDScriptParserRef>> parser_refs;
+		for (const String &E : depends) {
+			Error parse_err = OK;
+			Ref<GDScriptParserRef> parser_ref = get_parser(E, GDScriptParserRef::EMPTY, parse_err);
+			if (parse_err == OK && parser_ref.is_valid() && parser_ref->get_status() == GDScriptParserRef::EMPTY) {
+				parser_refs.push_back(parser_ref);
+			}
+		}
+
+		if (parser_refs.size() > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&GDScriptCache::_parse_script_task, parser_refs.ptr(), parser_refs.size(), -1, false, "GDScript dependency parse");
+			uint32_t allowance_id = WorkerThreadPool::thread_enter_unlock_allowance_zone(singleton->mutex);
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			WorkerThreadPool::thread_exit_unlock_allowance_zone(allowance_id);
+		}
+	}
+
 	Error err = OK;
 	for (const String &E : depends) {
 		Error this_err = OK;
@@ -434,6 +467,12 @@ Error GDScriptCache::finish_compiling(const String &p_owner) {
 	return err;
 }
 
+void GDScriptCache::_parse_script_task(void *p_parser_refs, uint32_t p_index) {
+	Ref<GDScriptParserRef> *parser_refs = static_cast<Ref<GDScriptParserRef> *>(p_parser_refs);
+	// Errors are ignored here; they resurface when the script is compiled.
+	parser_refs[p_index]->raise_status(GDScriptParserRef::PARSED);
+}
+
 void GDScriptCache::add_static_script(Ref<GDScript> p_script) {
 	ERR_FAIL_COND_MSG(p_script.is_null(), "Trying to cache empty script as static.");
 	ERR_FAIL_COND_MSG(!p_script->is_valid(), "Trying to cache non-compiled script as static.");
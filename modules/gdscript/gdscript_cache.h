@@ -61,6 +61,10 @@ private:
 	uint32_t source_hash = 0;
 	bool clearing = false;
 	bool abandoned = false;
+	// Guards status transitions, since parsing may run outside the global cache
+	// mutex (see GDScriptCache::finish_compiling()). Recursive on purpose, as
+	// both parsing and clearing can re-enter this reference.
+	Mutex parse_mutex;
 
 	friend class GDScriptCache;
 	friend class GDScript;
@@ -96,6 +100,8 @@ class GDScriptCache {
 
 	bool cleared = false;
 
+	static void _parse_script_task(void *p_parser_refs, uint32_t p_index);
+
 public:
 	static const int BINARY_MUTEX_TAG = 2;
 
@@ -238,9 +238,66 @@ Variant GDScriptFunctionState::resume(const Variant &p_arg) {
 	return ret;
 }
 
+SpinLock GDScriptFunctionState::stack_pool_lock;
+LocalVector<uint8_t *> GDScriptFunctionState::stack_pool_buckets[STACK_POOL_BUCKET_COUNT];
+
+uint8_t *GDScriptFunctionState::alloc_stack(uint32_t p_size) {
+	if (p_size > ((uint32_t)1 << STACK_POOL_MAX_SHIFT)) {
+		return (uint8_t *)memalloc(p_size);
+	}
+	uint32_t shift = STACK_POOL_MIN_SHIFT;
+	while (((uint32_t)1 << shift) < p_size) {
+		shift++;
+	}
+	LocalVector<uint8_t *> &bucket = stack_pool_buckets[shift - STACK_POOL_MIN_SHIFT];
+	uint8_t *stack = nullptr;
+	stack_pool_lock.lock();
+	if (!bucket.is_empty()) {
+		stack = bucket[bucket.size() - 1];
+		bucket.remove_at(bucket.size() - 1);
+	}
+	stack_pool_lock.unlock();
+	if (!stack) {
+		stack = (uint8_t *)memalloc((uint32_t)1 << shift);
+	}
+	return stack;
+}
+
+void GDScriptFunctionState::free_stack(uint8_t *p_stack, uint32_t p_size) {
+	if (p_size > ((uint32_t)1 << STACK_POOL_MAX_SHIFT)) {
+		memfree(p_stack);
+		return;
+	}
+	uint32_t shift = STACK_POOL_MIN_SHIFT;
+	while (((uint32_t)1 << shift) < p_size) {
+		shift++;
+	}
+	LocalVector<uint8_t *> &bucket = stack_pool_buckets[shift - STACK_POOL_MIN_SHIFT];
+	stack_pool_lock.lock();
+	bool pooled = bucket.size() < STACK_POOL_MAX_PER_BUCKET;
+	if (pooled) {
+		bucket.push_back(p_stack);
+	}
+	stack_pool_lock.unlock();
+	if (!pooled) {
+		memfree(p_stack);
+	}
+}
+
+void GDScriptFunctionState::clear_stack_pool() {
+	stack_pool_lock.lock();
+	for (uint32_t i = 0; i < STACK_POOL_BUCKET_COUNT; i++) {
+		for (uint8_t *stack : stack_pool_buckets[i]) {
+			memfree(stack);
+		}
+		stack_pool_buckets[i].clear();
+	}
+	stack_pool_lock.unlock();
+}
+
 void GDScriptFunctionState::_clear_stack() {
 	if (state.stack_size) {
-		Variant *stack = (Variant *)state.stack.ptr();
+		Variant *stack = (Variant *)state.stack;
 		// First `GDScriptFunction::FIXED_ADDRESSES_MAX` stack addresses are special
 		// and not copied to the state, so we skip them here.
 		for (int i = GDScriptFunction::FIXED_ADDRESSES_MAX; i < state.stack_size; i++) {
@@ -248,6 +305,11 @@ void GDScriptFunctionState::_clear_stack() {
 		}
 		state.stack_size = 0;
 	}
+	if (state.stack) {
+		free_stack(state.stack, state.stack_alloc_size);
+		state.stack = nullptr;
+		state.stack_alloc_size = 0;
+	}
 }
 
 void GDScriptFunctionState::_clear_connections() {
@@ -273,6 +335,13 @@ GDScriptFunctionState::GDScriptFunctionState() :
 }
 
 GDScriptFunctionState::~GDScriptFunctionState() {
+	if (state.stack) {
+		// Don't go through _clear_stack(): when the function was resumed and
+		// awaited again, the VM already destructed the stack variants but this
+		// state still owns the buffer.
+		free_stack(state.stack, state.stack_alloc_size);
+		state.stack = nullptr;
+	}
 	{
 		MutexLock lock(GDScriptLanguage::singleton->mutex);
 		scripts_list.remove_from_list();
@@ -34,7 +34,9 @@
 
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
+#include "core/os/spin_lock.h"
 #include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
 #include "core/templates/self_list.h"
@@ -265,6 +267,8 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF,
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,
 		OPCODE_TYPE_TEST_BUILTIN,
 		OPCODE_TYPE_TEST_ARRAY,
 		OPCODE_TYPE_TEST_DICTIONARY,
@@ -578,7 +582,8 @@ public:
 		StringName function_name;
 		String script_path;
 #endif
-		Vector<uint8_t> stack;
+		uint8_t *stack = nullptr; // Owned; allocated from the function state stack pool.
+		uint32_t stack_alloc_size = 0;
 		int stack_size = 0;
 		int ip = 0;
 		int line = 0;
@@ -622,6 +627,18 @@ class GDScriptFunctionState : public RefCounted {
 	SelfList<GDScriptFunctionState> scripts_list;
 	SelfList<GDScriptFunctionState> instances_list;
 
+	// Suspended-function stacks are recycled through a small bucketed pool, so
+	// scripts awaiting thousands of coroutines don't pay a heap allocation per
+	// suspension. Buffers above the largest bucket are allocated directly.
+	enum {
+		STACK_POOL_MIN_SHIFT = 9, // 512 bytes.
+		STACK_POOL_MAX_SHIFT = 16, // 64 KiB.
+		STACK_POOL_BUCKET_COUNT = STACK_POOL_MAX_SHIFT - STACK_POOL_MIN_SHIFT + 1,
+		STACK_POOL_MAX_PER_BUCKET = 64,
+	};
+	static SpinLock stack_pool_lock;
+	static LocalVector<uint8_t *> stack_pool_buckets[STACK_POOL_BUCKET_COUNT];
+
 protected:
 	static void _bind_methods();
 
@@ -636,6 +653,10 @@ public:
 	}
 #endif
 
+	static uint8_t *alloc_stack(uint32_t p_size);
+	static void free_stack(uint8_t *p_stack, uint32_t p_size);
+	static void clear_stack_pool();
+
 	void _clear_stack();
 	void _clear_connections();
 
@@ -63,7 +63,8 @@ public:
 
 	GDScriptLambdaCallable(GDScriptLambdaCallable &) = delete;
 	GDScriptLambdaCallable(const GDScriptLambdaCallable &) = delete;
-	GDScriptLambdaCallable(Ref<GDScript> p_script, GDScriptFunction *p_function, const Vector<Variant> &p_captures);
+	// Captures are taken by value so creation sites can move them in instead of copying.
+	GDScriptLambdaCallable(Ref<GDScript> p_script, GDScriptFunction *p_function, Vector<Variant> p_captures);
 	virtual ~GDScriptLambdaCallable() = default;
 };
 
@@ -92,7 +93,7 @@ public:
 
 	GDScriptLambdaSelfCallable(GDScriptLambdaSelfCallable &) = delete;
 	GDScriptLambdaSelfCallable(const GDScriptLambdaSelfCallable &) = delete;
-	GDScriptLambdaSelfCallable(Ref<RefCounted> p_self, GDScriptFunction *p_function, const Vector<Variant> &p_captures);
-	GDScriptLambdaSelfCallable(Object *p_self, GDScriptFunction *p_function, const Vector<Variant> &p_captures);
+	GDScriptLambdaSelfCallable(Ref<RefCounted> p_self, GDScriptFunction *p_function, Vector<Variant> p_captures);
+	GDScriptLambdaSelfCallable(Object *p_self, GDScriptFunction *p_function, Vector<Variant> p_captures);
 	virtual ~GDScriptLambdaSelfCallable() = default;
 };
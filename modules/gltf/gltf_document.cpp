@@ -44,6 +44,7 @@
 #include "core/io/json.h"
 #include "core/io/stream_peer.h"
 #include "core/object/object_id.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 #include "scene/2d/node_2d.h"
 #include "scene/3d/bone_attachment_3d.h"
@@ -3881,6 +3882,11 @@ Ref<Image> GLTFDocument::_parse_image_bytes_into_image(Ref<GLTFState> p_state, c
 		}
 	}
 	// If no extension wanted to import this data as an image, try to load a PNG or JPEG.
+	_parse_image_bytes_decode(p_bytes, p_mime_type, p_index, r_image, r_file_extension);
+	return r_image;
+}
+
+void GLTFDocument::_parse_image_bytes_decode(const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, Ref<Image> &r_image, String &r_file_extension) {
 	// First we honor the mime types if they were defined.
 	if (p_mime_type == "image/png") { // Load buffer as PNG.
 		r_image->load_png_from_buffer(p_bytes);
@@ -3905,7 +3911,15 @@ Ref<Image> GLTFDocument::_parse_image_bytes_into_image(Ref<GLTFState> p_state, c
 	if (r_image->is_empty()) {
 		ERR_PRINT(vformat("glTF: Couldn't load image index '%d' with its given mimetype: %s.", p_index, p_mime_type));
 	}
-	return r_image;
+}
+
+void GLTFDocument::_decode_parsed_image_task(uint32_t p_index, ParsedImageEntry *p_entries) {
+	ParsedImageEntry &entry = p_entries[p_index];
+	if (!entry.needs_decode) {
+		return;
+	}
+	entry.image.instantiate();
+	_parse_image_bytes_decode(entry.data, entry.mime_type, p_index, entry.image, entry.file_extension);
 }
 
 void GLTFDocument::_parse_image_save_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_resource_uri, const String &p_file_extension, int p_index, Ref<Image> p_image) {
@@ -4029,7 +4043,15 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 
 	const Array &images = p_state->json["images"];
 	HashSet<String> used_names;
+	LocalVector<ParsedImageEntry> entries;
+	entries.resize(images.size());
+	uint32_t decode_count = 0;
+
+	// First pass, serial: gather the image bytes from their URIs or buffer views, and let
+	// extensions claim them. Decoding of the gathered bytes is deferred so it can run in
+	// parallel below.
 	for (int i = 0; i < images.size(); i++) {
+		ParsedImageEntry &entry = entries[i];
 		const Dictionary &dict = images[i];
 
 		// glTF 2.0 supports PNG and JPEG types, which can be specified as (from spec):
@@ -4041,14 +4063,14 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 
 		// We'll assume that we use either URI or bufferView, so let's warn the user
 		// if their image somehow uses both. And fail if it has neither.
-		ERR_CONTINUE_MSG(!dict.has("uri") && !dict.has("bufferView"), "Invalid image definition in glTF file, it should specify an 'uri' or 'bufferView'.");
+		entry.skip = !dict.has("uri") && !dict.has("bufferView");
+		ERR_CONTINUE_MSG(entry.skip, "Invalid image definition in glTF file, it should specify an 'uri' or 'bufferView'.");
 		if (dict.has("uri") && dict.has("bufferView")) {
 			WARN_PRINT("Invalid image definition in glTF file using both 'uri' and 'bufferView'. 'uri' will take precedence.");
 		}
 
-		String mime_type;
 		if (dict.has("mimeType")) { // Should be "image/png", "image/jpeg", or something handled by an extension.
-			mime_type = dict["mimeType"];
+			entry.mime_type = dict["mimeType"];
 		}
 
 		String image_name;
@@ -4062,59 +4084,55 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 		while (used_names.has(image_name)) {
 			image_name += "_" + itos(i);
 		}
-
-		String resource_uri;
-
 		used_names.insert(image_name);
+		entry.image_name = image_name;
+
 		// Load the image data. If we get a byte array, store here for later.
-		Vector<uint8_t> data;
 		if (dict.has("uri")) {
 			// Handles the first two bullet points from the spec (embedded data, or external file).
 			String uri = dict["uri"];
 			if (uri.begins_with("data:")) { // Embedded data using base64.
-				data = _parse_base64_uri(uri);
+				entry.data = _parse_base64_uri(uri);
 				// mimeType is optional, but if we have it defined in the URI, let's use it.
-				if (mime_type.is_empty() && uri.contains_char(';')) {
+				if (entry.mime_type.is_empty() && uri.contains_char(';')) {
 					// Trim "data:" prefix which is 5 characters long, and end at ";base64".
-					mime_type = uri.substr(5, uri.find(";base64") - 5);
+					entry.mime_type = uri.substr(5, uri.find(";base64") - 5);
 				}
 			} else { // Relative path to an external image file.
 				ERR_FAIL_COND_V(p_base_path.is_empty(), ERR_INVALID_PARAMETER);
 				uri = uri.uri_file_decode();
 				uri = p_base_path.path_join(uri).replace_char('\\', '/'); // Fix for Windows.
-				resource_uri = uri.simplify_path();
+				entry.resource_uri = uri.simplify_path();
 				// ResourceLoader will rely on the file extension to use the relevant loader.
 				// The spec says that if mimeType is defined, it should take precedence (e.g.
 				// there could be a `.png` image which is actually JPEG), but there's no easy
 				// API for that in Godot, so we'd have to load as a buffer (i.e. embedded in
 				// the material), so we only do that only as fallback.
-				if (ResourceLoader::exists(resource_uri)) {
-					Ref<Texture2D> texture = ResourceLoader::load(resource_uri, "Texture2D");
+				if (ResourceLoader::exists(entry.resource_uri)) {
+					Ref<Texture2D> texture = ResourceLoader::load(entry.resource_uri, "Texture2D");
 					if (texture.is_valid()) {
-						p_state->images.push_back(texture);
-						p_state->source_images.push_back(texture->get_image());
+						entry.texture = texture;
+						entry.image = texture->get_image();
 						continue;
 					}
 				}
 				// mimeType is optional, but if we have it in the file extension, let's use it.
 				// If the mimeType does not match with the file extension, either it should be
 				// specified in the file, or the GLTFDocumentExtension should handle it.
-				if (mime_type.is_empty()) {
-					mime_type = "image/" + resource_uri.get_extension();
+				if (entry.mime_type.is_empty()) {
+					entry.mime_type = "image/" + entry.resource_uri.get_extension();
 				}
 				// Fallback to loading as byte array. This enables us to support the
 				// spec's requirement that we honor mimetype regardless of file URI.
-				data = FileAccess::get_file_as_bytes(resource_uri);
-				if (data.is_empty()) {
-					WARN_PRINT(vformat("glTF: Image index '%d' couldn't be loaded as a buffer of MIME type '%s' from URI: %s because there was no data to load. Skipping it.", i, mime_type, resource_uri));
-					p_state->images.push_back(Ref<Texture2D>()); // Placeholder to keep count.
-					p_state->source_images.push_back(Ref<Image>());
-					continue;
+				entry.data = FileAccess::get_file_as_bytes(entry.resource_uri);
+				if (entry.data.is_empty()) {
+					WARN_PRINT(vformat("glTF: Image index '%d' couldn't be loaded as a buffer of MIME type '%s' from URI: %s because there was no data to load. Skipping it.", i, entry.mime_type, entry.resource_uri));
+					continue; // Placeholder to keep count.
 				}
 			}
 		} else if (dict.has("bufferView")) {
 			// Handles the third bullet point from the spec (bufferView).
-			ERR_FAIL_COND_V_MSG(mime_type.is_empty(), ERR_FILE_CORRUPT, vformat("glTF: Image index '%d' specifies 'bufferView' but no 'mimeType', which is invalid.", i));
+			ERR_FAIL_COND_V_MSG(entry.mime_type.is_empty(), ERR_FILE_CORRUPT, vformat("glTF: Image index '%d' specifies 'bufferView' but no 'mimeType', which is invalid.", i));
 			const GLTFBufferViewIndex bvi = dict["bufferView"];
 			ERR_FAIL_INDEX_V(bvi, p_state->buffer_views.size(), ERR_PARAMETER_RANGE_ERROR);
 			Ref<GLTFBufferView> bv = p_state->buffer_views[bvi];
@@ -4122,21 +4140,54 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> p_state, const String &p_base_p
 			ERR_FAIL_INDEX_V(bi, p_state->buffers.size(), ERR_PARAMETER_RANGE_ERROR);
 			ERR_FAIL_COND_V(bv->byte_offset + bv->byte_length > p_state->buffers[bi].size(), ERR_FILE_CORRUPT);
 			const PackedByteArray &buffer = p_state->buffers[bi];
-			data = buffer.slice(bv->byte_offset, bv->byte_offset + bv->byte_length);
+			entry.data = buffer.slice(bv->byte_offset, bv->byte_offset + bv->byte_length);
 		}
 		// Done loading the image data bytes. Check that we actually got data to parse.
 		// Note: There are paths above that return early, so this point might not be reached.
-		if (data.is_empty()) {
+		if (entry.data.is_empty()) {
 			WARN_PRINT(vformat("glTF: Image index '%d' couldn't be loaded, no data found. Skipping it.", i));
+			continue; // Placeholder to keep count.
+		}
+		if (document_extensions.is_empty()) {
+			// Plain PNG/JPEG decode, safe to run on pool threads.
+			entry.needs_decode = true;
+			decode_count++;
+		} else {
+			// Extensions can run script code, so images are decoded here when any are registered.
+			entry.image = _parse_image_bytes_into_image(p_state, entry.data, entry.mime_type, i, entry.file_extension);
+		}
+	}
+
+	// Second pass: decode the gathered image bytes in parallel.
+	if (decode_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GLTFDocument::_decode_parsed_image_task, entries.ptr(), entries.size(), -1, true, SNAME("GLTFDecodeImages"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (decode_count == 1) {
+		for (uint32_t i = 0; i < entries.size(); i++) {
+			_decode_parsed_image_task(i, entries.ptr());
+		}
+	}
+
+	// Third pass, serial: save or embed the decoded images and register the resulting
+	// textures in the state, which must happen in index order.
+	for (int i = 0; i < images.size(); i++) {
+		ParsedImageEntry &entry = entries[i];
+		if (entry.skip) {
+			continue;
+		}
+		if (entry.texture.is_valid()) {
+			p_state->images.push_back(entry.texture);
+			p_state->source_images.push_back(entry.image);
+			continue;
+		}
+		if (entry.image.is_null()) {
 			p_state->images.push_back(Ref<Texture2D>()); // Placeholder to keep count.
 			p_state->source_images.push_back(Ref<Image>());
 			continue;
 		}
-		// Parse the image data from bytes into an Image resource and save if needed.
-		String file_extension;
-		Ref<Image> img = _parse_image_bytes_into_image(p_state, data, mime_type, i, file_extension);
-		img->set_name(image_name);
-		_parse_image_save_image(p_state, data, resource_uri, file_extension, i, img);
+		// Save the decoded image if needed, and register the resulting texture.
+		entry.image->set_name(entry.image_name);
+		_parse_image_save_image(p_state, entry.data, entry.resource_uri, entry.file_extension, i, entry.image);
 	}
 
 	print_verbose("glTF: Total images: " + itos(p_state->images.size()));
@@ -194,6 +194,19 @@ private:
 	Error _serialize_images(Ref<GLTFState> p_state);
 	Dictionary _serialize_image(Ref<GLTFState> p_state, Ref<Image> p_image, const String &p_image_format, float p_lossy_quality, Ref<GLTFDocumentExtension> p_image_save_extension);
 	Error _serialize_lights(Ref<GLTFState> p_state);
+	struct ParsedImageEntry {
+		Vector<uint8_t> data;
+		String mime_type;
+		String image_name;
+		String resource_uri;
+		String file_extension;
+		Ref<Image> image;
+		Ref<Texture2D> texture; // Loaded directly as a resource, skips decoding and saving.
+		bool skip = false;
+		bool needs_decode = false;
+	};
+	static void _parse_image_bytes_decode(const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, Ref<Image> &r_image, String &r_file_extension);
+	void _decode_parsed_image_task(uint32_t p_index, ParsedImageEntry *p_entries);
 	Ref<Image> _parse_image_bytes_into_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, String &r_file_extension);
 	void _parse_image_save_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_resource_uri, const String &p_file_extension, int p_index, Ref<Image> p_image);
 	Error _parse_images(Ref<GLTFState> p_state, const String &p_base_path);
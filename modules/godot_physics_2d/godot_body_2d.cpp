@@ -389,6 +389,45 @@ Variant GodotBody2D::get_state(PhysicsServer2D::BodyState p_state) const {
 	return Variant();
 }
 
+void GodotBody2D::snapshot_state(double *r_snapshot) const {
+	const Transform2D &t = get_transform();
+	r_snapshot[0] = t.columns[0].x;
+	r_snapshot[1] = t.columns[0].y;
+	r_snapshot[2] = t.columns[1].x;
+	r_snapshot[3] = t.columns[1].y;
+	r_snapshot[4] = t.columns[2].x;
+	r_snapshot[5] = t.columns[2].y;
+	r_snapshot[6] = linear_velocity.x;
+	r_snapshot[7] = linear_velocity.y;
+	r_snapshot[8] = angular_velocity;
+	r_snapshot[9] = biased_linear_velocity.x;
+	r_snapshot[10] = biased_linear_velocity.y;
+	r_snapshot[11] = biased_angular_velocity;
+	r_snapshot[12] = applied_force.x;
+	r_snapshot[13] = applied_force.y;
+	r_snapshot[14] = applied_torque;
+	r_snapshot[15] = still_time;
+	r_snapshot[16] = active ? 1.0 : 0.0;
+}
+
+void GodotBody2D::restore_state(const double *p_snapshot) {
+	Transform2D t;
+	t.columns[0] = Vector2(p_snapshot[0], p_snapshot[1]);
+	t.columns[1] = Vector2(p_snapshot[2], p_snapshot[3]);
+	t.columns[2] = Vector2(p_snapshot[4], p_snapshot[5]);
+	_set_transform(t);
+	_set_inv_transform(t.affine_inverse());
+	_update_transform_dependent();
+	linear_velocity = Vector2(p_snapshot[6], p_snapshot[7]);
+	angular_velocity = p_snapshot[8];
+	biased_linear_velocity = Vector2(p_snapshot[9], p_snapshot[10]);
+	biased_angular_velocity = p_snapshot[11];
+	applied_force = Vector2(p_snapshot[12], p_snapshot[13]);
+	applied_torque = p_snapshot[14];
+	still_time = p_snapshot[15];
+	set_active(p_snapshot[16] != 0.0);
+}
+
 void GodotBody2D::set_space(GodotSpace2D *p_space) {
 	if (get_space()) {
 		wakeup_neighbours();
@@ -677,7 +716,9 @@ void GodotBody2D::wakeup_neighbours() {
 }
 
 void GodotBody2D::call_queries() {
-	Variant direct_state_variant = get_direct_state();
+	// Also initializes the cached direct_state_variant; rebuilding the Variant wrapper
+	// here would cost an instance ID fetch per synced body per step.
+	get_direct_state();
 
 	if (fi_callback_data) {
 		if (!fi_callback_data->callable.is_valid()) {
@@ -741,6 +782,7 @@ GodotPhysicsDirectBodyState2D *GodotBody2D::get_direct_state() {
 	if (!direct_state) {
 		direct_state = memnew(GodotPhysicsDirectBodyState2D);
 		direct_state->body = this;
+		direct_state_variant = direct_state;
 	}
 	return direct_state;
 }
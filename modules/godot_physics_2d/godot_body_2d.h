@@ -148,6 +148,7 @@ class GodotBody2D : public GodotCollisionObject2D {
 	ForceIntegrationCallbackData *fi_callback_data = nullptr;
 
 	GodotPhysicsDirectBodyState2D *direct_state = nullptr;
+	Variant direct_state_variant;
 
 	uint64_t island_step = 0;
 
@@ -300,6 +301,12 @@ public:
 	void set_state(PhysicsServer2D::BodyState p_state, const Variant &p_variant);
 	Variant get_state(PhysicsServer2D::BodyState p_state) const;
 
+	// Number of doubles written and read by snapshot_state() / restore_state().
+	static const int STATE_SNAPSHOT_SIZE = 17;
+
+	void snapshot_state(double *r_snapshot) const;
+	void restore_state(const double *p_snapshot);
+
 	_FORCE_INLINE_ void set_continuous_collision_detection_mode(PhysicsServer2D::CCDMode p_mode) { continuous_cd_mode = p_mode; }
 	_FORCE_INLINE_ PhysicsServer2D::CCDMode get_continuous_collision_detection_mode() const { return continuous_cd_mode; }
 
@@ -357,6 +357,19 @@ bool GodotBodyPair2D::setup(real_t p_step) {
 	return true;
 }
 
+bool GodotBodyPair2D::is_pre_solve_thread_safe() const {
+	// Contact reporting appends to the other body's contact list. A static body can be
+	// shared between several islands, so pairs that may report contacts against one must
+	// keep the serial pre-solve.
+	if (A->get_mode() == PhysicsServer2D::BODY_MODE_STATIC && A->can_report_contacts()) {
+		return false;
+	}
+	if (B->get_mode() == PhysicsServer2D::BODY_MODE_STATIC && B->can_report_contacts()) {
+		return false;
+	}
+	return true;
+}
+
 bool GodotBodyPair2D::pre_solve(real_t p_step) {
 	if (oneway_disabled) {
 		return false;
@@ -439,6 +452,21 @@ bool GodotBodyPair2D::pre_solve(real_t p_step) {
 		c.rA = global_A - A->get_center_of_mass();
 		c.rB = global_B - B->get_center_of_mass() - offset_B;
 
+		if (report_contacts_only) {
+			// Overlap reporting tier: the solver never sees this pair, so skip the
+			// effective mass and bias precomputation.
+			Vector2 crB = Vector2(-B->get_angular_velocity() * c.rB.y, B->get_angular_velocity() * c.rB.x) + B->get_linear_velocity();
+			Vector2 crA = Vector2(-A->get_angular_velocity() * c.rA.y, A->get_angular_velocity() * c.rA.x) + A->get_linear_velocity();
+			if (A->can_report_contacts()) {
+				A->add_contact(global_A + offset_A, -c.normal, depth, shape_A, crA, global_B + offset_A, shape_B, B->get_instance_id(), B->get_self(), crB, c.acc_impulse);
+			}
+			if (B->can_report_contacts()) {
+				B->add_contact(global_B + offset_A, c.normal, depth, shape_B, crB, global_A + offset_A, shape_A, A->get_instance_id(), A->get_self(), crA, c.acc_impulse);
+			}
+			collided = false;
+			continue;
+		}
+
 		// Precompute normal mass, tangent mass, and bias.
 		real_t rnA = c.rA.dot(c.normal);
 		real_t rnB = c.rB.dot(c.normal);
@@ -471,11 +499,6 @@ bool GodotBodyPair2D::pre_solve(real_t p_step) {
 			}
 		}
 
-		if (report_contacts_only) {
-			collided = false;
-			continue;
-		}
-
 #ifdef ACCUMULATE_IMPULSES
 		{
 			// Apply normal + friction impulse
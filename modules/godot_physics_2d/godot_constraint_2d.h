@@ -59,6 +59,11 @@ public:
 	_FORCE_INLINE_ void disable_collisions_between_bodies(const bool p_disabled) { disabled_collisions_between_bodies = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled_collisions_between_bodies() const { return disabled_collisions_between_bodies; }
 
+	// Whether pre_solve() only touches state owned by this constraint's island, so the
+	// island can be pre-solved on a worker thread. Conservative default; body pairs
+	// override this based on contact reporting against shared static bodies.
+	virtual bool is_pre_solve_thread_safe() const { return false; }
+
 	virtual bool setup(real_t p_step) = 0;
 	virtual bool pre_solve(real_t p_step) = 0;
 	virtual void solve(real_t p_step) = 0;
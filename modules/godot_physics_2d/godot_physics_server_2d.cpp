@@ -276,6 +276,50 @@ int GodotPhysicsServer2D::space_get_contact_count(RID p_space) const {
 	return space->get_debug_contact_count();
 }
 
+PackedFloat64Array GodotPhysicsServer2D::space_snapshot_body_states(RID p_space) const {
+	PackedFloat64Array snapshot;
+	GodotSpace2D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, snapshot);
+	ERR_FAIL_COND_V_MSG(space->is_locked(), snapshot, "Space state is inaccessible right now, wait for iteration or physics process notification.");
+
+	uint32_t body_count = 0;
+	for (const GodotCollisionObject2D *co : space->get_objects()) {
+		if (co->get_type() == GodotCollisionObject2D::TYPE_BODY) {
+			body_count++;
+		}
+	}
+
+	snapshot.resize(body_count * GodotBody2D::STATE_SNAPSHOT_SIZE);
+	double *snapshot_ptr = snapshot.ptrw();
+	for (const GodotCollisionObject2D *co : space->get_objects()) {
+		if (co->get_type() == GodotCollisionObject2D::TYPE_BODY) {
+			static_cast<const GodotBody2D *>(co)->snapshot_state(snapshot_ptr);
+			snapshot_ptr += GodotBody2D::STATE_SNAPSHOT_SIZE;
+		}
+	}
+
+	return snapshot;
+}
+
+void GodotPhysicsServer2D::space_restore_body_states(RID p_space, const PackedFloat64Array &p_snapshot) {
+	GodotSpace2D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+	ERR_FAIL_COND_MSG(space->is_locked(), "Space state is inaccessible right now, wait for iteration or physics process notification.");
+
+	const double *snapshot_ptr = p_snapshot.ptr();
+	int64_t remaining = p_snapshot.size();
+	for (GodotCollisionObject2D *co : space->get_objects()) {
+		if (co->get_type() != GodotCollisionObject2D::TYPE_BODY) {
+			continue;
+		}
+		ERR_FAIL_COND_MSG(remaining < GodotBody2D::STATE_SNAPSHOT_SIZE, "Snapshot does not match the bodies in the space. Snapshots are only valid while no bodies or areas are added to or removed from the space.");
+		static_cast<GodotBody2D *>(co)->restore_state(snapshot_ptr);
+		snapshot_ptr += GodotBody2D::STATE_SNAPSHOT_SIZE;
+		remaining -= GodotBody2D::STATE_SNAPSHOT_SIZE;
+	}
+	ERR_FAIL_COND_MSG(remaining != 0, "Snapshot does not match the bodies in the space. Snapshots are only valid while no bodies or areas are added to or removed from the space.");
+}
+
 PhysicsDirectSpaceState2D *GodotPhysicsServer2D::space_get_direct_state(RID p_space) {
 	GodotSpace2D *space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL_V(space, nullptr);
@@ -115,6 +115,9 @@ public:
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const override;
 	virtual int space_get_contact_count(RID p_space) const override;
 
+	virtual PackedFloat64Array space_snapshot_body_states(RID p_space) const override;
+	virtual void space_restore_body_states(RID p_space, const PackedFloat64Array &p_snapshot) override;
+
 	// this function only works on physics process, errors and returns null otherwise
 	virtual PhysicsDirectSpaceState2D *space_get_direct_state(RID p_space) override;
 
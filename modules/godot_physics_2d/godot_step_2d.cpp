@@ -91,6 +91,10 @@ void GodotStep2D::_pre_solve_island(LocalVector<GodotConstraint2D *> &p_constrai
 	p_constraint_island.resize(valid_constraint_count);
 }
 
+void GodotStep2D::_pre_solve_island_task(uint32_t p_island_index, void *p_userdata) const {
+	_pre_solve_island(*pre_solve_islands[p_island_index]);
+}
+
 void GodotStep2D::_solve_island(uint32_t p_island_index, void *p_userdata) const {
 	const LocalVector<GodotConstraint2D *> &constraint_island = constraint_islands[p_island_index];
 
@@ -252,9 +256,30 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	/* PRE-SOLVE CONSTRAINT ISLANDS */
 
-	// WARNING: This doesn't run on threads, because it involves thread-unsafe processing.
+	// Islands whose constraints only touch state owned by the island can be pre-solved
+	// on worker threads; the rest (contact reporting against shared static bodies, area
+	// monitor queries, joints) involves thread-unsafe processing and keeps the serial
+	// path. Contact debugging appends to a single space-wide list, so it forces
+	// everything serial.
+	pre_solve_islands.clear();
 	for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
-		_pre_solve_island(constraint_islands[island_index]);
+		LocalVector<GodotConstraint2D *> &constraint_island = constraint_islands[island_index];
+
+		bool thread_safe = !p_space->is_debugging_contacts();
+		for (uint32_t constraint_index = 0; thread_safe && constraint_index < constraint_island.size(); ++constraint_index) {
+			thread_safe = constraint_island[constraint_index]->is_pre_solve_thread_safe();
+		}
+
+		if (thread_safe) {
+			pre_solve_islands.push_back(&constraint_island);
+		} else {
+			_pre_solve_island(constraint_island);
+		}
+	}
+
+	if (!pre_solve_islands.is_empty()) {
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_pre_solve_island_task, nullptr, pre_solve_islands.size(), -1, true, SNAME("Physics2DConstraintPreSolveIslands"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 	}
 
 	/* SOLVE CONSTRAINT ISLANDS */
@@ -993,22 +993,35 @@ bool Penetration(	const GodotShape3D*	shape0,
 
 /* clang-format on */
 
-bool gjk_epa_calculate_distance(const GodotShape3D *p_shape_A, const Transform3D &p_transform_A, const GodotShape3D *p_shape_B, const Transform3D &p_transform_B, Vector3 &r_result_A, Vector3 &r_result_B) {
+static _FORCE_INLINE_ Vector3 _gjk_epa_warm_start_guess(const Transform3D &p_transform_A, const Transform3D &p_transform_B, const Vector3 *p_sep_axis) {
+	// Seed the simplex search from the axis cached on the pair when one is
+	// available; with temporal coherence GJK then converges in very few
+	// iterations instead of walking in from the origin delta every query.
+	if (p_sep_axis && *p_sep_axis != Vector3()) {
+		return *p_sep_axis;
+	}
+	return p_transform_B.origin - p_transform_A.origin;
+}
+
+bool gjk_epa_calculate_distance(const GodotShape3D *p_shape_A, const Transform3D &p_transform_A, const GodotShape3D *p_shape_B, const Transform3D &p_transform_B, Vector3 &r_result_A, Vector3 &r_result_B, Vector3 *r_sep_axis) {
 	GjkEpa2::sResults res;
 
-	if (GjkEpa2::Distance(p_shape_A, p_transform_A, 0.0, p_shape_B, p_transform_B, 0.0, p_transform_B.origin - p_transform_A.origin, res)) {
+	if (GjkEpa2::Distance(p_shape_A, p_transform_A, 0.0, p_shape_B, p_transform_B, 0.0, _gjk_epa_warm_start_guess(p_transform_A, p_transform_B, r_sep_axis), res)) {
 		r_result_A = res.witnesses[0];
 		r_result_B = res.witnesses[1];
+		if (r_sep_axis && res.normal != Vector3()) {
+			*r_sep_axis = res.normal;
+		}
 		return true;
 	}
 
 	return false;
 }
 
-bool gjk_epa_calculate_penetration(const GodotShape3D *p_shape_A, const Transform3D &p_transform_A, const GodotShape3D *p_shape_B, const Transform3D &p_transform_B, GodotCollisionSolver3D::CallbackResult p_result_callback, void *p_userdata, bool p_swap, real_t p_margin_A, real_t p_margin_B) {
+bool gjk_epa_calculate_penetration(const GodotShape3D *p_shape_A, const Transform3D &p_transform_A, const GodotShape3D *p_shape_B, const Transform3D &p_transform_B, GodotCollisionSolver3D::CallbackResult p_result_callback, void *p_userdata, bool p_swap, real_t p_margin_A, real_t p_margin_B, Vector3 *r_sep_axis) {
 	GjkEpa2::sResults res;
 
-	if (GjkEpa2::Penetration(p_shape_A, p_transform_A, p_margin_A, p_shape_B, p_transform_B, p_margin_B, p_transform_B.origin - p_transform_A.origin, res)) {
+	if (GjkEpa2::Penetration(p_shape_A, p_transform_A, p_margin_A, p_shape_B, p_transform_B, p_margin_B, _gjk_epa_warm_start_guess(p_transform_A, p_transform_B, r_sep_axis), res)) {
 		if (p_result_callback) {
 			if (p_swap) {
 				Vector3 normal = (res.witnesses[1] - res.witnesses[0]).normalized();
@@ -1018,6 +1031,9 @@ bool gjk_epa_calculate_penetration(const GodotShape3D *p_shape_A, const Transfor
 				p_result_callback(res.witnesses[0], 0, res.witnesses[1], 0, normal, p_userdata);
 			}
 		}
+		if (r_sep_axis && res.normal != Vector3()) {
+			*r_sep_axis = res.normal;
+		}
 		return true;
 	}
 
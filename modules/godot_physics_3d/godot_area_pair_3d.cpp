@@ -33,27 +33,32 @@
 #include "godot_collision_solver_3d.h"
 
 bool GodotAreaPair3D::setup(real_t p_step) {
+	bool overrides_space = false;
+	if ((int)area->get_param(PhysicsServer3D::AREA_PARAM_GRAVITY_OVERRIDE_MODE) != PhysicsServer3D::AREA_SPACE_OVERRIDE_DISABLED) {
+		overrides_space = true;
+	} else if ((int)area->get_param(PhysicsServer3D::AREA_PARAM_LINEAR_DAMP_OVERRIDE_MODE) != PhysicsServer3D::AREA_SPACE_OVERRIDE_DISABLED) {
+		overrides_space = true;
+	} else if ((int)area->get_param(PhysicsServer3D::AREA_PARAM_ANGULAR_DAMP_OVERRIDE_MODE) != PhysicsServer3D::AREA_SPACE_OVERRIDE_DISABLED) {
+		overrides_space = true;
+	}
+
+	if (!overrides_space && !area->has_monitor_callback()) {
+		// Nothing can observe this pair, so don't pay for the narrowphase check.
+		// Enabling a space override or a monitor callback re-registers the area's
+		// shapes, which recreates the pair, so this can't go stale.
+		process_collision = false;
+		return false;
+	}
+
 	bool result = false;
 	if (area->collides_with(body) && GodotCollisionSolver3D::solve_static(body->get_shape(body_shape), body->get_transform() * body->get_shape_transform(body_shape), area->get_shape(area_shape), area->get_transform() * area->get_shape_transform(area_shape), nullptr, this)) {
 		result = true;
 	}
 
 	process_collision = false;
-	has_space_override = false;
 	if (result != colliding) {
-		if ((int)area->get_param(PhysicsServer3D::AREA_PARAM_GRAVITY_OVERRIDE_MODE) != PhysicsServer3D::AREA_SPACE_OVERRIDE_DISABLED) {
-			has_space_override = true;
-		} else if ((int)area->get_param(PhysicsServer3D::AREA_PARAM_LINEAR_DAMP_OVERRIDE_MODE) != PhysicsServer3D::AREA_SPACE_OVERRIDE_DISABLED) {
-			has_space_override = true;
-		} else if ((int)area->get_param(PhysicsServer3D::AREA_PARAM_ANGULAR_DAMP_OVERRIDE_MODE) != PhysicsServer3D::AREA_SPACE_OVERRIDE_DISABLED) {
-			has_space_override = true;
-		}
-		process_collision = has_space_override;
-
-		if (area->has_monitor_callback()) {
-			process_collision = true;
-		}
-
+		has_space_override = overrides_space;
+		process_collision = true;
 		colliding = result;
 	}
 
@@ -121,6 +126,17 @@ GodotAreaPair3D::~GodotAreaPair3D() {
 ////////////////////////////////////////////////////
 
 bool GodotArea2Pair3D::setup(real_t p_step) {
+	bool reports_a = area_a->has_area_monitor_callback() && area_b_monitorable;
+	bool reports_b = area_b->has_area_monitor_callback() && area_a_monitorable;
+	if (!reports_a && !reports_b) {
+		// Nothing can observe this pair, so don't pay for the narrowphase check.
+		// Changing a monitor callback or monitorable re-registers the area's
+		// shapes, which recreates the pair, so this can't go stale.
+		process_collision_a = false;
+		process_collision_b = false;
+		return false;
+	}
+
 	bool result_a = area_a->collides_with(area_b);
 	bool result_b = area_b->collides_with(area_a);
 	if ((result_a || result_b) && !GodotCollisionSolver3D::solve_static(area_a->get_shape(shape_a), area_a->get_transform() * area_a->get_shape_transform(shape_a), area_b->get_shape(shape_b), area_b->get_transform() * area_b->get_shape_transform(shape_b), nullptr, this)) {
@@ -132,7 +148,7 @@ bool GodotArea2Pair3D::setup(real_t p_step) {
 
 	process_collision_a = false;
 	if (result_a != colliding_a) {
-		if (area_a->has_area_monitor_callback() && area_b_monitorable) {
+		if (reports_a) {
 			process_collision_a = true;
 			process_collision = true;
 		}
@@ -141,7 +157,7 @@ bool GodotArea2Pair3D::setup(real_t p_step) {
 
 	process_collision_b = false;
 	if (result_b != colliding_b) {
-		if (area_b->has_area_monitor_callback() && area_a_monitorable) {
+		if (reports_b) {
 			process_collision_b = true;
 			process_collision = true;
 		}
@@ -206,6 +222,22 @@ GodotArea2Pair3D::~GodotArea2Pair3D() {
 ////////////////////////////////////////////////////
 
 bool GodotAreaSoftBodyPair3D::setup(real_t p_step) {
+	bool overrides_space = false;
+	if ((int)area->get_param(PhysicsServer3D::AREA_PARAM_GRAVITY_OVERRIDE_MODE) != PhysicsServer3D::AREA_SPACE_OVERRIDE_DISABLED) {
+		overrides_space = true;
+	} else if (area->get_wind_force_magnitude() > CMP_EPSILON) {
+		overrides_space = true;
+	}
+
+	if (!overrides_space && !area->has_monitor_callback()) {
+		// Nothing can observe this pair, so don't pay for the narrowphase check.
+		// Enabling the gravity override or a monitor callback re-registers the
+		// area's shapes, which recreates the pair, and the wind magnitude is
+		// rechecked every step, so this can't go stale.
+		process_collision = false;
+		return false;
+	}
+
 	bool result = false;
 	if (
 			area->collides_with(soft_body) &&
@@ -220,18 +252,9 @@ bool GodotAreaSoftBodyPair3D::setup(real_t p_step) {
 	}
 
 	process_collision = false;
-	has_space_override = false;
 	if (result != colliding) {
-		if ((int)area->get_param(PhysicsServer3D::AREA_PARAM_GRAVITY_OVERRIDE_MODE) != PhysicsServer3D::AREA_SPACE_OVERRIDE_DISABLED) {
-			has_space_override = true;
-		} else if (area->get_wind_force_magnitude() > CMP_EPSILON) {
-			has_space_override = true;
-		}
-
-		if (area->has_monitor_callback()) {
-			process_collision = true;
-		}
-
+		has_space_override = overrides_space;
+		process_collision = area->has_monitor_callback();
 		colliding = result;
 	}
 
@@ -247,6 +247,9 @@ void GodotBody3D::set_param(PhysicsServer3D::BodyParameter p_param, const Varian
 		case PhysicsServer3D::BODY_PARAM_ANGULAR_DAMP: {
 			angular_damp = p_value;
 		} break;
+		case PhysicsServer3D::BODY_PARAM_SIMULATION_DETAIL: {
+			simulation_detail = CLAMP((real_t)p_value, (real_t)0.0, (real_t)1.0);
+		} break;
 		default: {
 		}
 	}
@@ -288,6 +291,9 @@ Variant GodotBody3D::get_param(PhysicsServer3D::BodyParameter p_param) const {
 		case PhysicsServer3D::BODY_PARAM_ANGULAR_DAMP: {
 			return angular_damp;
 		} break;
+		case PhysicsServer3D::BODY_PARAM_SIMULATION_DETAIL: {
+			return simulation_detail;
+		} break;
 
 		default: {
 		}
@@ -760,7 +766,9 @@ void GodotBody3D::wakeup_neighbours() {
 }
 
 void GodotBody3D::call_queries() {
-	Variant direct_state_variant = get_direct_state();
+	// Also initializes the cached direct_state_variant; rebuilding the Variant wrapper
+	// here would cost an instance ID fetch per synced body per step.
+	get_direct_state();
 
 	if (fi_callback_data) {
 		if (!fi_callback_data->callable.is_valid()) {
@@ -792,7 +800,8 @@ bool GodotBody3D::sleep_test(real_t p_step) {
 	if (Math::abs(angular_velocity.length()) < get_space()->get_body_angular_velocity_sleep_threshold() && Math::abs(linear_velocity.length_squared()) < get_space()->get_body_linear_velocity_sleep_threshold() * get_space()->get_body_linear_velocity_sleep_threshold()) {
 		still_time += p_step;
 
-		return still_time > get_space()->get_body_time_to_sleep();
+		// Reduced-detail bodies are biased towards sleeping sooner.
+		return still_time > get_space()->get_body_time_to_sleep() * simulation_detail;
 	} else {
 		still_time = 0; //maybe this should be set to 0 on set_active?
 		return false;
@@ -820,6 +829,7 @@ GodotPhysicsDirectBodyState3D *GodotBody3D::get_direct_state() {
 	if (!direct_state) {
 		direct_state = memnew(GodotPhysicsDirectBodyState3D);
 		direct_state->body = this;
+		direct_state_variant = direct_state;
 	}
 	return direct_state;
 }
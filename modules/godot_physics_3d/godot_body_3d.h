@@ -62,6 +62,7 @@ class GodotBody3D : public GodotCollisionObject3D {
 
 	real_t linear_damp = 0.0;
 	real_t angular_damp = 0.0;
+	real_t simulation_detail = 1.0;
 
 	real_t total_linear_damp = 0.0;
 	real_t total_angular_damp = 0.0;
@@ -142,6 +143,7 @@ class GodotBody3D : public GodotCollisionObject3D {
 	ForceIntegrationCallbackData *fi_callback_data = nullptr;
 
 	GodotPhysicsDirectBodyState3D *direct_state = nullptr;
+	Variant direct_state_variant;
 
 	uint64_t island_step = 0;
 
@@ -312,6 +314,7 @@ public:
 	_FORCE_INLINE_ const Basis &get_inv_inertia_tensor() const { return _inv_inertia_tensor; }
 	_FORCE_INLINE_ real_t get_friction() const { return friction; }
 	_FORCE_INLINE_ real_t get_bounce() const { return bounce; }
+	_FORCE_INLINE_ real_t get_simulation_detail() const { return simulation_detail; }
 
 	void set_axis_lock(PhysicsServer3D::BodyAxis p_axis, bool lock);
 	bool is_axis_locked(PhysicsServer3D::BodyAxis p_axis) const;
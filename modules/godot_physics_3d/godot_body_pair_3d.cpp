@@ -294,7 +294,33 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 	GodotShape3D *shape_A_ptr = A->get_shape(shape_A);
 	GodotShape3D *shape_B_ptr = B->get_shape(shape_B);
 
-	collided = GodotCollisionSolver3D::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
+	Transform3D rel_transform = xform_A.affine_inverse() * xform_B;
+
+	if (manifold_cache_valid &&
+			shape_A_ptr->get_version() == manifold_shape_version_A &&
+			shape_B_ptr->get_version() == manifold_shape_version_B &&
+			rel_transform.is_equal_approx(manifold_rel_transform)) {
+		// The shapes haven't moved relative to each other since the last narrowphase, so
+		// the cached result and manifold are still valid; contacts reproject with the
+		// current transforms in pre_solve().
+		collided = manifold_collided;
+
+		if (collided) {
+			for (int i = 0; i < contact_count; i++) {
+				// Keep the surviving contacts across the next validate_contacts().
+				contacts[i].used = true;
+			}
+			return true;
+		}
+	} else {
+		collided = GodotCollisionSolver3D::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
+
+		manifold_rel_transform = rel_transform;
+		manifold_shape_version_A = shape_A_ptr->get_version();
+		manifold_shape_version_B = shape_B_ptr->get_version();
+		manifold_collided = collided;
+		manifold_cache_valid = true;
+	}
 
 	if (!collided) {
 		if (A->is_continuous_collision_detection_enabled() && collide_A) {
@@ -96,6 +96,15 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	Contact contacts[MAX_CONTACTS];
 	int contact_count = 0;
 
+	// Persistent manifold cache: while the shapes keep the same relative pose (resting
+	// contact), the previous step's contacts reproject exactly and the narrowphase can
+	// be skipped. Shape data changes invalidate it through the shape version.
+	Transform3D manifold_rel_transform; // Shape B in shape A's space at the last narrowphase.
+	uint32_t manifold_shape_version_A = 0;
+	uint32_t manifold_shape_version_B = 0;
+	bool manifold_cache_valid = false;
+	bool manifold_collided = false;
+
 	static void _contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal, void *p_userdata);
 
 	void contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal);
@@ -36,6 +36,11 @@
 class GodotCollisionObject3D;
 
 class GodotBroadPhase3D {
+protected:
+	// Bumped on every structural change (create/move/set_static/remove), so
+	// query caches can detect staleness without traversing the broadphase.
+	uint64_t version = 1;
+
 public:
 	typedef GodotBroadPhase3D *(*CreateFunction)();
 
@@ -65,5 +70,7 @@ public:
 
 	virtual void update() = 0;
 
+	_FORCE_INLINE_ uint64_t get_version() const { return version; }
+
 	virtual ~GodotBroadPhase3D();
 };
@@ -1675,6 +1675,8 @@ void GodotPhysicsServer3D::step(real_t p_step) {
 		return;
 	}
 
+	ScopedAllocTag alloc_tag(Memory::ALLOC_TAG_PHYSICS);
+
 	_update_shapes();
 
 	island_count = 0;
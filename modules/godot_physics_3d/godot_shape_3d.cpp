@@ -68,6 +68,7 @@ const double cylinder_face_support_threshold = 0.999;
 void GodotShape3D::configure(const AABB &p_aabb) {
 	aabb = p_aabb;
 	configured = true;
+	version++;
 	for (const KeyValue<GodotShapeOwner3D *, int> &E : owners) {
 		GodotShapeOwner3D *co = E.key;
 		co->_shape_changed();
@@ -813,8 +814,6 @@ void GodotConvexPolygonShape3D::project_range(const Vector3 &p_normal, const Tra
 		return;
 	}
 
-	const Vector3 *vrts = &mesh.vertices[0];
-
 	if (vertex_count > 3 * extreme_vertices.size()) {
 		// For a large mesh, two calls to get_support() is faster than a full
 		// scan over all vertices.
@@ -823,19 +822,48 @@ void GodotConvexPolygonShape3D::project_range(const Vector3 &p_normal, const Tra
 		r_min = p_normal.dot(p_transform.xform(get_support(-n)));
 		r_max = p_normal.dot(p_transform.xform(get_support(n)));
 	} else {
-		for (uint32_t i = 0; i < vertex_count; i++) {
-			real_t d = p_normal.dot(p_transform.xform(vrts[i]));
-
-			if (i == 0 || d > r_max) {
-				r_max = d;
-			}
-			if (i == 0 || d < r_min) {
-				r_min = d;
-			}
+		// a.dot(basis.xform(b)) == basis.xform_inv(a).dot(b), so the whole scan
+		// can run in local space over the SoA vertex copy, where it vectorizes.
+		Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
+
+		const real_t *xs = vertices_soa.ptr();
+		const real_t *ys = xs + vertex_count;
+		const real_t *zs = ys + vertex_count;
+
+		real_t min = local_normal.x * xs[0] + local_normal.y * ys[0] + local_normal.z * zs[0];
+		real_t max = min;
+		for (uint32_t i = 1; i < vertex_count; i++) {
+			real_t d = local_normal.x * xs[i] + local_normal.y * ys[i] + local_normal.z * zs[i];
+			min = MIN(d, min);
+			max = MAX(d, max);
 		}
+
+		real_t base = p_normal.dot(p_transform.origin);
+		r_min = base + min;
+		r_max = base + max;
 	}
 }
 
+uint32_t GodotConvexPolygonShape3D::_support_vertex_scan(const Vector3 &p_normal) const {
+	// Full scan over the SoA copy of the vertices. Written branch-free so the
+	// compiler can auto-vectorize it, which beats hill climbing for small hulls
+	// and the AoS dot product scan for any size.
+	uint32_t vertex_count = mesh.vertices.size();
+	const real_t *xs = vertices_soa.ptr();
+	const real_t *ys = xs + vertex_count;
+	const real_t *zs = ys + vertex_count;
+
+	uint32_t best_vertex = 0;
+	real_t best_support = p_normal.x * xs[0] + p_normal.y * ys[0] + p_normal.z * zs[0];
+	for (uint32_t i = 1; i < vertex_count; i++) {
+		real_t d = p_normal.x * xs[i] + p_normal.y * ys[i] + p_normal.z * zs[i];
+		best_vertex = d > best_support ? i : best_vertex;
+		best_support = MAX(d, best_support);
+	}
+
+	return best_vertex;
+}
+
 Vector3 GodotConvexPolygonShape3D::get_support(const Vector3 &p_normal) const {
 	// Skip if there are no vertices in the mesh
 	if (mesh.vertices.is_empty()) {
@@ -845,6 +873,11 @@ Vector3 GodotConvexPolygonShape3D::get_support(const Vector3 &p_normal) const {
 	// Get the array of vertices
 	const Vector3 *const vertices_array = mesh.vertices.ptr();
 
+	// Small hulls have no neighbor graph; scan every vertex instead.
+	if (extreme_vertices.size() == mesh.vertices.size()) {
+		return vertices_array[_support_vertex_scan(p_normal)];
+	}
+
 	// Start with an initial assumption of the first extreme vertex.
 	int best_vertex = extreme_vertices[0];
 	real_t max_support = p_normal.dot(vertices_array[best_vertex]);
@@ -858,11 +891,6 @@ Vector3 GodotConvexPolygonShape3D::get_support(const Vector3 &p_normal) const {
 		}
 	}
 
-	// If we checked all vertices in the mesh then we're done.
-	if (extreme_vertices.size() == mesh.vertices.size()) {
-		return vertices_array[best_vertex];
-	}
-
 	// Move along the surface until we reach the true support vertex.
 	int last_vertex = -1;
 	while (true) {
@@ -905,17 +933,7 @@ void GodotConvexPolygonShape3D::get_supports(const Vector3 &p_normal, int p_max,
 	ERR_FAIL_COND_MSG(vc == 0, "Convex polygon shape has no vertices.");
 
 	//find vertex first
-	real_t max = 0;
-	int vtx = 0;
-
-	for (int i = 0; i < vc; i++) {
-		real_t d = p_normal.dot(vertices[i]);
-
-		if (i == 0 || d > max) {
-			max = d;
-			vtx = i;
-		}
-	}
+	int vtx = (int)_support_vertex_scan(p_normal);
 
 	for (int i = 0; i < fc; i++) {
 		if (faces[i].plane.normal.dot(p_normal) > face_support_threshold) {
@@ -1086,6 +1104,14 @@ void GodotConvexPolygonShape3D::_setup(const Vector<Vector3> &p_vertices) {
 	extreme_vertices.resize(0);
 	vertex_neighbors.resize(0);
 
+	uint32_t vertex_count = mesh.vertices.size();
+	vertices_soa.resize(vertex_count * 3);
+	for (uint32_t i = 0; i < vertex_count; i++) {
+		vertices_soa[i] = mesh.vertices[i].x;
+		vertices_soa[vertex_count + i] = mesh.vertices[i].y;
+		vertices_soa[2 * vertex_count + i] = mesh.vertices[i].z;
+	}
+
 	AABB _aabb;
 
 	for (uint32_t i = 0; i < mesh.vertices.size(); i++) {
@@ -1594,13 +1620,55 @@ void GodotConcavePolygonShape3D::_fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_a
 	memdelete(p_bvh_tree);
 }
 
+HashMap<uint64_t, GodotConcavePolygonShape3D::CookedData> GodotConcavePolygonShape3D::cook_cache;
+Mutex GodotConcavePolygonShape3D::cook_cache_mutex;
+
+void GodotConcavePolygonShape3D::_release_cooked_data() {
+	if (cook_cache_key == 0) {
+		return;
+	}
+
+	MutexLock lock(cook_cache_mutex);
+	CookedData *cooked = cook_cache.getptr(cook_cache_key);
+	if (cooked != nullptr) {
+		cooked->users--;
+		if (cooked->users == 0) {
+			cook_cache.erase(cook_cache_key);
+		}
+	}
+	cook_cache_key = 0;
+}
+
 void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_backface_collision) {
+	_release_cooked_data();
+
 	int src_face_count = p_faces.size();
 	if (src_face_count == 0) {
 		configure(AABB());
 		return;
 	}
 	ERR_FAIL_COND(src_face_count % 3);
+
+	uint64_t cook_key = hash_murmur3_buffer(p_faces.ptr(), p_faces.size() * sizeof(Vector3));
+	if (cook_key == 0) {
+		cook_key = 1; // 0 means no cache entry.
+	}
+
+	{
+		MutexLock lock(cook_cache_mutex);
+		CookedData *cooked = cook_cache.getptr(cook_key);
+		if (cooked != nullptr && cooked->source_faces.size() == p_faces.size() && memcmp(cooked->source_faces.ptr(), p_faces.ptr(), p_faces.size() * sizeof(Vector3)) == 0) {
+			cooked->users++;
+			cook_cache_key = cook_key;
+			faces = cooked->faces;
+			vertices = cooked->vertices;
+			bvh = cooked->bvh;
+			backface_collision = p_backface_collision;
+			configure(cooked->aabb);
+			return;
+		}
+	}
+
 	src_face_count /= 3;
 
 	const Vector3 *facesr = p_faces.ptr();
@@ -1651,6 +1719,23 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 
 	backface_collision = p_backface_collision;
 
+	{
+		MutexLock lock(cook_cache_mutex);
+		if (!cook_cache.has(cook_key)) {
+			CookedData cooked;
+			cooked.source_faces = p_faces;
+			cooked.faces = faces;
+			cooked.vertices = vertices;
+			cooked.bvh = bvh;
+			cooked.aabb = _aabb;
+			cooked.users = 1;
+			cook_cache.insert(cook_key, cooked);
+			cook_cache_key = cook_key;
+		}
+		// On a hash collision with different content, the shape simply keeps its
+		// privately cooked data.
+	}
+
 	configure(_aabb); // this type of shape has no margin
 }
 
@@ -1672,6 +1757,10 @@ Variant GodotConcavePolygonShape3D::get_data() const {
 GodotConcavePolygonShape3D::GodotConcavePolygonShape3D() {
 }
 
+GodotConcavePolygonShape3D::~GodotConcavePolygonShape3D() {
+	_release_cooked_data();
+}
+
 /* HEIGHT MAP SHAPE */
 
 Vector<real_t> GodotHeightMapShape3D::get_heights() const {
@@ -31,6 +31,8 @@
 #pragma once
 
 #include "core/math/geometry_3d.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
 #include "core/templates/local_vector.h"
 #include "servers/physics_3d/physics_server_3d.h"
 
@@ -48,6 +50,7 @@ class GodotShape3D {
 	RID self;
 	AABB aabb;
 	bool configured = false;
+	uint32_t version = 0;
 	real_t custom_bias = 0.0;
 
 	HashMap<GodotShapeOwner3D *, int> owners;
@@ -72,6 +75,9 @@ public:
 
 	_FORCE_INLINE_ const AABB &get_aabb() const { return aabb; }
 	_FORCE_INLINE_ bool is_configured() const { return configured; }
+	// Bumped every time the shape data is (re)configured; lets cached collision
+	// results detect in-place shape changes.
+	_FORCE_INLINE_ uint32_t get_version() const { return version; }
 
 	virtual bool is_concave() const { return false; }
 
@@ -278,6 +284,11 @@ struct GodotConvexPolygonShape3D : public GodotShape3D {
 	Geometry3D::MeshData mesh;
 	LocalVector<int> extreme_vertices;
 	LocalVector<LocalVector<int>> vertex_neighbors;
+	// SoA copy of the hull vertices (all X, then all Y, then all Z), so full
+	// support scans can be auto-vectorized. Built in _setup().
+	LocalVector<real_t> vertices_soa;
+
+	uint32_t _support_vertex_scan(const Vector3 &p_normal) const;
 
 	void _setup(const Vector<Vector3> &p_vertices);
 
@@ -353,6 +364,25 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 
 	bool backface_collision = false;
 
+	// Cook cache: shapes set up from identical face arrays share their cooked
+	// faces/vertices/bvh vectors (copy-on-write) instead of rebuilding the BVH.
+	// Entries are refcounted by the shapes using them and validated by a full
+	// compare of the source faces, the hash only selects the bucket.
+	struct CookedData {
+		Vector<Vector3> source_faces;
+		Vector<Face> faces;
+		Vector<Vector3> vertices;
+		Vector<BVH> bvh;
+		AABB aabb;
+		uint32_t users = 0;
+	};
+
+	static HashMap<uint64_t, CookedData> cook_cache;
+	static Mutex cook_cache_mutex;
+	uint64_t cook_cache_key = 0;
+
+	void _release_cooked_data();
+
 	void _cull_segment(int p_idx, _SegmentCullParams *p_params) const;
 	bool _cull(int p_idx, _CullParams *p_params) const;
 
@@ -380,6 +410,7 @@ public:
 	virtual Variant get_data() const override;
 
 	GodotConcavePolygonShape3D();
+	~GodotConcavePolygonShape3D();
 };
 
 struct GodotHeightMapShape3D : public GodotConcaveShape3D {
@@ -33,6 +33,7 @@
 #include "godot_space_3d.h"
 
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "servers/rendering/rendering_server.h"
 
 // Based on Bullet soft body.
@@ -611,6 +612,7 @@ bool GodotSoftBody3D::create_from_trimesh(const Vector<int> &p_indices, const Ve
 
 	generate_bending_constraints(2);
 	reoptimize_link_order();
+	update_link_partitions();
 
 	update_constants();
 	update_normals_and_centroids();
@@ -855,6 +857,51 @@ void GodotSoftBody3D::reoptimize_link_order() {
 	memdelete_arr(link_buffer);
 }
 
+void GodotSoftBody3D::update_link_partitions() {
+	// Greedy graph coloring of the links; two links sharing a node never end
+	// up in the same partition. Only worth the dispatch overhead for bodies
+	// with enough links to saturate the worker pool.
+	const uint32_t parallel_link_threshold = 1024;
+
+	link_partitions.clear();
+	serial_links.clear();
+
+	uint32_t link_count = links.size();
+	if (link_count < parallel_link_threshold || WorkerThreadPool::get_singleton()->get_thread_count() < 2) {
+		return;
+	}
+
+	LocalVector<uint64_t> node_colors;
+	node_colors.resize(nodes.size());
+	memset(node_colors.ptr(), 0, node_colors.size() * sizeof(uint64_t));
+
+	for (uint32_t i = 0; i < link_count; ++i) {
+		const Link &link = links[i];
+		uint32_t node_a = link.n[0]->index;
+		uint32_t node_b = link.n[1]->index;
+
+		uint64_t used_colors = node_colors[node_a] | node_colors[node_b];
+		if (used_colors == UINT64_MAX) {
+			// Both nodes are saturated; solve this link serially.
+			serial_links.push_back(i);
+			continue;
+		}
+
+		uint32_t color = 0;
+		while (used_colors & ((uint64_t)1 << color)) {
+			++color; // Bounded by the 64 bits of the node masks.
+		}
+
+		if (color >= link_partitions.size()) {
+			link_partitions.resize(color + 1);
+		}
+		link_partitions[color].push_back(i);
+
+		node_colors[node_a] |= (uint64_t)1 << color;
+		node_colors[node_b] |= (uint64_t)1 << color;
+	}
+}
+
 void GodotSoftBody3D::append_link(uint32_t p_node1, uint32_t p_node2) {
 	if (p_node1 == p_node2) {
 		return;
@@ -1132,19 +1179,33 @@ void GodotSoftBody3D::solve_constraints(real_t p_delta) {
 	update_normals_and_centroids();
 }
 
+void GodotSoftBody3D::_solve_link_partition(uint32_t p_index, void *p_userdata) {
+	const LinkPartitionSolveData *solve_data = static_cast<const LinkPartitionSolveData *>(p_userdata);
+	solve_link(links[solve_data->link_indices[p_index]], solve_data->kst);
+}
+
 void GodotSoftBody3D::solve_links(real_t kst, real_t ti) {
-	for (Link &link : links) {
-		if (link.c0 > 0) {
-			Node &node_a = *link.n[0];
-			Node &node_b = *link.n[1];
-			const Vector3 del = node_b.x - node_a.x;
-			const real_t len = del.length_squared();
-			if (link.c1 + len > CMP_EPSILON) {
-				const real_t k = ((link.c1 - len) / (link.c0 * (link.c1 + len))) * kst;
-				node_a.x -= del * (k * node_a.im);
-				node_b.x += del * (k * node_b.im);
-			}
+	if (!link_partitions.is_empty()) {
+		// Solve each partition on the worker pool; links within a partition
+		// share no nodes, so the relaxation order inside one dispatch does not
+		// matter. The partition sequence differs from the plain link order, so
+		// results are numerically different from (but equivalent to) the
+		// serial Gauss-Seidel sweep.
+		LinkPartitionSolveData solve_data;
+		solve_data.kst = kst;
+		for (const LocalVector<uint32_t> &partition : link_partitions) {
+			solve_data.link_indices = partition.ptr();
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotSoftBody3D::_solve_link_partition, (void *)&solve_data, partition.size(), -1, true, SNAME("SoftBody3DSolveLinks"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		}
+		for (const uint32_t &link_index : serial_links) {
+			solve_link(links[link_index], kst);
+		}
+		return;
+	}
+
+	for (Link &link : links) {
+		solve_link(link, kst);
 	}
 }
 
@@ -1257,6 +1318,9 @@ void GodotSoftBody3D::destroy() {
 	links.clear();
 	faces.clear();
 
+	link_partitions.clear();
+	serial_links.clear();
+
 	bounds = AABB();
 	deinitialize_shape();
 }
@@ -81,6 +81,12 @@ class GodotSoftBody3D : public GodotCollisionObject3D {
 	LocalVector<Link> links;
 	LocalVector<Face> faces;
 
+	// Independent link partitions for the threaded solver. Links within a
+	// partition share no nodes, so all links of one partition can be solved
+	// in parallel. Links that could not be colored stay in a serial remainder.
+	LocalVector<LocalVector<uint32_t>> link_partitions;
+	LocalVector<uint32_t> serial_links;
+
 	DynamicBVH node_tree;
 	DynamicBVH face_tree;
 
@@ -240,11 +246,32 @@ private:
 	bool create_from_trimesh(const Vector<int> &p_indices, const Vector<Vector3> &p_vertices);
 	void generate_bending_constraints(int p_distance);
 	void reoptimize_link_order();
+	void update_link_partitions();
 	void append_link(uint32_t p_node1, uint32_t p_node2);
 	void append_face(uint32_t p_node1, uint32_t p_node2, uint32_t p_node3);
 
 	void solve_links(real_t kst, real_t ti);
 
+	_FORCE_INLINE_ void solve_link(Link &p_link, real_t p_kst) {
+		if (p_link.c0 > 0) {
+			Node &node_a = *p_link.n[0];
+			Node &node_b = *p_link.n[1];
+			const Vector3 del = node_b.x - node_a.x;
+			const real_t len = del.length_squared();
+			if (p_link.c1 + len > CMP_EPSILON) {
+				const real_t k = ((p_link.c1 - len) / (p_link.c0 * (p_link.c1 + len))) * p_kst;
+				node_a.x -= del * (k * node_a.im);
+				node_b.x += del * (k * node_b.im);
+			}
+		}
+	}
+
+	struct LinkPartitionSolveData {
+		const uint32_t *link_indices = nullptr;
+		real_t kst = 1.0;
+	};
+	void _solve_link_partition(uint32_t p_index, void *p_userdata);
+
 	void initialize_face_tree();
 	void update_face_tree(real_t p_delta);
 
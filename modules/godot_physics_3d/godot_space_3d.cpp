@@ -207,6 +207,41 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	return true;
 }
 
+int GodotPhysicsDirectSpaceState3D::_cull_aabb_cached(const AABB &p_aabb, GodotCollisionObject3D **&r_results, int *&r_result_indices) {
+	const uint64_t version = space->broadphase->get_version();
+	if (version == query_cache_version && query_cache_aabb.encloses(p_aabb)) {
+		r_results = query_cache_results.ptr();
+		r_result_indices = query_cache_subindex_results.ptr();
+		return (int)query_cache_results.size();
+	}
+
+	// Cull an inflated neighborhood, so the remaining queries of a batch
+	// (casts sweeping slightly different AABBs) can reuse the result.
+	AABB grown_aabb = p_aabb.grow(p_aabb.get_longest_axis_size() * 0.25);
+
+	query_cache_results.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+	query_cache_subindex_results.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+
+	int amount = space->broadphase->cull_aabb(grown_aabb, query_cache_results.ptr(), GodotSpace3D::INTERSECTION_QUERY_MAX, query_cache_subindex_results.ptr());
+	if (amount == GodotSpace3D::INTERSECTION_QUERY_MAX) {
+		// The inflated neighborhood overflowed the result buffer; redo the
+		// exact query and skip caching, so no candidate is lost to truncation.
+		query_cache_version = 0;
+		r_results = space->intersection_query_results;
+		r_result_indices = space->intersection_query_subindex_results;
+		return space->broadphase->cull_aabb(p_aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	}
+
+	query_cache_results.resize(amount);
+	query_cache_subindex_results.resize(amount);
+	query_cache_aabb = grown_aabb;
+	query_cache_version = version;
+
+	r_results = query_cache_results.ptr();
+	r_result_indices = query_cache_subindex_results.ptr();
+	return amount;
+}
+
 int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
 	if (p_result_max <= 0) {
 		return 0;
@@ -217,7 +252,9 @@ int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_par
 
 	AABB aabb = p_parameters.transform.xform(shape->get_aabb());
 
-	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	GodotCollisionObject3D **query_results = nullptr;
+	int *query_subindices = nullptr;
+	int amount = _cull_aabb_cached(aabb, query_results, query_subindices);
 
 	int cc = 0;
 
@@ -228,18 +265,18 @@ int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_par
 			break;
 		}
 
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
 		//area can't be picked by ray (default)
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(query_results[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
-		int shape_idx = space->intersection_query_subindex_results[i];
+		const GodotCollisionObject3D *col_obj = query_results[i];
+		int shape_idx = query_subindices[i];
 
 		if (!GodotCollisionSolver3D::solve_static(shape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), nullptr, nullptr, nullptr, p_parameters.margin, 0)) {
 			continue;
@@ -270,7 +307,9 @@ bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parame
 	aabb = aabb.merge(AABB(aabb.position + p_parameters.motion, aabb.size)); //motion
 	aabb = aabb.grow(p_parameters.margin);
 
-	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	GodotCollisionObject3D **query_results = nullptr;
+	int *query_subindices = nullptr;
+	int amount = _cull_aabb_cached(aabb, query_results, query_subindices);
 
 	real_t best_safe = 1;
 	real_t best_unsafe = 1;
@@ -287,16 +326,16 @@ bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parame
 	Vector3 closest_A, closest_B;
 
 	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(query_results[i]->get_self())) {
 			continue; //ignore excluded
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
-		int shape_idx = space->intersection_query_subindex_results[i];
+		const GodotCollisionObject3D *col_obj = query_results[i];
+		int shape_idx = query_subindices[i];
 
 		Vector3 point_A, point_B;
 		Vector3 sep_axis = motion_normal;
@@ -392,7 +431,9 @@ bool GodotPhysicsDirectSpaceState3D::collide_shape(const ShapeParameters &p_para
 	AABB aabb = p_parameters.transform.xform(shape->get_aabb());
 	aabb = aabb.grow(p_parameters.margin);
 
-	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	GodotCollisionObject3D **query_results = nullptr;
+	int *query_subindices = nullptr;
+	int amount = _cull_aabb_cached(aabb, query_results, query_subindices);
 
 	bool collided = false;
 	r_result_count = 0;
@@ -406,17 +447,17 @@ bool GodotPhysicsDirectSpaceState3D::collide_shape(const ShapeParameters &p_para
 	GodotPhysicsServer3D::CollCbkData *cbkptr = &cbk;
 
 	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
+		const GodotCollisionObject3D *col_obj = query_results[i];
 
 		if (p_parameters.exclude.has(col_obj->get_self())) {
 			continue;
 		}
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = query_subindices[i];
 
 		if (GodotCollisionSolver3D::solve_static(shape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), cbkres, cbkptr, nullptr, p_parameters.margin)) {
 			collided = true;
@@ -520,7 +561,9 @@ bool GodotPhysicsDirectSpaceState3D::rest_info(const ShapeParameters &p_paramete
 	AABB aabb = p_parameters.transform.xform(shape->get_aabb());
 	aabb = aabb.grow(margin);
 
-	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	GodotCollisionObject3D **query_results = nullptr;
+	int *query_subindices = nullptr;
+	int amount = _cull_aabb_cached(aabb, query_results, query_subindices);
 
 	_RestCallbackData rcd;
 
@@ -530,17 +573,17 @@ bool GodotPhysicsDirectSpaceState3D::rest_info(const ShapeParameters &p_paramete
 	rcd.min_allowed_depth = MIN(motion_length, min_contact_depth);
 
 	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
+		const GodotCollisionObject3D *col_obj = query_results[i];
 
 		if (p_parameters.exclude.has(col_obj->get_self())) {
 			continue;
 		}
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = query_subindices[i];
 
 		rcd.object = col_obj;
 		rcd.shape = shape_idx;
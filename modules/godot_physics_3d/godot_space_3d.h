@@ -41,6 +41,16 @@
 class GodotPhysicsDirectSpaceState3D : public PhysicsDirectSpaceState3D {
 	GDCLASS(GodotPhysicsDirectSpaceState3D, PhysicsDirectSpaceState3D);
 
+	// Cached broadphase neighborhood for repeated shape queries, e.g.
+	// character controllers issuing several casts per tick around the same
+	// region. Invalidated through the broadphase version counter.
+	AABB query_cache_aabb;
+	uint64_t query_cache_version = 0;
+	LocalVector<GodotCollisionObject3D *> query_cache_results;
+	LocalVector<int> query_cache_subindex_results;
+
+	int _cull_aabb_cached(const AABB &p_aabb, GodotCollisionObject3D **&r_results, int *&r_result_indices);
+
 public:
 	GodotSpace3D *space = nullptr;
 
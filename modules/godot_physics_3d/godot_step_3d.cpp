@@ -34,6 +34,7 @@
 
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
+#include "core/templates/a_hash_map.h"
 
 #define BODY_ISLAND_COUNT_RESERVE 128
 #define BODY_ISLAND_SIZE_RESERVE 512
@@ -41,6 +42,12 @@
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
 
+// Islands with at least this many constraints get split into parallel solve
+// phases instead of solving on a single thread.
+#define PARALLEL_ISLAND_MIN_CONSTRAINTS 512
+// Phases smaller than this solve inline; dispatching them isn't worth it.
+#define PARALLEL_PHASE_MIN_CONSTRAINTS 32
+
 void GodotStep3D::_populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
 
@@ -130,14 +137,52 @@ void GodotStep3D::_pre_solve_island(LocalVector<GodotConstraint3D *> &p_constrai
 	p_constraint_island.resize(valid_constraint_count);
 }
 
+int GodotStep3D::_get_island_iterations(const LocalVector<GodotConstraint3D *> &p_constraint_island) const {
+	// An island is solved at the detail of its most detailed dynamic body, so
+	// a reduced-detail body can't degrade anything it is in contact with.
+	real_t detail = 0.0;
+	bool any_dynamic = false;
+
+	uint32_t constraint_count = p_constraint_island.size();
+	for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
+		const GodotConstraint3D *constraint = p_constraint_island[constraint_index];
+		if (constraint->get_soft_body_count() > 0) {
+			return iterations; // Soft bodies always solve at full detail.
+		}
+		for (int i = 0; i < constraint->get_body_count(); i++) {
+			GodotBody3D *body = constraint->get_body_ptr()[i];
+			if (body->get_mode() <= PhysicsServer3D::BODY_MODE_KINEMATIC) {
+				continue;
+			}
+			any_dynamic = true;
+			detail = MAX(detail, body->get_simulation_detail());
+		}
+		if (detail >= 1.0) {
+			return iterations;
+		}
+	}
+
+	if (!any_dynamic) {
+		return iterations;
+	}
+
+	return CLAMP(int(Math::ceil(iterations * detail)), 1, iterations);
+}
+
 void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[p_island_index];
 
+	if (constraint_island.size() >= PARALLEL_ISLAND_MIN_CONSTRAINTS) {
+		return; // Solved through parallel phases in step().
+	}
+
 	int current_priority = 1;
 
+	const int island_iteration_count = island_iterations[p_island_index];
+
 	uint32_t constraint_count = constraint_island.size();
 	while (constraint_count > 0) {
-		for (int i = 0; i < iterations; i++) {
+		for (int i = 0; i < island_iteration_count; i++) {
 			// Go through all iterations.
 			for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
 				constraint_island[constraint_index]->solve(delta);
@@ -158,6 +203,130 @@ void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	}
 }
 
+void GodotStep3D::_solve_phase_constraint(uint32_t p_constraint_index, void *p_userdata) {
+	const LocalVector<GodotConstraint3D *> &phase = *static_cast<const LocalVector<GodotConstraint3D *> *>(p_userdata);
+	phase[p_constraint_index]->solve(delta);
+}
+
+void GodotStep3D::_solve_island_parallel(const LocalVector<GodotConstraint3D *> &p_constraint_island, int p_iterations) {
+	// Large islands serialize the solver on a single thread. Partition the
+	// island's constraints into phases through greedy graph coloring so that
+	// no two constraints in a phase share a dynamic body or soft body; each
+	// phase can then solve its constraints concurrently. Since constraints
+	// within a phase touch disjoint bodies, results don't depend on thread
+	// scheduling, which keeps the solve deterministic.
+	uint32_t constraint_count = p_constraint_island.size();
+
+	for (uint32_t phase_index = 0; phase_index < solve_phases.size(); ++phase_index) {
+		solve_phases[phase_index].clear();
+	}
+	solve_phase_overflow.clear();
+
+	AHashMap<const void *, uint32_t> used_phase_masks;
+	used_phase_masks.reserve(constraint_count);
+
+	uint32_t phase_count = 0;
+
+	for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
+		GodotConstraint3D *constraint = p_constraint_island[constraint_index];
+
+		uint32_t used_phases = 0;
+		for (int i = 0; i < constraint->get_body_count(); i++) {
+			GodotBody3D *body = constraint->get_body_ptr()[i];
+			if (body->get_mode() <= PhysicsServer3D::BODY_MODE_KINEMATIC) {
+				continue; // Only written to when dynamic.
+			}
+			const uint32_t *mask = used_phase_masks.getptr(body);
+			if (mask) {
+				used_phases |= *mask;
+			}
+		}
+		for (int i = 0; i < constraint->get_soft_body_count(); i++) {
+			const uint32_t *mask = used_phase_masks.getptr(constraint->get_soft_body_ptr(i));
+			if (mask) {
+				used_phases |= *mask;
+			}
+		}
+
+		if (used_phases == UINT32_MAX) {
+			// Conflicts with every phase; solve serially between phases.
+			solve_phase_overflow.push_back(constraint);
+			continue;
+		}
+
+		uint32_t phase = 0;
+		while (used_phases & (1u << phase)) {
+			phase++;
+		}
+
+		if (solve_phases.size() <= phase) {
+			solve_phases.resize(phase + 1);
+		}
+		solve_phases[phase].push_back(constraint);
+		phase_count = MAX(phase_count, phase + 1);
+
+		const uint32_t phase_bit = 1u << phase;
+		for (int i = 0; i < constraint->get_body_count(); i++) {
+			GodotBody3D *body = constraint->get_body_ptr()[i];
+			if (body->get_mode() <= PhysicsServer3D::BODY_MODE_KINEMATIC) {
+				continue;
+			}
+			used_phase_masks[body] |= phase_bit;
+		}
+		for (int i = 0; i < constraint->get_soft_body_count(); i++) {
+			used_phase_masks[constraint->get_soft_body_ptr(i)] |= phase_bit;
+		}
+	}
+
+	int current_priority = 1;
+
+	uint32_t remaining_count = constraint_count;
+	while (remaining_count > 0) {
+		for (int i = 0; i < p_iterations; i++) {
+			// Go through all iterations, one phase at a time.
+			for (uint32_t phase_index = 0; phase_index < phase_count; ++phase_index) {
+				const LocalVector<GodotConstraint3D *> &phase = solve_phases[phase_index];
+				if (phase.size() >= PARALLEL_PHASE_MIN_CONSTRAINTS) {
+					WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_phase_constraint, (void *)&phase, phase.size(), -1, true, SNAME("Physics3DConstraintSolvePhase"));
+					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+				} else {
+					for (uint32_t constraint_index = 0; constraint_index < phase.size(); ++constraint_index) {
+						phase[constraint_index]->solve(delta);
+					}
+				}
+			}
+			for (uint32_t constraint_index = 0; constraint_index < solve_phase_overflow.size(); ++constraint_index) {
+				solve_phase_overflow[constraint_index]->solve(delta);
+			}
+		}
+
+		// Check priority to keep only higher priority constraints.
+		++current_priority;
+		remaining_count = 0;
+		for (uint32_t phase_index = 0; phase_index < phase_count; ++phase_index) {
+			LocalVector<GodotConstraint3D *> &phase = solve_phases[phase_index];
+			uint32_t priority_constraint_count = 0;
+			for (uint32_t constraint_index = 0; constraint_index < phase.size(); ++constraint_index) {
+				GodotConstraint3D *constraint = phase[constraint_index];
+				if (constraint->get_priority() >= current_priority) {
+					phase[priority_constraint_count++] = constraint;
+				}
+			}
+			phase.resize(priority_constraint_count);
+			remaining_count += priority_constraint_count;
+		}
+		uint32_t priority_constraint_count = 0;
+		for (uint32_t constraint_index = 0; constraint_index < solve_phase_overflow.size(); ++constraint_index) {
+			GodotConstraint3D *constraint = solve_phase_overflow[constraint_index];
+			if (constraint->get_priority() >= current_priority) {
+				solve_phase_overflow[priority_constraint_count++] = constraint;
+			}
+		}
+		solve_phase_overflow.resize(priority_constraint_count);
+		remaining_count += priority_constraint_count;
+	}
+}
+
 void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const {
 	bool can_sleep = true;
 
@@ -356,12 +525,24 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	/* PRE-SOLVE CONSTRAINT ISLANDS */
 
 	// WARNING: This doesn't run on threads, because it involves thread-unsafe processing.
+	if (island_iterations.size() < island_count) {
+		island_iterations.resize(island_count);
+	}
 	for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
 		_pre_solve_island(constraint_islands[island_index]);
+		island_iterations[island_index] = _get_island_iterations(constraint_islands[island_index]);
 	}
 
 	/* SOLVE CONSTRAINT ISLANDS */
 
+	// Large islands are split into parallel phases first, using all the worker
+	// threads for a single island; `_solve_island` skips them.
+	for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
+		if (constraint_islands[island_index].size() >= PARALLEL_ISLAND_MIN_CONSTRAINTS) {
+			_solve_island_parallel(constraint_islands[island_index], island_iterations[island_index]);
+		}
+	}
+
 	// WARNING: `_solve_island` modifies the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
 	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics3DConstraintSolveIslands"));
@@ -42,13 +42,23 @@ class GodotStep3D {
 
 	LocalVector<LocalVector<GodotBody3D *>> body_islands;
 	LocalVector<LocalVector<GodotConstraint3D *>> constraint_islands;
+	// Per-island solver iteration counts, scaled by body simulation detail.
+	LocalVector<int> island_iterations;
 	LocalVector<GodotConstraint3D *> all_constraints;
 
+	// Solve phases for large islands; constraints within a phase don't share
+	// any dynamic body, so they can be solved concurrently.
+	LocalVector<LocalVector<GodotConstraint3D *>> solve_phases;
+	LocalVector<GodotConstraint3D *> solve_phase_overflow;
+
 	void _populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _populate_island_soft_body(GodotSoftBody3D *p_soft_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const;
+	int _get_island_iterations(const LocalVector<GodotConstraint3D *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
+	void _solve_island_parallel(const LocalVector<GodotConstraint3D *> &p_constraint_island, int p_iterations);
+	void _solve_phase_constraint(uint32_t p_constraint_index, void *p_userdata);
 	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const;
 
 public:
@@ -29,9 +29,12 @@
 /**************************************************************************/
 
 #include "grid_map.h"
+#include "grid_map.compat.inc"
 
 #include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/a_hash_map.h"
+#include "scene/resources/3d/importer_mesh.h"
 #include "scene/resources/3d/mesh_library.h"
 #include "scene/resources/3d/primitive_meshes.h"
 #include "scene/resources/surface_tool.h"
@@ -1242,7 +1245,7 @@ void GridMap::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_bake_mesh_instance", "idx"), &GridMap::get_bake_mesh_instance);
 
 	ClassDB::bind_method(D_METHOD("clear_baked_meshes"), &GridMap::clear_baked_meshes);
-	ClassDB::bind_method(D_METHOD("make_baked_meshes", "gen_lightmap_uv", "lightmap_uv_texel_size"), &GridMap::make_baked_meshes, DEFVAL(false), DEFVAL(0.1));
+	ClassDB::bind_method(D_METHOD("make_baked_meshes", "gen_lightmap_uv", "lightmap_uv_texel_size", "generate_lods"), &GridMap::make_baked_meshes, DEFVAL(false), DEFVAL(0.1), DEFVAL(false));
 
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "mesh_library", PROPERTY_HINT_RESOURCE_TYPE, "MeshLibrary"), "set_mesh_library", "get_mesh_library");
 #ifndef PHYSICS_3D_DISABLED
@@ -1356,13 +1359,65 @@ void GridMap::clear_baked_meshes() {
 	_recreate_octant_data();
 }
 
-void GridMap::make_baked_meshes(bool p_gen_lightmap_uv, float p_lightmap_uv_texel_size) {
+struct GridMap::BakedMeshBuildData {
+	struct ItemSurface {
+		Array arrays;
+		Ref<Material> material;
+	};
+
+	struct OctantBuild {
+		struct Placement {
+			Transform3D transform;
+			int item = 0;
+		};
+		struct Surface {
+			Ref<Material> material;
+			Array arrays;
+		};
+
+		LocalVector<Placement> placements;
+		LocalVector<Surface> surfaces;
+	};
+
+	AHashMap<int, LocalVector<ItemSurface>> item_surfaces;
+	LocalVector<OctantBuild> octants;
+};
+
+void GridMap::_bake_octant_surfaces(uint32_t p_index, BakedMeshBuildData *p_data) {
+	BakedMeshBuildData::OctantBuild &ob = p_data->octants[p_index];
+	const AHashMap<int, LocalVector<BakedMeshBuildData::ItemSurface>> &item_surfaces = p_data->item_surfaces;
+
+	HashMap<Ref<Material>, Ref<SurfaceTool>> mat_map;
+
+	for (const BakedMeshBuildData::OctantBuild::Placement &placement : ob.placements) {
+		for (const BakedMeshBuildData::ItemSurface &item_surface : item_surfaces[placement.item]) {
+			HashMap<Ref<Material>, Ref<SurfaceTool>>::Iterator I = mat_map.find(item_surface.material);
+			if (!I) {
+				Ref<SurfaceTool> st;
+				st.instantiate();
+				st->begin(Mesh::PRIMITIVE_TRIANGLES);
+				st->set_material(item_surface.material);
+				I = mat_map.insert(item_surface.material, st);
+			}
+			I->value->append_from_arrays(item_surface.arrays, Mesh::PRIMITIVE_TRIANGLES, placement.transform);
+		}
+	}
+
+	for (KeyValue<Ref<Material>, Ref<SurfaceTool>> &E : mat_map) {
+		BakedMeshBuildData::OctantBuild::Surface surface;
+		surface.material = E.key;
+		surface.arrays = E.value->commit_to_arrays();
+		ob.surfaces.push_back(surface);
+	}
+}
+
+void GridMap::make_baked_meshes(bool p_gen_lightmap_uv, float p_lightmap_uv_texel_size, bool p_generate_lods) {
 	if (mesh_library.is_null()) {
 		return;
 	}
 
-	//generate
-	HashMap<OctantKey, HashMap<Ref<Material>, Ref<SurfaceTool>>, OctantKey> surface_map;
+	BakedMeshBuildData build_data;
+	HashMap<OctantKey, uint32_t, OctantKey> octant_indices;
 
 	for (KeyValue<IndexKey, Cell> &E : cell_map) {
 		IndexKey key = E.key;
@@ -1377,6 +1432,24 @@ void GridMap::make_baked_meshes(bool p_gen_lightmap_uv, float p_lightmap_uv_texe
 			continue;
 		}
 
+		// Extract each item's surfaces only once instead of once per cell; merging
+		// transformed copies on the worker threads below then needs no access to
+		// the mesh or the RenderingServer.
+		if (!build_data.item_surfaces.has(item)) {
+			LocalVector<BakedMeshBuildData::ItemSurface> surfaces;
+			for (int i = 0; i < mesh->get_surface_count(); i++) {
+				if (mesh->surface_get_primitive_type(i) != Mesh::PRIMITIVE_TRIANGLES) {
+					continue;
+				}
+
+				BakedMeshBuildData::ItemSurface item_surface;
+				item_surface.arrays = mesh->surface_get_arrays(i);
+				item_surface.material = mesh->surface_get_material(i);
+				surfaces.push_back(item_surface);
+			}
+			build_data.item_surfaces.insert(item, surfaces);
+		}
+
 		Vector3 cellpos = Vector3(key.x, key.y, key.z);
 		Vector3 ofs = _get_offset();
 
@@ -1388,35 +1461,55 @@ void GridMap::make_baked_meshes(bool p_gen_lightmap_uv, float p_lightmap_uv_texe
 
 		const OctantKey ok = get_octant_key_from_index_key(key);
 
-		if (!surface_map.has(ok)) {
-			surface_map[ok] = HashMap<Ref<Material>, Ref<SurfaceTool>>();
+		uint32_t octant_index;
+		if (octant_indices.has(ok)) {
+			octant_index = octant_indices[ok];
+		} else {
+			octant_index = build_data.octants.size();
+			octant_indices[ok] = octant_index;
+			build_data.octants.push_back(BakedMeshBuildData::OctantBuild());
 		}
 
-		HashMap<Ref<Material>, Ref<SurfaceTool>> &mat_map = surface_map[ok];
-
-		for (int i = 0; i < mesh->get_surface_count(); i++) {
-			if (mesh->surface_get_primitive_type(i) != Mesh::PRIMITIVE_TRIANGLES) {
-				continue;
-			}
+		BakedMeshBuildData::OctantBuild::Placement placement;
+		placement.transform = xform;
+		placement.item = item;
+		build_data.octants[octant_index].placements.push_back(placement);
+	}
 
-			Ref<Material> surf_mat = mesh->surface_get_material(i);
-			if (!mat_map.has(surf_mat)) {
-				Ref<SurfaceTool> st;
-				st.instantiate();
-				st->begin(Mesh::PRIMITIVE_TRIANGLES);
-				st->set_material(surf_mat);
-				mat_map[surf_mat] = st;
-			}
+	// Merge every octant's cells into one surface per material. Octants are
+	// independent, so spread them over the worker pool.
+	if (build_data.octants.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GridMap::_bake_octant_surfaces, &build_data, build_data.octants.size(), -1, false, SNAME("GridMapBakeOctants"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (build_data.octants.size() == 1) {
+		_bake_octant_surfaces(0, &build_data);
+	}
 
-			mat_map[surf_mat]->append_from(mesh, i, xform);
+	for (const BakedMeshBuildData::OctantBuild &ob : build_data.octants) {
+		if (ob.surfaces.is_empty()) {
+			continue;
 		}
-	}
 
-	for (KeyValue<OctantKey, HashMap<Ref<Material>, Ref<SurfaceTool>>> &E : surface_map) {
 		Ref<ArrayMesh> mesh;
-		mesh.instantiate();
-		for (KeyValue<Ref<Material>, Ref<SurfaceTool>> &F : E.value) {
-			F.value->commit(mesh);
+		if (p_generate_lods) {
+			// Route the merged surfaces through ImporterMesh so meshoptimizer can
+			// generate per-octant LODs; distant octants then render with a fraction
+			// of the merged index count.
+			Ref<ImporterMesh> importer_mesh;
+			importer_mesh.instantiate();
+			for (const BakedMeshBuildData::OctantBuild::Surface &surface : ob.surfaces) {
+				importer_mesh->add_surface(Mesh::PRIMITIVE_TRIANGLES, surface.arrays, TypedArray<Array>(), Dictionary(), surface.material);
+			}
+			// Same normal merge angle the scene importer defaults to.
+			importer_mesh->generate_lods(60.0f, Array());
+			mesh = importer_mesh->get_mesh();
+		} else {
+			mesh.instantiate();
+			for (const BakedMeshBuildData::OctantBuild::Surface &surface : ob.surfaces) {
+				int surface_index = mesh->get_surface_count();
+				mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, surface.arrays);
+				mesh->surface_set_material(surface_index, surface.material);
+			}
 		}
 
 		BakedMesh bm;
@@ -227,6 +227,9 @@ class GridMap : public Node3D {
 
 	Vector<BakedMesh> baked_meshes;
 
+	struct BakedMeshBuildData;
+	void _bake_octant_surfaces(uint32_t p_index, BakedMeshBuildData *p_data);
+
 protected:
 	bool _set(const StringName &p_name, const Variant &p_value);
 	bool _get(const StringName &p_name, Variant &r_ret) const;
@@ -236,6 +239,11 @@ protected:
 	void _update_visibility();
 	static void _bind_methods();
 
+#ifndef DISABLE_DEPRECATED
+	void _make_baked_meshes_bind_compat_112500(bool p_gen_lightmap_uv, float p_lightmap_uv_texel_size);
+	static void _bind_compatibility_methods();
+#endif // DISABLE_DEPRECATED
+
 public:
 	enum {
 		INVALID_CELL_ITEM = -1
@@ -306,7 +314,7 @@ public:
 	Array get_meshes() const;
 
 	void clear_baked_meshes();
-	void make_baked_meshes(bool p_gen_lightmap_uv = false, float p_lightmap_uv_texel_size = 0.1);
+	void make_baked_meshes(bool p_gen_lightmap_uv = false, float p_lightmap_uv_texel_size = 0.1, bool p_generate_lods = false);
 
 	void clear();
 
@@ -34,6 +34,26 @@
 
 #include "thirdparty/meshoptimizer/meshoptimizer.h"
 
+// Thin adapters so SurfaceTool's function pointer types don't need the meshoptimizer structs.
+static size_t _build_meshlets(unsigned int *r_meshlets, unsigned int *r_meshlet_vertices, unsigned char *r_meshlet_triangles, const unsigned int *p_indices, size_t p_index_count, const float *p_vertex_positions, size_t p_vertex_count, size_t p_vertex_positions_stride, size_t p_max_vertices, size_t p_max_triangles, float p_cone_weight) {
+	return meshopt_buildMeshlets((meshopt_Meshlet *)r_meshlets, r_meshlet_vertices, r_meshlet_triangles, p_indices, p_index_count, p_vertex_positions, p_vertex_count, p_vertex_positions_stride, p_max_vertices, p_max_triangles, p_cone_weight);
+}
+
+static void _compute_meshlet_bounds(const unsigned int *p_meshlet_vertices, const unsigned char *p_meshlet_triangles, size_t p_triangle_count, const float *p_vertex_positions, size_t p_vertex_count, size_t p_vertex_positions_stride, float *r_bounds) {
+	meshopt_Bounds bounds = meshopt_computeMeshletBounds(p_meshlet_vertices, p_meshlet_triangles, p_triangle_count, p_vertex_positions, p_vertex_count, p_vertex_positions_stride);
+	r_bounds[0] = bounds.center[0];
+	r_bounds[1] = bounds.center[1];
+	r_bounds[2] = bounds.center[2];
+	r_bounds[3] = bounds.radius;
+	r_bounds[4] = bounds.cone_apex[0];
+	r_bounds[5] = bounds.cone_apex[1];
+	r_bounds[6] = bounds.cone_apex[2];
+	r_bounds[7] = bounds.cone_axis[0];
+	r_bounds[8] = bounds.cone_axis[1];
+	r_bounds[9] = bounds.cone_axis[2];
+	r_bounds[10] = bounds.cone_cutoff;
+}
+
 void initialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
 	if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
 		return;
@@ -47,6 +67,9 @@ void initialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
 	SurfaceTool::generate_remap_func = meshopt_generateVertexRemap;
 	SurfaceTool::remap_vertex_func = meshopt_remapVertexBuffer;
 	SurfaceTool::remap_index_func = meshopt_remapIndexBuffer;
+	SurfaceTool::build_meshlets_bound_func = meshopt_buildMeshletsBound;
+	SurfaceTool::build_meshlets_func = _build_meshlets;
+	SurfaceTool::compute_meshlet_bounds_func = _compute_meshlet_bounds;
 }
 
 void uninitialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
@@ -61,4 +84,7 @@ void uninitialize_meshoptimizer_module(ModuleInitializationLevel p_level) {
 	SurfaceTool::generate_remap_func = nullptr;
 	SurfaceTool::remap_vertex_func = nullptr;
 	SurfaceTool::remap_index_func = nullptr;
+	SurfaceTool::build_meshlets_bound_func = nullptr;
+	SurfaceTool::build_meshlets_func = nullptr;
+	SurfaceTool::compute_meshlet_bounds_func = nullptr;
 }
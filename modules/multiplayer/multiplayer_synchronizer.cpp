@@ -110,6 +110,7 @@ void MultiplayerSynchronizer::reset() {
 	last_watch_usec = 0;
 	sync_started = false;
 	watchers.clear();
+	aoi_peer_visibility.clear();
 }
 
 uint32_t MultiplayerSynchronizer::get_net_id() const {
@@ -190,7 +191,37 @@ void MultiplayerSynchronizer::set_visibility_public(bool p_visible) {
 	set_visibility_for(0, p_visible);
 }
 
+void MultiplayerSynchronizer::set_visibility_range(double p_range) {
+	ERR_FAIL_COND_MSG(p_range < 0, "Range must be greater or equal to 0 (where 0 disables area-of-interest filtering)");
+	if (visibility_range == p_range) {
+		return;
+	}
+	visibility_range = p_range;
+	update_visibility(0);
+}
+
+double MultiplayerSynchronizer::get_visibility_range() const {
+	return visibility_range;
+}
+
+void MultiplayerSynchronizer::set_aoi_visible_to(int p_peer, bool p_visible) {
+	if (p_visible) {
+		aoi_peer_visibility.insert(p_peer);
+	} else {
+		aoi_peer_visibility.erase(p_peer);
+	}
+}
+
+bool MultiplayerSynchronizer::is_aoi_visible_to(int p_peer) const {
+	return aoi_peer_visibility.has(p_peer);
+}
+
 bool MultiplayerSynchronizer::is_visible_to(int p_peer) {
+	if (visibility_range > 0.0 && !aoi_peer_visibility.has(p_peer)) {
+		// Gated by the area of interest. Note that this is never true for
+		// peer 0, so "visible to all" checks fall back to per-peer checks.
+		return false;
+	}
 	if (visibility_filters.size()) {
 		Variant arg = p_peer;
 		const Variant *argv[1] = { &arg };
@@ -259,6 +290,9 @@ void MultiplayerSynchronizer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_visibility_update_mode"), &MultiplayerSynchronizer::get_visibility_update_mode);
 	ClassDB::bind_method(D_METHOD("update_visibility", "for_peer"), &MultiplayerSynchronizer::update_visibility, DEFVAL(0));
 
+	ClassDB::bind_method(D_METHOD("set_visibility_range", "range"), &MultiplayerSynchronizer::set_visibility_range);
+	ClassDB::bind_method(D_METHOD("get_visibility_range"), &MultiplayerSynchronizer::get_visibility_range);
+
 	ClassDB::bind_method(D_METHOD("set_visibility_public", "visible"), &MultiplayerSynchronizer::set_visibility_public);
 	ClassDB::bind_method(D_METHOD("is_visibility_public"), &MultiplayerSynchronizer::is_visibility_public);
 
@@ -273,6 +307,7 @@ void MultiplayerSynchronizer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "replication_config", PROPERTY_HINT_RESOURCE_TYPE, "SceneReplicationConfig", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_EDITOR_INSTANTIATE_OBJECT), "set_replication_config", "get_replication_config");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "visibility_update_mode", PROPERTY_HINT_ENUM, "Idle,Physics,None"), "set_visibility_update_mode", "get_visibility_update_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "public_visibility"), "set_visibility_public", "is_visibility_public");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "visibility_range", PROPERTY_HINT_RANGE, "0,4096,0.1,or_greater,suffix:m"), "set_visibility_range", "get_visibility_range");
 
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_IDLE);
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_PHYSICS);
@@ -58,6 +58,12 @@ private:
 	VisibilityUpdateMode visibility_update_mode = VISIBILITY_PROCESS_IDLE;
 	HashSet<Callable> visibility_filters;
 	HashSet<int> peer_visibility;
+	// Area-of-interest state. When visibility_range is greater than 0, only peers
+	// in this set pass the visibility check; the set is maintained by the
+	// replication interface from the interest positions registered on
+	// SceneMultiplayer.
+	double visibility_range = 0.0;
+	HashSet<int> aoi_peer_visibility;
 	Vector<Watcher> watchers;
 	uint64_t last_watch_usec = 0;
 
@@ -105,6 +111,13 @@ public:
 	NodePath get_root_path() const;
 	virtual void set_multiplayer_authority(int p_peer_id, bool p_recursive = true) override;
 
+	void set_visibility_range(double p_range);
+	double get_visibility_range() const;
+	// Called by the replication interface when a peer enters or leaves this
+	// synchronizer's area of interest.
+	void set_aoi_visible_to(int p_peer, bool p_visible);
+	bool is_aoi_visible_to(int p_peer) const;
+
 	bool is_visibility_public() const;
 	void set_visibility_public(bool p_public);
 	bool is_visible_to(int p_peer);
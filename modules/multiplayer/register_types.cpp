@@ -36,6 +36,7 @@
 #include "scene_multiplayer.h"
 #include "scene_replication_interface.h"
 #include "scene_rpc_interface.h"
+#include "scene_snapshot.h"
 
 #ifdef TOOLS_ENABLED
 #include "editor/multiplayer_editor_plugin.h"
@@ -44,6 +45,7 @@
 void initialize_multiplayer_module(ModuleInitializationLevel p_level) {
 	if (p_level == MODULE_INITIALIZATION_LEVEL_SCENE) {
 		GDREGISTER_CLASS(SceneReplicationConfig);
+		GDREGISTER_CLASS(SceneSnapshot);
 		GDREGISTER_CLASS(MultiplayerSpawner);
 		GDREGISTER_CLASS(MultiplayerSynchronizer);
 		GDREGISTER_CLASS(OfflineMultiplayerPeer);
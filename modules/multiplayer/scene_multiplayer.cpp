@@ -161,14 +161,67 @@ Error SceneMultiplayer::poll() {
 	}
 
 	replicator->on_network_process();
+
+	// Send out packets coalesced since the last poll in single per-peer, per-channel datagrams.
+	_flush_batches();
 	return OK;
 }
 
+bool SceneMultiplayer::_queue_packet(int p_peer, const uint8_t *p_packet, int p_packet_len) {
+	if (!packet_batching || p_peer <= 0 || multiplayer_peer->get_transfer_mode() != MultiplayerPeer::TRANSFER_MODE_RELIABLE) {
+		return false;
+	}
+
+	const int channel = multiplayer_peer->get_transfer_channel();
+	const uint64_t key = (uint64_t(uint32_t(p_peer)) << 32) | uint32_t(channel);
+	Vector<uint8_t> &batch = send_batches[key];
+
+	if (batch.size() && batch.size() + 4 + p_packet_len > max_batch_packet_size) {
+		// Keep datagrams below the limit; flushing first also preserves in-channel ordering.
+		multiplayer_peer->set_target_peer(p_peer);
+		_send(batch.ptr(), batch.size());
+		batch.clear();
+	}
+	if (2 + 4 + p_packet_len > max_batch_packet_size) {
+		return false; // Too big to batch, the caller sends it as its own packet.
+	}
+
+	if (batch.is_empty()) {
+		batch.push_back(NETWORK_COMMAND_SYS);
+		batch.push_back(SYS_COMMAND_BATCH);
+	}
+	const int ofs = batch.size();
+	batch.resize(ofs + 4 + p_packet_len);
+	encode_uint32(p_packet_len, batch.ptrw() + ofs);
+	memcpy(batch.ptrw() + ofs + 4, p_packet, p_packet_len);
+	return true;
+}
+
+void SceneMultiplayer::_flush_batches() {
+	if (send_batches.is_empty()) {
+		return;
+	}
+	multiplayer_peer->set_transfer_mode(MultiplayerPeer::TRANSFER_MODE_RELIABLE);
+	for (KeyValue<uint64_t, Vector<uint8_t>> &E : send_batches) {
+		if (E.value.is_empty()) {
+			continue;
+		}
+		const int peer = int(int32_t(E.key >> 32));
+		if (connected_peers.has(peer)) {
+			multiplayer_peer->set_target_peer(peer);
+			multiplayer_peer->set_transfer_channel(int(int32_t(E.key & 0xFFFFFFFF)));
+			_send(E.value.ptr(), E.value.size());
+		}
+		E.value.clear();
+	}
+}
+
 void SceneMultiplayer::clear() {
 	last_connection_status = MultiplayerPeer::CONNECTION_DISCONNECTED;
 	pending_peers.clear();
 	connected_peers.clear();
 	packet_cache.clear();
+	send_batches.clear();
 	replicator->on_reset();
 	cache->clear();
 	relay_buffer->clear();
@@ -263,12 +316,18 @@ Error SceneMultiplayer::send_command(int p_to, const uint8_t *p_packet, int p_pa
 		relay_buffer->put_u8(SYS_COMMAND_RELAY);
 		relay_buffer->put_32(p_to); // Set the destination.
 		relay_buffer->put_data(p_packet, p_packet_len);
-		multiplayer_peer->set_target_peer(1);
 		const Vector<uint8_t> data = relay_buffer->get_data_array();
+		if (_queue_packet(1, data.ptr(), relay_buffer->get_position())) {
+			return OK;
+		}
+		multiplayer_peer->set_target_peer(1);
 		return _send(data.ptr(), relay_buffer->get_position());
 	}
 	if (p_to > 0) {
 		ERR_FAIL_COND_V(!connected_peers.has(p_to), ERR_BUG);
+		if (_queue_packet(p_to, p_packet, p_packet_len)) {
+			return OK;
+		}
 		multiplayer_peer->set_target_peer(p_to);
 		return _send(p_packet, p_packet_len);
 	} else {
@@ -276,6 +335,9 @@ Error SceneMultiplayer::send_command(int p_to, const uint8_t *p_packet, int p_pa
 			if (p_to && pid == -p_to) {
 				continue;
 			}
+			if (_queue_packet(pid, p_packet, p_packet_len)) {
+				continue;
+			}
 			multiplayer_peer->set_target_peer(pid);
 			_send(p_packet, p_packet_len);
 		}
@@ -346,6 +408,31 @@ void SceneMultiplayer::_process_sys(int p_from, const uint8_t *p_packet, int p_p
 				remote_sender_id = 0;
 			}
 		} break;
+		case SYS_COMMAND_BATCH: {
+			// Coalesced packets, each prefixed with its length. Note that `peer`
+			// above was decoded from what is the first length prefix, ignore it.
+			int ofs = 2;
+			while (ofs < p_packet_len) {
+				ERR_FAIL_COND(ofs + 4 > p_packet_len);
+				const uint32_t size = decode_uint32(&p_packet[ofs]);
+				ofs += 4;
+				ERR_FAIL_COND(size == 0 || uint64_t(ofs) + size > uint64_t(p_packet_len));
+				const uint8_t *sub_packet = &p_packet[ofs];
+				if ((sub_packet[0] & CMD_MASK) == NETWORK_COMMAND_SYS) {
+					// Relay commands can end up inside batches. Nested batches are never produced.
+					ERR_FAIL_COND(size < 2 || sub_packet[1] == SYS_COMMAND_BATCH);
+					_process_sys(p_from, sub_packet, size, p_mode, p_channel);
+				} else {
+					remote_sender_id = p_from;
+					_process_packet(p_from, sub_packet, size);
+					remote_sender_id = 0;
+				}
+				if (!connected_peers.has(p_from)) {
+					return; // Processing might have dropped the sender.
+				}
+				ofs += size;
+			}
+		} break;
 		default: {
 			ERR_FAIL();
 		}
@@ -366,6 +453,7 @@ void SceneMultiplayer::_add_peer(int p_id) {
 void SceneMultiplayer::_admit_peer(int p_id) {
 	if (server_relay && get_unique_id() == 1 && multiplayer_peer->is_server_relay_supported()) {
 		// Notify others of connection, and send connected peers to newly connected one.
+		_flush_batches(); // Don't let the notification overtake coalesced packets.
 		uint8_t buf[SYS_CMD_SIZE];
 		buf[0] = NETWORK_COMMAND_SYS;
 		buf[1] = SYS_COMMAND_ADD_PEER;
@@ -403,6 +491,7 @@ void SceneMultiplayer::_del_peer(int p_id) {
 
 	if (server_relay && get_unique_id() == 1 && multiplayer_peer->is_server_relay_supported()) {
 		// Notify others of disconnection.
+		_flush_batches(); // Don't let the notification overtake coalesced packets.
 		uint8_t buf[SYS_CMD_SIZE];
 		buf[0] = NETWORK_COMMAND_SYS;
 		buf[1] = SYS_COMMAND_DEL_PEER;
@@ -617,6 +706,26 @@ bool SceneMultiplayer::is_server_relay_enabled() const {
 	return server_relay;
 }
 
+void SceneMultiplayer::set_packet_batching_enabled(bool p_enabled) {
+	if (!p_enabled && packet_batching && multiplayer_peer.is_valid()) {
+		_flush_batches(); // Don't leave queued packets behind.
+	}
+	packet_batching = p_enabled;
+}
+
+bool SceneMultiplayer::is_packet_batching_enabled() const {
+	return packet_batching;
+}
+
+void SceneMultiplayer::set_max_batch_packet_size(int p_size) {
+	ERR_FAIL_COND_MSG(p_size < 128, "Maximum batch packet size must be at least 128 bytes.");
+	max_batch_packet_size = p_size;
+}
+
+int SceneMultiplayer::get_max_batch_packet_size() const {
+	return max_batch_packet_size;
+}
+
 void SceneMultiplayer::set_max_sync_packet_size(int p_size) {
 	replicator->set_max_sync_packet_size(p_size);
 }
@@ -633,6 +742,14 @@ int SceneMultiplayer::get_max_delta_packet_size() const {
 	return replicator->get_max_delta_packet_size();
 }
 
+void SceneMultiplayer::set_peer_interest_position(int p_peer, const Vector3 &p_position) {
+	replicator->set_peer_interest_position(p_peer, p_position);
+}
+
+void SceneMultiplayer::clear_peer_interest_position(int p_peer) {
+	replicator->clear_peer_interest_position(p_peer);
+}
+
 void SceneMultiplayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_root_path", "path"), &SceneMultiplayer::set_root_path);
 	ClassDB::bind_method(D_METHOD("get_root_path"), &SceneMultiplayer::get_root_path);
@@ -657,17 +774,26 @@ void SceneMultiplayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_server_relay_enabled"), &SceneMultiplayer::is_server_relay_enabled);
 	ClassDB::bind_method(D_METHOD("send_bytes", "bytes", "id", "mode", "channel"), &SceneMultiplayer::send_bytes, DEFVAL(MultiplayerPeer::TARGET_PEER_BROADCAST), DEFVAL(MultiplayerPeer::TRANSFER_MODE_RELIABLE), DEFVAL(0));
 
+	ClassDB::bind_method(D_METHOD("set_packet_batching_enabled", "enabled"), &SceneMultiplayer::set_packet_batching_enabled);
+	ClassDB::bind_method(D_METHOD("is_packet_batching_enabled"), &SceneMultiplayer::is_packet_batching_enabled);
+	ClassDB::bind_method(D_METHOD("get_max_batch_packet_size"), &SceneMultiplayer::get_max_batch_packet_size);
+	ClassDB::bind_method(D_METHOD("set_max_batch_packet_size", "size"), &SceneMultiplayer::set_max_batch_packet_size);
 	ClassDB::bind_method(D_METHOD("get_max_sync_packet_size"), &SceneMultiplayer::get_max_sync_packet_size);
 	ClassDB::bind_method(D_METHOD("set_max_sync_packet_size", "size"), &SceneMultiplayer::set_max_sync_packet_size);
 	ClassDB::bind_method(D_METHOD("get_max_delta_packet_size"), &SceneMultiplayer::get_max_delta_packet_size);
 	ClassDB::bind_method(D_METHOD("set_max_delta_packet_size", "size"), &SceneMultiplayer::set_max_delta_packet_size);
 
+	ClassDB::bind_method(D_METHOD("set_peer_interest_position", "id", "position"), &SceneMultiplayer::set_peer_interest_position);
+	ClassDB::bind_method(D_METHOD("clear_peer_interest_position", "id"), &SceneMultiplayer::clear_peer_interest_position);
+
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_path"), "set_root_path", "get_root_path");
 	ADD_PROPERTY(PropertyInfo(Variant::CALLABLE, "auth_callback"), "set_auth_callback", "get_auth_callback");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "auth_timeout", PROPERTY_HINT_RANGE, "0,30,0.1,or_greater,suffix:s"), "set_auth_timeout", "get_auth_timeout");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "allow_object_decoding"), "set_allow_object_decoding", "is_object_decoding_allowed");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "refuse_new_connections"), "set_refuse_new_connections", "is_refusing_new_connections");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "server_relay"), "set_server_relay_enabled", "is_server_relay_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "packet_batching"), "set_packet_batching_enabled", "is_packet_batching_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_batch_packet_size"), "set_max_batch_packet_size", "get_max_batch_packet_size");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_sync_packet_size"), "set_max_sync_packet_size", "get_max_sync_packet_size");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_delta_packet_size"), "set_max_delta_packet_size", "get_max_delta_packet_size");
 
@@ -81,6 +81,7 @@ public:
 		SYS_COMMAND_ADD_PEER,
 		SYS_COMMAND_DEL_PEER,
 		SYS_COMMAND_RELAY,
+		SYS_COMMAND_BATCH,
 	};
 
 	enum {
@@ -118,6 +119,10 @@ private:
 
 	Vector<uint8_t> packet_cache;
 
+	bool packet_batching = false;
+	int max_batch_packet_size = 1350; // Fits a typical MTU with some margin for the transport's own headers.
+	HashMap<uint64_t, Vector<uint8_t>> send_batches; // Key: peer << 32 | channel. Reliable packets coalesced until the next flush.
+
 	NodePath root_path;
 	bool allow_object_decoding = false;
 	bool server_relay = true;
@@ -143,6 +148,9 @@ protected:
 	void _process_raw(int p_from, const uint8_t *p_packet, int p_packet_len);
 	void _process_sys(int p_from, const uint8_t *p_packet, int p_packet_len, MultiplayerPeer::TransferMode p_mode, int p_channel);
 
+	bool _queue_packet(int p_peer, const uint8_t *p_packet, int p_packet_len);
+	void _flush_batches();
+
 	void _add_peer(int p_id);
 	void _admit_peer(int p_id);
 	void _del_peer(int p_id);
@@ -194,12 +202,21 @@ public:
 	void set_server_relay_enabled(bool p_enabled);
 	bool is_server_relay_enabled() const;
 
+	void set_packet_batching_enabled(bool p_enabled);
+	bool is_packet_batching_enabled() const;
+
+	void set_max_batch_packet_size(int p_size);
+	int get_max_batch_packet_size() const;
+
 	void set_max_sync_packet_size(int p_size);
 	int get_max_sync_packet_size() const;
 
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_peer_interest_position(int p_peer, const Vector3 &p_position);
+	void clear_peer_interest_position(int p_peer);
+
 	SceneMultiplayer();
 	~SceneMultiplayer();
 };
@@ -35,7 +35,12 @@
 #include "core/debugger/engine_debugger.h"
 #include "core/io/marshalls.h"
 #include "core/os/os.h"
+#include "core/templates/pair.h"
+#include "scene/2d/node_2d.h"
 #include "scene/main/node.h"
+#ifndef _3D_DISABLED
+#include "scene/3d/node_3d.h"
+#endif
 
 #define MAKE_ROOM(m_amount)             \
 	if (packet_cache.size() < m_amount) \
@@ -102,6 +107,14 @@ void SceneReplicationInterface::on_peer_change(int p_id, bool p_connected) {
 	} else {
 		ERR_FAIL_COND(!peers_info.has(p_id));
 		_free_remotes(peers_info[p_id]);
+		// Clear this peer from the area-of-interest state, so a future peer
+		// reusing the id doesn't inherit it.
+		for (const ObjectID &sid : peers_info[p_id].aoi_nodes) {
+			MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+			if (sync) {
+				sync->set_aoi_visible_to(p_id, false);
+			}
+		}
 		peers_info.erase(p_id);
 	}
 }
@@ -111,6 +124,8 @@ void SceneReplicationInterface::on_reset() {
 		_free_remotes(E.value);
 	}
 	peers_info.clear();
+	sync_encode_cache.clear();
+	delta_encode_cache.clear();
 	// Tracked nodes are cleared on deletion, here we only reset the ids so they can be later re-assigned.
 	for (KeyValue<ObjectID, TrackedNode> &E : tracked_nodes) {
 		TrackedNode &tobj = E.value;
@@ -139,6 +154,9 @@ void SceneReplicationInterface::on_network_process() {
 		spawn_queue.clear();
 	}
 
+	// Update per-peer relevance from the registered interest positions.
+	_update_aoi();
+
 	// Process syncs.
 	uint64_t usec = OS::get_singleton()->get_ticks_usec();
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
@@ -278,6 +296,8 @@ Error SceneReplicationInterface::on_replication_stop(Object *p_obj, Variant p_co
 	TrackedNode &tobj = _track(oid);
 	tobj.synchronizers.erase(sid);
 	sync_nodes.erase(sid);
+	sync_encode_cache.erase(sid);
+	delta_encode_cache.erase(sid);
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
 		E.value.sync_nodes.erase(sid);
 		E.value.last_watch_usecs.erase(sid);
@@ -288,6 +308,115 @@ Error SceneReplicationInterface::on_replication_stop(Object *p_obj, Variant p_co
 	return OK;
 }
 
+bool SceneReplicationInterface::_get_aoi_position(Node *p_node, Vector3 &r_position) {
+#ifndef _3D_DISABLED
+	if (Node3D *node_3d = Object::cast_to<Node3D>(p_node)) {
+		r_position = node_3d->get_global_position();
+		return true;
+	}
+#endif
+	if (Node2D *node_2d = Object::cast_to<Node2D>(p_node)) {
+		const Vector2 position = node_2d->get_global_position();
+		r_position = Vector3(position.x, position.y, 0);
+		return true;
+	}
+	return false;
+}
+
+void SceneReplicationInterface::_update_aoi() {
+	// Gather the authoritative synchronizers with a visibility range set.
+	struct AOISync {
+		ObjectID sid;
+		Vector3 position;
+		real_t range = 0.0;
+	};
+	LocalVector<AOISync> aoi_syncs;
+	real_t max_range = 0.0;
+	for (const ObjectID &sid : sync_nodes) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+		if (!sync || !_has_authority(sync) || sync->get_visibility_range() <= 0.0) {
+			continue;
+		}
+		AOISync aoi;
+		if (!_get_aoi_position(sync->get_root_node(), aoi.position)) {
+			continue;
+		}
+		aoi.sid = sid;
+		aoi.range = real_t(sync->get_visibility_range());
+		aoi_syncs.push_back(aoi);
+		max_range = MAX(max_range, aoi.range);
+	}
+	if (aoi_syncs.is_empty()) {
+		return;
+	}
+
+	// Bin positions into a uniform grid sized by the largest range (plus the
+	// exit hysteresis), so each peer query only needs to visit the 3x3x3
+	// neighborhood of its cell.
+	const real_t cell_size = max_range * (real_t)1.1;
+	HashMap<Vector3i, LocalVector<uint32_t>> grid;
+	for (uint32_t i = 0; i < aoi_syncs.size(); i++) {
+		grid[Vector3i((aoi_syncs[i].position / cell_size).floor())].push_back(i);
+	}
+
+	LocalVector<Pair<int, ObjectID>> transitions;
+	for (KeyValue<int, PeerInfo> &E : peers_info) {
+		PeerInfo &info = E.value;
+		HashSet<ObjectID> in_range;
+		if (!info.has_interest_position) {
+			// Peers without a registered interest position see everything, so
+			// not opting into the area of interest fails visible.
+			for (const AOISync &aoi : aoi_syncs) {
+				in_range.insert(aoi.sid);
+			}
+		} else {
+			const Vector3i center = Vector3i((info.interest_position / cell_size).floor());
+			for (int x = -1; x <= 1; x++) {
+				for (int y = -1; y <= 1; y++) {
+					for (int z = -1; z <= 1; z++) {
+						const LocalVector<uint32_t> *cell = grid.getptr(center + Vector3i(x, y, z));
+						if (!cell) {
+							continue;
+						}
+						for (const uint32_t idx : *cell) {
+							const AOISync &aoi = aoi_syncs[idx];
+							// 10% exit hysteresis, so nodes sitting on the
+							// boundary don't spawn and despawn every tick.
+							const real_t range = info.aoi_nodes.has(aoi.sid) ? aoi.range * (real_t)1.1 : aoi.range;
+							if (info.interest_position.distance_squared_to(aoi.position) <= range * range) {
+								in_range.insert(aoi.sid);
+							}
+						}
+					}
+				}
+			}
+		}
+
+		// Apply the transitions to the synchronizers first, so is_visible_to()
+		// reflects the new state when the visibility updates below run.
+		for (const ObjectID &sid : in_range) {
+			if (!info.aoi_nodes.has(sid)) {
+				get_id_as<MultiplayerSynchronizer>(sid)->set_aoi_visible_to(E.key, true);
+				transitions.push_back(Pair<int, ObjectID>(E.key, sid));
+			}
+		}
+		for (const ObjectID &sid : info.aoi_nodes) {
+			if (!in_range.has(sid)) {
+				MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+				if (sync) {
+					sync->set_aoi_visible_to(E.key, false);
+					transitions.push_back(Pair<int, ObjectID>(E.key, sid));
+				}
+			}
+		}
+		info.aoi_nodes = in_range;
+	}
+
+	for (const Pair<int, ObjectID> &transition : transitions) {
+		_visibility_changed(transition.first, transition.second);
+	}
+}
+
 void SceneReplicationInterface::_visibility_changed(int p_peer, ObjectID p_sid) {
 	MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(p_sid);
 	ERR_FAIL_NULL(sync); // Bug.
@@ -719,26 +848,39 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 			continue;
 		}
 		uint64_t last_usec = p_last_watch_usecs.has(oid) ? p_last_watch_usecs[oid] : 0;
-		uint64_t indexes;
-		List<Variant> delta = sync->get_delta_state(p_usec, last_usec, indexes);
+		EncodedState *enc = delta_encode_cache.getptr(oid);
+		if (enc == nullptr || enc->usec != p_usec || enc->last_usec != last_usec) {
+			uint64_t indexes;
+			List<Variant> delta = sync->get_delta_state(p_usec, last_usec, indexes);
 
-		if (!delta.size()) {
-			continue; // Nothing to update.
-		}
+			if (!delta.size()) {
+				continue; // Nothing to update.
+			}
 
-		Vector<const Variant *> varp;
-		varp.resize(delta.size());
-		const Variant **vptr = varp.ptrw();
-		int i = 0;
-		for (const Variant &v : delta) {
-			vptr[i] = &v;
-			i++;
+			Vector<const Variant *> varp;
+			varp.resize(delta.size());
+			const Variant **vptr = varp.ptrw();
+			int i = 0;
+			for (const Variant &v : delta) {
+				vptr[i] = &v;
+				i++;
+			}
+			int size;
+			Error err = MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), nullptr, size);
+			ERR_CONTINUE_MSG(err != OK, "Unable to encode delta state.");
+
+			ERR_CONTINUE_MSG(size > delta_mtu, vformat("Synchronizer delta bigger than MTU will not be sent (%d > %d): %s", size, delta_mtu, sync->get_path()));
+
+			enc = &delta_encode_cache[oid];
+			enc->usec = p_usec;
+			enc->last_usec = last_usec;
+			enc->indexes = indexes;
+			enc->data.resize(size);
+			if (size) {
+				MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), enc->data.ptrw(), size);
+			}
 		}
-		int size;
-		Error err = MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), nullptr, size);
-		ERR_CONTINUE_MSG(err != OK, "Unable to encode delta state.");
-
-		ERR_CONTINUE_MSG(size > delta_mtu, vformat("Synchronizer delta bigger than MTU will not be sent (%d > %d): %s", size, delta_mtu, sync->get_path()));
+		int size = enc->data.size();
 
 		if (ofs + 4 + 8 + 4 + size > delta_mtu) {
 			// Send what we got, and reset write.
@@ -747,9 +889,9 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 		}
 		if (size) {
 			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
-			ofs += encode_uint64(indexes, &ptr[ofs]);
+			ofs += encode_uint64(enc->indexes, &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), &ptr[ofs], size);
+			memcpy(&ptr[ofs], enc->data.ptr(), size);
 			ofs += size;
 		}
 #ifdef DEBUG_ENABLED
@@ -820,16 +962,26 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 			// The path based sync is not yet confirmed, skipping.
 			continue;
 		}
-		int size;
-		Vector<Variant> vars;
-		Vector<const Variant *> varp;
-		const List<NodePath> props = sync->get_replication_config_ptr()->get_sync_properties();
-		Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp);
-		ERR_CONTINUE_MSG(err != OK, "Unable to retrieve sync state.");
-		err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
-		ERR_CONTINUE_MSG(err != OK, "Unable to encode sync state.");
-		// TODO Handle single state above MTU.
-		ERR_CONTINUE_MSG(size > sync_mtu, vformat("Node states bigger than MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
+		EncodedState *enc = sync_encode_cache.getptr(oid);
+		if (enc == nullptr || enc->usec != p_usec) {
+			int size;
+			Vector<Variant> vars;
+			Vector<const Variant *> varp;
+			const List<NodePath> props = sync->get_replication_config_ptr()->get_sync_properties();
+			Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp);
+			ERR_CONTINUE_MSG(err != OK, "Unable to retrieve sync state.");
+			err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
+			ERR_CONTINUE_MSG(err != OK, "Unable to encode sync state.");
+			// TODO Handle single state above MTU.
+			ERR_CONTINUE_MSG(size > sync_mtu, vformat("Node states bigger than MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
+			enc = &sync_encode_cache[oid];
+			enc->usec = p_usec;
+			enc->data.resize(size);
+			if (size) {
+				MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), enc->data.ptrw(), size);
+			}
+		}
+		int size = enc->data.size();
 		if (ofs + 4 + 4 + size > sync_mtu) {
 			// Send what we got, and reset write.
 			_send_raw(packet_cache.ptr(), ofs, p_peer, false);
@@ -838,7 +990,7 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 		if (size) {
 			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), &ptr[ofs], size);
+			memcpy(&ptr[ofs], enc->data.ptr(), size);
 			ofs += size;
 		}
 #ifdef DEBUG_ENABLED
@@ -913,6 +1065,17 @@ void SceneReplicationInterface::set_max_delta_packet_size(int p_size) {
 	delta_mtu = p_size;
 }
 
+void SceneReplicationInterface::set_peer_interest_position(int p_peer, const Vector3 &p_position) {
+	ERR_FAIL_COND_MSG(!peers_info.has(p_peer), vformat("Cannot set the interest position of peer %d which is not connected.", p_peer));
+	peers_info[p_peer].interest_position = p_position;
+	peers_info[p_peer].has_interest_position = true;
+}
+
+void SceneReplicationInterface::clear_peer_interest_position(int p_peer) {
+	ERR_FAIL_COND_MSG(!peers_info.has(p_peer), vformat("Cannot clear the interest position of peer %d which is not connected.", p_peer));
+	peers_info[p_peer].has_interest_position = false;
+}
+
 int SceneReplicationInterface::get_max_delta_packet_size() const {
 	return delta_mtu;
 }
@@ -67,6 +67,11 @@ private:
 		HashMap<uint32_t, ObjectID> recv_sync_ids;
 		HashMap<uint32_t, ObjectID> recv_nodes;
 		uint16_t last_sent_sync = 0;
+		// Area-of-interest state: the point relevance is measured from, and the
+		// synchronizers currently in range.
+		Vector3 interest_position;
+		bool has_interest_position = false;
+		HashSet<ObjectID> aoi_nodes;
 	};
 
 	// Replication state.
@@ -93,6 +98,18 @@ private:
 	int sync_mtu = 1350; // Highly dependent on underlying protocol.
 	int delta_mtu = 65535;
 
+	// Per-cycle cache of encoded synchronizer states. Every peer observing a
+	// synchronizer receives the same bytes, so the state is fetched and encoded
+	// once per process cycle and copied into each peer's packet.
+	struct EncodedState {
+		uint64_t usec = 0; // Process cycle the encoding was made in.
+		uint64_t last_usec = 0; // Delta baseline the encoding applies to (delta cache only).
+		uint64_t indexes = 0; // Changed property bitmask (delta cache only).
+		PackedByteArray data;
+	};
+	HashMap<ObjectID, EncodedState> sync_encode_cache;
+	HashMap<ObjectID, EncodedState> delta_encode_cache;
+
 	TrackedNode &_track(const ObjectID &p_id);
 	void _untrack(const ObjectID &p_id);
 	void _node_ready(const ObjectID &p_oid);
@@ -107,6 +124,9 @@ private:
 	Error _make_despawn_packet(Node *p_node, int &r_len);
 	Error _send_raw(const uint8_t *p_buffer, int p_size, int p_peer, bool p_reliable);
 
+	static bool _get_aoi_position(Node *p_node, Vector3 &r_position);
+	void _update_aoi();
+
 	void _visibility_changed(int p_peer, ObjectID p_oid);
 	Error _update_sync_visibility(int p_peer, MultiplayerSynchronizer *p_sync);
 	Error _update_spawn_visibility(int p_peer, const ObjectID &p_oid);
@@ -146,6 +166,9 @@ public:
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_peer_interest_position(int p_peer, const Vector3 &p_position);
+	void clear_peer_interest_position(int p_peer);
+
 	SceneReplicationInterface(SceneMultiplayer *p_multiplayer, SceneCacheInterface *p_cache) {
 		multiplayer = p_multiplayer;
 		multiplayer_cache = p_cache;
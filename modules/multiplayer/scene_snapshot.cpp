@@ -0,0 +1,101 @@
+/**************************************************************************/
+/*  scene_snapshot.cpp                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_snapshot.h"
+
+void SceneSnapshot::add_node(Node *p_node, const Ref<SceneReplicationConfig> &p_config) {
+	ERR_FAIL_NULL(p_node);
+	ERR_FAIL_COND(p_config.is_null());
+	for (const NodePath &prop : p_config->get_sync_properties()) {
+		add_property(p_node, prop);
+	}
+}
+
+void SceneSnapshot::add_property(Object *p_object, const NodePath &p_property) {
+	ERR_FAIL_NULL(p_object);
+	Object *target = p_object;
+	if (p_property.get_name_count() > 0) {
+		Node *node = Object::cast_to<Node>(p_object);
+		ERR_FAIL_COND_MSG(!node || !node->has_node(p_property), vformat("Node '%s' not found.", p_property));
+		target = node->get_node(p_property);
+	}
+	TrackedProperty tp;
+	tp.object_id = target->get_instance_id();
+	tp.subnames = p_property.get_subnames();
+	tp.path = p_property;
+	tracked.push_back(tp);
+}
+
+void SceneSnapshot::clear() {
+	tracked.clear();
+}
+
+int SceneSnapshot::get_property_count() const {
+	return tracked.size();
+}
+
+Array SceneSnapshot::capture() const {
+	Array state;
+	state.resize(tracked.size());
+	for (uint32_t i = 0; i < tracked.size(); i++) {
+		const TrackedProperty &tp = tracked[i];
+		Object *obj = ObjectDB::get_instance(tp.object_id);
+		if (!obj) {
+			continue; // Freed since registration; leave the slot null.
+		}
+		bool valid = false;
+		state[i] = obj->get_indexed(tp.subnames, &valid);
+		ERR_CONTINUE_MSG(!valid, vformat("Property '%s' not found.", tp.path));
+	}
+	return state;
+}
+
+void SceneSnapshot::restore(const Array &p_state) const {
+	ERR_FAIL_COND_MSG(p_state.size() != (int)tracked.size(), "Snapshot state size does not match the tracked property count.");
+	for (uint32_t i = 0; i < tracked.size(); i++) {
+		const TrackedProperty &tp = tracked[i];
+		Object *obj = ObjectDB::get_instance(tp.object_id);
+		if (!obj || p_state[i].get_type() == Variant::NIL) {
+			continue;
+		}
+		bool valid = false;
+		obj->set_indexed(tp.subnames, p_state[i], &valid);
+		ERR_CONTINUE_MSG(!valid, vformat("Property '%s' not found.", tp.path));
+	}
+}
+
+void SceneSnapshot::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("add_node", "node", "config"), &SceneSnapshot::add_node);
+	ClassDB::bind_method(D_METHOD("add_property", "object", "property"), &SceneSnapshot::add_property);
+	ClassDB::bind_method(D_METHOD("clear"), &SceneSnapshot::clear);
+	ClassDB::bind_method(D_METHOD("get_property_count"), &SceneSnapshot::get_property_count);
+	ClassDB::bind_method(D_METHOD("capture"), &SceneSnapshot::capture);
+	ClassDB::bind_method(D_METHOD("restore", "state"), &SceneSnapshot::restore);
+}
@@ -0,0 +1,63 @@
+/**************************************************************************/
+/*  scene_snapshot.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene_replication_config.h"
+
+#include "core/object/ref_counted.h"
+#include "scene/main/node.h"
+
+class SceneSnapshot : public RefCounted {
+	GDCLASS(SceneSnapshot, RefCounted);
+
+	// Property targets are resolved once, when registered, so per-tick
+	// capture/restore is a flat loop of indexed gets/sets with no NodePath
+	// lookups.
+	struct TrackedProperty {
+		ObjectID object_id;
+		Vector<StringName> subnames;
+		NodePath path; // Only kept for error reporting.
+	};
+
+	LocalVector<TrackedProperty> tracked;
+
+protected:
+	static void _bind_methods();
+
+public:
+	void add_node(Node *p_node, const Ref<SceneReplicationConfig> &p_config);
+	void add_property(Object *p_object, const NodePath &p_property);
+	void clear();
+	int get_property_count() const;
+
+	Array capture() const;
+	void restore(const Array &p_state) const;
+};
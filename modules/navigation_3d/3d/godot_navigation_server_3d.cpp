@@ -30,6 +30,7 @@
 
 #include "godot_navigation_server_3d.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 #include "scene/main/node.h"
 
@@ -1378,6 +1379,8 @@ void GodotNavigationServer3D::process(double p_delta_time) {
 	// E.g. (final) sync of objects for this main loop iteration, updating rendered debug visuals, updating debug statistics, ...
 
 	sync();
+
+	_flush_async_path_queries();
 }
 
 void GodotNavigationServer3D::physics_process(double p_delta_time) {
@@ -1454,7 +1457,55 @@ void GodotNavigationServer3D::query_path(const Ref<NavigationPathQueryParameters
 	NavMap3D *map = map_owner.get_or_null(p_query_parameters->get_map());
 	ERR_FAIL_NULL(map);
 
-	NavMeshQueries3D::map_query_path(map, p_query_parameters, p_query_result, p_callback);
+	if (p_callback.is_valid()) {
+		// Defer the query; all queries queued this way run in parallel on worker
+		// threads against the map's immutable iteration during the next server
+		// process, with the callbacks dispatched serially afterwards.
+		MutexLock lock(async_path_queries_mutex);
+		async_path_queries.push_back({ p_query_parameters, p_query_result, p_callback });
+		return;
+	}
+
+	NavMeshQueries3D::map_query_path(map, p_query_parameters, p_query_result, Callable());
+}
+
+void GodotNavigationServer3D::_execute_async_path_query(uint32_t p_index, AsyncPathQuery *p_queries) {
+	const AsyncPathQuery &query = p_queries[p_index];
+
+	NavMap3D *map = map_owner.get_or_null(query.query_parameters->get_map());
+	if (map == nullptr) {
+		return;
+	}
+
+	NavMeshQueries3D::map_query_path(map, query.query_parameters, query.query_result, Callable());
+}
+
+void GodotNavigationServer3D::_flush_async_path_queries() {
+	LocalVector<AsyncPathQuery> queries_to_process;
+	{
+		MutexLock lock(async_path_queries_mutex);
+		if (async_path_queries.is_empty()) {
+			return;
+		}
+		SWAP(queries_to_process, async_path_queries);
+	}
+
+	// The map iterations are immutable while queries run and the per-map path
+	// query slots are sized for the worker pool, so the queries can execute
+	// concurrently; queries beyond the slot count wait on the slot semaphore.
+	if (queries_to_process.size() > 1 && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotNavigationServer3D::_execute_async_path_query, queries_to_process.ptr(), queries_to_process.size(), -1, true, SNAME("NavigationPathQueries"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	} else {
+		for (uint32_t i = 0; i < queries_to_process.size(); i++) {
+			_execute_async_path_query(i, queries_to_process.ptr());
+		}
+	}
+
+	// Dispatch the callbacks serially on the server thread.
+	for (const AsyncPathQuery &query : queries_to_process) {
+		NavMeshQueries3D::emit_callback(query.callback);
+	}
 }
 
 RID GodotNavigationServer3D::source_geometry_parser_create() {
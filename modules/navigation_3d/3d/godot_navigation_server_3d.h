@@ -80,6 +80,16 @@ class GodotNavigationServer3D : public NavigationServer3D {
 	bool active = true;
 	LocalVector<NavMap3D *> active_maps;
 
+	// Path queries with a callback are deferred and executed in parallel on
+	// worker threads during the next physics process step.
+	struct AsyncPathQuery {
+		Ref<NavigationPathQueryParameters3D> query_parameters;
+		Ref<NavigationPathQueryResult3D> query_result;
+		Callable callback;
+	};
+	Mutex async_path_queries_mutex;
+	LocalVector<AsyncPathQuery> async_path_queries;
+
 	NavMeshGenerator3D *navmesh_generator_3d = nullptr;
 
 	// Performance Monitor
@@ -299,6 +309,9 @@ public:
 private:
 	void internal_free_agent(RID p_object);
 	void internal_free_obstacle(RID p_object);
+
+	void _execute_async_path_query(uint32_t p_index, AsyncPathQuery *p_queries);
+	void _flush_async_path_queries();
 };
 
 #undef COMMAND_1
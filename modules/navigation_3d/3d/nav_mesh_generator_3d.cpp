@@ -46,6 +46,7 @@ bool NavMeshGenerator3D::use_threads = true;
 bool NavMeshGenerator3D::baking_use_multiple_threads = true;
 bool NavMeshGenerator3D::baking_use_high_priority_threads = true;
 HashMap<Ref<NavigationMesh>, NavMeshGenerator3D::NavMeshGeneratorTask3D *> NavMeshGenerator3D::baking_navmeshes;
+HashMap<ObjectID, NavMeshGenerator3D::BakedInputs> NavMeshGenerator3D::baked_inputs;
 HashMap<WorkerThreadPool::TaskID, NavMeshGenerator3D::NavMeshGeneratorTask3D *> NavMeshGenerator3D::generator_tasks;
 LocalVector<NavMeshGeometryParser3D *> NavMeshGenerator3D::generator_parsers;
 
@@ -105,6 +106,7 @@ void NavMeshGenerator3D::sync() {
 				DEV_ASSERT(generator_task->status == NavMeshGeneratorTask3D::TaskStatus::BAKING_FINISHED);
 
 				baking_navmeshes.erase(generator_task->navigation_mesh);
+				_store_baked_inputs_locked(generator_task->navigation_mesh, generator_task->bake_inputs_hash);
 				if (generator_task->callback.is_valid()) {
 					generator_emit_callback(generator_task->callback);
 				}
@@ -125,6 +127,7 @@ void NavMeshGenerator3D::cleanup() {
 		MutexLock generator_task_lock(generator_task_mutex);
 
 		baking_navmeshes.clear();
+		baked_inputs.clear();
 
 		for (KeyValue<WorkerThreadPool::TaskID, NavMeshGeneratorTask3D *> &E : generator_tasks) {
 			WorkerThreadPool::get_singleton()->wait_for_task_completion(E.key);
@@ -157,6 +160,85 @@ void NavMeshGenerator3D::parse_source_geometry_data(Ref<NavigationMesh> p_naviga
 	}
 }
 
+uint32_t NavMeshGenerator3D::_hash_bake_inputs(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data) {
+	Vector<float> source_vertices;
+	Vector<int> source_indices;
+	Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
+	p_source_geometry_data->get_data(source_vertices, source_indices, projected_obstructions);
+
+	uint32_t h = hash_murmur3_one_32(source_vertices.size());
+	h = hash_murmur3_one_32(hash_murmur3_buffer(source_vertices.ptr(), source_vertices.size() * sizeof(float)), h);
+	h = hash_murmur3_one_32(hash_murmur3_buffer(source_indices.ptr(), source_indices.size() * sizeof(int)), h);
+	for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+		h = hash_murmur3_one_32(hash_murmur3_buffer(projected_obstruction.vertices.ptr(), projected_obstruction.vertices.size() * sizeof(float)), h);
+		h = hash_murmur3_one_float(projected_obstruction.elevation, h);
+		h = hash_murmur3_one_float(projected_obstruction.height, h);
+		h = hash_murmur3_one_32(projected_obstruction.carve, h);
+	}
+
+	h = hash_murmur3_one_float(p_navigation_mesh->get_cell_size(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_cell_height(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_border_size(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_agent_height(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_agent_radius(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_agent_max_climb(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_agent_max_slope(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_region_min_size(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_region_merge_size(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_edge_max_length(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_edge_max_error(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_vertices_per_polygon(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_detail_sample_distance(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_detail_sample_max_error(), h);
+	h = hash_murmur3_one_32(p_navigation_mesh->get_filter_low_hanging_obstacles(), h);
+	h = hash_murmur3_one_32(p_navigation_mesh->get_filter_ledge_spans(), h);
+	h = hash_murmur3_one_32(p_navigation_mesh->get_filter_walkable_low_height_spans(), h);
+	h = hash_murmur3_one_32(p_navigation_mesh->get_sample_partition_type(), h);
+	const AABB filter_baking_aabb = p_navigation_mesh->get_filter_baking_aabb();
+	h = hash_murmur3_one_real(filter_baking_aabb.position.x, h);
+	h = hash_murmur3_one_real(filter_baking_aabb.position.y, h);
+	h = hash_murmur3_one_real(filter_baking_aabb.position.z, h);
+	h = hash_murmur3_one_real(filter_baking_aabb.size.x, h);
+	h = hash_murmur3_one_real(filter_baking_aabb.size.y, h);
+	h = hash_murmur3_one_real(filter_baking_aabb.size.z, h);
+	const Vector3 filter_baking_aabb_offset = p_navigation_mesh->get_filter_baking_aabb_offset();
+	h = hash_murmur3_one_real(filter_baking_aabb_offset.x, h);
+	h = hash_murmur3_one_real(filter_baking_aabb_offset.y, h);
+	h = hash_murmur3_one_real(filter_baking_aabb_offset.z, h);
+
+	return hash_fmix32(h);
+}
+
+bool NavMeshGenerator3D::_skip_unchanged_bake(const Ref<NavigationMesh> &p_navigation_mesh, uint32_t p_bake_inputs_hash) {
+	MutexLock baking_navmesh_lock(baking_navmesh_mutex);
+	const BakedInputs *baked = baked_inputs.getptr(p_navigation_mesh->get_instance_id());
+	if (baked == nullptr || baked->hash != p_bake_inputs_hash) {
+		return false;
+	}
+	// Only skip when the mesh still holds the result of that bake and was not cleared or replaced since.
+	return baked->polygon_count == p_navigation_mesh->get_polygon_count();
+}
+
+void NavMeshGenerator3D::_store_baked_inputs_locked(const Ref<NavigationMesh> &p_navigation_mesh, uint32_t p_bake_inputs_hash) {
+	if (baked_inputs.size() > 256) {
+		// Drop entries of meshes that no longer exist so the map can't grow without bounds.
+		LocalVector<ObjectID> dead_meshes;
+		for (const KeyValue<ObjectID, BakedInputs> &E : baked_inputs) {
+			if (ObjectDB::get_instance(E.key) == nullptr) {
+				dead_meshes.push_back(E.key);
+			}
+		}
+		for (ObjectID dead_mesh : dead_meshes) {
+			baked_inputs.erase(dead_mesh);
+		}
+	}
+
+	BakedInputs baked;
+	baked.hash = p_bake_inputs_hash;
+	baked.polygon_count = p_navigation_mesh->get_polygon_count();
+	baked_inputs.insert(p_navigation_mesh->get_instance_id(), baked);
+}
+
 void NavMeshGenerator3D::bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback) {
 	ERR_FAIL_COND(p_navigation_mesh.is_null());
 	ERR_FAIL_COND(p_source_geometry_data.is_null());
@@ -173,6 +255,17 @@ void NavMeshGenerator3D::bake_from_source_geometry_data(Ref<NavigationMesh> p_na
 	if (is_baking(p_navigation_mesh)) {
 		ERR_FAIL_MSG("NavigationMesh is already baking. Wait for current bake to finish.");
 	}
+
+	const uint32_t bake_inputs_hash = _hash_bake_inputs(p_navigation_mesh, p_source_geometry_data);
+	if (_skip_unchanged_bake(p_navigation_mesh, bake_inputs_hash)) {
+		// Neither the source geometry nor the bake settings changed since the last bake,
+		// so the mesh already holds the result this bake would produce.
+		if (p_callback.is_valid()) {
+			generator_emit_callback(p_callback);
+		}
+		return;
+	}
+
 	baking_navmesh_mutex.lock();
 	NavMeshGeneratorTask3D generator_task;
 	baking_navmeshes.insert(p_navigation_mesh, &generator_task);
@@ -186,6 +279,7 @@ void NavMeshGenerator3D::bake_from_source_geometry_data(Ref<NavigationMesh> p_na
 
 	baking_navmesh_mutex.lock();
 	baking_navmeshes.erase(p_navigation_mesh);
+	_store_baked_inputs_locked(p_navigation_mesh, bake_inputs_hash);
 	baking_navmesh_mutex.unlock();
 
 	if (p_callback.is_valid()) {
@@ -217,6 +311,17 @@ void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh
 		ERR_FAIL_MSG("NavigationMesh is already baking. Wait for current bake to finish.");
 		return;
 	}
+
+	const uint32_t bake_inputs_hash = _hash_bake_inputs(p_navigation_mesh, p_source_geometry_data);
+	if (_skip_unchanged_bake(p_navigation_mesh, bake_inputs_hash)) {
+		// Neither the source geometry nor the bake settings changed since the last bake,
+		// so the mesh already holds the result this bake would produce.
+		if (p_callback.is_valid()) {
+			generator_emit_callback(p_callback);
+		}
+		return;
+	}
+
 	baking_navmesh_mutex.lock();
 	NavMeshGeneratorTask3D *generator_task = memnew(NavMeshGeneratorTask3D);
 	baking_navmeshes.insert(p_navigation_mesh, generator_task);
@@ -226,6 +331,7 @@ void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh
 	generator_task->source_geometry_data = p_source_geometry_data;
 	generator_task->callback = p_callback;
 	generator_task->status = NavMeshGeneratorTask3D::TaskStatus::BAKING_STARTED;
+	generator_task->bake_inputs_hash = bake_inputs_hash;
 	generator_task->thread_task_id = WorkerThreadPool::get_singleton()->add_native_task(&NavMeshGenerator3D::generator_thread_bake, generator_task, NavMeshGenerator3D::baking_use_high_priority_threads, SNAME("NavMeshGeneratorBake3D"));
 	MutexLock generator_task_lock(generator_task_mutex);
 	generator_tasks.insert(generator_task->thread_task_id, generator_task);
@@ -87,6 +87,7 @@ private:
 		Callable callback;
 		WorkerThreadPool::TaskID thread_task_id = WorkerThreadPool::INVALID_TASK_ID;
 		NavMeshGeneratorTask3D::TaskStatus status = NavMeshGeneratorTask3D::TaskStatus::BAKING_STARTED;
+		uint32_t bake_inputs_hash = 0;
 
 		NavMeshBakeState bake_state = NavMeshBakeState::BAKE_STATE_NONE;
 	};
@@ -97,6 +98,19 @@ private:
 
 	static HashMap<Ref<NavigationMesh>, NavMeshGeneratorTask3D *> baking_navmeshes;
 
+	struct BakedInputs {
+		uint32_t hash = 0;
+		int polygon_count = 0;
+	};
+	// Hash of the inputs of the last finished bake per navigation mesh, used to
+	// skip rebakes whose source geometry and bake settings did not change.
+	// Guarded by baking_navmesh_mutex.
+	static HashMap<ObjectID, BakedInputs> baked_inputs;
+
+	static uint32_t _hash_bake_inputs(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data);
+	static bool _skip_unchanged_bake(const Ref<NavigationMesh> &p_navigation_mesh, uint32_t p_bake_inputs_hash);
+	static void _store_baked_inputs_locked(const Ref<NavigationMesh> &p_navigation_mesh, uint32_t p_bake_inputs_hash);
+
 	static void generator_parse_geometry_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node, bool p_recurse_children);
 	static void generator_parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_root_node);
 	static void generator_bake_from_source_geometry_data(NavMeshGeneratorTask3D *p_generator_task);
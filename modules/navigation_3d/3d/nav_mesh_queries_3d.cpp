@@ -295,6 +295,11 @@ void NavMeshQueries3D::_query_task_search_polygon_connections(NavMeshPathQueryTa
 
 	// Check if the neighbor polygon has already been processed.
 	NavigationPoly &neighbor_poly = navigation_polys[p_query_task.path_query_slot->poly_to_id[p_connection.polygon]];
+	if (neighbor_poly.search_pass != p_query_task.path_query_slot->search_pass) {
+		// First visit in this search pass, reset the stale entry.
+		neighbor_poly.reset();
+		neighbor_poly.search_pass = p_query_task.path_query_slot->search_pass;
+	}
 	if (new_traveled_distance < neighbor_poly.traveled_distance) {
 		// Add the polygon to the heap of polygons to traverse next.
 		neighbor_poly.back_navigation_poly_id = p_least_cost_id;
@@ -329,12 +334,15 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 	traversable_polys.clear();
 
 	LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
-	for (NavigationPoly &polygon : navigation_polys) {
-		polygon.reset();
-	}
+	// Stale corridor entries are reset lazily when a search pass first touches
+	// them, so a query does not pay for clearing a corridor sized for the
+	// whole map when it only visits a few polygons.
+	uint64_t search_pass = ++p_query_task.path_query_slot->search_pass;
 
 	// Initialize the matching navigation polygon.
 	NavigationPoly &begin_navigation_poly = navigation_polys[p_query_task.path_query_slot->poly_to_id[begin_poly]];
+	begin_navigation_poly.reset();
+	begin_navigation_poly.search_pass = search_pass;
 	begin_navigation_poly.poly = begin_poly;
 	begin_navigation_poly.entry = begin_point;
 	begin_navigation_poly.back_navigation_edge_pathway_start = begin_point;
@@ -446,11 +454,12 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 				return;
 			}
 
-			for (NavigationPoly &nav_poly : navigation_polys) {
-				nav_poly.poly = nullptr;
-				nav_poly.traveled_distance = FLT_MAX;
-			}
+			// Restart the search with a fresh pass; entries of the old pass are
+			// reset lazily as they are visited again.
+			search_pass = ++p_query_task.path_query_slot->search_pass;
 			uint32_t _bp_id = p_query_task.path_query_slot->poly_to_id[begin_poly];
+			navigation_polys[_bp_id].reset();
+			navigation_polys[_bp_id].search_pass = search_pass;
 			navigation_polys[_bp_id].poly = begin_poly;
 			navigation_polys[_bp_id].traveled_distance = 0;
 			least_cost_id = _bp_id;
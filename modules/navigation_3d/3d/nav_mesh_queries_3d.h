@@ -52,6 +52,7 @@ public:
 		Heap<Nav3D::NavigationPoly *, Nav3D::NavPolyTravelCostGreaterThan, Nav3D::NavPolyHeapIndexer> traversable_polys;
 		bool in_use = false;
 		uint32_t slot_index = 0;
+		uint64_t search_pass = 0;
 		AHashMap<const Nav3D::Polygon *, uint32_t> poly_to_id;
 	};
 
@@ -110,6 +110,11 @@ struct NavigationPoly {
 	/// This poly.
 	const Polygon *poly = nullptr;
 
+	/// Search pass that last touched this poly. Entries from older passes are
+	/// lazily reset when first visited, so a query does not need to clear the
+	/// whole corridor up front.
+	uint64_t search_pass = 0;
+
 	/// Index in the heap of traversable polygons.
 	uint32_t traversable_poly_index = UINT32_MAX;
 
@@ -30,6 +30,82 @@
 
 #include "noise.h"
 
+#include "core/object/worker_thread_pool.h"
+
+PackedFloat32Array Noise::get_noise_series_2d(const PackedVector2Array &p_points) const {
+	PackedFloat32Array values;
+	values.resize(p_points.size());
+
+	const Vector2 *points_ptr = p_points.ptr();
+	float *values_ptr = values.ptrw();
+	for (int i = 0; i < p_points.size(); i++) {
+		values_ptr[i] = get_noise_2dv(points_ptr[i]);
+	}
+
+	return values;
+}
+
+PackedFloat32Array Noise::get_noise_series_3d(const PackedVector3Array &p_points) const {
+	PackedFloat32Array values;
+	values.resize(p_points.size());
+
+	const Vector3 *points_ptr = p_points.ptr();
+	float *values_ptr = values.ptrw();
+	for (int i = 0; i < p_points.size(); i++) {
+		values_ptr[i] = get_noise_3dv(points_ptr[i]);
+	}
+
+	return values;
+}
+
+struct NoiseBufferFillState {
+	const Noise *noise = nullptr;
+	float *values = nullptr;
+	Vector3 position;
+	Vector3i size;
+	Vector3 step;
+};
+
+static void _noise_buffer_fill_plane(void *p_state, uint32_t p_z) {
+	const NoiseBufferFillState &state = *static_cast<NoiseBufferFillState *>(p_state);
+
+	float *values_ptr = state.values + int64_t(p_z) * state.size.x * state.size.y;
+	real_t z = state.position.z + p_z * state.step.z;
+	for (int y = 0; y < state.size.y; y++) {
+		real_t py = state.position.y + y * state.step.y;
+		for (int x = 0; x < state.size.x; x++) {
+			*values_ptr++ = state.noise->get_noise_3d(state.position.x + x * state.step.x, py, z);
+		}
+	}
+}
+
+PackedFloat32Array Noise::get_noise_buffer_3d(const Vector3 &p_position, const Vector3i &p_size, const Vector3 &p_step) const {
+	ERR_FAIL_COND_V(p_size.x <= 0 || p_size.y <= 0 || p_size.z <= 0, PackedFloat32Array());
+
+	PackedFloat32Array values;
+	values.resize(int64_t(p_size.x) * p_size.y * p_size.z);
+
+	NoiseBufferFillState state;
+	state.noise = this;
+	state.values = values.ptrw();
+	state.position = p_position;
+	state.size = p_size;
+	state.step = p_step;
+
+	// Planes are independent, so spread large fills over the worker pool.
+	const int64_t plane_size = int64_t(p_size.x) * p_size.y;
+	if (p_size.z > 1 && plane_size * p_size.z >= 4096) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_noise_buffer_fill_plane, &state, p_size.z, -1, false, SNAME("NoiseBufferFill"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (int z = 0; z < p_size.z; z++) {
+			_noise_buffer_fill_plane(&state, z);
+		}
+	}
+
+	return values;
+}
+
 Vector<Ref<Image>> Noise::_get_seamless_image(int p_width, int p_height, int p_depth, bool p_invert, bool p_in_3d_space, real_t p_blend_skirt, bool p_normalize) const {
 	ERR_FAIL_COND_V(p_width <= 0 || p_height <= 0 || p_depth <= 0, Vector<Ref<Image>>());
 
@@ -189,6 +265,11 @@ void Noise::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_noise_3d", "x", "y", "z"), &Noise::get_noise_3d);
 	ClassDB::bind_method(D_METHOD("get_noise_3dv", "v"), &Noise::get_noise_3dv);
 
+	// Batch sampling.
+	ClassDB::bind_method(D_METHOD("get_noise_series_2d", "points"), &Noise::get_noise_series_2d);
+	ClassDB::bind_method(D_METHOD("get_noise_series_3d", "points"), &Noise::get_noise_series_3d);
+	ClassDB::bind_method(D_METHOD("get_noise_buffer_3d", "position", "size", "step"), &Noise::get_noise_buffer_3d, DEFVAL(Vector3(1, 1, 1)));
+
 	// Textures.
 	ClassDB::bind_method(D_METHOD("get_image", "width", "height", "invert", "in_3d_space", "normalize"), &Noise::get_image, DEFVAL(false), DEFVAL(false), DEFVAL(true));
 	ClassDB::bind_method(D_METHOD("get_seamless_image", "width", "height", "invert", "in_3d_space", "skirt", "normalize"), &Noise::get_seamless_image, DEFVAL(false), DEFVAL(false), DEFVAL(0.1), DEFVAL(true));
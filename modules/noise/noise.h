@@ -289,6 +289,12 @@ public:
 	virtual real_t get_noise_3dv(Vector3 p_v) const = 0;
 	virtual real_t get_noise_3d(real_t p_x, real_t p_y, real_t p_z) const = 0;
 
+	// Batch sampling. One call amortizes the per-sample call overhead over many
+	// points, which matters when filling whole chunks from scripts.
+	PackedFloat32Array get_noise_series_2d(const PackedVector2Array &p_points) const;
+	PackedFloat32Array get_noise_series_3d(const PackedVector3Array &p_points) const;
+	PackedFloat32Array get_noise_buffer_3d(const Vector3 &p_position, const Vector3i &p_size, const Vector3 &p_step = Vector3(1, 1, 1)) const;
+
 	Vector<Ref<Image>> _get_image(int p_width, int p_height, int p_depth, bool p_invert = false, bool p_in_3d_space = false, bool p_normalize = true) const;
 	virtual Ref<Image> get_image(int p_width, int p_height, bool p_invert = false, bool p_in_3d_space = false, bool p_normalize = true) const;
 	virtual TypedArray<Image> get_image_3d(int p_width, int p_height, int p_depth, bool p_invert = false, bool p_normalize = true) const;
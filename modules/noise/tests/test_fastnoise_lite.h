@@ -631,4 +631,56 @@ TEST_CASE("[FastNoiseLite] Generating seamless 2D images (11x11px) and compare t
 	}
 }
 
+TEST_CASE("[FastNoiseLite] Batch sampling matches single samples") {
+	FastNoiseLite noise;
+	noise.set_noise_type(FastNoiseLite::NoiseType::TYPE_SIMPLEX);
+	noise.set_seed(123);
+
+	SUBCASE("2D series") {
+		PackedVector2Array points;
+		for (int i = 0; i < 16; i++) {
+			points.push_back(Vector2(i * 0.7, i * -1.3));
+		}
+		PackedFloat32Array values = noise.get_noise_series_2d(points);
+		REQUIRE(values.size() == points.size());
+		for (int i = 0; i < points.size(); i++) {
+			CHECK(values[i] == doctest::Approx(noise.get_noise_2dv(points[i])));
+		}
+	}
+
+	SUBCASE("3D series") {
+		PackedVector3Array points;
+		for (int i = 0; i < 16; i++) {
+			points.push_back(Vector3(i * 0.7, i * -1.3, i * 2.1));
+		}
+		PackedFloat32Array values = noise.get_noise_series_3d(points);
+		REQUIRE(values.size() == points.size());
+		for (int i = 0; i < points.size(); i++) {
+			CHECK(values[i] == doctest::Approx(noise.get_noise_3dv(points[i])));
+		}
+	}
+
+	SUBCASE("3D buffer, including the threaded path") {
+		const Vector3 position = Vector3(-4, 2, 7);
+		const Vector3i size = Vector3i(16, 16, 16); // Large enough for the worker pool path.
+		const Vector3 step = Vector3(0.5, 1.0, 2.0);
+		PackedFloat32Array values = noise.get_noise_buffer_3d(position, size, step);
+		REQUIRE(values.size() == size.x * size.y * size.z);
+		for (int z = 0; z < size.z; z++) {
+			for (int y = 0; y < size.y; y++) {
+				for (int x = 0; x < size.x; x++) {
+					const int index = x + y * size.x + z * size.x * size.y;
+					CHECK(values[index] == doctest::Approx(noise.get_noise_3d(position.x + x * step.x, position.y + y * step.y, position.z + z * step.z)));
+				}
+			}
+		}
+	}
+
+	SUBCASE("Invalid buffer size") {
+		ERR_PRINT_OFF;
+		CHECK(noise.get_noise_buffer_3d(Vector3(), Vector3i(0, 4, 4)).is_empty());
+		ERR_PRINT_ON;
+	}
+}
+
 } //namespace TestFastNoiseLite
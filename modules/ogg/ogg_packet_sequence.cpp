@@ -166,39 +166,39 @@ bool OggPacketSequencePlayback::next_ogg_packet(ogg_packet **p_packet) const {
 
 uint32_t OggPacketSequencePlayback::seek_page_internal(int64_t granule, uint32_t after_page_inclusive, uint32_t before_page_inclusive) {
 	// FIXME: This function needs better corner case handling.
-	if (before_page_inclusive == after_page_inclusive) {
-		return before_page_inclusive;
-	}
-	uint32_t actual_middle_page = after_page_inclusive + (before_page_inclusive - after_page_inclusive) / 2;
-	// Complicating the bisection search algorithm, the middle page might not have a packet that ends on it,
-	// which means it might not have a correct granule position. Find a nearby page that does have a packet ending on it.
-	uint32_t bisection_page = -1;
-	// Don't include before_page_inclusive because that always succeeds and will cause infinite recursion later.
-	for (uint32_t test_page = actual_middle_page; test_page < before_page_inclusive; test_page++) {
-		if (ogg_packet_sequence->page_data[test_page].size() > 0) {
-			bisection_page = test_page;
-			break;
-		}
-	}
-	// Check if we have to go backwards.
-	if (bisection_page == (unsigned int)-1) {
-		for (uint32_t test_page = actual_middle_page; test_page >= after_page_inclusive; test_page--) {
+	while (before_page_inclusive != after_page_inclusive) {
+		uint32_t actual_middle_page = after_page_inclusive + (before_page_inclusive - after_page_inclusive) / 2;
+		// Complicating the bisection search algorithm, the middle page might not have a packet that ends on it,
+		// which means it might not have a correct granule position. Find a nearby page that does have a packet ending on it.
+		uint32_t bisection_page = -1;
+		// Don't include before_page_inclusive because that always succeeds and will cause an infinite loop later.
+		for (uint32_t test_page = actual_middle_page; test_page < before_page_inclusive; test_page++) {
 			if (ogg_packet_sequence->page_data[test_page].size() > 0) {
 				bisection_page = test_page;
 				break;
 			}
 		}
-	}
-	if (bisection_page == (unsigned int)-1) {
-		return -1;
-	}
+		// Check if we have to go backwards.
+		if (bisection_page == (unsigned int)-1) {
+			for (uint32_t test_page = actual_middle_page; test_page >= after_page_inclusive; test_page--) {
+				if (ogg_packet_sequence->page_data[test_page].size() > 0) {
+					bisection_page = test_page;
+					break;
+				}
+			}
+		}
+		if (bisection_page == (unsigned int)-1) {
+			return -1;
+		}
 
-	int64_t bisection_granule_pos = ogg_packet_sequence->page_granule_positions[bisection_page];
-	if (granule > bisection_granule_pos) {
-		return seek_page_internal(granule, bisection_page + 1, before_page_inclusive);
-	} else {
-		return seek_page_internal(granule, after_page_inclusive, bisection_page);
+		int64_t bisection_granule_pos = ogg_packet_sequence->page_granule_positions[bisection_page];
+		if (granule > bisection_granule_pos) {
+			after_page_inclusive = bisection_page + 1;
+		} else {
+			before_page_inclusive = bisection_page;
+		}
 	}
+	return before_page_inclusive;
 }
 
 bool OggPacketSequencePlayback::seek_page(int64_t p_granule_pos) {
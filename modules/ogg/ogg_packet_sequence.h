@@ -106,7 +106,7 @@ class OggPacketSequencePlayback : public RefCounted {
 
 	mutable int64_t packetno = 0;
 
-	// Recursive bisection search for the correct page.
+	// Bisection search for the correct page.
 	uint32_t seek_page_internal(int64_t granule, uint32_t after_page_inclusive, uint32_t before_page_inclusive);
 
 public:
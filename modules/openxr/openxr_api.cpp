@@ -2279,27 +2279,9 @@ void OpenXRAPI::free_main_swapchains() {
 	}
 }
 
-void OpenXRAPI::pre_render() {
-	ERR_FAIL_COND(session == XR_NULL_HANDLE);
-
+bool OpenXRAPI::locate_views() {
 	// Must be called from rendering thread!
-	ERR_NOT_ON_RENDER_THREAD;
-
-	if (!render_state.running) {
-		return;
-	}
-
-	// Process any swapchains that were queued to be freed
-	OpenXRSwapChainInfo::free_queued();
-
-	Size2i swapchain_size = get_recommended_target_size();
-	if (swapchain_size != render_state.main_swapchain_size) {
-		// Out with the old.
-		free_main_swapchains();
-
-		// In with the new.
-		create_main_swapchains(swapchain_size);
-	}
+	ERR_NOT_ON_RENDER_THREAD_V(false);
 
 	void *view_locate_info_next_pointer = nullptr;
 	for (OpenXRExtensionWrapper *extension : frame_info_extensions) {
@@ -2309,17 +2291,6 @@ void OpenXRAPI::pre_render() {
 		}
 	}
 
-	// Get our view info for the frame we're about to render, note from the OpenXR manual:
-	// "Repeatedly calling xrLocateViews with the same time may not necessarily return the same result. Instead the prediction gets increasingly accurate as the function is called closer to the given time for which a prediction is made"
-
-	// We're calling this "relatively" early, the positioning we're obtaining here will be used to do our frustum culling,
-	// occlusion culling, etc. There is however a technique that we can investigate in the future where after our entire
-	// Vulkan command buffer is build, but right before vkSubmitQueue is called, we call xrLocateViews one more time and
-	// update the view and projection matrix once more with a slightly more accurate predication and then submit the
-	// command queues.
-
-	// That is not possible yet but worth investigating in the future.
-
 	XrViewLocateInfo view_locate_info = {
 		XR_TYPE_VIEW_LOCATE_INFO, // type
 		view_locate_info_next_pointer, // next
@@ -2336,7 +2307,7 @@ void OpenXRAPI::pre_render() {
 	XrResult result = xrLocateViews(session, &view_locate_info, &view_state, render_state.views.size(), &view_count_output, render_state.views.ptr());
 	if (XR_FAILED(result)) {
 		print_line("OpenXR: Couldn't locate views [", get_error_string(result), "]");
-		return;
+		return false;
 	}
 
 	bool pose_valid = true;
@@ -2355,6 +2326,47 @@ void OpenXRAPI::pre_render() {
 		}
 	}
 
+	return true;
+}
+
+void OpenXRAPI::pre_render() {
+	ERR_FAIL_COND(session == XR_NULL_HANDLE);
+
+	// Must be called from rendering thread!
+	ERR_NOT_ON_RENDER_THREAD;
+
+	if (!render_state.running) {
+		return;
+	}
+
+	// Process any swapchains that were queued to be freed
+	OpenXRSwapChainInfo::free_queued();
+
+	Size2i swapchain_size = get_recommended_target_size();
+	if (swapchain_size != render_state.main_swapchain_size) {
+		// Out with the old.
+		free_main_swapchains();
+
+		// In with the new.
+		create_main_swapchains(swapchain_size);
+	}
+
+	// Get our view info for the frame we're about to render, note from the OpenXR manual:
+	// "Repeatedly calling xrLocateViews with the same time may not necessarily return the same result. Instead the prediction gets increasingly accurate as the function is called closer to the given time for which a prediction is made"
+
+	// We're calling this "relatively" early, the positioning we're obtaining here will be used to do our frustum culling,
+	// occlusion culling, etc. We re-locate once more in pre_draw_viewport, right before the XR viewport is culled and
+	// its command buffer is built, which gets us a more accurate prediction. There is however a technique that we can
+	// investigate in the future where after our entire Vulkan command buffer is build, but right before vkSubmitQueue
+	// is called, we call xrLocateViews one more time and update the view and projection matrix once more with a
+	// slightly more accurate predication and then submit the command queues.
+
+	// That is not possible yet but worth investigating in the future.
+
+	if (!locate_views()) {
+		return;
+	}
+
 	// We should get our frame no from the rendering server, but this will do.
 	begin_debug_label_region(String("Session Frame ") + String::num_uint64(++render_state.frame));
 
@@ -2388,6 +2400,13 @@ bool OpenXRAPI::pre_draw_viewport(RID p_render_target) {
 		return false;
 	}
 
+	// Re-locate our views with a more accurate prediction now that we're about to cull and record this viewport.
+	// Any work the rendering server did since pre_render (shadow updates, other viewports) has passed, so this
+	// sample is closer to the display time and shaves a bit of motion-to-photon latency off the head pose.
+	if (!locate_views() || !render_state.view_pose_valid) {
+		return false;
+	}
+
 	// Acquire our images
 	for (int i = 0; i < OPENXR_SWAPCHAIN_MAX; i++) {
 		if (!render_state.main_swapchains[i].is_image_acquired() && render_state.main_swapchains[i].get_swapchain() != XR_NULL_HANDLE) {
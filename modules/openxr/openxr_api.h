@@ -262,6 +262,7 @@ private:
 	bool obtain_swapchain_formats();
 	bool create_main_swapchains(const Size2i &p_size);
 	void free_main_swapchains();
+	bool locate_views();
 	void destroy_session();
 
 	// action map
@@ -339,7 +339,9 @@ void RaycastOcclusionCull::Scenario::_update_dirty_instance(int p_idx, RID *p_in
 	const Vector3 *read_ptr = occ->vertices.ptr();
 	float *write_ptr = occ_inst->xformed_vertices.ptr();
 
-	if (vertices_size > 1024) {
+	// Don't spawn nested group tasks when the instances themselves are already
+	// being updated in parallel on the pool.
+	if (vertices_size > 1024 && WorkerThreadPool::get_singleton()->get_caller_group_id() == WorkerThreadPool::INVALID_TASK_ID) {
 		TransformThreadData td;
 		td.xform = occ_inst->xform;
 		td.read = read_ptr;
@@ -424,8 +426,10 @@ void RaycastOcclusionCull::Scenario::update() {
 		instances.erase(scenario);
 	}
 
-	if (dirty_instances_array.size() / WorkerThreadPool::get_singleton()->get_thread_count() > 128) {
-		// Lots of instances, use per-instance threading
+	uint32_t thread_count = WorkerThreadPool::get_singleton()->get_thread_count();
+	if (thread_count > 1 && dirty_instances_array.size() >= thread_count) {
+		// Enough instances to spread across the pool, use per-instance threading.
+		// Vertex transforms stay serial inside each task in this case.
 		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &Scenario::_update_dirty_instance_thread, dirty_instances_array.ptr(), dirty_instances_array.size(), -1, true, SNAME("RaycastOcclusionCullUpdate"));
 		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
@@ -512,17 +516,20 @@ void RaycastOcclusionCull::add_buffer(RID p_buffer) {
 
 void RaycastOcclusionCull::remove_buffer(RID p_buffer) {
 	ERR_FAIL_COND(!buffers.has(p_buffer));
+	_buffer_wait(buffers[p_buffer]);
 	buffers.erase(p_buffer);
 }
 
 void RaycastOcclusionCull::buffer_set_scenario(RID p_buffer, RID p_scenario) {
 	ERR_FAIL_COND(!buffers.has(p_buffer));
 	ERR_FAIL_COND(p_scenario.is_valid() && !scenarios.has(p_scenario));
+	_buffer_wait(buffers[p_buffer]);
 	buffers[p_buffer].scenario_rid = p_scenario;
 }
 
 void RaycastOcclusionCull::buffer_set_size(RID p_buffer, const Vector2i &p_size) {
 	ERR_FAIL_COND(!buffers.has(p_buffer));
+	_buffer_wait(buffers[p_buffer]);
 	buffers[p_buffer].resize(p_size);
 }
 
@@ -591,6 +598,32 @@ Rect2 _get_viewport_rect(const Projection &p_cam_projection) {
 	return Rect2(bottom_left, 2 * half_extents);
 }
 
+void RaycastOcclusionCull::_buffer_update_rays(RaycastHZBuffer &p_buffer, const Scenario &p_scenario, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	Rect2 vp_rect = _get_viewport_rect(p_cam_projection);
+	Vector2 bottom_left = vp_rect.position;
+	bottom_left += _get_jitter(vp_rect, p_buffer.get_occlusion_buffer_size());
+	Vector3 near_bottom_left = Vector3(bottom_left.x, bottom_left.y, -p_cam_projection.get_z_near());
+
+	p_buffer.update_camera_rays(p_cam_transform, near_bottom_left, vp_rect.get_size(), p_cam_projection.get_z_far(), p_cam_orthogonal);
+
+	p_scenario.raycast(p_buffer.camera_rays, p_buffer.camera_ray_masks.ptr(), p_buffer.camera_rays_tile_count);
+	p_buffer.sort_rays(-p_cam_transform.basis.get_column(2), p_cam_orthogonal);
+	p_buffer.update_mips();
+}
+
+void RaycastOcclusionCull::_buffer_update_task(RaycastHZBuffer *p_buffer) {
+	const Scenario *scenario = scenarios.getptr(p_buffer->scenario_rid);
+	ERR_FAIL_NULL(scenario);
+	_buffer_update_rays(*p_buffer, *scenario, p_buffer->pending_cam_transform, p_buffer->pending_cam_projection, p_buffer->pending_cam_orthogonal);
+}
+
+void RaycastOcclusionCull::_buffer_wait(RaycastHZBuffer &p_buffer) {
+	if (p_buffer.update_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(p_buffer.update_task);
+		p_buffer.update_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+}
+
 void RaycastOcclusionCull::buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
 	if (!buffers.has(p_buffer)) {
 		return;
@@ -598,6 +631,12 @@ void RaycastOcclusionCull::buffer_update(RID p_buffer, const Transform3D &p_cam_
 
 	RaycastHZBuffer &buffer = buffers[p_buffer];
 
+	if (buffer.update_task != WorkerThreadPool::INVALID_TASK_ID) {
+		// buffer_update_async() already dispatched this frame's update; just wait for it.
+		_buffer_wait(buffer);
+		return;
+	}
+
 	if (buffer.is_empty() || !scenarios.has(buffer.scenario_rid)) {
 		return;
 	}
@@ -605,16 +644,33 @@ void RaycastOcclusionCull::buffer_update(RID p_buffer, const Transform3D &p_cam_
 	Scenario &scenario = scenarios[buffer.scenario_rid];
 	scenario.update();
 
-	Rect2 vp_rect = _get_viewport_rect(p_cam_projection);
-	Vector2 bottom_left = vp_rect.position;
-	bottom_left += _get_jitter(vp_rect, buffer.get_occlusion_buffer_size());
-	Vector3 near_bottom_left = Vector3(bottom_left.x, bottom_left.y, -p_cam_projection.get_z_near());
+	_buffer_update_rays(buffer, scenario, p_cam_transform, p_cam_projection, p_cam_orthogonal);
+}
+
+void RaycastOcclusionCull::buffer_update_async(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	if (!buffers.has(p_buffer)) {
+		return;
+	}
+
+	RaycastHZBuffer &buffer = buffers[p_buffer];
 
-	buffer.update_camera_rays(p_cam_transform, near_bottom_left, vp_rect.get_size(), p_cam_projection.get_z_far(), p_cam_orthogonal);
+	if (buffer.update_task != WorkerThreadPool::INVALID_TASK_ID) {
+		return; // Already in flight.
+	}
+
+	if (buffer.is_empty() || !scenarios.has(buffer.scenario_rid)) {
+		return;
+	}
+
+	// Committing scene updates is not thread-safe, so do it on the calling thread;
+	// concurrent raycasts against the committed scene are safe.
+	Scenario &scenario = scenarios[buffer.scenario_rid];
+	scenario.update();
 
-	scenario.raycast(buffer.camera_rays, buffer.camera_ray_masks.ptr(), buffer.camera_rays_tile_count);
-	buffer.sort_rays(-p_cam_transform.basis.get_column(2), p_cam_orthogonal);
-	buffer.update_mips();
+	buffer.pending_cam_transform = p_cam_transform;
+	buffer.pending_cam_projection = p_cam_projection;
+	buffer.pending_cam_orthogonal = p_cam_orthogonal;
+	buffer.update_task = WorkerThreadPool::get_singleton()->add_template_task(this, &RaycastOcclusionCull::_buffer_update_task, &buffer, true, SNAME("RaycastOcclusionCullBufferUpdate"));
 }
 
 RaycastOcclusionCull::HZBuffer *RaycastOcclusionCull::buffer_get_ptr(RID p_buffer) {
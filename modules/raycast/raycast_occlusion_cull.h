@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/math/projection.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/rid_owner.h"
 #include "servers/rendering/renderer_scene_occlusion_cull.h"
@@ -68,6 +69,12 @@ public:
 		LocalVector<uint32_t> camera_ray_masks;
 		RID scenario_rid;
 
+		// Pending update dispatched from buffer_update_async().
+		WorkerThreadPool::TaskID update_task = WorkerThreadPool::INVALID_TASK_ID;
+		Transform3D pending_cam_transform;
+		Projection pending_cam_projection;
+		bool pending_cam_orthogonal = false;
+
 		virtual void clear() override;
 		virtual void resize(const Size2i &p_size) override;
 		void sort_rays(const Vector3 &p_camera_dir, bool p_orthogonal);
@@ -162,6 +169,9 @@ private:
 
 	void _init_embree();
 	Vector2 _get_jitter(const Rect2 &p_viewport_rect, const Size2i &p_buffer_size);
+	void _buffer_update_rays(RaycastHZBuffer &p_buffer, const Scenario &p_scenario, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal);
+	void _buffer_update_task(RaycastHZBuffer *p_buffer);
+	void _buffer_wait(RaycastHZBuffer &p_buffer);
 
 public:
 	virtual bool is_occluder(RID p_rid) override;
@@ -181,6 +191,7 @@ public:
 	virtual void buffer_set_scenario(RID p_buffer, RID p_scenario) override;
 	virtual void buffer_set_size(RID p_buffer, const Vector2i &p_size) override;
 	virtual void buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) override;
+	virtual void buffer_update_async(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) override;
 
 	virtual RID buffer_get_debug_texture(RID p_buffer) override;
 
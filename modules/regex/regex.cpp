@@ -31,7 +31,9 @@
 #include "regex.h"
 #include "regex.compat.inc"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/memory.h"
+#include "core/templates/local_vector.h"
 
 extern "C" {
 #include <pcre2.h>
@@ -201,6 +203,11 @@ Error RegEx::compile(const String &p_pattern, bool p_show_error) {
 		}
 		return FAILED;
 	}
+
+	// Speeds up matching considerably on supported platforms. When the JIT compiler is
+	// unavailable or rejects the pattern, matching falls back to the interpreter.
+	pcre2_jit_compile_32((pcre2_code_32 *)code, PCRE2_JIT_COMPLETE);
+
 	return OK;
 }
 
@@ -217,16 +224,15 @@ Ref<RegExMatch> RegEx::search(const String &p_subject, int p_offset, int p_end)
 
 	pcre2_code_32 *c = (pcre2_code_32 *)code;
 	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
-	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
 	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
 
 	pcre2_match_data_32 *match = pcre2_match_data_create_from_pattern_32(c, gctx);
 
-	int res = pcre2_match_32(c, s, length, p_offset, 0, match, mctx);
+	// A null match context uses the defaults, which is all we ever need.
+	int res = pcre2_match_32(c, s, length, p_offset, 0, match, nullptr);
 
 	if (res < 0) {
 		pcre2_match_data_free_32(match);
-		pcre2_match_context_free_32(mctx);
 
 		return nullptr;
 	}
@@ -242,7 +248,6 @@ Ref<RegExMatch> RegEx::search(const String &p_subject, int p_offset, int p_end)
 	}
 
 	pcre2_match_data_free_32(match);
-	pcre2_match_context_free_32(mctx);
 
 	result->subject = p_subject;
 
@@ -289,6 +294,55 @@ TypedArray<RegExMatch> RegEx::search_all(const String &p_subject, int p_offset,
 	return result;
 }
 
+struct RegExBatchSearchState {
+	const RegEx *regex = nullptr;
+	const String *subjects = nullptr;
+	TypedArray<RegExMatch> *matches = nullptr;
+	int offset = 0;
+	int end = -1;
+};
+
+static void _regex_batch_search_subject(void *p_state, uint32_t p_index) {
+	RegExBatchSearchState &state = *static_cast<RegExBatchSearchState *>(p_state);
+	state.matches[p_index] = state.regex->search_all(state.subjects[p_index], state.offset, state.end);
+}
+
+TypedArray<Array> RegEx::search_all_batch(const PackedStringArray &p_subjects, int p_offset, int p_end) const {
+	ERR_FAIL_COND_V(!is_valid(), TypedArray<Array>());
+	ERR_FAIL_COND_V_MSG(p_offset < 0, TypedArray<Array>(), "RegEx search offset must be >= 0");
+
+	TypedArray<Array> result;
+	const int64_t subject_count = p_subjects.size();
+	if (subject_count == 0) {
+		return result;
+	}
+
+	// The compiled pattern is immutable and every worker gets its own match data,
+	// so subjects can be matched in parallel against the shared pattern.
+	LocalVector<TypedArray<RegExMatch>> matches;
+	matches.resize(subject_count);
+
+	RegExBatchSearchState state;
+	state.regex = this;
+	state.subjects = p_subjects.ptr();
+	state.matches = matches.ptr();
+	state.offset = p_offset;
+	state.end = p_end;
+
+	if (subject_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_regex_batch_search_subject, &state, subject_count, -1, false, SNAME("RegExBatchSearch"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_regex_batch_search_subject(&state, 0);
+	}
+
+	result.resize(subject_count);
+	for (int64_t i = 0; i < subject_count; i++) {
+		result[i] = matches[i];
+	}
+	return result;
+}
+
 int RegEx::_sub(const String &p_subject, const String &p_replacement, int p_offset, int p_end, uint32_t p_flags, String &r_output) const {
 	// `safety_zone` is the number of chars we allocate in addition to the number of chars expected in order to
 	// guard against the PCRE API writing one additional `\0` at the end. PCRE's API docs are unclear on whether
@@ -307,23 +361,21 @@ int RegEx::_sub(const String &p_subject, const String &p_replacement, int p_offs
 
 	pcre2_code_32 *c = (pcre2_code_32 *)code;
 	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
-	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
 	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
 	PCRE2_SPTR32 r = (PCRE2_SPTR32)p_replacement.get_data();
 	PCRE2_UCHAR32 *o = (PCRE2_UCHAR32 *)output.ptrw();
 
 	pcre2_match_data_32 *match = pcre2_match_data_create_from_pattern_32(c, gctx);
 
-	int res = pcre2_substitute_32(c, s, length, p_offset, p_flags, match, mctx, r, p_replacement.length(), o, &olength);
+	int res = pcre2_substitute_32(c, s, length, p_offset, p_flags, match, nullptr, r, p_replacement.length(), o, &olength);
 
 	if (res == PCRE2_ERROR_NOMEMORY) {
 		output.resize(olength + safety_zone);
 		o = (PCRE2_UCHAR32 *)output.ptrw();
-		res = pcre2_substitute_32(c, s, length, p_offset, p_flags, match, mctx, r, p_replacement.length(), o, &olength);
+		res = pcre2_substitute_32(c, s, length, p_offset, p_flags, match, nullptr, r, p_replacement.length(), o, &olength);
 	}
 
 	pcre2_match_data_free_32(match);
-	pcre2_match_context_free_32(mctx);
 
 	if (res >= 0) {
 		r_output = String::utf32(Span(output.ptr(), olength)) + p_subject.substr(length);
@@ -423,6 +475,7 @@ void RegEx::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("compile", "pattern", "show_error"), &RegEx::compile, DEFVAL(true));
 	ClassDB::bind_method(D_METHOD("search", "subject", "offset", "end"), &RegEx::search, DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("search_all", "subject", "offset", "end"), &RegEx::search_all, DEFVAL(0), DEFVAL(-1));
+	ClassDB::bind_method(D_METHOD("search_all_batch", "subjects", "offset", "end"), &RegEx::search_all_batch, DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("sub", "subject", "replacement", "all", "offset", "end"), &RegEx::sub, DEFVAL(false), DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("is_valid"), &RegEx::is_valid);
 	ClassDB::bind_method(D_METHOD("get_pattern"), &RegEx::get_pattern);
@@ -421,4 +421,33 @@ TEST_CASE("[RegEx] Lookbehind groups empty matches") {
 	CHECK(match->get_string(1) == String("b"));
 }
 
+TEST_CASE("[RegEx] Batch search all") {
+	RegEx re("\\d+");
+	REQUIRE(re.is_valid());
+
+	PackedStringArray subjects;
+	subjects.push_back("1 2 3");
+	subjects.push_back("no digits");
+	subjects.push_back("42");
+
+	const TypedArray<Array> batch_results = re.search_all_batch(subjects);
+	REQUIRE(batch_results.size() == 3);
+
+	for (int i = 0; i < subjects.size(); i++) {
+		const Array expected = re.search_all(subjects[i]);
+		const Array results = batch_results[i];
+		REQUIRE(results.size() == expected.size());
+		for (int j = 0; j < results.size(); j++) {
+			Ref<RegExMatch> match = results[j];
+			Ref<RegExMatch> expected_match = expected[j];
+			REQUIRE(match.is_valid());
+			CHECK(match->get_string(0) == expected_match->get_string(0));
+			CHECK(match->get_start(0) == expected_match->get_start(0));
+			CHECK(match->get_end(0) == expected_match->get_end(0));
+		}
+	}
+
+	CHECK(re.search_all_batch(PackedStringArray()).is_empty());
+}
+
 } // namespace TestRegEx
@@ -416,6 +416,7 @@ void TextServerAdvanced::_free_rid(const RID &p_rid) {
 			font_owner.free(p_rid);
 		}
 		memdelete(fd);
+		_shape_run_cache_clear(); // Cached runs may reference the freed font.
 	} else if (font_var_owner.owns(p_rid)) {
 		MutexLock ftlock(ft_mutex);
 
@@ -1379,6 +1380,9 @@ bool TextServerAdvanced::_ensure_glyph(FontAdvanced *p_font_data, const Vector2i
 			FT_Stroker_Done(stroker);
 		}
 		gl.from_svg = from_svg;
+		if (from_svg && gl.texture_idx >= 0) {
+			fd->textures.write[gl.texture_idx].from_svg = true;
+		}
 		E = fd->glyph_map.insert(p_glyph, gl);
 		r_glyph = E->value;
 		return gl.found;
@@ -2012,6 +2016,26 @@ _FORCE_INLINE_ void TextServerAdvanced::_font_clear_cache(FontAdvanced *p_font_d
 	p_font_data->supported_features.clear();
 	p_font_data->supported_varaitions.clear();
 	p_font_data->supported_scripts.clear();
+
+	_shape_run_cache_clear(); // Cached runs may reference the modified font.
+}
+
+_FORCE_INLINE_ void TextServerAdvanced::_font_upload_dirty_texture(const FontAdvanced *p_font_data, ShelfPackTexture &p_tex) const {
+	Ref<Image> img = p_tex.image;
+	if (p_tex.from_svg) {
+		// Same as the "fix alpha border" process option when importing SVGs
+		img->fix_alpha_edges();
+	}
+	if (p_font_data->mipmaps && !img->has_mipmaps()) {
+		img = p_tex.image->duplicate();
+		img->generate_mipmaps();
+	}
+	if (p_tex.texture.is_null()) {
+		p_tex.texture = ImageTexture::create_from_image(img);
+	} else {
+		p_tex.texture->update(img);
+	}
+	p_tex.dirty = false;
 }
 
 hb_font_t *TextServerAdvanced::_font_get_hb_handle(const RID &p_font_rid, int64_t p_size, bool &r_is_color) const {
@@ -3479,22 +3503,7 @@ RID TextServerAdvanced::_font_get_glyph_texture_rid(const RID &p_font_rid, const
 	if (RenderingServer::get_singleton() != nullptr) {
 		if (fgl.texture_idx != -1) {
 			if (ffsd->textures[fgl.texture_idx].dirty) {
-				ShelfPackTexture &tex = ffsd->textures.write[fgl.texture_idx];
-				Ref<Image> img = tex.image;
-				if (fgl.from_svg) {
-					// Same as the "fix alpha border" process option when importing SVGs
-					img->fix_alpha_edges();
-				}
-				if (fd->mipmaps && !img->has_mipmaps()) {
-					img = tex.image->duplicate();
-					img->generate_mipmaps();
-				}
-				if (tex.texture.is_null()) {
-					tex.texture = ImageTexture::create_from_image(img);
-				} else {
-					tex.texture->update(img);
-				}
-				tex.dirty = false;
+				_font_upload_dirty_texture(fd, ffsd->textures.write[fgl.texture_idx]);
 			}
 			return ffsd->textures[fgl.texture_idx].texture->get_rid();
 		}
@@ -3531,22 +3540,7 @@ Size2 TextServerAdvanced::_font_get_glyph_texture_size(const RID &p_font_rid, co
 	if (RenderingServer::get_singleton() != nullptr) {
 		if (fgl.texture_idx != -1) {
 			if (ffsd->textures[fgl.texture_idx].dirty) {
-				ShelfPackTexture &tex = ffsd->textures.write[fgl.texture_idx];
-				Ref<Image> img = tex.image;
-				if (fgl.from_svg) {
-					// Same as the "fix alpha border" process option when importing SVGs
-					img->fix_alpha_edges();
-				}
-				if (fd->mipmaps && !img->has_mipmaps()) {
-					img = tex.image->duplicate();
-					img->generate_mipmaps();
-				}
-				if (tex.texture.is_null()) {
-					tex.texture = ImageTexture::create_from_image(img);
-				} else {
-					tex.texture->update(img);
-				}
-				tex.dirty = false;
+				_font_upload_dirty_texture(fd, ffsd->textures.write[fgl.texture_idx]);
 			}
 			return ffsd->textures[fgl.texture_idx].texture->get_size();
 		}
@@ -3893,6 +3887,15 @@ void TextServerAdvanced::_font_render_range(const RID &p_font_rid, const Vector2
 		}
 #endif
 	}
+	if (RenderingServer::get_singleton() != nullptr) {
+		// Upload everything rasterized above in one texture update per atlas
+		// page, so the first draw of the warmed glyphs does not pay for it.
+		for (int i = 0; i < ffsd->textures.size(); i++) {
+			if (ffsd->textures[i].dirty) {
+				_font_upload_dirty_texture(fd, ffsd->textures.write[i]);
+			}
+		}
+	}
 }
 
 void TextServerAdvanced::_font_render_glyph(const RID &p_font_rid, const Vector2i &p_size, int64_t p_index) {
@@ -3926,11 +3929,29 @@ void TextServerAdvanced::_font_render_glyph(const RID &p_font_rid, const Vector2
 		}
 	}
 #endif
+	if (RenderingServer::get_singleton() != nullptr) {
+		// Upload everything rasterized above in one texture update per atlas
+		// page, so the first draw of the warmed glyphs does not pay for it.
+		for (int i = 0; i < ffsd->textures.size(); i++) {
+			if (ffsd->textures[i].dirty) {
+				_font_upload_dirty_texture(fd, ffsd->textures.write[i]);
+			}
+		}
+	}
 }
 
 void TextServerAdvanced::_font_draw_glyph(const RID &p_font_rid, const RID &p_canvas, int64_t p_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color, float p_oversampling) const {
-	if (p_index == 0) {
-		return; // Non visual character, skip.
+	PackedVector2Array positions;
+	positions.push_back(p_pos);
+	PackedInt64Array indices;
+	indices.push_back(p_index);
+	_font_draw_glyphs(p_font_rid, p_canvas, p_size, positions, indices, p_color, p_oversampling);
+}
+
+void TextServerAdvanced::_font_draw_glyphs(const RID &p_font_rid, const RID &p_canvas, int64_t p_size, const PackedVector2Array &p_positions, const PackedInt64Array &p_indices, const Color &p_color, float p_oversampling) const {
+	ERR_FAIL_COND(p_positions.size() != p_indices.size());
+	if (p_positions.is_empty()) {
+		return;
 	}
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
@@ -3968,110 +3989,134 @@ void TextServerAdvanced::_font_draw_glyph(const RID &p_font_rid, const RID &p_ca
 	FontForSizeAdvanced *ffsd = nullptr;
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size, ffsd, false, viewport_oversampling ? 64 * oversampling_factor : 0));
 
-	int32_t index = p_index & 0xffffff; // Remove subpixel shifts.
-	bool lcd_aa = false;
+	// Consecutive glyphs that land on the same cache texture with the same modulate color are flushed as a single batched rect command.
+	RID batch_texture;
+	Color batch_modulate;
+	Vector<Rect2> batch_rects;
+	Vector<Rect2> batch_src_rects;
+	auto flush_batch = [&]() {
+		if (batch_rects.is_empty()) {
+			return;
+		}
+#ifdef GDEXTENSION
+		// godot-cpp only exposes the scripting API, which has no batched rect command; emit the rects one by one.
+		for (int i = 0; i < batch_rects.size(); i++) {
+			RenderingServer::get_singleton()->canvas_item_add_texture_rect_region(p_canvas, batch_rects[i], batch_texture, batch_src_rects[i], batch_modulate, false, false);
+		}
+#else
+		RenderingServer::get_singleton()->canvas_item_add_texture_rect_region_batch(p_canvas, batch_texture, batch_rects, batch_src_rects, batch_modulate);
+#endif
+		batch_rects.clear();
+		batch_src_rects.clear();
+	};
+
+	for (int gl = 0; gl < p_positions.size(); gl++) {
+		if (p_indices[gl] == 0) {
+			continue; // Non visual character, skip.
+		}
+		const Vector2 glyph_pos = p_positions[gl];
+
+		int32_t index = p_indices[gl] & 0xffffff; // Remove subpixel shifts.
+		bool lcd_aa = false;
 
 #ifdef MODULE_FREETYPE_ENABLED
-	if (!fd->msdf && ffsd->face) {
-		// LCD layout, bits 24, 25, 26
-		if (fd->antialiasing == FONT_ANTIALIASING_LCD) {
-			TextServer::FontLCDSubpixelLayout layout = lcd_subpixel_layout.get();
-			if (layout != FONT_LCD_SUBPIXEL_LAYOUT_NONE) {
-				lcd_aa = true;
-				index = index | (layout << 24);
+		if (!fd->msdf && ffsd->face) {
+			// LCD layout, bits 24, 25, 26
+			if (fd->antialiasing == FONT_ANTIALIASING_LCD) {
+				TextServer::FontLCDSubpixelLayout layout = lcd_subpixel_layout.get();
+				if (layout != FONT_LCD_SUBPIXEL_LAYOUT_NONE) {
+					lcd_aa = true;
+					index = index | (layout << 24);
+				}
+			}
+			// Subpixel X-shift, bits 27, 28
+			if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE * 64)) {
+				int xshift = (int)(Math::floor(4 * (glyph_pos.x + 0.125)) - 4 * Math::floor(glyph_pos.x + 0.125));
+				index = index | (xshift << 27);
+			} else if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE * 64)) {
+				int xshift = (int)(Math::floor(2 * (glyph_pos.x + 0.25)) - 2 * Math::floor(glyph_pos.x + 0.25));
+				index = index | (xshift << 27);
 			}
 		}
-		// Subpixel X-shift, bits 27, 28
-		if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE * 64)) {
-			int xshift = (int)(Math::floor(4 * (p_pos.x + 0.125)) - 4 * Math::floor(p_pos.x + 0.125));
-			index = index | (xshift << 27);
-		} else if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE * 64)) {
-			int xshift = (int)(Math::floor(2 * (p_pos.x + 0.25)) - 2 * Math::floor(p_pos.x + 0.25));
-			index = index | (xshift << 27);
-		}
-	}
 #endif
 
-	FontGlyph fgl;
-	if (!_ensure_glyph(fd, size, index, fgl, viewport_oversampling ? 64 * oversampling_factor : 0)) {
-		return; // Invalid or non-graphical glyph, do not display errors, nothing to draw.
-	}
+		FontGlyph fgl;
+		if (!_ensure_glyph(fd, size, index, fgl, viewport_oversampling ? 64 * oversampling_factor : 0)) {
+			continue; // Invalid or non-graphical glyph, do not display errors, nothing to draw.
+		}
 
-	if (fgl.found) {
+		if (!fgl.found) {
+			continue;
+		}
 		ERR_FAIL_COND(fgl.texture_idx < -1 || fgl.texture_idx >= ffsd->textures.size());
 
-		if (fgl.texture_idx != -1) {
-			Color modulate = p_color;
+		if (fgl.texture_idx == -1) {
+			continue;
+		}
+		Color modulate = p_color;
 #ifdef MODULE_FREETYPE_ENABLED
-			if (!fd->modulate_color_glyphs && ffsd->face && ffsd->textures[fgl.texture_idx].image.is_valid() && (ffsd->textures[fgl.texture_idx].image->get_format() == Image::FORMAT_RGBA8) && !lcd_aa && !fd->msdf) {
-				modulate.r = modulate.g = modulate.b = 1.0;
-			}
+		if (!fd->modulate_color_glyphs && ffsd->face && ffsd->textures[fgl.texture_idx].image.is_valid() && (ffsd->textures[fgl.texture_idx].image->get_format() == Image::FORMAT_RGBA8) && !lcd_aa && !fd->msdf) {
+			modulate.r = modulate.g = modulate.b = 1.0;
+		}
 #endif
-			if (RenderingServer::get_singleton() != nullptr) {
-				if (ffsd->textures[fgl.texture_idx].dirty) {
-					ShelfPackTexture &tex = ffsd->textures.write[fgl.texture_idx];
-					Ref<Image> img = tex.image;
-					if (fgl.from_svg) {
-						// Same as the "fix alpha border" process option when importing SVGs
-						img->fix_alpha_edges();
-					}
-					if (fd->mipmaps && !img->has_mipmaps()) {
-						img = tex.image->duplicate();
-						img->generate_mipmaps();
-					}
-					if (tex.texture.is_null()) {
-						tex.texture = ImageTexture::create_from_image(img);
-					} else {
-						tex.texture->update(img);
+		if (RenderingServer::get_singleton() != nullptr) {
+			if (ffsd->textures[fgl.texture_idx].dirty) {
+				_font_upload_dirty_texture(fd, ffsd->textures.write[fgl.texture_idx]);
+			}
+			RID texture = ffsd->textures[fgl.texture_idx].texture->get_rid();
+			if (fd->msdf) {
+				flush_batch(); // Keep draw order.
+				Point2 cpos = glyph_pos;
+				cpos += fgl.rect.position * (double)p_size / (double)fd->msdf_source_size;
+				Size2 csize = fgl.rect.size * (double)p_size / (double)fd->msdf_source_size;
+				RenderingServer::get_singleton()->canvas_item_add_msdf_texture_rect_region(p_canvas, Rect2(cpos, csize), texture, fgl.uv_rect, modulate, 0, fd->msdf_range, (double)p_size / (double)fd->msdf_source_size);
+			} else {
+				Point2 cpos = glyph_pos;
+				double scale = _font_get_scale(p_font_rid, p_size) / oversampling_factor;
+				if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE * 64)) {
+					cpos.x = cpos.x + 0.125;
+				} else if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE * 64)) {
+					cpos.x = cpos.x + 0.25;
+				}
+				if (scale == 1.0) {
+					cpos.y = Math::floor(cpos.y);
+					cpos.x = Math::floor(cpos.x);
+				}
+				Vector2 gpos = fgl.rect.position;
+				Size2 csize = fgl.rect.size;
+				if (fd->fixed_size > 0 && fd->fixed_size_scale_mode != FIXED_SIZE_SCALE_DISABLE) {
+					if (size.x != p_size * 64) {
+						if (fd->fixed_size_scale_mode == FIXED_SIZE_SCALE_ENABLED) {
+							double gl_scale = (double)p_size / (double)fd->fixed_size;
+							gpos *= gl_scale;
+							csize *= gl_scale;
+						} else {
+							double gl_scale = Math::round((double)p_size / (double)fd->fixed_size);
+							gpos *= gl_scale;
+							csize *= gl_scale;
+						}
 					}
-					tex.dirty = false;
+				} else {
+					gpos /= oversampling_factor;
+					csize /= oversampling_factor;
 				}
-				RID texture = ffsd->textures[fgl.texture_idx].texture->get_rid();
-				if (fd->msdf) {
-					Point2 cpos = p_pos;
-					cpos += fgl.rect.position * (double)p_size / (double)fd->msdf_source_size;
-					Size2 csize = fgl.rect.size * (double)p_size / (double)fd->msdf_source_size;
-					RenderingServer::get_singleton()->canvas_item_add_msdf_texture_rect_region(p_canvas, Rect2(cpos, csize), texture, fgl.uv_rect, modulate, 0, fd->msdf_range, (double)p_size / (double)fd->msdf_source_size);
+				cpos += gpos;
+				if (lcd_aa) {
+					flush_batch(); // Keep draw order.
+					RenderingServer::get_singleton()->canvas_item_add_lcd_texture_rect_region(p_canvas, Rect2(cpos, csize), texture, fgl.uv_rect, modulate);
 				} else {
-					Point2 cpos = p_pos;
-					double scale = _font_get_scale(p_font_rid, p_size) / oversampling_factor;
-					if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE * 64)) {
-						cpos.x = cpos.x + 0.125;
-					} else if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE * 64)) {
-						cpos.x = cpos.x + 0.25;
-					}
-					if (scale == 1.0) {
-						cpos.y = Math::floor(cpos.y);
-						cpos.x = Math::floor(cpos.x);
-					}
-					Vector2 gpos = fgl.rect.position;
-					Size2 csize = fgl.rect.size;
-					if (fd->fixed_size > 0 && fd->fixed_size_scale_mode != FIXED_SIZE_SCALE_DISABLE) {
-						if (size.x != p_size * 64) {
-							if (fd->fixed_size_scale_mode == FIXED_SIZE_SCALE_ENABLED) {
-								double gl_scale = (double)p_size / (double)fd->fixed_size;
-								gpos *= gl_scale;
-								csize *= gl_scale;
-							} else {
-								double gl_scale = Math::round((double)p_size / (double)fd->fixed_size);
-								gpos *= gl_scale;
-								csize *= gl_scale;
-							}
-						}
-					} else {
-						gpos /= oversampling_factor;
-						csize /= oversampling_factor;
-					}
-					cpos += gpos;
-					if (lcd_aa) {
-						RenderingServer::get_singleton()->canvas_item_add_lcd_texture_rect_region(p_canvas, Rect2(cpos, csize), texture, fgl.uv_rect, modulate);
-					} else {
-						RenderingServer::get_singleton()->canvas_item_add_texture_rect_region(p_canvas, Rect2(cpos, csize), texture, fgl.uv_rect, modulate, false, false);
+					if (texture != batch_texture || modulate != batch_modulate) {
+						flush_batch();
+						batch_texture = texture;
+						batch_modulate = modulate;
 					}
+					batch_rects.push_back(Rect2(cpos, csize));
+					batch_src_rects.push_back(fgl.uv_rect);
 				}
 			}
 		}
 	}
+	flush_batch();
 }
 
 void TextServerAdvanced::_font_draw_glyph_outline(const RID &p_font_rid, const RID &p_canvas, int64_t p_size, int64_t p_outline_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color, float p_oversampling) const {
@@ -4155,18 +4200,7 @@ void TextServerAdvanced::_font_draw_glyph_outline(const RID &p_font_rid, const R
 #endif
 			if (RenderingServer::get_singleton() != nullptr) {
 				if (ffsd->textures[fgl.texture_idx].dirty) {
-					ShelfPackTexture &tex = ffsd->textures.write[fgl.texture_idx];
-					Ref<Image> img = tex.image;
-					if (fd->mipmaps && !img->has_mipmaps()) {
-						img = tex.image->duplicate();
-						img->generate_mipmaps();
-					}
-					if (tex.texture.is_null()) {
-						tex.texture = ImageTexture::create_from_image(img);
-					} else {
-						tex.texture->update(img);
-					}
-					tex.dirty = false;
+					_font_upload_dirty_texture(fd, ffsd->textures.write[fgl.texture_idx]);
 				}
 				RID texture = ffsd->textures[fgl.texture_idx].texture->get_rid();
 				if (fd->msdf) {
@@ -6729,6 +6763,36 @@ UBreakIterator *TextServerAdvanced::_create_line_break_iterator_for_locale(const
 	return ubrk_clone(bi, r_err);
 }
 
+bool TextServerAdvanced::_shape_run_cache_lookup(const ShapeRunKey &p_key, ShapeRunCacheEntry &r_entry) {
+	MutexLock lock(shape_run_cache_mutex);
+	List<Pair<ShapeRunKey, ShapeRunCacheEntry>>::Element **E = shape_run_cache_map.getptr(p_key);
+	if (!E) {
+		return false;
+	}
+	shape_run_cache_list.move_to_front(*E);
+	r_entry = (*E)->get().second;
+	return true;
+}
+
+void TextServerAdvanced::_shape_run_cache_insert(const ShapeRunKey &p_key, const ShapeRunCacheEntry &p_entry) {
+	MutexLock lock(shape_run_cache_mutex);
+	if (shape_run_cache_map.has(p_key)) {
+		return; // Another thread shaped the same run first.
+	}
+	shape_run_cache_list.push_front(Pair<ShapeRunKey, ShapeRunCacheEntry>(p_key, p_entry));
+	shape_run_cache_map.insert(p_key, shape_run_cache_list.front());
+	while (shape_run_cache_map.size() > shape_run_cache_capacity) {
+		shape_run_cache_map.erase(shape_run_cache_list.back()->get().first);
+		shape_run_cache_list.pop_back();
+	}
+}
+
+void TextServerAdvanced::_shape_run_cache_clear() {
+	MutexLock lock(shape_run_cache_mutex);
+	shape_run_cache_map.clear();
+	shape_run_cache_list.clear();
+}
+
 void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_start, int64_t p_end, hb_script_t p_script, hb_direction_t p_direction, FontPriorityList &p_fonts, int64_t p_span, int64_t p_fb_index, int64_t p_prev_start, int64_t p_prev_end, RID p_prev_font) {
 	RID f;
 	int fs = p_sd->spans[p_span].font_size;
@@ -6860,8 +6924,6 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 	bool subpos = (scale != 1.0) || (_font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_ONE_HALF) || (_font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_ONE_QUARTER) || (_font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_AUTO && fs <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE);
 	ERR_FAIL_NULL(hb_font);
 
-	hb_buffer_clear_contents(p_sd->hb_buffer);
-	hb_buffer_set_direction(p_sd->hb_buffer, p_direction);
 	int flags = (p_start == 0 ? HB_BUFFER_FLAG_BOT : 0) | (p_end == p_sd->text.length() ? HB_BUFFER_FLAG_EOT : 0);
 	if (p_sd->preserve_control) {
 		flags |= HB_BUFFER_FLAG_PRESERVE_DEFAULT_IGNORABLES;
@@ -6871,28 +6933,64 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 #if HB_VERSION_ATLEAST(5, 1, 0)
 	flags |= HB_BUFFER_FLAG_PRODUCE_SAFE_TO_INSERT_TATWEEL;
 #endif
-	hb_buffer_set_flags(p_sd->hb_buffer, (hb_buffer_flags_t)flags);
-	hb_buffer_set_script(p_sd->hb_buffer, (p_script == HB_TAG('Z', 's', 'y', 'e')) ? HB_SCRIPT_COMMON : p_script);
-
-	if (p_sd->spans[p_span].language.is_empty()) {
-		hb_language_t lang = hb_language_from_string(TranslationServer::get_singleton()->get_tool_locale().ascii().get_data(), -1);
-		hb_buffer_set_language(p_sd->hb_buffer, lang);
-	} else {
-		hb_language_t lang = hb_language_from_string(p_sd->spans[p_span].language.ascii().get_data(), -1);
-		hb_buffer_set_language(p_sd->hb_buffer, lang);
-	}
-
-	hb_buffer_add_utf32(p_sd->hb_buffer, (const uint32_t *)p_sd->text.ptr(), p_sd->text.length(), p_start, p_end - p_start);
+	String language = p_sd->spans[p_span].language.is_empty() ? TranslationServer::get_singleton()->get_tool_locale() : p_sd->spans[p_span].language;
 
 	Vector<hb_feature_t> ftrs;
 	_add_features(_font_get_opentype_feature_overrides(f), ftrs);
 	_add_features(p_sd->spans[p_span].features, ftrs);
 
-	hb_shape(hb_font, p_sd->hb_buffer, ftrs.is_empty() ? nullptr : &ftrs[0], ftrs.size());
-
+	ShapeRunKey key;
+	int64_t ctx_start = MAX((int64_t)0, p_start - shape_run_context_size);
+	int64_t ctx_end = MIN((int64_t)p_sd->text.length(), p_end + shape_run_context_size);
+	key.text = p_sd->text.substr(ctx_start, ctx_end - ctx_start);
+	key.run_start = p_start - ctx_start;
+	key.run_length = p_end - p_start;
+	key.font = f;
+	key.font_size = fs;
+	key.script = (uint32_t)p_script;
+	key.direction = (uint32_t)p_direction;
+	key.buffer_flags = flags;
+	key.language = language;
+	key.features = ftrs;
+
+	ShapeRunCacheEntry run_entry;
 	unsigned int glyph_count = 0;
-	hb_glyph_info_t *glyph_info = hb_buffer_get_glyph_infos(p_sd->hb_buffer, &glyph_count);
-	hb_glyph_position_t *glyph_pos = hb_buffer_get_glyph_positions(p_sd->hb_buffer, &glyph_count);
+	const hb_glyph_info_t *glyph_info = nullptr;
+	const hb_glyph_position_t *glyph_pos = nullptr;
+	if (_shape_run_cache_lookup(key, run_entry)) {
+		glyph_count = run_entry.glyph_info.size();
+		hb_glyph_info_t *info_w = run_entry.glyph_info.ptrw();
+		for (unsigned int i = 0; i < glyph_count; i++) {
+			info_w[i].cluster += p_start;
+		}
+		glyph_info = run_entry.glyph_info.ptr();
+		glyph_pos = run_entry.glyph_pos.ptr();
+	} else {
+		hb_buffer_clear_contents(p_sd->hb_buffer);
+		hb_buffer_set_direction(p_sd->hb_buffer, p_direction);
+		hb_buffer_set_flags(p_sd->hb_buffer, (hb_buffer_flags_t)flags);
+		hb_buffer_set_script(p_sd->hb_buffer, (p_script == HB_TAG('Z', 's', 'y', 'e')) ? HB_SCRIPT_COMMON : p_script);
+		hb_buffer_set_language(p_sd->hb_buffer, hb_language_from_string(language.ascii().get_data(), -1));
+
+		hb_buffer_add_utf32(p_sd->hb_buffer, (const uint32_t *)p_sd->text.ptr(), p_sd->text.length(), p_start, p_end - p_start);
+
+		hb_shape(hb_font, p_sd->hb_buffer, ftrs.is_empty() ? nullptr : &ftrs[0], ftrs.size());
+
+		glyph_info = hb_buffer_get_glyph_infos(p_sd->hb_buffer, &glyph_count);
+		glyph_pos = hb_buffer_get_glyph_positions(p_sd->hb_buffer, &glyph_count);
+
+		run_entry.glyph_info.resize(glyph_count);
+		run_entry.glyph_pos.resize(glyph_count);
+		if (glyph_count > 0) {
+			hb_glyph_info_t *info_w = run_entry.glyph_info.ptrw();
+			memcpy(info_w, glyph_info, glyph_count * sizeof(hb_glyph_info_t));
+			for (unsigned int i = 0; i < glyph_count; i++) {
+				info_w[i].cluster -= p_start;
+			}
+			memcpy(run_entry.glyph_pos.ptrw(), glyph_pos, glyph_count * sizeof(hb_glyph_position_t));
+		}
+		_shape_run_cache_insert(key, run_entry);
+	}
 
 	int mod = 0;
 	if (fd->antialiasing == FONT_ANTIALIASING_LCD) {
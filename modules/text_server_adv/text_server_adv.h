@@ -49,6 +49,7 @@
 #include <godot_cpp/variant/array.hpp>
 #include <godot_cpp/variant/dictionary.hpp>
 #include <godot_cpp/variant/packed_int32_array.hpp>
+#include <godot_cpp/variant/packed_int64_array.hpp>
 #include <godot_cpp/variant/packed_string_array.hpp>
 #include <godot_cpp/variant/packed_vector2_array.hpp>
 #include <godot_cpp/variant/rect2.hpp>
@@ -224,6 +225,7 @@ class TextServerAdvanced : public TextServerExtension {
 		Ref<Image> image;
 		Ref<ImageTexture> texture;
 		bool dirty = true;
+		bool from_svg = false; // Page contains glyphs rendered from an SVG outline.
 
 		List<Shelf> shelves;
 
@@ -387,6 +389,7 @@ class TextServerAdvanced : public TextServerExtension {
 #ifdef MODULE_FREETYPE_ENABLED
 	_FORCE_INLINE_ FontGlyph rasterize_bitmap(FontForSizeAdvanced *p_data, int p_rect_margin, FT_Bitmap p_bitmap, int p_yofs, int p_xofs, const Vector2 &p_advance, bool p_bgra) const;
 #endif
+	_FORCE_INLINE_ void _font_upload_dirty_texture(const FontAdvanced *p_font_data, ShelfPackTexture &p_tex) const;
 	bool _ensure_glyph(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_glyph, FontGlyph &r_glyph, uint32_t p_oversampling = 0) const;
 	bool _ensure_cache_for_size(FontAdvanced *p_font_data, const Vector2i &p_size, FontForSizeAdvanced *&r_cache_for_size, bool p_silent = false, uint32_t p_oversampling = 0) const;
 	_FORCE_INLINE_ bool _font_validate(const RID &p_font_rid) const;
@@ -768,6 +771,70 @@ class TextServerAdvanced : public TextServerExtension {
 
 	_FORCE_INLINE_ void _add_features(const Dictionary &p_source, Vector<hb_feature_t> &r_ftrs);
 
+	// Run-level shaping cache. Stores raw HarfBuzz output keyed on the run text and
+	// everything else that affects shaping, so identical runs re-shaped across frames
+	// (repeated labels, list rows, chat lines) skip hb_shape() and only redo the
+	// buffer specific glyph post-processing.
+	struct ShapeRunKey {
+		String text; // Run text with up to `shape_run_context_size` context characters on each side.
+		uint32_t run_start = 0; // Offset of the run inside `text`.
+		uint32_t run_length = 0;
+		RID font;
+		int32_t font_size = 0;
+		uint32_t script = 0;
+		uint32_t direction = 0;
+		uint32_t buffer_flags = 0;
+		String language;
+		Vector<hb_feature_t> features;
+
+		bool operator==(const ShapeRunKey &p_b) const {
+			if (run_start != p_b.run_start || run_length != p_b.run_length || font != p_b.font || font_size != p_b.font_size || script != p_b.script || direction != p_b.direction || buffer_flags != p_b.buffer_flags || features.size() != p_b.features.size()) {
+				return false;
+			}
+			if (!features.is_empty() && memcmp(features.ptr(), p_b.features.ptr(), features.size() * sizeof(hb_feature_t)) != 0) {
+				return false;
+			}
+			return text == p_b.text && language == p_b.language;
+		}
+	};
+
+	struct ShapeRunKeyHasher {
+		_FORCE_INLINE_ static uint32_t hash(const ShapeRunKey &p_a) {
+			uint32_t hash = p_a.text.hash();
+			hash = hash_murmur3_one_32(p_a.run_start, hash);
+			hash = hash_murmur3_one_32(p_a.run_length, hash);
+			hash = hash_murmur3_one_64(p_a.font.get_id(), hash);
+			hash = hash_murmur3_one_32(p_a.font_size, hash);
+			hash = hash_murmur3_one_32(p_a.script, hash);
+			hash = hash_murmur3_one_32(p_a.direction, hash);
+			hash = hash_murmur3_one_32(p_a.buffer_flags, hash);
+			hash = hash_murmur3_one_32(p_a.language.hash(), hash);
+			if (!p_a.features.is_empty()) {
+				hash = hash_murmur3_buffer(p_a.features.ptr(), p_a.features.size() * sizeof(hb_feature_t), hash);
+			}
+			return hash_fmix32(hash);
+		}
+	};
+
+	struct ShapeRunCacheEntry {
+		// Glyph clusters are stored relative to the run start, so the same run can be
+		// reused at a different offset in another string.
+		Vector<hb_glyph_info_t> glyph_info;
+		Vector<hb_glyph_position_t> glyph_pos;
+	};
+
+	static constexpr int64_t shape_run_context_size = 5; // Maximum number of context characters HarfBuzz reads on each side of the run.
+	static constexpr uint32_t shape_run_cache_capacity = 512;
+
+	// LRU list of cached runs, most recently used first, with a map for lookup.
+	Mutex shape_run_cache_mutex;
+	List<Pair<ShapeRunKey, ShapeRunCacheEntry>> shape_run_cache_list;
+	HashMap<ShapeRunKey, List<Pair<ShapeRunKey, ShapeRunCacheEntry>>::Element *, ShapeRunKeyHasher> shape_run_cache_map;
+
+	bool _shape_run_cache_lookup(const ShapeRunKey &p_key, ShapeRunCacheEntry &r_entry);
+	void _shape_run_cache_insert(const ShapeRunKey &p_key, const ShapeRunCacheEntry &p_entry);
+	void _shape_run_cache_clear();
+
 	Mutex ft_mutex;
 
 	// HarfBuzz bitmap font interface.
@@ -995,6 +1062,7 @@ public:
 	MODBIND3(font_render_glyph, const RID &, const Vector2i &, int64_t);
 
 	MODBIND7C(font_draw_glyph, const RID &, const RID &, int64_t, const Vector2 &, int64_t, const Color &, float);
+	MODBIND7C(font_draw_glyphs, const RID &, const RID &, int64_t, const PackedVector2Array &, const PackedInt64Array &, const Color &, float);
 	MODBIND8C(font_draw_glyph_outline, const RID &, const RID &, int64_t, int64_t, const Vector2 &, int64_t, const Color &, float);
 
 	MODBIND2RC(bool, font_is_language_supported, const RID &, const String &);
@@ -73,6 +73,30 @@ public:
 		return OK;
 	}
 
+	// Reads the next packet without copying, returning a pointer directly into
+	// the ring. Returns nullptr when the payload wraps around the ring end, in
+	// which case the caller must fall back to read_packet(). The pointer is
+	// only valid until more payload is written to the buffer.
+	const uint8_t *read_packet_ptr(T *r_info, int &r_read) {
+		ERR_FAIL_COND_V(_queued < 1, nullptr);
+		const _Packet &p = _packets[_read_pos];
+		ERR_FAIL_COND_V(_payload.data_left() < (int)p.size, nullptr);
+		if (_payload.contiguous_data_left() < (int)p.size) {
+			return nullptr;
+		}
+		_read_pos += 1;
+		if (_read_pos >= _packets.size()) {
+			_read_pos = 0;
+		}
+		_queued -= 1;
+
+		r_read = p.size;
+		memcpy(r_info, &p.info, sizeof(T));
+		const uint8_t *ptr = _payload.read_ptr();
+		_payload.advance_read(p.size);
+		return ptr;
+	}
+
 	Error read_packet(uint8_t *r_payload, int p_bytes, T *r_info, int &r_read) {
 		ERR_FAIL_COND_V(_queued < 1, ERR_UNAVAILABLE);
 		_Packet p = _packets[_read_pos];
@@ -299,6 +299,7 @@ Error WSLPeer::_do_server_handshake() {
 			wslay_event_config_set_max_recv_msg_length(wsl_ctx, inbound_buffer_size);
 			in_buffer.resize(nearest_shift((uint32_t)inbound_buffer_size), max_queued_packets);
 			packet_buffer.resize(inbound_buffer_size);
+			out_buffer.resize(nearest_shift((uint32_t)(outbound_buffer_size > 0 ? outbound_buffer_size : (int)DEFAULT_BUFFER_SIZE)));
 			ready_state = STATE_OPEN;
 		}
 	}
@@ -408,6 +409,7 @@ void WSLPeer::_do_client_handshake() {
 				wslay_event_config_set_max_recv_msg_length(wsl_ctx, inbound_buffer_size);
 				in_buffer.resize(nearest_shift((uint32_t)inbound_buffer_size), max_queued_packets);
 				packet_buffer.resize(inbound_buffer_size);
+				out_buffer.resize(nearest_shift((uint32_t)(outbound_buffer_size > 0 ? outbound_buffer_size : (int)DEFAULT_BUFFER_SIZE)));
 				ready_state = STATE_OPEN;
 				break;
 			}
@@ -613,22 +615,47 @@ void WSLPeer::_wsl_frame_recv_chunk_callback(wslay_event_context_ptr ctx, const
 
 ssize_t WSLPeer::_wsl_send_callback(wslay_event_context_ptr ctx, const uint8_t *data, size_t len, int flags, void *user_data) {
 	WSLPeer *peer = (WSLPeer *)user_data;
-	Ref<StreamPeer> conn = peer->connection;
-	if (conn.is_null()) {
+	if (peer->connection.is_null()) {
 		wslay_event_set_error(ctx, WSLAY_ERR_CALLBACK_FAILURE);
 		return -1;
 	}
-	int sent = 0;
-	Error err = conn->put_partial_data(data, len, sent);
-	if (err != OK) {
-		wslay_event_set_error(ctx, WSLAY_ERR_CALLBACK_FAILURE);
-		return -1;
+	// Coalesce into the outbound ring instead of writing each message to the
+	// stream; the ring is flushed in bulk once per poll.
+	int wrote = peer->out_buffer.write(data, len);
+	if (wrote == 0) {
+		// Ring is full, try to make room by flushing to the network now.
+		if (peer->_flush_output() != OK) {
+			wslay_event_set_error(ctx, WSLAY_ERR_CALLBACK_FAILURE);
+			return -1;
+		}
+		wrote = peer->out_buffer.write(data, len);
+		if (wrote == 0) {
+			wslay_event_set_error(ctx, WSLAY_ERR_WOULDBLOCK);
+			return -1;
+		}
 	}
-	if (sent == 0) {
-		wslay_event_set_error(ctx, WSLAY_ERR_WOULDBLOCK);
-		return -1;
+	return wrote;
+}
+
+Error WSLPeer::_flush_output() {
+	if (connection.is_null()) {
+		return FAILED;
 	}
-	return sent;
+	while (out_buffer.data_left() > 0) {
+		// Write the pending data directly out of the ring, in at most two
+		// contiguous chunks when it wraps around the ring end.
+		int to_send = out_buffer.contiguous_data_left();
+		int sent = 0;
+		Error err = connection->put_partial_data(out_buffer.read_ptr(), to_send, sent);
+		if (err != OK) {
+			return err;
+		}
+		out_buffer.advance_read(sent);
+		if (sent < to_send) {
+			break; // Stream is saturated, keep the rest for the next poll.
+		}
+	}
+	return OK;
 }
 
 int WSLPeer::_wsl_genmask_callback(wslay_event_context_ptr ctx, uint8_t *buf, size_t len, void *user_data) {
@@ -743,6 +770,12 @@ void WSLPeer::poll() {
 			close(-1);
 			return;
 		}
+		if (_flush_output() != OK) {
+			wslay_event_context_free(wsl_ctx);
+			wsl_ctx = nullptr;
+			close(-1);
+			return;
+		}
 		if (wslay_event_get_close_sent(wsl_ctx)) {
 			if (wslay_event_get_close_received(wsl_ctx)) {
 				// Clean close.
@@ -781,7 +814,7 @@ void WSLPeer::poll() {
 Error WSLPeer::_send(const uint8_t *p_buffer, int p_buffer_size, wslay_opcode p_opcode) {
 	ERR_FAIL_COND_V(ready_state != STATE_OPEN, FAILED);
 	ERR_FAIL_COND_V(wslay_event_get_queued_msg_count(wsl_ctx) >= (uint32_t)max_queued_packets, ERR_OUT_OF_MEMORY);
-	ERR_FAIL_COND_V(outbound_buffer_size > 0 && (wslay_event_get_queued_msg_length(wsl_ctx) + p_buffer_size > (uint32_t)outbound_buffer_size), ERR_OUT_OF_MEMORY);
+	ERR_FAIL_COND_V(outbound_buffer_size > 0 && (wslay_event_get_queued_msg_length(wsl_ctx) + out_buffer.data_left() + p_buffer_size > (uint32_t)outbound_buffer_size), ERR_OUT_OF_MEMORY);
 
 	struct wslay_event_msg msg;
 	msg.opcode = p_opcode;
@@ -815,6 +848,16 @@ Error WSLPeer::get_packet(const uint8_t **r_buffer, int &r_buffer_size) {
 	}
 
 	int read = 0;
+	const uint8_t *rp = in_buffer.read_packet_ptr(&was_string, read);
+	if (rp) {
+		// Common case, the payload is contiguous in the ring and can be
+		// returned without copying (the view is valid until the next poll).
+		*r_buffer = rp;
+		r_buffer_size = read;
+		return OK;
+	}
+
+	// The payload wraps around the ring end, copy it out through the scratch buffer.
 	uint8_t *rw = packet_buffer.ptrw();
 	in_buffer.read_packet(rw, packet_buffer.size(), &was_string, read);
 
@@ -837,7 +880,7 @@ int WSLPeer::get_current_outbound_buffered_amount() const {
 		return 0;
 	}
 
-	return wslay_event_get_queued_msg_length(wsl_ctx);
+	return wslay_event_get_queued_msg_length(wsl_ctx) + out_buffer.data_left();
 }
 
 void WSLPeer::close(int p_code, const String &p_reason) {
@@ -850,6 +893,7 @@ void WSLPeer::close(int p_code, const String &p_reason) {
 		CharString cs = p_reason.utf8();
 		wslay_event_queue_close(wsl_ctx, p_code, (uint8_t *)cs.ptr(), cs.length());
 		wslay_event_send(wsl_ctx);
+		_flush_output();
 		ready_state = STATE_CLOSING;
 	} else if (ready_state == STATE_CONNECTING || ready_state == STATE_CLOSED) {
 		ready_state = STATE_CLOSED;
@@ -864,6 +908,7 @@ void WSLPeer::close(int p_code, const String &p_reason) {
 		heartbeat_waiting = false;
 		in_buffer.clear();
 		packet_buffer.resize(0);
+		out_buffer.resize(0);
 		pending_message.clear();
 	}
 }
@@ -917,6 +962,7 @@ void WSLPeer::_clear() {
 	was_string = 0;
 	in_buffer.clear();
 	packet_buffer.clear();
+	out_buffer.resize(0);
 
 	// Close code info.
 	close_code = -1;
@@ -120,8 +120,12 @@ private:
 	Vector<uint8_t> packet_buffer;
 	// Our packet info is just a boolean (is_string), using uint8_t for it.
 	PacketBuffer<uint8_t> in_buffer;
+	// Outbound messages are coalesced here and flushed to the stream once per
+	// poll, so many small packets share a single (possibly TLS) write.
+	RingBuffer<uint8_t> out_buffer;
 
 	Error _send(const uint8_t *p_buffer, int p_buffer_size, wslay_opcode p_opcode);
+	Error _flush_output();
 
 	Error _do_server_handshake();
 	bool _parse_client_request();
@@ -297,11 +297,10 @@ void TileMapLayer::_rendering_update(bool p_force_cleanup) {
 			if (has_a_tile) {
 				// Process the quadrant.
 
-				// First, clear the quadrant's canvas items.
-				for (RID &ci : rendering_quadrant->canvas_items) {
-					rs->free_rid(ci);
-				}
-				rendering_quadrant->canvas_items.clear();
+				// Reuse the quadrant's canvas items from the previous rebuild where
+				// possible; quadrants edited every frame would otherwise churn RID
+				// allocations and reparenting work in the rendering server.
+				List<RID>::Element *reusable_canvas_item = rendering_quadrant->canvas_items.front();
 
 				// Sort the quadrant cells.
 				if (is_y_sort_enabled() && x_draw_order_reversed) {
@@ -338,15 +337,21 @@ void TileMapLayer::_rendering_update(bool p_force_cleanup) {
 
 					// Check if the material or the z_index changed.
 					if (prev_ci == RID() || prev_material != mat || prev_z_index != tile_z_index) {
-						// If so, create a new CanvasItem.
-						ci = rs->canvas_item_create();
-						if (needs_set_not_interpolated) {
-							rs->canvas_item_set_interpolated(ci, false);
-						}
-						if (mat.is_valid()) {
-							rs->canvas_item_set_material(ci, mat->get_rid());
+						// If so, start a new CanvasItem, recycling one from the previous rebuild if available.
+						if (reusable_canvas_item) {
+							ci = reusable_canvas_item->get();
+							reusable_canvas_item = reusable_canvas_item->next();
+							rs->canvas_item_clear(ci);
+							rs->canvas_item_set_interpolated(ci, !needs_set_not_interpolated);
+						} else {
+							ci = rs->canvas_item_create();
+							if (needs_set_not_interpolated) {
+								rs->canvas_item_set_interpolated(ci, false);
+							}
+							rs->canvas_item_set_parent(ci, get_canvas_item());
+							rendering_quadrant->canvas_items.push_back(ci);
 						}
-						rs->canvas_item_set_parent(ci, get_canvas_item());
+						rs->canvas_item_set_material(ci, mat.is_valid() ? mat->get_rid() : RID());
 						rs->canvas_item_set_use_parent_material(ci, mat.is_null());
 
 						Transform2D xform(0, rendering_quadrant->canvas_items_position);
@@ -360,8 +365,6 @@ void TileMapLayer::_rendering_update(bool p_force_cleanup) {
 						rs->canvas_item_set_default_texture_filter(ci, RS::CanvasItemTextureFilter(get_texture_filter_in_tree()));
 						rs->canvas_item_set_default_texture_repeat(ci, RS::CanvasItemTextureRepeat(get_texture_repeat_in_tree()));
 
-						rendering_quadrant->canvas_items.push_back(ci);
-
 						prev_ci = ci;
 						prev_material = mat;
 						prev_z_index = tile_z_index;
@@ -384,6 +387,14 @@ void TileMapLayer::_rendering_update(bool p_force_cleanup) {
 					draw_tile(ci, local_tile_pos - rendering_quadrant->canvas_items_position, tile_set, cell_data.cell.source_id, cell_data.cell.get_atlas_coords(), cell_data.cell.alternative_tile, -1, tile_data, random_animation_offset);
 				}
 
+				// Free the canvas items that were not reused.
+				while (reusable_canvas_item) {
+					List<RID>::Element *next_canvas_item = reusable_canvas_item->next();
+					rs->free_rid(reusable_canvas_item->get());
+					rendering_quadrant->canvas_items.erase(reusable_canvas_item);
+					reusable_canvas_item = next_canvas_item;
+				}
+
 				// Reset physics interpolation for any recreated canvas items.
 				if (is_physics_interpolated_and_enabled() && is_visible_in_tree()) {
 					for (const RID &ci : rendering_quadrant->canvas_items) {
@@ -821,15 +832,10 @@ void TileMapLayer::_physics_update(bool p_force_cleanup) {
 			if (has_a_tile) {
 				// Process the quadrant.
 
-				// First, clear the quadrant bodies.
-				for (KeyValue<PhysicsQuadrant::PhysicsBodyKey, PhysicsQuadrant::PhysicsBodyValue> &kvbody : physics_quadrant->bodies) {
-					RID &body = kvbody.value.body;
-					if (body.is_valid()) {
-						bodies_coords.erase(body);
-						ps->free_rid(body);
-						body = RID();
-					}
-				}
+				// Keep the previous bodies around so those whose key still exists
+				// after the rebuild can be reused instead of recreated; per-frame
+				// cell edits would otherwise churn body RIDs in the physics server.
+				HashMap<PhysicsQuadrant::PhysicsBodyKey, PhysicsQuadrant::PhysicsBodyValue, PhysicsQuadrant::PhysicsBodyKeyHasher> previous_bodies = physics_quadrant->bodies;
 				physics_quadrant->bodies.clear();
 				physics_quadrant->shapes.clear();
 
@@ -879,7 +885,16 @@ void TileMapLayer::_physics_update(bool p_force_cleanup) {
 							physics_body_key.y_origin = map_to_local(cell_data.coords).y;
 
 							if (!physics_quadrant->bodies.has(physics_body_key)) {
-								RID body = ps->body_create();
+								RID body;
+								HashMap<PhysicsQuadrant::PhysicsBodyKey, PhysicsQuadrant::PhysicsBodyValue, PhysicsQuadrant::PhysicsBodyKeyHasher>::Iterator previous_body = previous_bodies.find(physics_body_key);
+								if (previous_body) {
+									// Reuse the body from the previous rebuild.
+									body = previous_body->value.body;
+									ps->body_clear_shapes(body);
+									previous_bodies.remove(previous_body);
+								} else {
+									body = ps->body_create();
+								}
 								physics_quadrant->bodies[physics_body_key] = {};
 								physics_quadrant->bodies[physics_body_key].body = body;
 								bodies_coords[body] = physics_quadrant->quadrant_coords;
@@ -943,6 +958,15 @@ void TileMapLayer::_physics_update(bool p_force_cleanup) {
 						body_shape_index++;
 					}
 				}
+
+				// Free the bodies whose key disappeared in the rebuild.
+				for (KeyValue<PhysicsQuadrant::PhysicsBodyKey, PhysicsQuadrant::PhysicsBodyValue> &kvbody : previous_bodies) {
+					RID &body = kvbody.value.body;
+					if (body.is_valid()) {
+						bodies_coords.erase(body);
+						ps->free_rid(body);
+					}
+				}
 			} else {
 				// Free the quadrant.
 				for (KeyValue<PhysicsQuadrant::PhysicsBodyKey, PhysicsQuadrant::PhysicsBodyValue> &kv : physics_quadrant->bodies) {
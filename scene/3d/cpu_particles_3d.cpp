@@ -32,6 +32,7 @@
 #include "cpu_particles_3d.compat.inc"
 
 #include "core/math/random_number_generator.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/3d/camera_3d.h"
 #include "scene/3d/gpu_particles_3d.h"
 #include "scene/main/viewport.h"
@@ -721,9 +722,6 @@ void CPUParticles3D::_particles_process(double p_delta) {
 	p_delta *= speed_scale;
 
 	int pcount = particles.size();
-	Particle *w = particles.ptrw();
-
-	Particle *parray = w;
 
 	double prev_time = time;
 	time += p_delta;
@@ -745,8 +743,61 @@ void CPUParticles3D::_particles_process(double p_delta) {
 
 	double system_phase = time / lifetime;
 
+	ParticleProcessContext context;
+	context.delta = p_delta;
+	context.prev_time = prev_time;
+	context.system_phase = system_phase;
+	context.emission_xform = emission_xform;
+	context.velocity_xform = velocity_xform;
+
+	bool should_be_active = false;
+
+	uint32_t chunk_count = (uint32_t(pcount) + PROCESS_CHUNK_SIZE - 1) / PROCESS_CHUNK_SIZE;
+	if (chunk_count > 1 && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+		// Particles are fully independent (restarts re-seed the generator from
+		// the particle's own seed), so the update can be sliced across the
+		// worker pool without changing the results.
+		LocalVector<bool> chunk_active;
+		chunk_active.resize(chunk_count);
+		context.chunk_active = chunk_active.ptr();
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CPUParticles3D::_particles_process_chunk, &context, chunk_count, -1, true, SNAME("CPUParticles3DProcess"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		for (uint32_t i = 0; i < chunk_count; i++) {
+			should_be_active = should_be_active || chunk_active[i];
+		}
+	} else {
+		should_be_active = _particles_process_range(0, pcount, context, rng.ptr());
+	}
+
+	if (!Math::is_equal_approx(time, 0.0) && active && !should_be_active) {
+		active = false;
+		emit_signal(SceneStringName(finished));
+	}
+}
+
+void CPUParticles3D::_particles_process_chunk(uint32_t p_chunk, ParticleProcessContext *p_context) {
+	uint32_t from = p_chunk * PROCESS_CHUNK_SIZE;
+	uint32_t to = MIN(from + PROCESS_CHUNK_SIZE, uint32_t(particles.size()));
+	// Worker tasks use their own generator instead of the shared member; every
+	// use is preceded by a set_seed() from the particle's seed, so the values
+	// match the single-threaded path.
+	Ref<RandomNumberGenerator> chunk_rng;
+	chunk_rng.instantiate();
+	p_context->chunk_active[p_chunk] = _particles_process_range(from, to, *p_context, chunk_rng.ptr());
+}
+
+bool CPUParticles3D::_particles_process_range(uint32_t p_from, uint32_t p_to, const ParticleProcessContext &p_context, RandomNumberGenerator *p_rng) {
+	int pcount = particles.size();
+	Particle *parray = particles.ptrw();
+
+	const double p_delta = p_context.delta;
+	const double prev_time = p_context.prev_time;
+	const double system_phase = p_context.system_phase;
+	const Transform3D &emission_xform = p_context.emission_xform;
+	const Basis &velocity_xform = p_context.velocity_xform;
+
 	bool should_be_active = false;
-	for (int i = 0; i < pcount; i++) {
+	for (uint32_t i = p_from; i < p_to; i++) {
 		Particle &p = parray[i];
 
 		if (!emitting && !p.active) {
@@ -829,26 +880,26 @@ void CPUParticles3D::_particles_process(double p_delta) {
 			}
 
 			p.seed = seed + uint32_t(1) + i + cycle;
-			rng->set_seed(p.seed);
-			p.angle_rand = rng->randf();
-			p.scale_rand = rng->randf();
-			p.hue_rot_rand = rng->randf();
-			p.anim_offset_rand = rng->randf();
+			p_rng->set_seed(p.seed);
+			p.angle_rand = p_rng->randf();
+			p.scale_rand = p_rng->randf();
+			p.hue_rot_rand = p_rng->randf();
+			p.anim_offset_rand = p_rng->randf();
 
 			if (color_initial_ramp.is_valid()) {
-				p.start_color_rand = color_initial_ramp->get_color_at_offset(rng->randf());
+				p.start_color_rand = color_initial_ramp->get_color_at_offset(p_rng->randf());
 			} else {
 				p.start_color_rand = Color(1, 1, 1, 1);
 			}
 
 			if (particle_flags[PARTICLE_FLAG_DISABLE_Z]) {
-				real_t angle1_rad = Math::atan2(direction.y, direction.x) + Math::deg_to_rad((rng->randf() * 2.0 - 1.0) * spread);
+				real_t angle1_rad = Math::atan2(direction.y, direction.x) + Math::deg_to_rad((p_rng->randf() * 2.0 - 1.0) * spread);
 				Vector3 rot = Vector3(Math::cos(angle1_rad), Math::sin(angle1_rad), 0.0);
-				p.velocity = rot * Math::lerp(parameters_min[PARAM_INITIAL_LINEAR_VELOCITY], parameters_max[PARAM_INITIAL_LINEAR_VELOCITY], rng->randf());
+				p.velocity = rot * Math::lerp(parameters_min[PARAM_INITIAL_LINEAR_VELOCITY], parameters_max[PARAM_INITIAL_LINEAR_VELOCITY], p_rng->randf());
 			} else {
 				//initiate velocity spread in 3D
-				real_t angle1_rad = Math::deg_to_rad((rng->randf() * (real_t)2.0 - (real_t)1.0) * spread);
-				real_t angle2_rad = Math::deg_to_rad((rng->randf() * (real_t)2.0 - (real_t)1.0) * ((real_t)1.0 - flatness) * spread);
+				real_t angle1_rad = Math::deg_to_rad((p_rng->randf() * (real_t)2.0 - (real_t)1.0) * spread);
+				real_t angle2_rad = Math::deg_to_rad((p_rng->randf() * (real_t)2.0 - (real_t)1.0) * ((real_t)1.0 - flatness) * spread);
 
 				Vector3 direction_xz = Vector3(Math::sin(angle1_rad), 0, Math::cos(angle1_rad));
 				Vector3 direction_yz = Vector3(0, Math::sin(angle2_rad), Math::cos(angle2_rad));
@@ -868,14 +919,14 @@ void CPUParticles3D::_particles_process(double p_delta) {
 				binormal.normalize();
 				Vector3 normal = binormal.cross(direction_nrm);
 				spread_direction = binormal * spread_direction.x + normal * spread_direction.y + direction_nrm * spread_direction.z;
-				p.velocity = spread_direction * Math::lerp(parameters_min[PARAM_INITIAL_LINEAR_VELOCITY], parameters_max[PARAM_INITIAL_LINEAR_VELOCITY], rng->randf());
+				p.velocity = spread_direction * Math::lerp(parameters_min[PARAM_INITIAL_LINEAR_VELOCITY], parameters_max[PARAM_INITIAL_LINEAR_VELOCITY], p_rng->randf());
 			}
 
 			real_t base_angle = tex_angle * Math::lerp(parameters_min[PARAM_ANGLE], parameters_max[PARAM_ANGLE], p.angle_rand);
 			p.custom[0] = Math::deg_to_rad(base_angle); //angle
 			p.custom[1] = 0.0; //phase
 			p.custom[2] = tex_anim_offset * Math::lerp(parameters_min[PARAM_ANIM_OFFSET], parameters_max[PARAM_ANIM_OFFSET], p.anim_offset_rand); //animation offset (0-1)
-			p.custom[3] = (1.0 - rng->randf() * lifetime_randomness);
+			p.custom[3] = (1.0 - p_rng->randf() * lifetime_randomness);
 			p.transform = Transform3D();
 			p.time = 0;
 			p.lifetime = lifetime * p.custom[3];
@@ -886,20 +937,20 @@ void CPUParticles3D::_particles_process(double p_delta) {
 					//do none
 				} break;
 				case EMISSION_SHAPE_SPHERE: {
-					real_t s = 2.0 * rng->randf() - 1.0;
-					real_t t = Math::TAU * rng->randf();
-					real_t x = rng->randf();
+					real_t s = 2.0 * p_rng->randf() - 1.0;
+					real_t t = Math::TAU * p_rng->randf();
+					real_t x = p_rng->randf();
 					real_t radius = emission_sphere_radius * Math::sqrt(1.0 - s * s);
 					p.transform.origin = Vector3(0, 0, 0).lerp(Vector3(radius * Math::cos(t), radius * Math::sin(t), emission_sphere_radius * s), x);
 				} break;
 				case EMISSION_SHAPE_SPHERE_SURFACE: {
-					real_t s = 2.0 * rng->randf() - 1.0;
-					real_t t = Math::TAU * rng->randf();
+					real_t s = 2.0 * p_rng->randf() - 1.0;
+					real_t t = Math::TAU * p_rng->randf();
 					real_t radius = emission_sphere_radius * Math::sqrt(1.0 - s * s);
 					p.transform.origin = Vector3(radius * Math::cos(t), radius * Math::sin(t), emission_sphere_radius * s);
 				} break;
 				case EMISSION_SHAPE_BOX: {
-					p.transform.origin = Vector3(rng->randf() * 2.0 - 1.0, rng->randf() * 2.0 - 1.0, rng->randf() * 2.0 - 1.0) * emission_box_extents;
+					p.transform.origin = Vector3(p_rng->randf() * 2.0 - 1.0, p_rng->randf() * 2.0 - 1.0, p_rng->randf() * 2.0 - 1.0) * emission_box_extents;
 				} break;
 				case EMISSION_SHAPE_POINTS:
 				case EMISSION_SHAPE_DIRECTED_POINTS: {
@@ -908,7 +959,7 @@ void CPUParticles3D::_particles_process(double p_delta) {
 						break;
 					}
 
-					int random_idx = Math::rand() % pc;
+					int random_idx = int(p_rng->randi() % uint32_t(pc));
 
 					p.transform.origin = emission_points.get(random_idx);
 
@@ -943,11 +994,11 @@ void CPUParticles3D::_particles_process(double p_delta) {
 				case EMISSION_SHAPE_RING: {
 					real_t radius_clamped = MAX(0.001, emission_ring_radius);
 					real_t top_radius = MAX(radius_clamped - Math::tan(Math::deg_to_rad(90.0 - emission_ring_cone_angle)) * emission_ring_height, 0.0);
-					real_t y_pos = rng->randf();
+					real_t y_pos = p_rng->randf();
 					real_t skew = MAX(MIN(radius_clamped, top_radius) / MAX(radius_clamped, top_radius), 0.5);
 					y_pos = radius_clamped < top_radius ? Math::pow(y_pos, skew) : 1.0 - Math::pow(y_pos, skew);
-					real_t ring_random_angle = rng->randf() * Math::TAU;
-					real_t ring_random_radius = Math::sqrt(rng->randf() * (radius_clamped * radius_clamped - emission_ring_inner_radius * emission_ring_inner_radius) + emission_ring_inner_radius * emission_ring_inner_radius);
+					real_t ring_random_angle = p_rng->randf() * Math::TAU;
+					real_t ring_random_radius = Math::sqrt(p_rng->randf() * (radius_clamped * radius_clamped - emission_ring_inner_radius * emission_ring_inner_radius) + emission_ring_inner_radius * emission_ring_inner_radius);
 					ring_random_radius = Math::lerp(ring_random_radius, ring_random_radius * (top_radius / radius_clamped), y_pos);
 					Vector3 axis = emission_ring_axis == Vector3(0.0, 0.0, 0.0) ? Vector3(0.0, 0.0, 1.0) : emission_ring_axis.normalized();
 					Vector3 ortho_axis;
@@ -1222,10 +1273,8 @@ void CPUParticles3D::_particles_process(double p_delta) {
 
 		should_be_active = true;
 	}
-	if (!Math::is_equal_approx(time, 0.0) && active && !should_be_active) {
-		active = false;
-		emit_signal(SceneStringName(finished));
-	}
+
+	return should_be_active;
 }
 
 void CPUParticles3D::_update_particle_data_buffer() {
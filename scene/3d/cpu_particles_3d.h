@@ -194,8 +194,26 @@ private:
 
 	Ref<RandomNumberGenerator> rng;
 
+	// Loop-invariant state shared by the particle update workers. Pointed-to
+	// storage lives on the stack of _particles_process, which waits for the
+	// group task before returning.
+	struct ParticleProcessContext {
+		double delta = 0.0;
+		double prev_time = 0.0;
+		double system_phase = 0.0;
+		Transform3D emission_xform;
+		Basis velocity_xform;
+		bool *chunk_active = nullptr;
+	};
+
+	enum {
+		PROCESS_CHUNK_SIZE = 512
+	};
+
 	void _update_internal();
 	void _particles_process(double p_delta);
+	void _particles_process_chunk(uint32_t p_chunk, ParticleProcessContext *p_context);
+	bool _particles_process_range(uint32_t p_from, uint32_t p_to, const ParticleProcessContext &p_context, RandomNumberGenerator *p_rng);
 	void _update_particle_data_buffer();
 	void _set_emitting();
 
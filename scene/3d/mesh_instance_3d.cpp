@@ -31,6 +31,7 @@
 #include "mesh_instance_3d.h"
 
 #include "scene/3d/skeleton_3d.h"
+#include "scene/resources/surface_tool.h"
 
 #ifndef PHYSICS_3D_DISABLED
 #include "scene/3d/physics/collision_shape_3d.h"
@@ -510,6 +511,115 @@ void MeshInstance3D::create_debug_tangents() {
 	}
 }
 
+static Transform3D _compute_transform_relative_to(const Node *p_node, const Node *p_ancestor) {
+	// Walk up the parents accumulating local transforms, so this also works
+	// for subtrees that are not inside the tree yet (e.g. right after
+	// instantiation, before the scene is added).
+	Transform3D xform;
+	const Node *node = p_node;
+	while (node && node != p_ancestor) {
+		const Node3D *node_3d = Object::cast_to<Node3D>(node);
+		if (node_3d) {
+			xform = node_3d->get_transform() * xform;
+		}
+		node = node->get_parent();
+	}
+	return xform;
+}
+
+static void _gather_mesh_instances(Node *p_node, LocalVector<MeshInstance3D *> &r_instances) {
+	MeshInstance3D *mi = Object::cast_to<MeshInstance3D>(p_node);
+	if (mi) {
+		r_instances.push_back(mi);
+	}
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_gather_mesh_instances(p_node->get_child(i), r_instances);
+	}
+}
+
+MeshInstance3D *MeshInstance3D::create_merged(Node *p_subtree_root) {
+	ERR_FAIL_NULL_V(p_subtree_root, nullptr);
+	ERR_FAIL_NULL_V_MSG(Object::cast_to<Node3D>(p_subtree_root), nullptr, "The subtree root must be a Node3D.");
+
+	LocalVector<MeshInstance3D *> instances;
+	_gather_mesh_instances(p_subtree_root, instances);
+
+	// One SurfaceTool per unique material, so the merged mesh ends up with a
+	// single surface (and draw call) per material.
+	LocalVector<Ref<Material>> materials;
+	LocalVector<Ref<SurfaceTool>> surfaces;
+
+	for (MeshInstance3D *mi : instances) {
+		Ref<Mesh> mesh = mi->get_mesh();
+		if (mesh.is_null() || !mi->is_visible()) {
+			continue;
+		}
+		if (mesh->get_blend_shape_count() > 0 || mi->get_skin().is_valid()) {
+			continue; // Deforming instances cannot be baked.
+		}
+
+		Transform3D xform = _compute_transform_relative_to(mi, p_subtree_root);
+
+		for (int i = 0; i < mesh->get_surface_count(); i++) {
+			if (mesh->surface_get_primitive_type(i) != Mesh::PRIMITIVE_TRIANGLES) {
+				continue;
+			}
+
+			Array arrays = mesh->surface_get_arrays(i);
+			ERR_CONTINUE(arrays.size() != Mesh::ARRAY_MAX);
+
+			// Index non-indexed surfaces, so indexed and non-indexed sources
+			// can be appended into the same surface consistently.
+			Vector<int> src_indices = arrays[Mesh::ARRAY_INDEX];
+			if (src_indices.is_empty()) {
+				Vector<Vector3> src_vertices = arrays[Mesh::ARRAY_VERTEX];
+				src_indices.resize(src_vertices.size());
+				int *idx = src_indices.ptrw();
+				for (int j = 0; j < src_vertices.size(); j++) {
+					idx[j] = j;
+				}
+				arrays[Mesh::ARRAY_INDEX] = src_indices;
+			}
+
+			Ref<Material> material = mi->get_active_material(i);
+
+			int surface_index = -1;
+			for (uint32_t j = 0; j < materials.size(); j++) {
+				if (materials[j] == material) {
+					surface_index = j;
+					break;
+				}
+			}
+			if (surface_index == -1) {
+				surface_index = materials.size();
+				materials.push_back(material);
+				Ref<SurfaceTool> st;
+				st.instantiate();
+				st->begin(Mesh::PRIMITIVE_TRIANGLES);
+				surfaces.push_back(st);
+			}
+
+			surfaces[surface_index]->append_from_arrays(arrays, Mesh::PRIMITIVE_TRIANGLES, xform);
+		}
+	}
+
+	if (materials.is_empty()) {
+		return nullptr;
+	}
+
+	Ref<ArrayMesh> merged_mesh;
+	merged_mesh.instantiate();
+	for (uint32_t i = 0; i < surfaces.size(); i++) {
+		surfaces[i]->commit(merged_mesh);
+		merged_mesh->surface_set_material(merged_mesh->get_surface_count() - 1, materials[i]);
+	}
+
+	MeshInstance3D *mi = memnew(MeshInstance3D);
+	mi->set_mesh(merged_mesh);
+	mi->set_name("MergedMeshInstance3D");
+	return mi;
+}
+
 bool MeshInstance3D::_property_can_revert(const StringName &p_name) const {
 	HashMap<StringName, int>::ConstIterator E = blend_shape_properties.find(p_name);
 	if (E) {
@@ -914,6 +1024,8 @@ void MeshInstance3D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("create_debug_tangents"), &MeshInstance3D::create_debug_tangents);
 
+	ClassDB::bind_static_method("MeshInstance3D", D_METHOD("create_merged", "subtree_root"), &MeshInstance3D::create_merged);
+
 	ClassDB::bind_method(D_METHOD("bake_mesh_from_current_blend_shape_mix", "existing"), &MeshInstance3D::bake_mesh_from_current_blend_shape_mix, DEFVAL(Ref<ArrayMesh>()));
 	ClassDB::bind_method(D_METHOD("bake_mesh_from_current_skeleton_pose", "existing"), &MeshInstance3D::bake_mesh_from_current_skeleton_pose, DEFVAL(Ref<ArrayMesh>()));
 
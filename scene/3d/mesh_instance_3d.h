@@ -112,6 +112,8 @@ public:
 	MeshInstance3D *create_debug_tangents_node();
 	void create_debug_tangents();
 
+	static MeshInstance3D *create_merged(Node *p_subtree_root);
+
 	virtual AABB get_aabb() const override;
 
 	Ref<ArrayMesh> bake_mesh_from_current_blend_shape_mix(Ref<ArrayMesh> p_existing = Ref<ArrayMesh>());
@@ -108,6 +108,17 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
+	/* This check avoids re-propagating into a subtree that is already fully
+	 * dirty (same optimization CanvasItem::_notify_transform uses). Global
+	 * transforms are only cleaned through the parent chain, and the
+	 * interpolated bit is only cleared by whole-tree sweeps, so if both bits
+	 * are still set here, every non-toplevel descendant still has them set
+	 * and is already queued for notification where interested.
+	 */
+	if (_test_dirty_bits(DIRTY_GLOBAL_TRANSFORM) && _test_dirty_bits(DIRTY_GLOBAL_INTERPOLATED_TRANSFORM)) {
+		return;
+	}
+
 	for (uint32_t n = 0; n < data.node3d_children.size(); n++) {
 		Node3D *s = data.node3d_children[n];
 
@@ -396,11 +396,17 @@ void Skeleton3D::_notification(int p_what) {
 					E->skeleton_version = version;
 				}
 
+				// Compute all skinning transforms and submit them in one call; per-bone
+				// calls pay a command queue round trip and RID lookup each.
+				Vector<Transform3D> bind_transforms;
+				bind_transforms.resize(bind_count);
+				Transform3D *bind_transforms_ptr = bind_transforms.ptrw();
 				for (uint32_t i = 0; i < bind_count; i++) {
 					uint32_t bone_index = E->skin_bone_indices_ptrs[i];
 					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					rs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].global_pose * skin->get_bind_pose(i));
+					bind_transforms_ptr[i] = bonesptr[bone_index].global_pose * skin->get_bind_pose(i);
 				}
+				rs->skeleton_bone_set_transforms(skeleton, bind_transforms);
 			}
 
 			if (!modifiers.is_empty()) {
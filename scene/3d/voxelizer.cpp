@@ -31,6 +31,7 @@
 #include "voxelizer.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 
 static _FORCE_INLINE_ void get_uv_and_normal(const Vector3 &p_pos, const Vector3 *p_vtx, const Vector2 *p_uv, const Vector3 *p_normal, Vector2 &r_uv, Vector3 &r_normal) {
 	if (p_pos.is_equal_approx(p_vtx[0])) {
@@ -72,7 +73,7 @@ static _FORCE_INLINE_ void get_uv_and_normal(const Vector3 &p_pos, const Vector3
 	r_normal = (p_normal[0] * u + p_normal[1] * v + p_normal[2] * w).normalized();
 }
 
-void Voxelizer::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb) {
+void Voxelizer::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb, Vector<Cell> &r_cells) {
 	if (p_level == cell_subdiv) {
 		//plot the face by guessing its albedo and emission value
 
@@ -219,16 +220,16 @@ void Voxelizer::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, co
 		}
 
 		//put this temporarily here, corrected in a later step
-		bake_cells.write[p_idx].albedo[0] += albedo_accum.r;
-		bake_cells.write[p_idx].albedo[1] += albedo_accum.g;
-		bake_cells.write[p_idx].albedo[2] += albedo_accum.b;
-		bake_cells.write[p_idx].emission[0] += emission_accum.r;
-		bake_cells.write[p_idx].emission[1] += emission_accum.g;
-		bake_cells.write[p_idx].emission[2] += emission_accum.b;
-		bake_cells.write[p_idx].normal[0] += normal_accum.x;
-		bake_cells.write[p_idx].normal[1] += normal_accum.y;
-		bake_cells.write[p_idx].normal[2] += normal_accum.z;
-		bake_cells.write[p_idx].alpha += alpha;
+		r_cells.write[p_idx].albedo[0] += albedo_accum.r;
+		r_cells.write[p_idx].albedo[1] += albedo_accum.g;
+		r_cells.write[p_idx].albedo[2] += albedo_accum.b;
+		r_cells.write[p_idx].emission[0] += emission_accum.r;
+		r_cells.write[p_idx].emission[1] += emission_accum.g;
+		r_cells.write[p_idx].emission[2] += emission_accum.b;
+		r_cells.write[p_idx].normal[0] += normal_accum.x;
+		r_cells.write[p_idx].normal[1] += normal_accum.y;
+		r_cells.write[p_idx].normal[2] += normal_accum.z;
+		r_cells.write[p_idx].alpha += alpha;
 
 	} else {
 		//go down
@@ -271,19 +272,19 @@ void Voxelizer::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, co
 				}
 			}
 
-			if (bake_cells[p_idx].children[i] == CHILD_EMPTY) {
+			if (r_cells[p_idx].children[i] == CHILD_EMPTY) {
 				//sub cell must be created
 
-				uint32_t child_idx = bake_cells.size();
-				bake_cells.write[p_idx].children[i] = child_idx;
-				bake_cells.resize(bake_cells.size() + 1);
-				bake_cells.write[child_idx].level = p_level + 1;
-				bake_cells.write[child_idx].x = nx / half;
-				bake_cells.write[child_idx].y = ny / half;
-				bake_cells.write[child_idx].z = nz / half;
+				uint32_t child_idx = r_cells.size();
+				r_cells.write[p_idx].children[i] = child_idx;
+				r_cells.resize(r_cells.size() + 1);
+				r_cells.write[child_idx].level = p_level + 1;
+				r_cells.write[child_idx].x = nx / half;
+				r_cells.write[child_idx].y = ny / half;
+				r_cells.write[child_idx].z = nz / half;
 			}
 
-			_plot_face(bake_cells[p_idx].children[i], p_level + 1, nx, ny, nz, p_vtx, p_normal, p_uv, p_material, aabb);
+			_plot_face(r_cells[p_idx].children[i], p_level + 1, nx, ny, nz, p_vtx, p_normal, p_uv, p_material, aabb, r_cells);
 		}
 	}
 }
@@ -402,6 +403,89 @@ int Voxelizer::get_bake_steps(Ref<Mesh> &p_mesh) const {
 	return bake_total;
 }
 
+void Voxelizer::_plot_mesh_octant(uint32_t p_index, void *p_userdata) {
+	OctantPlotter *plotter = (OctantPlotter *)p_userdata;
+	OctantPlotter::Octant &octant = plotter->octants[p_index];
+	if (!octant.valid) {
+		return;
+	}
+
+	int half = (1 << cell_subdiv) >> 1;
+	octant.cells.resize(1);
+	octant.cells.write[0].level = 1;
+	octant.cells.write[0].x = octant.x / half;
+	octant.cells.write[0].y = octant.y / half;
+	octant.cells.write[0].z = octant.z / half;
+
+	const Vector3 qsize = octant.aabb.size * 0.5;
+	const Vector3 center = octant.aabb.position + qsize;
+
+	for (int j = 0; j < plotter->face_count; j++) {
+		Vector3 vtxs[3];
+		Vector2 uvs[3];
+		Vector3 normal[3];
+
+		for (int k = 0; k < 3; k++) {
+			int vidx = plotter->indices ? plotter->indices[j * 3 + k] : j * 3 + k;
+			vtxs[k] = plotter->xform->xform(plotter->vertices[vidx]);
+			if (plotter->uvs) {
+				uvs[k] = plotter->uvs[vidx];
+			}
+			if (plotter->normals) {
+				// Keep the serial path's behavior: normals of non-indexed
+				// surfaces are plotted untransformed.
+				normal[k] = plotter->indices ? plotter->normal_xform->xform(plotter->normals[vidx]).normalized() : plotter->normals[vidx];
+			}
+		}
+
+		// Test against original bounds, then against this octant.
+		if (!Geometry3D::triangle_box_overlap(original_bounds.get_center(), original_bounds.size * 0.5, vtxs)) {
+			continue;
+		}
+		if (!Geometry3D::triangle_box_overlap(center, qsize, vtxs)) {
+			continue;
+		}
+
+		octant.used = true;
+		_plot_face(0, 1, octant.x, octant.y, octant.z, vtxs, normal, uvs, *plotter->material, octant.aabb, octant.cells);
+	}
+}
+
+void Voxelizer::_merge_plotted_cells(uint32_t p_dst_idx, const Vector<Cell> &p_src_cells, uint32_t p_src_idx) {
+	const Cell &src = p_src_cells[p_src_idx];
+
+	if (src.level == cell_subdiv) {
+		Cell &dst = bake_cells.write[p_dst_idx];
+		for (int i = 0; i < 3; i++) {
+			dst.albedo[i] += src.albedo[i];
+			dst.emission[i] += src.emission[i];
+			dst.normal[i] += src.normal[i];
+		}
+		dst.alpha += src.alpha;
+		return;
+	}
+
+	for (int i = 0; i < 8; i++) {
+		uint32_t src_child = src.children[i];
+		if (src_child == CHILD_EMPTY) {
+			continue;
+		}
+		uint32_t dst_child = bake_cells[p_dst_idx].children[i];
+		if (dst_child == CHILD_EMPTY) {
+			dst_child = bake_cells.size();
+			bake_cells.write[p_dst_idx].children[i] = dst_child;
+			bake_cells.resize(bake_cells.size() + 1);
+			const Cell &src_child_cell = p_src_cells[src_child];
+			Cell &dst_child_cell = bake_cells.write[dst_child];
+			dst_child_cell.level = src_child_cell.level;
+			dst_child_cell.x = src_child_cell.x;
+			dst_child_cell.y = src_child_cell.y;
+			dst_child_cell.z = src_child_cell.z;
+		}
+		_merge_plotted_cells(dst_child, p_src_cells, src_child);
+	}
+}
+
 Voxelizer::BakeResult Voxelizer::plot_mesh(const Transform3D &p_xform, Ref<Mesh> &p_mesh, const Vector<Ref<Material>> &p_materials, const Ref<Material> &p_override_material, BakeStepFunc p_bake_step_func) {
 	ERR_FAIL_COND_V_MSG(!p_xform.is_finite(), BAKE_RESULT_INVALID_PARAMETER, "Invalid mesh bake transform.");
 
@@ -444,6 +528,70 @@ Voxelizer::BakeResult Voxelizer::plot_mesh(const Transform3D &p_xform, Ref<Mesh>
 			nr = normals.ptr();
 		}
 
+		int total_facecount = (index.size() ? index.size() : vertices.size()) / 3;
+		if (total_facecount >= 1024 && cell_subdiv >= 1 && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+			// Plot the surface in parallel, one worker per root octant, each
+			// into its own octree fragment; fragments are merged below.
+			bake_current += total_facecount;
+			if (p_bake_step_func != nullptr && p_bake_step_func(bake_current, bake_total)) {
+				return BAKE_RESULT_CANCELLED;
+			}
+
+			OctantPlotter plotter;
+			plotter.xform = &p_xform;
+			plotter.normal_xform = &normal_xform;
+			plotter.vertices = vr;
+			plotter.uvs = uvr;
+			plotter.normals = nr;
+			plotter.indices = index.size() ? index.ptr() : nullptr;
+			plotter.face_count = total_facecount;
+			plotter.material = &material;
+
+			int half = (1 << cell_subdiv) >> 1;
+			for (int oct = 0; oct < 8; oct++) {
+				OctantPlotter::Octant &octant = plotter.octants[oct];
+				AABB aabb = po2_bounds;
+				aabb.size *= 0.5;
+				octant.x = (oct & 1) ? half : 0;
+				octant.y = (oct & 2) ? half : 0;
+				octant.z = (oct & 4) ? half : 0;
+				if (oct & 1) {
+					aabb.position.x += aabb.size.x;
+				}
+				if (oct & 2) {
+					aabb.position.y += aabb.size.y;
+				}
+				if (oct & 4) {
+					aabb.position.z += aabb.size.z;
+				}
+				octant.aabb = aabb;
+				octant.valid = octant.x < axis_cell_size[0] && octant.y < axis_cell_size[1] && octant.z < axis_cell_size[2];
+			}
+
+			WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(this, &Voxelizer::_plot_mesh_octant, (void *)&plotter, 8, -1, true, SNAME("VoxelizerPlotMesh"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+			for (int oct = 0; oct < 8; oct++) {
+				const OctantPlotter::Octant &octant = plotter.octants[oct];
+				if (!octant.used) {
+					continue;
+				}
+				uint32_t dst_idx = bake_cells[0].children[oct];
+				if (dst_idx == CHILD_EMPTY) {
+					dst_idx = bake_cells.size();
+					bake_cells.write[0].children[oct] = dst_idx;
+					bake_cells.resize(bake_cells.size() + 1);
+					bake_cells.write[dst_idx].level = 1;
+					bake_cells.write[dst_idx].x = octant.cells[0].x;
+					bake_cells.write[dst_idx].y = octant.cells[0].y;
+					bake_cells.write[dst_idx].z = octant.cells[0].z;
+				}
+				_merge_plotted_cells(dst_idx, octant.cells, 0);
+			}
+
+			continue;
+		}
+
 		if (index.size()) {
 			int facecount = index.size() / 3;
 			const int *ir = index.ptr();
@@ -481,7 +629,7 @@ Voxelizer::BakeResult Voxelizer::plot_mesh(const Transform3D &p_xform, Ref<Mesh>
 					continue;
 				}
 				//plot
-				_plot_face(0, 0, 0, 0, 0, vtxs, normal, uvs, material, po2_bounds);
+				_plot_face(0, 0, 0, 0, 0, vtxs, normal, uvs, material, po2_bounds, bake_cells);
 			}
 
 		} else {
@@ -520,7 +668,7 @@ Voxelizer::BakeResult Voxelizer::plot_mesh(const Transform3D &p_xform, Ref<Mesh>
 					continue;
 				}
 				//plot face
-				_plot_face(0, 0, 0, 0, 0, vtxs, normal, uvs, material, po2_bounds);
+				_plot_face(0, 0, 0, 0, 0, vtxs, normal, uvs, material, po2_bounds, bake_cells);
 			}
 		}
 	}
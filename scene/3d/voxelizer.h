@@ -111,8 +111,32 @@ private:
 	Vector<Color> _get_bake_texture(Ref<Image> p_image, const Color &p_color_mul, const Color &p_color_add);
 	MaterialCache _get_material_cache(Ref<Material> p_material);
 
-	void _plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb);
+	void _plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb, Vector<Cell> &r_cells);
 	void _fixup_plot(int p_idx, int p_level);
+
+	// Parallel plotting: each of the root's octants is voxelized by a worker
+	// into its own cell vector, then merged into bake_cells afterwards.
+	struct OctantPlotter {
+		const Transform3D *xform = nullptr;
+		const Basis *normal_xform = nullptr;
+		const Vector3 *vertices = nullptr;
+		const Vector2 *uvs = nullptr;
+		const Vector3 *normals = nullptr;
+		const int *indices = nullptr;
+		int face_count = 0;
+		const MaterialCache *material = nullptr;
+
+		struct Octant {
+			AABB aabb;
+			int x = 0, y = 0, z = 0; // Cell coordinates of the octant origin.
+			bool valid = false;
+			bool used = false;
+			Vector<Cell> cells; // cells[0] is the octant root.
+		};
+		Octant octants[8];
+	};
+	void _plot_mesh_octant(uint32_t p_index, void *p_userdata);
+	void _merge_plotted_cells(uint32_t p_dst_idx, const Vector<Cell> &p_src_cells, uint32_t p_src_idx);
 	void _debug_mesh(int p_idx, int p_level, const AABB &p_aabb, Ref<MultiMesh> &p_multimesh, int &idx);
 
 	bool sorted = false;
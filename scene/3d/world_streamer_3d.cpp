@@ -0,0 +1,462 @@
+/**************************************************************************/
+/*  world_streamer_3d.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "world_streamer_3d.h"
+
+#include "core/config/engine.h"
+#include "core/io/resource_loader.h"
+#include "core/os/os.h"
+#include "core/templates/pair.h"
+#include "scene/main/scene_tree.h"
+
+int WorldStreamer3D::add_chunk(const String &p_scene_path, const AABB &p_bounds) {
+	ERR_FAIL_COND_V_MSG(p_scene_path.is_empty(), -1, "Chunk scene path can't be empty.");
+
+	Chunk chunk;
+	chunk.scene_path = p_scene_path;
+	chunk.bounds = p_bounds;
+
+	int id = next_chunk_id++;
+	chunks.insert(id, chunk);
+	return id;
+}
+
+void WorldStreamer3D::remove_chunk(int p_chunk_id) {
+	Chunk *chunk = chunks.getptr(p_chunk_id);
+	ERR_FAIL_NULL_MSG(chunk, vformat("Invalid chunk ID: %d.", p_chunk_id));
+
+	switch (chunk->state) {
+		case CHUNK_STATE_LOADING: {
+			// Threaded loads can't be canceled; drain the result later so the
+			// loader doesn't keep it around.
+			orphaned_loads.push_back(chunk->scene_path);
+			loads_in_flight--;
+		} break;
+		case CHUNK_STATE_ACTIVATING: {
+			// The async instantiation can't be canceled either; keep the entry
+			// until the instantiated callback can free the node.
+			chunk->pending_removal = true;
+			return;
+		} break;
+		case CHUNK_STATE_ACTIVE: {
+			_unload_chunk(p_chunk_id, *chunk);
+		} break;
+		case CHUNK_STATE_UNLOADED: {
+		} break;
+	}
+	chunks.erase(p_chunk_id);
+}
+
+void WorldStreamer3D::clear_chunks() {
+	LocalVector<int> ids;
+	ids.reserve(chunks.size());
+	for (const KeyValue<int, Chunk> &E : chunks) {
+		ids.push_back(E.key);
+	}
+	for (int id : ids) {
+		remove_chunk(id);
+	}
+}
+
+int WorldStreamer3D::get_chunk_count() const {
+	return chunks.size();
+}
+
+WorldStreamer3D::ChunkState WorldStreamer3D::get_chunk_state(int p_chunk_id) const {
+	const Chunk *chunk = chunks.getptr(p_chunk_id);
+	ERR_FAIL_NULL_V_MSG(chunk, CHUNK_STATE_UNLOADED, vformat("Invalid chunk ID: %d.", p_chunk_id));
+	return chunk->state;
+}
+
+Node *WorldStreamer3D::get_chunk_node(int p_chunk_id) const {
+	const Chunk *chunk = chunks.getptr(p_chunk_id);
+	ERR_FAIL_NULL_V_MSG(chunk, nullptr, vformat("Invalid chunk ID: %d.", p_chunk_id));
+	return ObjectDB::get_instance<Node>(chunk->instance_id);
+}
+
+void WorldStreamer3D::set_target(const NodePath &p_target) {
+	target_path = p_target;
+	target_position_valid = false;
+	update_configuration_warnings();
+}
+
+NodePath WorldStreamer3D::get_target() const {
+	return target_path;
+}
+
+void WorldStreamer3D::set_load_range(real_t p_range) {
+	ERR_FAIL_COND(p_range <= 0.0);
+	load_range = p_range;
+	unload_range = MAX(unload_range, load_range);
+}
+
+real_t WorldStreamer3D::get_load_range() const {
+	return load_range;
+}
+
+void WorldStreamer3D::set_unload_range(real_t p_range) {
+	// Keep some hysteresis so chunks don't thrash at the load boundary.
+	unload_range = MAX(p_range, load_range);
+}
+
+real_t WorldStreamer3D::get_unload_range() const {
+	return unload_range;
+}
+
+void WorldStreamer3D::set_look_ahead_time(real_t p_seconds) {
+	ERR_FAIL_COND(p_seconds < 0.0);
+	look_ahead_time = p_seconds;
+}
+
+real_t WorldStreamer3D::get_look_ahead_time() const {
+	return look_ahead_time;
+}
+
+void WorldStreamer3D::set_max_concurrent_loads(int p_loads) {
+	ERR_FAIL_COND(p_loads < 1);
+	max_concurrent_loads = p_loads;
+}
+
+int WorldStreamer3D::get_max_concurrent_loads() const {
+	return max_concurrent_loads;
+}
+
+void WorldStreamer3D::set_memory_budget_mb(int p_budget_mb) {
+	ERR_FAIL_COND(p_budget_mb < 0);
+	memory_budget_mb = p_budget_mb;
+}
+
+int WorldStreamer3D::get_memory_budget_mb() const {
+	return memory_budget_mb;
+}
+
+void WorldStreamer3D::_update_distances(double p_delta) {
+	Node3D *target = Object::cast_to<Node3D>(get_node_or_null(target_path));
+	if (!target || !target->is_inside_tree()) {
+		target_position_valid = false;
+		return;
+	}
+
+	Vector3 target_position = to_local(target->get_global_position());
+	if (target_position_valid && p_delta > 0.0) {
+		// Smooth the velocity estimate a bit so a single stutter frame doesn't
+		// flip the predicted direction.
+		target_velocity = target_velocity.lerp((target_position - last_target_position) / p_delta, 0.5);
+	} else {
+		target_velocity = Vector3();
+	}
+	last_target_position = target_position;
+	target_position_valid = true;
+
+	// Prioritize by distance to where the target is heading, not where it is.
+	Vector3 predicted = target_position + target_velocity * look_ahead_time;
+	for (KeyValue<int, Chunk> &E : chunks) {
+		Vector3 closest = predicted.clamp(E.value.bounds.position, E.value.bounds.position + E.value.bounds.size);
+		E.value.distance = predicted.distance_to(closest);
+	}
+}
+
+void WorldStreamer3D::_poll_loads() {
+	// Drain loads whose chunk went away before they finished.
+	for (List<String>::Element *E = orphaned_loads.front(); E;) {
+		List<String>::Element *N = E->next();
+		ResourceLoader::ThreadLoadStatus status = ResourceLoader::load_threaded_get_status(E->get());
+		if (status == ResourceLoader::THREAD_LOAD_LOADED) {
+			ResourceLoader::load_threaded_get(E->get()); // Discard.
+			orphaned_loads.erase(E);
+		} else if (status != ResourceLoader::THREAD_LOAD_IN_PROGRESS) {
+			orphaned_loads.erase(E);
+		}
+		E = N;
+	}
+
+	for (KeyValue<int, Chunk> &E : chunks) {
+		Chunk &chunk = E.value;
+		if (chunk.state != CHUNK_STATE_LOADING) {
+			continue;
+		}
+		ResourceLoader::ThreadLoadStatus status = ResourceLoader::load_threaded_get_status(chunk.scene_path);
+		if (status == ResourceLoader::THREAD_LOAD_IN_PROGRESS) {
+			continue;
+		}
+		loads_in_flight--;
+		Ref<PackedScene> scene;
+		if (status == ResourceLoader::THREAD_LOAD_LOADED) {
+			scene = ResourceLoader::load_threaded_get(chunk.scene_path);
+		}
+		if (scene.is_null()) {
+			chunk.state = CHUNK_STATE_UNLOADED;
+			WARN_PRINT(vformat("WorldStreamer3D: Failed to load chunk scene \"%s\".", chunk.scene_path));
+			continue;
+		}
+		chunk.scene = scene;
+		// Activation goes through the scene tree's budgeted instantiation, so
+		// entering a large chunk never blows a single frame.
+		if (get_tree()->instantiate_async(scene, this) != OK) {
+			chunk.scene.unref();
+			chunk.state = CHUNK_STATE_UNLOADED;
+			continue;
+		}
+		chunk.state = CHUNK_STATE_ACTIVATING;
+		activation_queue.push_back(E.key);
+	}
+}
+
+void WorldStreamer3D::_issue_loads() {
+	if (!target_position_valid || over_memory_budget) {
+		return;
+	}
+
+	LocalVector<Pair<real_t, int>> candidates;
+	for (const KeyValue<int, Chunk> &E : chunks) {
+		if (E.value.state == CHUNK_STATE_UNLOADED && E.value.distance <= load_range) {
+			candidates.push_back(Pair<real_t, int>(E.value.distance, E.key));
+		}
+	}
+	candidates.sort();
+
+	for (const Pair<real_t, int> &candidate : candidates) {
+		if (loads_in_flight >= max_concurrent_loads) {
+			break;
+		}
+		Chunk &chunk = chunks[candidate.second];
+		Error err = ResourceLoader::load_threaded_request(chunk.scene_path);
+		ERR_CONTINUE_MSG(err != OK, vformat("WorldStreamer3D: Can't request load of chunk scene \"%s\".", chunk.scene_path));
+		chunk.state = CHUNK_STATE_LOADING;
+		loads_in_flight++;
+	}
+}
+
+void WorldStreamer3D::_apply_memory_budget() {
+	if (memory_budget_mb <= 0) {
+		over_memory_budget = false;
+		return;
+	}
+	over_memory_budget = OS::get_singleton()->get_static_memory_usage() > uint64_t(memory_budget_mb) * 1024 * 1024;
+	if (!over_memory_budget) {
+		return;
+	}
+
+	// Under pressure, release the farthest resident chunk. One per frame, so a
+	// momentary spike doesn't dump the whole world.
+	int farthest_id = -1;
+	real_t farthest_distance = -1.0;
+	for (const KeyValue<int, Chunk> &E : chunks) {
+		if (E.value.state == CHUNK_STATE_ACTIVE && E.value.distance > farthest_distance) {
+			farthest_distance = E.value.distance;
+			farthest_id = E.key;
+		}
+	}
+	if (farthest_id != -1) {
+		_unload_chunk(farthest_id, chunks[farthest_id]);
+	}
+}
+
+void WorldStreamer3D::_verify_releases() {
+	for (List<PendingRelease>::Element *E = pending_releases.front(); E;) {
+		List<PendingRelease>::Element *N = E->next();
+		PendingRelease &pr = E->get();
+		pr.frames_left--;
+		if (pr.frames_left <= 0) {
+			bool in_use = false;
+			for (const KeyValue<int, Chunk> &C : chunks) {
+				if (C.value.state != CHUNK_STATE_UNLOADED && C.value.scene_path == pr.scene_path) {
+					in_use = true; // Another chunk legitimately holds the scene.
+					break;
+				}
+			}
+			if (!in_use && ResourceCache::has(pr.scene_path)) {
+				WARN_VERBOSE(vformat("WorldStreamer3D: Chunk scene \"%s\" is still referenced after unload; its memory won't be reclaimed.", pr.scene_path));
+			}
+			pending_releases.erase(E);
+		}
+		E = N;
+	}
+}
+
+void WorldStreamer3D::_unload_chunk(int p_chunk_id, Chunk &p_chunk) {
+	Node *node = ObjectDB::get_instance<Node>(p_chunk.instance_id);
+	if (node) {
+		node->queue_free();
+	}
+	p_chunk.instance_id = ObjectID();
+	p_chunk.scene.unref();
+	p_chunk.state = CHUNK_STATE_UNLOADED;
+
+	// The freed instance may hold the last reference until the deferred delete
+	// runs, so give the cache a few frames before checking.
+	PendingRelease pr;
+	pr.scene_path = p_chunk.scene_path;
+	pr.frames_left = 3;
+	pending_releases.push_back(pr);
+
+	emit_signal(SNAME("chunk_unloaded"), p_chunk_id);
+}
+
+void WorldStreamer3D::_on_async_scene_instantiated(const Ref<PackedScene> &p_scene, Node *p_node) {
+	if (p_node->get_parent() != this) {
+		return; // Not one of ours.
+	}
+
+	// Requests are served FIFO, so the first queued chunk with this scene is
+	// the one that just finished.
+	for (List<int>::Element *E = activation_queue.front(); E; E = E->next()) {
+		Chunk *chunk = chunks.getptr(E->get());
+		if (!chunk || chunk->state != CHUNK_STATE_ACTIVATING || chunk->scene != p_scene) {
+			continue;
+		}
+		int chunk_id = E->get();
+		activation_queue.erase(E);
+
+		if (chunk->pending_removal || chunk->distance > unload_range) {
+			// Removed or out of range while instantiating; discard the instance.
+			bool removed = chunk->pending_removal;
+			chunk->instance_id = p_node->get_instance_id();
+			_unload_chunk(chunk_id, *chunk);
+			if (removed) {
+				chunks.erase(chunk_id);
+			}
+			return;
+		}
+
+		Node3D *node_3d = Object::cast_to<Node3D>(p_node);
+		if (node_3d) {
+			node_3d->set_position(chunk->bounds.position);
+		}
+		chunk->instance_id = p_node->get_instance_id();
+		chunk->state = CHUNK_STATE_ACTIVE;
+		emit_signal(SNAME("chunk_loaded"), chunk_id, p_node);
+		return;
+	}
+}
+
+void WorldStreamer3D::_update_streaming(double p_delta) {
+	_update_distances(p_delta);
+	_poll_loads();
+	_verify_releases();
+
+	if (target_position_valid) {
+		for (KeyValue<int, Chunk> &E : chunks) {
+			if (E.value.state == CHUNK_STATE_ACTIVE && E.value.distance > unload_range) {
+				_unload_chunk(E.key, E.value);
+			} else if (E.value.state == CHUNK_STATE_LOADING && E.value.distance > unload_range) {
+				// No longer wanted; orphan the threaded load.
+				orphaned_loads.push_back(E.value.scene_path);
+				loads_in_flight--;
+				E.value.state = CHUNK_STATE_UNLOADED;
+			}
+		}
+	}
+
+	_apply_memory_budget();
+	_issue_loads();
+}
+
+void WorldStreamer3D::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_ENTER_TREE: {
+			if (!Engine::get_singleton()->is_editor_hint()) {
+				set_process_internal(true);
+				get_tree()->connect(SNAME("async_scene_instantiated"), callable_mp(this, &WorldStreamer3D::_on_async_scene_instantiated));
+			}
+		} break;
+
+		case NOTIFICATION_EXIT_TREE: {
+			if (!Engine::get_singleton()->is_editor_hint()) {
+				set_process_internal(false);
+				get_tree()->disconnect(SNAME("async_scene_instantiated"), callable_mp(this, &WorldStreamer3D::_on_async_scene_instantiated));
+			}
+			// Pending instantiations are dropped by the tree once the parent is
+			// outside it, so their chunks go back to unloaded.
+			for (int id : activation_queue) {
+				Chunk *chunk = chunks.getptr(id);
+				if (!chunk) {
+					continue;
+				}
+				if (chunk->pending_removal) {
+					chunks.erase(id);
+				} else {
+					chunk->scene.unref();
+					chunk->state = CHUNK_STATE_UNLOADED;
+				}
+			}
+			activation_queue.clear();
+		} break;
+
+		case NOTIFICATION_INTERNAL_PROCESS: {
+			_update_streaming(get_process_delta_time());
+		} break;
+	}
+}
+
+PackedStringArray WorldStreamer3D::get_configuration_warnings() const {
+	PackedStringArray warnings = Node3D::get_configuration_warnings();
+	if (target_path.is_empty()) {
+		warnings.push_back(RTR("WorldStreamer3D requires a target node to stream around. Set the \"target\" property to the player or camera."));
+	}
+	return warnings;
+}
+
+void WorldStreamer3D::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("add_chunk", "scene_path", "bounds"), &WorldStreamer3D::add_chunk);
+	ClassDB::bind_method(D_METHOD("remove_chunk", "chunk_id"), &WorldStreamer3D::remove_chunk);
+	ClassDB::bind_method(D_METHOD("clear_chunks"), &WorldStreamer3D::clear_chunks);
+	ClassDB::bind_method(D_METHOD("get_chunk_count"), &WorldStreamer3D::get_chunk_count);
+	ClassDB::bind_method(D_METHOD("get_chunk_state", "chunk_id"), &WorldStreamer3D::get_chunk_state);
+	ClassDB::bind_method(D_METHOD("get_chunk_node", "chunk_id"), &WorldStreamer3D::get_chunk_node);
+
+	ClassDB::bind_method(D_METHOD("set_target", "target"), &WorldStreamer3D::set_target);
+	ClassDB::bind_method(D_METHOD("get_target"), &WorldStreamer3D::get_target);
+	ClassDB::bind_method(D_METHOD("set_load_range", "range"), &WorldStreamer3D::set_load_range);
+	ClassDB::bind_method(D_METHOD("get_load_range"), &WorldStreamer3D::get_load_range);
+	ClassDB::bind_method(D_METHOD("set_unload_range", "range"), &WorldStreamer3D::set_unload_range);
+	ClassDB::bind_method(D_METHOD("get_unload_range"), &WorldStreamer3D::get_unload_range);
+	ClassDB::bind_method(D_METHOD("set_look_ahead_time", "seconds"), &WorldStreamer3D::set_look_ahead_time);
+	ClassDB::bind_method(D_METHOD("get_look_ahead_time"), &WorldStreamer3D::get_look_ahead_time);
+	ClassDB::bind_method(D_METHOD("set_max_concurrent_loads", "loads"), &WorldStreamer3D::set_max_concurrent_loads);
+	ClassDB::bind_method(D_METHOD("get_max_concurrent_loads"), &WorldStreamer3D::get_max_concurrent_loads);
+	ClassDB::bind_method(D_METHOD("set_memory_budget_mb", "budget_mb"), &WorldStreamer3D::set_memory_budget_mb);
+	ClassDB::bind_method(D_METHOD("get_memory_budget_mb"), &WorldStreamer3D::get_memory_budget_mb);
+
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "target", PROPERTY_HINT_NODE_PATH_VALID_TYPES, "Node3D"), "set_target", "get_target");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "load_range", PROPERTY_HINT_RANGE, "0.001,4096,0.1,or_greater,suffix:m"), "set_load_range", "get_load_range");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "unload_range", PROPERTY_HINT_RANGE, "0.001,4096,0.1,or_greater,suffix:m"), "set_unload_range", "get_unload_range");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "look_ahead_time", PROPERTY_HINT_RANGE, "0,10,0.1,or_greater,suffix:s"), "set_look_ahead_time", "get_look_ahead_time");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_concurrent_loads", PROPERTY_HINT_RANGE, "1,16,1,or_greater"), "set_max_concurrent_loads", "get_max_concurrent_loads");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "memory_budget_mb", PROPERTY_HINT_RANGE, "0,16384,1,or_greater,suffix:MB"), "set_memory_budget_mb", "get_memory_budget_mb");
+
+	ADD_SIGNAL(MethodInfo("chunk_loaded", PropertyInfo(Variant::INT, "chunk_id"), PropertyInfo(Variant::OBJECT, "node", PROPERTY_HINT_RESOURCE_TYPE, "Node")));
+	ADD_SIGNAL(MethodInfo("chunk_unloaded", PropertyInfo(Variant::INT, "chunk_id")));
+
+	BIND_ENUM_CONSTANT(CHUNK_STATE_UNLOADED);
+	BIND_ENUM_CONSTANT(CHUNK_STATE_LOADING);
+	BIND_ENUM_CONSTANT(CHUNK_STATE_ACTIVATING);
+	BIND_ENUM_CONSTANT(CHUNK_STATE_ACTIVE);
+}
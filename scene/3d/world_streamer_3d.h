@@ -0,0 +1,134 @@
+/**************************************************************************/
+/*  world_streamer_3d.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/3d/node_3d.h"
+#include "scene/resources/packed_scene.h"
+
+class WorldStreamer3D : public Node3D {
+	GDCLASS(WorldStreamer3D, Node3D);
+
+public:
+	enum ChunkState {
+		CHUNK_STATE_UNLOADED,
+		CHUNK_STATE_LOADING,
+		CHUNK_STATE_ACTIVATING,
+		CHUNK_STATE_ACTIVE,
+	};
+
+private:
+	struct Chunk {
+		String scene_path;
+		AABB bounds;
+		ChunkState state = CHUNK_STATE_UNLOADED;
+		Ref<PackedScene> scene;
+		ObjectID instance_id;
+		real_t distance = 0.0; // To the predicted target position, updated every frame.
+		bool pending_removal = false; // Removed while activating; erased once the instance arrives.
+	};
+
+	HashMap<int, Chunk> chunks;
+	int next_chunk_id = 1;
+
+	// Chunks waiting on SceneTree::instantiate_async, in request order. The
+	// instantiated signal carries only (scene, node), so requests are matched
+	// back FIFO among chunks sharing the same scene.
+	List<int> activation_queue;
+
+	// Threaded loads whose chunk was removed or went out of range before the
+	// load finished; they are drained so the loader doesn't keep them cached.
+	List<String> orphaned_loads;
+
+	// Unloaded chunk scenes whose release from ResourceCache is still pending
+	// verification (the freed instance may hold the last reference until the
+	// deferred delete runs).
+	struct PendingRelease {
+		String scene_path;
+		int frames_left = 0;
+	};
+	List<PendingRelease> pending_releases;
+
+	NodePath target_path;
+	real_t load_range = 128.0;
+	real_t unload_range = 160.0;
+	real_t look_ahead_time = 1.0;
+	int max_concurrent_loads = 4;
+	int memory_budget_mb = 0;
+
+	Vector3 last_target_position;
+	Vector3 target_velocity;
+	bool target_position_valid = false;
+	bool over_memory_budget = false;
+	int loads_in_flight = 0;
+
+	void _update_streaming(double p_delta);
+	void _update_distances(double p_delta);
+	void _poll_loads();
+	void _issue_loads();
+	void _apply_memory_budget();
+	void _verify_releases();
+	void _unload_chunk(int p_chunk_id, Chunk &p_chunk);
+	void _on_async_scene_instantiated(const Ref<PackedScene> &p_scene, Node *p_node);
+
+protected:
+	void _notification(int p_what);
+	static void _bind_methods();
+
+public:
+	int add_chunk(const String &p_scene_path, const AABB &p_bounds);
+	void remove_chunk(int p_chunk_id);
+	void clear_chunks();
+	int get_chunk_count() const;
+	ChunkState get_chunk_state(int p_chunk_id) const;
+	Node *get_chunk_node(int p_chunk_id) const;
+
+	void set_target(const NodePath &p_target);
+	NodePath get_target() const;
+
+	void set_load_range(real_t p_range);
+	real_t get_load_range() const;
+
+	void set_unload_range(real_t p_range);
+	real_t get_unload_range() const;
+
+	void set_look_ahead_time(real_t p_seconds);
+	real_t get_look_ahead_time() const;
+
+	void set_max_concurrent_loads(int p_loads);
+	int get_max_concurrent_loads() const;
+
+	void set_memory_budget_mb(int p_budget_mb);
+	int get_memory_budget_mb() const;
+
+	PackedStringArray get_configuration_warnings() const override;
+};
+
+VARIANT_ENUM_CAST(WorldStreamer3D::ChunkState);
@@ -612,9 +612,11 @@ void AnimationMixer::_create_track_num_to_track_cache_for_animation(Ref<Animatio
 		// Since multiple AnimationLibraries can share the same Animation, it is possible that the cache is already created.
 		return;
 	}
-	LocalVector<TrackCache *> &track_num_to_track_cache = animation_track_num_to_track_cache.insert_new(p_animation, LocalVector<TrackCache *>())->value;
+	AnimationTrackCacheEntry &entry = animation_track_num_to_track_cache.insert_new(p_animation, AnimationTrackCacheEntry())->value;
+	LocalVector<TrackCache *> &track_num_to_track_cache = entry.track_num_to_track_cache;
 	const LocalVector<Animation::Track *> &tracks = p_animation->get_tracks();
 
+	HashSet<Animation::TypeHash, HashHasher> seen_hashes;
 	track_num_to_track_cache.resize(tracks.size());
 	for (uint32_t i = 0; i < tracks.size(); i++) {
 		TrackCache **track_ptr = track_cache.getptr(tracks[i]->thash);
@@ -623,6 +625,11 @@ void AnimationMixer::_create_track_num_to_track_cache_for_animation(Ref<Animatio
 		} else {
 			track_num_to_track_cache[i] = *track_ptr;
 		}
+		if (seen_hashes.has(tracks[i]->thash)) {
+			entry.has_duplicate_thash = true;
+		} else {
+			seen_hashes.insert(tracks[i]->thash);
+		}
 	}
 }
 
@@ -1133,10 +1140,16 @@ void AnimationMixer::_blend_calc_total_weight() {
 		real_t weight = ai.playback_info.weight;
 		const real_t *track_weights_ptr = ai.playback_info.track_weights.ptr();
 		int track_weights_count = ai.playback_info.track_weights.size();
-		ERR_CONTINUE_EDMSG(!animation_track_num_to_track_cache.has(a), "No animation in cache.");
-		LocalVector<TrackCache *> &track_num_to_track_cache = animation_track_num_to_track_cache[a];
+		AnimationTrackCacheEntry *entry = animation_track_num_to_track_cache.getptr(a);
+		ERR_CONTINUE_EDMSG(entry == nullptr, "No animation in cache.");
+		LocalVector<TrackCache *> &track_num_to_track_cache = entry->track_num_to_track_cache;
+		// Only animations with tracks sharing a type hash need the per-track
+		// duplicate bookkeeping; skip the hash set entirely otherwise.
+		bool check_duplicates = entry->has_duplicate_thash;
 		thread_local HashSet<Animation::TypeHash, HashHasher> processed_hashes;
-		processed_hashes.clear();
+		if (check_duplicates) {
+			processed_hashes.clear();
+		}
 		const LocalVector<Animation::Track *> &tracks = a->get_tracks();
 		Animation::Track *const *tracks_ptr = tracks.ptr();
 		int count = tracks.size();
@@ -1147,7 +1160,7 @@ void AnimationMixer::_blend_calc_total_weight() {
 			}
 			Animation::TypeHash thash = animation_track->thash;
 			TrackCache *track = track_num_to_track_cache[i];
-			if (track == nullptr || processed_hashes.has(thash)) {
+			if (track == nullptr || (check_duplicates && processed_hashes.has(thash))) {
 				// No path, but avoid error spamming.
 				// Or, there is the case different track type with same path; These can be distinguished by hash. So don't add the weight doubly.
 				continue;
@@ -1156,7 +1169,9 @@ void AnimationMixer::_blend_calc_total_weight() {
 			ERR_CONTINUE(blend_idx < 0 || blend_idx >= track_count);
 			real_t blend = blend_idx < track_weights_count ? track_weights_ptr[blend_idx] * weight : weight;
 			track->total_weight += blend;
-			processed_hashes.insert(thash);
+			if (check_duplicates) {
+				processed_hashes.insert(thash);
+			}
 		}
 	}
 }
@@ -1183,8 +1198,9 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 #ifndef _3D_DISABLED
 		bool calc_root = !seeked || is_external_seeking;
 #endif // _3D_DISABLED
-		ERR_CONTINUE_EDMSG(!animation_track_num_to_track_cache.has(a), "No animation in cache.");
-		LocalVector<TrackCache *> &track_num_to_track_cache = animation_track_num_to_track_cache[a];
+		AnimationTrackCacheEntry *entry = animation_track_num_to_track_cache.getptr(a);
+		ERR_CONTINUE_EDMSG(entry == nullptr, "No animation in cache.");
+		LocalVector<TrackCache *> &track_num_to_track_cache = entry->track_num_to_track_cache;
 		const LocalVector<Animation::Track *> &tracks = a->get_tracks();
 		Animation::Track *const *tracks_ptr = tracks.ptr();
 		real_t a_length = a->get_length();
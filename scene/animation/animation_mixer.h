@@ -303,9 +303,16 @@ protected:
 		}
 	};
 
+	struct AnimationTrackCacheEntry {
+		LocalVector<TrackCache *> track_num_to_track_cache;
+		// Whether any two tracks share the same type hash; when false (the common
+		// case), the per-frame duplicate-track bookkeeping can be skipped.
+		bool has_duplicate_thash = false;
+	};
+
 	RootMotionCache root_motion_cache;
 	AHashMap<Animation::TypeHash, TrackCache *, HashHasher> track_cache;
-	AHashMap<Ref<Animation>, LocalVector<TrackCache *>> animation_track_num_to_track_cache;
+	AHashMap<Ref<Animation>, AnimationTrackCacheEntry> animation_track_num_to_track_cache;
 	HashSet<TrackCache *> playing_caches;
 	Vector<Node *> playing_audio_stream_players;
 
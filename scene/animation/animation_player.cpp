@@ -299,6 +299,48 @@ void AnimationPlayer::_blend_playback_data(double p_delta, bool p_started) {
 	}
 }
 
+void AnimationPlayer::_process_animation(double p_delta, bool p_update_only) {
+	Playback &c = playback;
+
+	if (static_pose_applied && !p_update_only && cache_valid && playing && !is_stopping &&
+			c.current.from && !c.started && !c.seeked && c.blend.is_empty() &&
+			capture_cache.animation.is_null() &&
+			c.current.from->animation->get_instance_id() == static_eval_animation) {
+		// The held pose cannot change any output; only advance the playback position.
+		PlaybackData &cd = c.current;
+		double start = cd.get_start_time();
+		double end = cd.get_end_time();
+		if (Animation::is_greater_approx(end, start)) {
+			cd.pos = Math::fposmod(cd.pos + p_delta * speed_scale * cd.speed_scale - start, end - start) + start;
+		}
+		return;
+	}
+
+	bool was_cache_valid = cache_valid;
+	AnimationMixer::_process_animation(p_delta, p_update_only);
+
+	// Evaluate whether the state left by this frame is a static pose that the
+	// following frames can hold without blending and applying again.
+	static_pose_applied = false;
+	if (p_update_only || !playing || is_stopping || !c.current.from || c.started || c.seeked || !c.blend.is_empty() || !capture_cache.animation.is_null()) {
+		return;
+	}
+	if (c.current.from->animation->get_loop_mode() != Animation::LOOP_LINEAR) {
+		// LOOP_NONE needs end detection and ping-pong flips the playback
+		// speed at the section bounds; neither is worth replicating here,
+		// and finished non-looping animations stop processing anyway.
+		return;
+	}
+	ObjectID anim_id = c.current.from->animation->get_instance_id();
+	if (!was_cache_valid || !static_eval_valid || static_eval_animation != anim_id) {
+		// Any track cache invalidation may mean the animation was edited.
+		static_eval_result = c.current.from->animation->is_static();
+		static_eval_animation = anim_id;
+		static_eval_valid = true;
+	}
+	static_pose_applied = static_eval_result;
+}
+
 bool AnimationPlayer::_blend_pre_process(double p_delta, int p_track_count, const AHashMap<NodePath, int> &p_track_map) {
 	if (!playback.current.from) {
 		_set_process(false);
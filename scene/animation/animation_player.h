@@ -64,6 +64,13 @@ private:
 
 	bool is_stopping = false;
 
+	// Dead-zone idle skipping: while the current animation is a held static
+	// pose, processing only advances the playback position.
+	bool static_pose_applied = false;
+	bool static_eval_valid = false;
+	bool static_eval_result = false;
+	ObjectID static_eval_animation;
+
 	struct PlaybackData {
 		AnimationData *from = nullptr;
 		double pos = 0.0;
@@ -149,6 +156,8 @@ protected:
 
 	static void _bind_methods();
 
+	virtual void _process_animation(double p_delta, bool p_update_only = false) override;
+
 	// Make animation instances.
 	virtual bool _blend_pre_process(double p_delta, int p_track_count, const AHashMap<NodePath, int> &p_track_map) override;
 	virtual void _blend_capture(double p_delta) override;
@@ -295,19 +295,28 @@ AnimationNode::NodeTimeInfo AnimationNode::_blend_node(Ref<AnimationNode> p_node
 		}
 	}
 
-	String new_path;
 	AnimationNode *new_parent;
+	StringName parent_path;
 
-	// This is the slowest part of processing, but as strings process in powers of 2, and the paths always exist, it will not result in that many allocations.
 	if (p_new_parent) {
 		new_parent = p_new_parent;
-		new_path = String(node_state.base_path) + String(p_subpath) + "/";
+		parent_path = node_state.base_path;
 	} else {
 		ERR_FAIL_NULL_V(node_state.parent, NodeTimeInfo());
 		new_parent = node_state.parent;
-		new_path = String(new_parent->node_state.base_path) + String(p_subpath) + "/";
+		parent_path = new_parent->node_state.base_path;
 	}
 
+	// Concatenating the path costs a String allocation and a global StringName table
+	// lookup, so the result is cached in the child node. As long as the graph topology
+	// doesn't change, this is two StringName comparisons per node per frame.
+	if (p_node->base_path_cache_parent_path != parent_path || p_node->base_path_cache_subpath != p_subpath) {
+		p_node->base_path_cache_parent_path = parent_path;
+		p_node->base_path_cache_subpath = p_subpath;
+		p_node->base_path_cache = StringName(String(parent_path) + String(p_subpath) + "/");
+	}
+	const StringName &new_path = p_node->base_path_cache;
+
 	// This process, which depends on p_sync is needed to process sync correctly in the case of
 	// that a synced AnimationNodeSync exists under the un-synced AnimationNodeSync.
 	p_node->set_node_state_base_path(new_path);
@@ -125,6 +125,13 @@ public:
 private:
 	mutable AHashMap<StringName, int> property_cache;
 
+	// Cache for the concatenated parameter base path assigned by _blend_node, keyed by
+	// the parent path and subpath it was derived from, so the string concatenation and
+	// StringName table lookup only happen when the node is re-parented or re-pathed.
+	StringName base_path_cache;
+	StringName base_path_cache_parent_path;
+	StringName base_path_cache_subpath;
+
 public:
 	void set_node_state_base_path(const StringName p_base_path) {
 		if (p_base_path != node_state.base_path) {
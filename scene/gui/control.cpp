@@ -3856,6 +3856,10 @@ void Control::_notification(int p_notification) {
 		case NOTIFICATION_ENTER_CANVAS: {
 			data.is_rtl_dirty = true;
 
+			for (CanvasItem *ci = this; ci; ci = ci->get_parent_item()) {
+				ci->control_count_in_subtree++;
+			}
+
 			CanvasItem *node = this;
 			bool has_parent_control = false;
 
@@ -3898,6 +3902,10 @@ void Control::_notification(int p_notification) {
 		} break;
 
 		case NOTIFICATION_EXIT_CANVAS: {
+			for (CanvasItem *ci = this; ci; ci = ci->get_parent_item()) {
+				ci->control_count_in_subtree--;
+			}
+
 			if (data.parent_canvas_item) {
 				data.parent_canvas_item->disconnect(SceneStringName(item_rect_changed), callable_mp(this, &Control::_size_changed));
 				data.parent_canvas_item = nullptr;
@@ -160,6 +160,12 @@ private:
 	void _notify_transform_deferred();
 	const StringName *_instance_shader_parameter_get_remap(const StringName &p_name) const;
 
+	// Number of Control nodes in this item's subtree (including itself), not
+	// crossing top_level boundaries. Maintained by Control on canvas
+	// enter/exit; lets GUI hit testing skip subtrees that cannot yield a hit.
+	int control_count_in_subtree = 0;
+	friend class Control;
+
 protected:
 	bool _set(const StringName &p_name, const Variant &p_value);
 	bool _get(const StringName &p_name, Variant &r_ret) const;
@@ -55,6 +55,9 @@ STATIC_ASSERT_INCOMPLETE_TYPE(class, Engine);
 SafeNumeric<uint64_t> Node::total_node_count{ 0 };
 #endif
 
+// Starts at 1 so that the default-initialized per-node cache version (0) never matches.
+SafeNumeric<uint64_t> Node::structure_version{ 1 };
+
 thread_local Node *Node::current_process_thread_group = nullptr;
 
 void Node::_notification(int p_notification) {
@@ -701,6 +704,8 @@ void Node::set_process_mode(ProcessMode p_mode) {
 
 	_propagate_process_owner(data.process_owner, pause_notification, enabled_notification);
 
+	data.tree->_process_state_changed();
+
 #ifdef TOOLS_ENABLED
 	// This is required for the editor to update the visibility of disabled nodes
 	// It's very expensive during runtime to change, so editor-only
@@ -1450,6 +1455,8 @@ void Node::set_name(const StringName &p_name) {
 		_acquire_unique_name_in_owner();
 	}
 
+	structure_version.increment();
+
 	propagate_notification(NOTIFICATION_PATH_RENAMED);
 
 	if (is_inside_tree()) {
@@ -1646,6 +1653,8 @@ Node::InternalMode Node::get_internal_mode() const {
 void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalMode p_internal_mode) {
 	//add a child node quickly, without name validation
 
+	structure_version.increment();
+
 	p_child->data.name = p_name;
 	data.children.insert(p_name, p_child);
 
@@ -1750,6 +1759,8 @@ void Node::remove_child(Node *p_child) {
 
 	data.blocked--;
 
+	structure_version.increment();
+
 	data.children_cache_dirty = true;
 	bool success = data.children.erase(p_child->data.name);
 	ERR_FAIL_COND_MSG(!success, "Children name does not match parent name in hashtable, this is a bug.");
@@ -1891,6 +1902,14 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 
 	ERR_FAIL_COND_V_MSG(!data.tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
 
+	// Repeated lookups of the same path (the common case for scripts calling
+	// get_node() every frame) are answered from a single-entry cache, which is
+	// invalidated by any structural change to any tree (see structure_version).
+	const uint64_t current_structure_version = structure_version.get();
+	if (data.resolution_cache_version == current_structure_version && data.resolution_cache_path == p_path) {
+		return data.resolution_cache_result;
+	}
+
 	Node *current = nullptr;
 	Node *root = nullptr;
 
@@ -1942,6 +1961,12 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 		current = next;
 	}
 
+	if (current) {
+		data.resolution_cache_path = p_path;
+		data.resolution_cache_result = current;
+		data.resolution_cache_version = current_structure_version;
+	}
+
 	return current;
 }
 
@@ -2200,6 +2225,8 @@ void Node::_set_owner_nocheck(Node *p_owner) {
 	data.owner->data.owned.push_back(this);
 	data.OW = data.owner->data.owned.back();
 
+	structure_version.increment();
+
 	owner_changed_notify();
 }
 
@@ -2211,6 +2238,7 @@ void Node::_release_unique_name_in_owner() {
 		return; // Ignore.
 	}
 	data.owner->data.owned_unique_nodes.erase(key);
+	structure_version.increment();
 }
 
 void Node::_acquire_unique_name_in_owner() {
@@ -2225,6 +2253,7 @@ void Node::_acquire_unique_name_in_owner() {
 		return;
 	}
 	data.owner->data.owned_unique_nodes[key] = this;
+	structure_version.increment();
 }
 
 void Node::set_unique_name_in_owner(bool p_enabled) {
@@ -2288,6 +2317,8 @@ void Node::_clean_up_owner() {
 	data.owner->data.owned.erase(data.OW);
 	data.owner = nullptr;
 	data.OW = nullptr;
+
+	structure_version.increment();
 }
 
 Node *Node::find_common_parent_with(const Node *p_node) const {
@@ -4102,6 +4133,9 @@ Node::Node() {
 }
 
 Node::~Node() {
+	// Any node may be held by another node's resolution cache; invalidate on destruction.
+	structure_version.increment();
+
 	data.grouped.clear();
 	data.owned.clear();
 	data.children.clear();
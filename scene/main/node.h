@@ -134,6 +134,10 @@ public:
 #ifdef DEBUG_ENABLED
 	static SafeNumeric<uint64_t> total_node_count;
 #endif
+	// Bumped on every change that can affect NodePath resolution (reparenting,
+	// renames, owner or unique name changes, node destruction). Used to
+	// invalidate the per-node get_node_or_null() resolution cache.
+	static SafeNumeric<uint64_t> structure_version;
 	enum {
 		UNIQUE_SCENE_ID_UNASSIGNED = 0
 	};
@@ -290,6 +294,12 @@ private:
 
 		mutable NodePath *path_cache = nullptr;
 
+		// Single-entry get_node_or_null() resolution cache, only valid while
+		// resolution_cache_version matches Node::structure_version.
+		mutable NodePath resolution_cache_path;
+		mutable Node *resolution_cache_result = nullptr;
+		mutable uint64_t resolution_cache_version = 0;
+
 	} data;
 
 	String _get_tree_string_pretty(const String &p_prefix, bool p_last);
@@ -175,6 +175,7 @@ SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_nod
 	ERR_FAIL_COND_V_MSG(E->value.nodes.has(p_node), &E->value, "Already in group: " + p_group + ".");
 	E->value.nodes.push_back(p_node);
 	E->value.changed = true;
+	group_membership_version++;
 	return &E->value;
 }
 
@@ -188,6 +189,7 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 	if (E->value.nodes.is_empty()) {
 		group_map.remove(E);
 	}
+	group_membership_version++;
 }
 
 void SceneTree::flush_transform_notifications() {
@@ -720,6 +722,8 @@ bool SceneTree::process(double p_time) {
 
 	flush_transform_notifications(); // Additional transforms after timers update.
 
+	_process_async_instantiations();
+
 	// This should happen last because any processing that deletes something beforehand might expect the object to be removed in the same frame.
 	_flush_delete_queue();
 
@@ -846,6 +850,14 @@ void SceneTree::finalize() {
 
 	_flush_ugc();
 
+	// Nodes already inside the tree are owned by it; only detached leftovers need freeing.
+	for (AsyncInstantiation &ai : async_instantiations) {
+		for (uint32_t i = ai.attached_count; i < ai.pending_children.size(); i++) {
+			memdelete(ai.pending_children[i]);
+		}
+	}
+	async_instantiations.clear();
+
 	if (root) {
 		root->_set_tree(nullptr);
 		root->_propagate_after_exit_tree();
@@ -1106,6 +1118,7 @@ void SceneTree::set_pause(bool p_enabled) {
 	}
 
 	paused = p_enabled;
+	process_state_version++;
 
 #ifndef PHYSICS_3D_DISABLED
 	PhysicsServer3D::get_singleton()->set_active(!p_enabled);
@@ -1130,6 +1143,7 @@ void SceneTree::set_suspend(bool p_enabled) {
 	}
 
 	suspended = p_enabled;
+	process_state_version++;
 
 	Engine::get_singleton()->set_freeze_time_scale(p_enabled);
 
@@ -1390,19 +1404,26 @@ void SceneTree::_add_node_to_process_group(Node *p_node, Node *p_owner) {
 	_THREAD_SAFE_METHOD_
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
+	// Nodes are typically added in tree order, so appending very often keeps the
+	// array sorted and the whole group only needs a re-sort when it doesn't.
+
 	if (p_node->is_processing() || p_node->is_processing_internal()) {
+		if (!pg->node_order_dirty && !pg->nodes.is_empty() && Node::ComparatorWithPriority()(p_node, pg->nodes[pg->nodes.size() - 1])) {
+			pg->node_order_dirty = true;
+		}
 		pg->nodes.push_back(p_node);
-		pg->node_order_dirty = true;
 	}
 
 	if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
+		if (!pg->physics_node_order_dirty && !pg->physics_nodes.is_empty() && Node::ComparatorWithPhysicsPriority()(p_node, pg->physics_nodes[pg->physics_nodes.size() - 1])) {
+			pg->physics_node_order_dirty = true;
+		}
 		pg->physics_nodes.push_back(p_node);
-		pg->physics_node_order_dirty = true;
 	}
 }
 
 void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_call_type, const Ref<InputEvent> &p_input, Viewport *p_viewport) {
-	Vector<Node *> nodes_copy;
+	LocalVector<ObjectID> node_ids;
 	{
 		_THREAD_SAFE_METHOD_
 
@@ -1415,34 +1436,38 @@ void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_cal
 			return;
 		}
 
-		_update_group_order(g);
-
-		//copy, so copy on write happens in case something is removed from process while being called
-		//performance is not lost because only if something is added/removed the vector is copied.
-		nodes_copy = g.nodes;
-	}
-
-	int gr_node_count = nodes_copy.size();
-	Node **gr_nodes = nodes_copy.ptrw();
-
-	{
-		_THREAD_SAFE_METHOD_
-		nodes_removed_on_group_call_lock++;
+		// Dispatch goes through a pre-filtered list so batches of high-rate
+		// events (e.g. 1000 Hz mice) don't re-sort and re-filter the group per
+		// event; it only needs rebuilding when membership or pause state changed.
+		InputDispatchCache &cache = input_dispatch_cache[p_group];
+		if (cache.group_version != group_membership_version || cache.process_version != process_state_version) {
+			_update_group_order(g);
+			cache.nodes.clear();
+			// Input calls happen in reverse group (scene) order.
+			for (int i = g.nodes.size() - 1; i >= 0; i--) {
+				Node *n = g.nodes[i];
+				if (!n->can_process()) {
+					continue;
+				}
+				cache.nodes.push_back(n->get_instance_id());
+			}
+			cache.group_version = group_membership_version;
+			cache.process_version = process_state_version;
+		}
+		// Copy, as handlers can push more input and rebuild the cache reentrantly.
+		node_ids = cache.nodes;
 	}
 
 	Vector<ObjectID> no_context_node_ids; // Nodes may be deleted due to this shortcut input.
 
-	for (int i = gr_node_count - 1; i >= 0; i--) {
+	for (const ObjectID &id : node_ids) {
 		if (p_viewport->is_input_handled()) {
 			break;
 		}
 
-		Node *n = gr_nodes[i];
-		if (nodes_removed_on_group_call.has(n)) {
-			continue;
-		}
-
-		if (!n->can_process()) {
+		// Resolving the ID also covers nodes deleted by a previous handler.
+		Node *n = ObjectDB::get_instance<Node>(id);
+		if (!n || !n->is_inside_tree() || !n->can_process()) {
 			continue;
 		}
 
@@ -1484,14 +1509,6 @@ void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_cal
 			n->_call_shortcut_input(p_input);
 		}
 	}
-
-	{
-		_THREAD_SAFE_METHOD_
-		nodes_removed_on_group_call_lock--;
-		if (nodes_removed_on_group_call_lock == 0) {
-			nodes_removed_on_group_call.clear();
-		}
-	}
 }
 
 void SceneTree::_call_group_flags(const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
@@ -1735,6 +1752,98 @@ void SceneTree::unload_current_scene() {
 	}
 }
 
+Error SceneTree::instantiate_async(const Ref<PackedScene> &p_scene, Node *p_parent, bool p_atomic) {
+	ERR_FAIL_COND_V_MSG(!Thread::is_main_thread(), ERR_UNAVAILABLE, "Async instantiation can only be requested from the main thread.");
+	ERR_FAIL_COND_V(p_scene.is_null(), ERR_INVALID_PARAMETER);
+	ERR_FAIL_NULL_V(p_parent, ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V_MSG(p_parent->get_tree() != this, ERR_INVALID_PARAMETER, "The parent node must be inside this scene tree.");
+
+	AsyncInstantiation ai;
+	ai.scene = p_scene;
+	ai.parent_id = p_parent->get_instance_id();
+	ai.atomic = p_atomic;
+	async_instantiations.push_back(ai);
+	return OK;
+}
+
+void SceneTree::set_async_instantiation_budget_msec(double p_budget_msec) {
+	ERR_FAIL_COND(p_budget_msec <= 0.0);
+	async_instantiation_budget_usec = uint64_t(p_budget_msec * 1000.0);
+}
+
+double SceneTree::get_async_instantiation_budget_msec() const {
+	return async_instantiation_budget_usec / 1000.0;
+}
+
+void SceneTree::_process_async_instantiations() {
+	if (async_instantiations.is_empty()) {
+		return;
+	}
+
+	uint64_t end_time = OS::get_singleton()->get_ticks_usec() + async_instantiation_budget_usec;
+
+	while (!async_instantiations.is_empty()) {
+		AsyncInstantiation &ai = async_instantiations.front()->get();
+
+		Node *parent = ObjectDB::get_instance<Node>(ai.parent_id);
+		Node *ai_root = ai.root_id.is_valid() ? ObjectDB::get_instance<Node>(ai.root_id) : nullptr;
+
+		if (!parent || !parent->is_inside_tree() || (ai.root_id.is_valid() && !ai_root)) {
+			// The target (or a partially entered instance) is gone; drop the request and
+			// anything already built that isn't owned by the tree.
+			for (uint32_t i = ai.attached_count; i < ai.pending_children.size(); i++) {
+				memdelete(ai.pending_children[i]);
+			}
+			if (ai_root && !ai_root->is_inside_tree()) {
+				memdelete(ai_root);
+			}
+			async_instantiations.pop_front();
+			continue;
+		}
+
+		if (!ai_root) {
+			ai_root = ai.scene->instantiate();
+			if (!ai_root) {
+				async_instantiations.pop_front();
+				continue;
+			}
+			ai.root_id = ai_root->get_instance_id();
+
+			if (!ai.atomic) {
+				// Detach the root's children so tree entry can be sliced one subtree at a
+				// time. Note that this makes the root ready before its sliced children.
+				int child_count = ai_root->get_child_count(false);
+				ai.pending_children.reserve(child_count);
+				for (int i = 0; i < child_count; i++) {
+					ai.pending_children.push_back(ai_root->get_child(i, false));
+				}
+				for (Node *child : ai.pending_children) {
+					ai_root->remove_child(child);
+				}
+			}
+
+			parent->add_child(ai_root);
+		}
+
+		while (ai.attached_count < ai.pending_children.size() && OS::get_singleton()->get_ticks_usec() < end_time) {
+			ai_root->add_child(ai.pending_children[ai.attached_count]);
+			ai.attached_count++;
+		}
+
+		if (ai.attached_count < ai.pending_children.size()) {
+			// Budget exhausted; continue next frame.
+			return;
+		}
+
+		emit_signal(SNAME("async_scene_instantiated"), ai.scene, ai_root);
+		async_instantiations.pop_front();
+
+		if (OS::get_singleton()->get_ticks_usec() >= end_time) {
+			return;
+		}
+	}
+}
+
 void SceneTree::add_current_scene(Node *p_current) {
 	ERR_FAIL_COND_MSG(!Thread::is_main_thread(), "Adding a current scene can only be done from the main thread.");
 	current_scene = p_current;
@@ -1936,6 +2045,10 @@ void SceneTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("reload_current_scene"), &SceneTree::reload_current_scene);
 	ClassDB::bind_method(D_METHOD("unload_current_scene"), &SceneTree::unload_current_scene);
 
+	ClassDB::bind_method(D_METHOD("instantiate_async", "scene", "parent", "atomic"), &SceneTree::instantiate_async, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("set_async_instantiation_budget_msec", "budget_msec"), &SceneTree::set_async_instantiation_budget_msec);
+	ClassDB::bind_method(D_METHOD("get_async_instantiation_budget_msec"), &SceneTree::get_async_instantiation_budget_msec);
+
 	ClassDB::bind_method(D_METHOD("set_multiplayer", "multiplayer", "root_path"), &SceneTree::set_multiplayer, DEFVAL(NodePath()));
 	ClassDB::bind_method(D_METHOD("get_multiplayer", "for_path"), &SceneTree::get_multiplayer, DEFVAL(NodePath()));
 	ClassDB::bind_method(D_METHOD("set_multiplayer_poll_enabled", "enabled"), &SceneTree::set_multiplayer_poll_enabled);
@@ -1959,6 +2072,7 @@ void SceneTree::_bind_methods() {
 	ADD_SIGNAL(MethodInfo("node_added", PropertyInfo(Variant::OBJECT, "node", PROPERTY_HINT_RESOURCE_TYPE, "Node")));
 	ADD_SIGNAL(MethodInfo("node_removed", PropertyInfo(Variant::OBJECT, "node", PROPERTY_HINT_RESOURCE_TYPE, "Node")));
 	ADD_SIGNAL(MethodInfo("node_renamed", PropertyInfo(Variant::OBJECT, "node", PROPERTY_HINT_RESOURCE_TYPE, "Node")));
+	ADD_SIGNAL(MethodInfo("async_scene_instantiated", PropertyInfo(Variant::OBJECT, "scene", PROPERTY_HINT_RESOURCE_TYPE, "PackedScene"), PropertyInfo(Variant::OBJECT, "node", PROPERTY_HINT_RESOURCE_TYPE, "Node")));
 	ADD_SIGNAL(MethodInfo("node_configuration_warning_changed", PropertyInfo(Variant::OBJECT, "node", PROPERTY_HINT_RESOURCE_TYPE, "Node")));
 
 	ADD_SIGNAL(MethodInfo("process_frame"));
@@ -147,6 +147,20 @@ private:
 	HashMap<StringName, Group> group_map;
 	bool _quit = false;
 
+	// Pre-filtered dispatch lists for the input call groups, so batches of
+	// high-rate events don't re-sort and re-filter the group per event. Rebuilt
+	// whenever group membership or pause/process-mode state changes.
+	struct InputDispatchCache {
+		uint64_t group_version = 0;
+		uint64_t process_version = 0;
+		LocalVector<ObjectID> nodes; // In call order (reverse group order), processable nodes only.
+	};
+	HashMap<StringName, InputDispatchCache> input_dispatch_cache;
+	uint64_t group_membership_version = 1;
+	uint64_t process_state_version = 1;
+
+	_FORCE_INLINE_ void _process_state_changed() { process_state_version++; } // Called by Node on process-mode changes.
+
 	// Static so we can get directly instead of via SceneTree pointer.
 	static bool _physics_interpolation_enabled;
 
@@ -214,6 +228,21 @@ private:
 
 	void _flush_scene_change();
 
+	// Time-sliced scene instantiation, so large spawns don't hitch a single frame.
+	struct AsyncInstantiation {
+		Ref<PackedScene> scene;
+		ObjectID parent_id;
+		ObjectID root_id;
+		// The root's children, detached so tree entry can be sliced one subtree at a time.
+		LocalVector<Node *> pending_children;
+		uint32_t attached_count = 0;
+		bool atomic = false;
+	};
+	List<AsyncInstantiation> async_instantiations;
+	uint64_t async_instantiation_budget_usec = 2000;
+
+	void _process_async_instantiations();
+
 	List<Ref<SceneTreeTimer>> timers;
 	List<Ref<Tween>> tweens;
 
@@ -428,6 +457,10 @@ public:
 	Error reload_current_scene();
 	void unload_current_scene();
 
+	Error instantiate_async(const Ref<PackedScene> &p_scene, Node *p_parent, bool p_atomic = false);
+	void set_async_instantiation_budget_msec(double p_budget_msec);
+	double get_async_instantiation_budget_msec() const;
+
 	Ref<SceneTreeTimer> create_timer(double p_delay_sec, bool p_process_always = true, bool p_process_in_physics = false, bool p_ignore_time_scale = false);
 	Ref<Tween> create_tween();
 	void remove_tween(const Ref<Tween> &p_tween);
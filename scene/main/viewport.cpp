@@ -1825,12 +1825,20 @@ Control *Viewport::_gui_find_control_at_pos(CanvasItem *p_node, const Point2 &p_
 
 	Control *c = Object::cast_to<Control>(p_node);
 
-	if (!c || !c->is_clipping_contents() || c->has_point(matrix.affine_inverse().xform(p_global))) {
+	Point2 local_point;
+	if (c) {
+		local_point = matrix.affine_inverse().xform(p_global);
+	}
+
+	if (!c || !c->is_clipping_contents() || c->has_point(local_point)) {
 		for (int i = p_node->get_child_count() - 1; i >= 0; i--) {
 			CanvasItem *ci = Object::cast_to<CanvasItem>(p_node->get_child(i));
 			if (!ci || ci->is_set_as_top_level()) {
 				continue;
 			}
+			if (ci->control_count_in_subtree == 0) {
+				continue; // No controls under this item, nothing to hit.
+			}
 
 			Control *ret = _gui_find_control_at_pos(ci, p_global, matrix);
 			if (ret) {
@@ -1843,8 +1851,7 @@ Control *Viewport::_gui_find_control_at_pos(CanvasItem *p_node, const Point2 &p_
 		return nullptr;
 	}
 
-	matrix.affine_invert();
-	if (!c->has_point(matrix.xform(p_global))) {
+	if (!c->has_point(local_point)) {
 		return nullptr;
 	}
 
@@ -32,6 +32,7 @@
 
 #include "core/io/marshalls.h"
 #include "core/math/random_pcg.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/resources/surface_tool.h"
 
 #ifndef PHYSICS_3D_DISABLED
@@ -294,124 +295,128 @@ void ImporterMesh::generate_lods(float p_normal_merge_angle, Array p_bone_transf
 		return;
 	}
 
-	LocalVector<Transform3D> bone_transform_vector;
+	SurfaceLodData lod_data;
+	lod_data.normal_merge_threshold = Math::cos(Math::deg_to_rad(p_normal_merge_angle));
 	for (int i = 0; i < p_bone_transform_array.size(); i++) {
 		ERR_FAIL_COND(p_bone_transform_array[i].get_type() != Variant::TRANSFORM3D);
-		bone_transform_vector.push_back(p_bone_transform_array[i]);
+		lod_data.bone_transform_vector.push_back(p_bone_transform_array[i]);
 	}
 
-	for (int i = 0; i < surfaces.size(); i++) {
-		if (surfaces[i].primitive != Mesh::PRIMITIVE_TRIANGLES) {
-			continue;
-		}
+	// Each surface simplifies independently, so spread them over the worker pool.
+	surfaces.ptrw(); // Make the surface vector unique ahead of the concurrent writes.
+	if (surfaces.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ImporterMesh::_generate_surface_lods, (const SurfaceLodData *)&lod_data, surfaces.size(), -1, false, SNAME("ImporterMeshGenerateLODs"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (surfaces.size() == 1) {
+		_generate_surface_lods(0, &lod_data);
+	}
+}
 
-		surfaces.write[i].lods.clear();
-		Vector<Vector3> vertices = surfaces[i].arrays[RS::ARRAY_VERTEX];
-		PackedInt32Array indices = surfaces[i].arrays[RS::ARRAY_INDEX];
-		Vector<Vector3> normals = surfaces[i].arrays[RS::ARRAY_NORMAL];
-		Vector<float> tangents = surfaces[i].arrays[RS::ARRAY_TANGENT];
-		Vector<Vector2> uvs = surfaces[i].arrays[RS::ARRAY_TEX_UV];
-		Vector<Vector2> uv2s = surfaces[i].arrays[RS::ARRAY_TEX_UV2];
-		Vector<int> bones = surfaces[i].arrays[RS::ARRAY_BONES];
-		Vector<float> weights = surfaces[i].arrays[RS::ARRAY_WEIGHTS];
-		Vector<Color> colors = surfaces[i].arrays[RS::ARRAY_COLOR];
+void ImporterMesh::_generate_surface_lods(uint32_t p_surface, const SurfaceLodData *p_lod_data) {
+	const int i = p_surface;
+	const LocalVector<Transform3D> &bone_transform_vector = p_lod_data->bone_transform_vector;
 
-		unsigned int index_count = indices.size();
-		unsigned int vertex_count = vertices.size();
+	if (surfaces[i].primitive != Mesh::PRIMITIVE_TRIANGLES) {
+		return;
+	}
 
-		if (index_count == 0) {
-			continue; //no lods if no indices
-		}
-		ERR_FAIL_COND_MSG(index_count % 3 != 0, "ImporterMesh::generate_lods: Indexed triangle meshes MUST have an index array with a size that is a multiple of 3, but got " + itos(index_count) + " indices. Cannot generate LODs for this invalid mesh.");
-
-		const Vector3 *vertices_ptr = vertices.ptr();
-		const int *indices_ptr = indices.ptr();
-
-		if (normals.is_empty()) {
-			normals.resize(index_count);
-			Vector3 *n_ptr = normals.ptrw();
-			for (unsigned int j = 0; j < index_count; j += 3) {
-				const Vector3 &v0 = vertices_ptr[indices_ptr[j + 0]];
-				const Vector3 &v1 = vertices_ptr[indices_ptr[j + 1]];
-				const Vector3 &v2 = vertices_ptr[indices_ptr[j + 2]];
-				Vector3 n = vec3_cross(v0 - v2, v0 - v1).normalized();
-				n_ptr[j + 0] = n;
-				n_ptr[j + 1] = n;
-				n_ptr[j + 2] = n;
-			}
+	surfaces.write[i].lods.clear();
+	Vector<Vector3> vertices = surfaces[i].arrays[RS::ARRAY_VERTEX];
+	PackedInt32Array indices = surfaces[i].arrays[RS::ARRAY_INDEX];
+	Vector<Vector3> normals = surfaces[i].arrays[RS::ARRAY_NORMAL];
+	Vector<float> tangents = surfaces[i].arrays[RS::ARRAY_TANGENT];
+	Vector<Vector2> uvs = surfaces[i].arrays[RS::ARRAY_TEX_UV];
+	Vector<Vector2> uv2s = surfaces[i].arrays[RS::ARRAY_TEX_UV2];
+	Vector<int> bones = surfaces[i].arrays[RS::ARRAY_BONES];
+	Vector<float> weights = surfaces[i].arrays[RS::ARRAY_WEIGHTS];
+	Vector<Color> colors = surfaces[i].arrays[RS::ARRAY_COLOR];
+
+	unsigned int index_count = indices.size();
+	unsigned int vertex_count = vertices.size();
+
+	if (index_count == 0) {
+		return; //no lods if no indices
+	}
+	ERR_FAIL_COND_MSG(index_count % 3 != 0, "ImporterMesh::generate_lods: Indexed triangle meshes MUST have an index array with a size that is a multiple of 3, but got " + itos(index_count) + " indices. Cannot generate LODs for this invalid mesh.");
+
+	const Vector3 *vertices_ptr = vertices.ptr();
+	const int *indices_ptr = indices.ptr();
+
+	if (normals.is_empty()) {
+		normals.resize(index_count);
+		Vector3 *n_ptr = normals.ptrw();
+		for (unsigned int j = 0; j < index_count; j += 3) {
+			const Vector3 &v0 = vertices_ptr[indices_ptr[j + 0]];
+			const Vector3 &v1 = vertices_ptr[indices_ptr[j + 1]];
+			const Vector3 &v2 = vertices_ptr[indices_ptr[j + 2]];
+			Vector3 n = vec3_cross(v0 - v2, v0 - v1).normalized();
+			n_ptr[j + 0] = n;
+			n_ptr[j + 1] = n;
+			n_ptr[j + 2] = n;
 		}
+	}
 
-		bool deformable = bones.size() > 0 || blend_shapes.size() > 0;
-
-		if (bones.size() > 0 && weights.size() && bone_transform_vector.size() > 0) {
-			Vector3 *vertices_ptrw = vertices.ptrw();
+	bool deformable = bones.size() > 0 || blend_shapes.size() > 0;
 
-			// Apply bone transforms to regular surface.
-			unsigned int bone_weight_length = surfaces[i].flags & Mesh::ARRAY_FLAG_USE_8_BONE_WEIGHTS ? 8 : 4;
+	if (bones.size() > 0 && weights.size() && bone_transform_vector.size() > 0) {
+		Vector3 *vertices_ptrw = vertices.ptrw();
 
-			const int *bo = bones.ptr();
-			const float *we = weights.ptr();
+		// Apply bone transforms to regular surface.
+		unsigned int bone_weight_length = surfaces[i].flags & Mesh::ARRAY_FLAG_USE_8_BONE_WEIGHTS ? 8 : 4;
 
-			for (unsigned int j = 0; j < vertex_count; j++) {
-				VERTEX_SKIN_FUNC(bone_weight_length, j, vertices_ptr, vertices_ptrw, bone_transform_vector, bo, we)
-			}
+		const int *bo = bones.ptr();
+		const float *we = weights.ptr();
 
-			vertices_ptr = vertices.ptr();
+		for (unsigned int j = 0; j < vertex_count; j++) {
+			VERTEX_SKIN_FUNC(bone_weight_length, j, vertices_ptr, vertices_ptrw, bone_transform_vector, bo, we)
 		}
 
-		float normal_merge_threshold = Math::cos(Math::deg_to_rad(p_normal_merge_angle));
-		const Vector3 *normals_ptr = normals.ptr();
-
-		HashMap<Vector3, LocalVector<Pair<int, int>>> unique_vertices;
-
-		LocalVector<int> vertex_remap;
-		LocalVector<int> vertex_inverse_remap;
-		LocalVector<Vector3> merged_vertices;
-		LocalVector<Vector3> merged_normals;
-		LocalVector<int> merged_normals_counts;
-		const Vector2 *uvs_ptr = uvs.ptr();
-		const Vector2 *uv2s_ptr = uv2s.ptr();
-		const float *tangents_ptr = tangents.ptr();
-		const Color *colors_ptr = colors.ptr();
+		vertices_ptr = vertices.ptr();
+	}
 
-		for (unsigned int j = 0; j < vertex_count; j++) {
-			const Vector3 &v = vertices_ptr[j];
-			const Vector3 &n = normals_ptr[j];
-
-			HashMap<Vector3, LocalVector<Pair<int, int>>>::Iterator E = unique_vertices.find(v);
-
-			if (E) {
-				const LocalVector<Pair<int, int>> &close_verts = E->value;
-
-				bool found = false;
-				for (const Pair<int, int> &idx : close_verts) {
-					bool is_uvs_close = (!uvs_ptr || uvs_ptr[j].distance_squared_to(uvs_ptr[idx.second]) < CMP_EPSILON2);
-					bool is_uv2s_close = (!uv2s_ptr || uv2s_ptr[j].distance_squared_to(uv2s_ptr[idx.second]) < CMP_EPSILON2);
-					bool is_tang_aligned = !tangents_ptr || (tangents_ptr[j * 4 + 3] < 0) == (tangents_ptr[idx.second * 4 + 3] < 0);
-					ERR_FAIL_INDEX(idx.second, normals.size());
-					bool is_normals_close = normals[idx.second].dot(n) > normal_merge_threshold;
-					bool is_col_close = (!colors_ptr || colors_ptr[j].is_equal_approx(colors_ptr[idx.second]));
-					if (is_uvs_close && is_uv2s_close && is_normals_close && is_tang_aligned && is_col_close) {
-						vertex_remap.push_back(idx.first);
-						merged_normals[idx.first] += normals[idx.second];
-						merged_normals_counts[idx.first]++;
-						found = true;
-						break;
-					}
+	float normal_merge_threshold = p_lod_data->normal_merge_threshold;
+	const Vector3 *normals_ptr = normals.ptr();
+
+	HashMap<Vector3, LocalVector<Pair<int, int>>> unique_vertices;
+
+	LocalVector<int> vertex_remap;
+	LocalVector<int> vertex_inverse_remap;
+	LocalVector<Vector3> merged_vertices;
+	LocalVector<Vector3> merged_normals;
+	LocalVector<int> merged_normals_counts;
+	const Vector2 *uvs_ptr = uvs.ptr();
+	const Vector2 *uv2s_ptr = uv2s.ptr();
+	const float *tangents_ptr = tangents.ptr();
+	const Color *colors_ptr = colors.ptr();
+
+	for (unsigned int j = 0; j < vertex_count; j++) {
+		const Vector3 &v = vertices_ptr[j];
+		const Vector3 &n = normals_ptr[j];
+
+		HashMap<Vector3, LocalVector<Pair<int, int>>>::Iterator E = unique_vertices.find(v);
+
+		if (E) {
+			const LocalVector<Pair<int, int>> &close_verts = E->value;
+
+			bool found = false;
+			for (const Pair<int, int> &idx : close_verts) {
+				bool is_uvs_close = (!uvs_ptr || uvs_ptr[j].distance_squared_to(uvs_ptr[idx.second]) < CMP_EPSILON2);
+				bool is_uv2s_close = (!uv2s_ptr || uv2s_ptr[j].distance_squared_to(uv2s_ptr[idx.second]) < CMP_EPSILON2);
+				bool is_tang_aligned = !tangents_ptr || (tangents_ptr[j * 4 + 3] < 0) == (tangents_ptr[idx.second * 4 + 3] < 0);
+				ERR_FAIL_INDEX(idx.second, normals.size());
+				bool is_normals_close = normals[idx.second].dot(n) > normal_merge_threshold;
+				bool is_col_close = (!colors_ptr || colors_ptr[j].is_equal_approx(colors_ptr[idx.second]));
+				if (is_uvs_close && is_uv2s_close && is_normals_close && is_tang_aligned && is_col_close) {
+					vertex_remap.push_back(idx.first);
+					merged_normals[idx.first] += normals[idx.second];
+					merged_normals_counts[idx.first]++;
+					found = true;
+					break;
 				}
+			}
 
-				if (!found) {
-					int vcount = merged_vertices.size();
-					unique_vertices[v].push_back(Pair<int, int>(vcount, j));
-					vertex_inverse_remap.push_back(j);
-					merged_vertices.push_back(v);
-					vertex_remap.push_back(vcount);
-					merged_normals.push_back(normals_ptr[j]);
-					merged_normals_counts.push_back(1);
-				}
-			} else {
+			if (!found) {
 				int vcount = merged_vertices.size();
-				unique_vertices[v] = LocalVector<Pair<int, int>>();
 				unique_vertices[v].push_back(Pair<int, int>(vcount, j));
 				vertex_inverse_remap.push_back(j);
 				merged_vertices.push_back(v);
@@ -419,151 +424,160 @@ void ImporterMesh::generate_lods(float p_normal_merge_angle, Array p_bone_transf
 				merged_normals.push_back(normals_ptr[j]);
 				merged_normals_counts.push_back(1);
 			}
+		} else {
+			int vcount = merged_vertices.size();
+			unique_vertices[v] = LocalVector<Pair<int, int>>();
+			unique_vertices[v].push_back(Pair<int, int>(vcount, j));
+			vertex_inverse_remap.push_back(j);
+			merged_vertices.push_back(v);
+			vertex_remap.push_back(vcount);
+			merged_normals.push_back(normals_ptr[j]);
+			merged_normals_counts.push_back(1);
 		}
+	}
 
-		LocalVector<int> merged_indices;
-		merged_indices.resize(index_count);
-		for (unsigned int j = 0; j < index_count; j++) {
-			merged_indices[j] = vertex_remap[indices[j]];
-		}
+	LocalVector<int> merged_indices;
+	merged_indices.resize(index_count);
+	for (unsigned int j = 0; j < index_count; j++) {
+		merged_indices[j] = vertex_remap[indices[j]];
+	}
 
-		unsigned int merged_vertex_count = merged_vertices.size();
-		const Vector3 *merged_vertices_ptr = merged_vertices.ptr();
-		Vector3 *merged_normals_ptr = merged_normals.ptr();
+	unsigned int merged_vertex_count = merged_vertices.size();
+	const Vector3 *merged_vertices_ptr = merged_vertices.ptr();
+	Vector3 *merged_normals_ptr = merged_normals.ptr();
 
-		{
-			const int *counts_ptr = merged_normals_counts.ptr();
-			for (unsigned int j = 0; j < merged_vertex_count; j++) {
-				merged_normals_ptr[j] /= counts_ptr[j];
-			}
+	{
+		const int *counts_ptr = merged_normals_counts.ptr();
+		for (unsigned int j = 0; j < merged_vertex_count; j++) {
+			merged_normals_ptr[j] /= counts_ptr[j];
 		}
+	}
 
-		Vector<float> merged_vertices_f32 = vector3_to_float32_array(merged_vertices_ptr, merged_vertex_count);
-		float scale = SurfaceTool::simplify_scale_func(merged_vertices_f32.ptr(), merged_vertex_count, sizeof(float) * 3);
+	Vector<float> merged_vertices_f32 = vector3_to_float32_array(merged_vertices_ptr, merged_vertex_count);
+	float scale = SurfaceTool::simplify_scale_func(merged_vertices_f32.ptr(), merged_vertex_count, sizeof(float) * 3);
 
-		const size_t attrib_count = 6; // 3 for normal + 3 for color (if present)
+	const size_t attrib_count = 6; // 3 for normal + 3 for color (if present)
 
-		float attrib_weights[attrib_count] = {};
+	float attrib_weights[attrib_count] = {};
 
-		// Give some weight to normal preservation
-		attrib_weights[0] = attrib_weights[1] = attrib_weights[2] = 1.0f;
+	// Give some weight to normal preservation
+	attrib_weights[0] = attrib_weights[1] = attrib_weights[2] = 1.0f;
 
-		// Give some weight to colors but only if present to avoid redundant computations during simplification
-		if (colors_ptr) {
-			attrib_weights[3] = attrib_weights[4] = attrib_weights[5] = 1.0f;
-		}
+	// Give some weight to colors but only if present to avoid redundant computations during simplification
+	if (colors_ptr) {
+		attrib_weights[3] = attrib_weights[4] = attrib_weights[5] = 1.0f;
+	}
 
-		LocalVector<float> merged_attribs;
-		merged_attribs.resize(merged_vertex_count * attrib_count);
-		float *merged_attribs_ptr = merged_attribs.ptr();
+	LocalVector<float> merged_attribs;
+	merged_attribs.resize(merged_vertex_count * attrib_count);
+	float *merged_attribs_ptr = merged_attribs.ptr();
 
-		memset(merged_attribs_ptr, 0, merged_attribs.size() * sizeof(float));
+	memset(merged_attribs_ptr, 0, merged_attribs.size() * sizeof(float));
 
-		for (unsigned int j = 0; j < merged_vertex_count; ++j) {
-			merged_attribs_ptr[j * attrib_count + 0] = merged_normals_ptr[j].x;
-			merged_attribs_ptr[j * attrib_count + 1] = merged_normals_ptr[j].y;
-			merged_attribs_ptr[j * attrib_count + 2] = merged_normals_ptr[j].z;
+	for (unsigned int j = 0; j < merged_vertex_count; ++j) {
+		merged_attribs_ptr[j * attrib_count + 0] = merged_normals_ptr[j].x;
+		merged_attribs_ptr[j * attrib_count + 1] = merged_normals_ptr[j].y;
+		merged_attribs_ptr[j * attrib_count + 2] = merged_normals_ptr[j].z;
 
-			if (colors_ptr) {
-				unsigned int rj = vertex_inverse_remap[j];
+		if (colors_ptr) {
+			unsigned int rj = vertex_inverse_remap[j];
 
-				merged_attribs_ptr[j * attrib_count + 3] = colors_ptr[rj].r;
-				merged_attribs_ptr[j * attrib_count + 4] = colors_ptr[rj].g;
-				merged_attribs_ptr[j * attrib_count + 5] = colors_ptr[rj].b;
-			}
+			merged_attribs_ptr[j * attrib_count + 3] = colors_ptr[rj].r;
+			merged_attribs_ptr[j * attrib_count + 4] = colors_ptr[rj].g;
+			merged_attribs_ptr[j * attrib_count + 5] = colors_ptr[rj].b;
 		}
+	}
 
-		print_verbose("LOD Generation: Triangles " + itos(index_count / 3) + ", vertices " + itos(vertex_count) + " (merged " + itos(merged_vertex_count) + ")" + (deformable ? ", deformable" : ""));
+	print_verbose("LOD Generation: Triangles " + itos(index_count / 3) + ", vertices " + itos(vertex_count) + " (merged " + itos(merged_vertex_count) + ")" + (deformable ? ", deformable" : ""));
 
-		const float max_mesh_error = 1.0f; // We only need LODs that can be selected by error threshold.
-		const unsigned min_target_indices = 12;
+	const float max_mesh_error = 1.0f; // We only need LODs that can be selected by error threshold.
+	const unsigned min_target_indices = 12;
 
-		LocalVector<int> current_indices = merged_indices;
-		float current_error = 0.0f;
-		bool allow_prune = true;
+	LocalVector<int> current_indices = merged_indices;
+	float current_error = 0.0f;
+	bool allow_prune = true;
 
-		while (current_indices.size() > min_target_indices * 2) {
-			unsigned int current_index_count = current_indices.size();
-			unsigned int target_index_count = MAX(((current_index_count / 3) / 2) * 3, min_target_indices);
+	while (current_indices.size() > min_target_indices * 2) {
+		unsigned int current_index_count = current_indices.size();
+		unsigned int target_index_count = MAX(((current_index_count / 3) / 2) * 3, min_target_indices);
 
-			PackedInt32Array new_indices;
-			new_indices.resize(current_index_count);
+		PackedInt32Array new_indices;
+		new_indices.resize(current_index_count);
 
-			int simplify_options = SurfaceTool::SIMPLIFY_SPARSE; // Does not change appearance, but speeds up subsequent iterations.
+		int simplify_options = SurfaceTool::SIMPLIFY_SPARSE; // Does not change appearance, but speeds up subsequent iterations.
 
-			// Lock geometric boundary in case the mesh is composed of multiple material subsets.
-			simplify_options |= SurfaceTool::SIMPLIFY_LOCK_BORDER;
+		// Lock geometric boundary in case the mesh is composed of multiple material subsets.
+		simplify_options |= SurfaceTool::SIMPLIFY_LOCK_BORDER;
 
-			if (allow_prune) {
-				// Remove small disconnected components.
-				simplify_options |= SurfaceTool::SIMPLIFY_PRUNE;
-			}
+		if (allow_prune) {
+			// Remove small disconnected components.
+			simplify_options |= SurfaceTool::SIMPLIFY_PRUNE;
+		}
 
-			if (deformable) {
-				// Improves appearance of deformable objects after deformation by using more regular tessellation.
-				simplify_options |= SurfaceTool::SIMPLIFY_REGULARIZE;
-			}
+		if (deformable) {
+			// Improves appearance of deformable objects after deformation by using more regular tessellation.
+			simplify_options |= SurfaceTool::SIMPLIFY_REGULARIZE;
+		}
 
-			float step_error = 0.0f;
-			size_t new_index_count = SurfaceTool::simplify_with_attrib_func(
-					(unsigned int *)new_indices.ptrw(),
-					(const uint32_t *)current_indices.ptr(), current_index_count,
-					merged_vertices_f32.ptr(), merged_vertex_count,
-					sizeof(float) * 3, // Vertex stride
-					merged_attribs_ptr,
-					sizeof(float) * attrib_count, // Attribute stride
-					attrib_weights, attrib_count,
-					nullptr, // Vertex lock
-					target_index_count,
-					max_mesh_error,
-					simplify_options,
-					&step_error);
-
-			if (new_index_count == 0 && allow_prune) {
-				// If the best result the simplifier could arrive at with pruning enabled is 0 triangles, there might still be an opportunity
-				// to reduce the number of triangles further *without* completely decimating the mesh. It will be impossible to reach the target
-				// this way - if the target was reachable without going down to 0, the simplifier would have done it! - but we might still be able
-				// to get one more slightly lower level if we retry without pruning.
-				allow_prune = false;
-				continue;
-			}
+		float step_error = 0.0f;
+		size_t new_index_count = SurfaceTool::simplify_with_attrib_func(
+				(unsigned int *)new_indices.ptrw(),
+				(const uint32_t *)current_indices.ptr(), current_index_count,
+				merged_vertices_f32.ptr(), merged_vertex_count,
+				sizeof(float) * 3, // Vertex stride
+				merged_attribs_ptr,
+				sizeof(float) * attrib_count, // Attribute stride
+				attrib_weights, attrib_count,
+				nullptr, // Vertex lock
+				target_index_count,
+				max_mesh_error,
+				simplify_options,
+				&step_error);
+
+		if (new_index_count == 0 && allow_prune) {
+			// If the best result the simplifier could arrive at with pruning enabled is 0 triangles, there might still be an opportunity
+			// to reduce the number of triangles further *without* completely decimating the mesh. It will be impossible to reach the target
+			// this way - if the target was reachable without going down to 0, the simplifier would have done it! - but we might still be able
+			// to get one more slightly lower level if we retry without pruning.
+			allow_prune = false;
+			continue;
+		}
 
-			// Accumulate error over iterations. Usually, it's correct to use step_error as is; however, on coarse LODs, we may start
-			// getting *smaller* relative error compared to the previous LOD. To make sure the error is monotonic and strictly increasing,
-			// and to limit the switching (pop) distance, we ensure the error grows by an arbitrary factor each iteration.
-			current_error = MAX(current_error * 1.5f, step_error);
+		// Accumulate error over iterations. Usually, it's correct to use step_error as is; however, on coarse LODs, we may start
+		// getting *smaller* relative error compared to the previous LOD. To make sure the error is monotonic and strictly increasing,
+		// and to limit the switching (pop) distance, we ensure the error grows by an arbitrary factor each iteration.
+		current_error = MAX(current_error * 1.5f, step_error);
 
-			new_indices.resize(new_index_count);
-			current_indices = new_indices;
+		new_indices.resize(new_index_count);
+		current_indices = new_indices;
 
-			if (new_index_count == 0 || (new_index_count >= current_index_count * 0.75f)) {
-				print_verbose("  LOD stop: got " + itos(new_index_count / 3) + " triangles when asking for " + itos(target_index_count / 3));
-				break;
-			}
+		if (new_index_count == 0 || (new_index_count >= current_index_count * 0.75f)) {
+			print_verbose("  LOD stop: got " + itos(new_index_count / 3) + " triangles when asking for " + itos(target_index_count / 3));
+			break;
+		}
 
-			if (current_error > max_mesh_error) {
-				print_verbose("  LOD stop: reached " + rtos(current_error) + " cumulative error (step error " + rtos(step_error) + ")");
-				break;
-			}
+		if (current_error > max_mesh_error) {
+			print_verbose("  LOD stop: reached " + rtos(current_error) + " cumulative error (step error " + rtos(step_error) + ")");
+			break;
+		}
 
-			// We need to remap the LOD indices back to the original vertex array; note that we already copied new_indices into current_indices for subsequent iteration.
-			{
-				int *ptrw = new_indices.ptrw();
-				for (unsigned int j = 0; j < new_index_count; j++) {
-					ptrw[j] = vertex_inverse_remap[ptrw[j]];
-				}
+		// We need to remap the LOD indices back to the original vertex array; note that we already copied new_indices into current_indices for subsequent iteration.
+		{
+			int *ptrw = new_indices.ptrw();
+			for (unsigned int j = 0; j < new_index_count; j++) {
+				ptrw[j] = vertex_inverse_remap[ptrw[j]];
 			}
-
-			Surface::LOD lod;
-			lod.distance = MAX(current_error * scale, CMP_EPSILON2);
-			lod.indices = new_indices;
-			surfaces.write[i].lods.push_back(lod);
-
-			print_verbose("  LOD " + itos(surfaces.write[i].lods.size()) + ": " + itos(new_index_count / 3) + " triangles, error " + rtos(current_error) + " (step error " + rtos(step_error) + ")");
 		}
 
-		surfaces.write[i].lods.sort_custom<Surface::LODComparator>();
+		Surface::LOD lod;
+		lod.distance = MAX(current_error * scale, CMP_EPSILON2);
+		lod.indices = new_indices;
+		surfaces.write[i].lods.push_back(lod);
+
+		print_verbose("  LOD " + itos(surfaces.write[i].lods.size()) + ": " + itos(new_index_count / 3) + " triangles, error " + rtos(current_error) + " (step error " + rtos(step_error) + ")");
 	}
+
+	surfaces.write[i].lods.sort_custom<Surface::LODComparator>();
 }
 
 void ImporterMesh::_generate_lods_bind(float p_normal_merge_angle, float p_normal_split_angle, Array p_skin_pose_transform_array) {
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/templates/local_vector.h"
 #include "scene/resources/mesh.h"
 #include "scene/resources/navigation_mesh.h"
 
@@ -78,6 +79,13 @@ class ImporterMesh : public Resource {
 
 	Size2i lightmap_size_hint;
 
+	struct SurfaceLodData {
+		LocalVector<Transform3D> bone_transform_vector;
+		float normal_merge_threshold = 0.0f;
+	};
+
+	void _generate_surface_lods(uint32_t p_surface, const SurfaceLodData *p_lod_data);
+
 protected:
 	void _set_data(const Dictionary &p_data);
 	Dictionary _get_data() const;
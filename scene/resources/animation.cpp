@@ -2247,6 +2247,37 @@ bool Animation::track_is_compressed(int p_track) const {
 	}
 }
 
+bool Animation::is_static() const {
+	// True when sampling can never change any output over time: every track
+	// holds at most one key and no track has time-dependent side effects.
+	for (uint32_t i = 0; i < tracks.size(); i++) {
+		int key_count = track_get_key_count(i);
+		if (key_count == 0) {
+			continue;
+		}
+		if (key_count > 1) {
+			return false;
+		}
+		switch (tracks[i]->type) {
+			case TYPE_METHOD:
+			case TYPE_AUDIO:
+			case TYPE_ANIMATION: {
+				// Keys fire when crossed, so any key makes these time dependent.
+				return false;
+			} break;
+			case TYPE_VALUE: {
+				if (static_cast<const ValueTrack *>(tracks[i])->update_mode == UPDATE_CAPTURE) {
+					// Capture interpolates from the captured value over time.
+					return false;
+				}
+			} break;
+			default: {
+			} break;
+		}
+	}
+	return true;
+}
+
 void Animation::track_set_key_value(int p_track, int p_key_idx, const Variant &p_value) {
 	ERR_FAIL_UNSIGNED_INDEX((uint32_t)p_track, tracks.size());
 	Track *t = tracks[p_track];
@@ -5350,12 +5381,21 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 
 	double frame_to_sec = 1.0 / double(compression.fps);
 
+	// Pages are sorted by time offset, binary search the page containing p_time
+	// instead of walking the whole page list on every sample.
 	int32_t page_index = -1;
-	for (uint32_t i = 0; i < compression.pages.size(); i++) {
-		if (compression.pages[i].time_offset > p_time) {
-			break;
+	{
+		int32_t low = 0;
+		int32_t high = (int32_t)compression.pages.size() - 1;
+		while (low <= high) {
+			int32_t middle = (low + high) / 2;
+			if (compression.pages[middle].time_offset > p_time) {
+				high = middle - 1;
+			} else {
+				page_index = middle;
+				low = middle + 1;
+			}
 		}
-		page_index = i;
 	}
 
 	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
@@ -5368,26 +5408,41 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 	uint32_t time_key_count = indices[p_compressed_track * 3 + 1];
 
 	int32_t packet_idx = 0;
-	double packet_time = double(time_keys[0]) * frame_to_sec + page_base_time;
-	uint32_t base_frame = time_keys[0];
 
-	for (uint32_t i = 1; i < time_key_count; i++) {
-		uint32_t f = time_keys[i * 2 + 0];
-		double frame_time = double(f) * frame_to_sec + page_base_time;
+	if (key_index) {
+		// The caller needs the number of keys skipped, which requires
+		// accumulating the per-packet data counts while walking.
+		for (uint32_t i = 1; i < time_key_count; i++) {
+			uint32_t f = time_keys[i * 2 + 0];
+			double frame_time = double(f) * frame_to_sec + page_base_time;
 
-		if (frame_time > p_time) {
-			break;
-		}
+			if (frame_time > p_time) {
+				break;
+			}
 
-		if (key_index) {
 			(*key_index) += (time_keys[(i - 1) * 2 + 1] >> 12) + 1;
+			packet_idx = i;
+		}
+	} else if (time_key_count > 1) {
+		// Sampling only needs the packet, so binary search the sorted time
+		// keys instead of walking them from the start of the track.
+		uint32_t low = 1;
+		uint32_t high = time_key_count - 1;
+		while (low <= high) {
+			uint32_t middle = (low + high) / 2;
+			double frame_time = double(time_keys[middle * 2 + 0]) * frame_to_sec + page_base_time;
+			if (frame_time > p_time) {
+				high = middle - 1;
+			} else {
+				packet_idx = middle;
+				low = middle + 1;
+			}
 		}
-
-		packet_idx = i;
-		packet_time = frame_time;
-		base_frame = f;
 	}
 
+	double packet_time = double(time_keys[packet_idx * 2 + 0]) * frame_to_sec + page_base_time;
+	uint32_t base_frame = time_keys[packet_idx * 2 + 0];
+
 	const uint8_t *data_keys_base = (const uint8_t *)&page_data[indices[p_compressed_track * 3 + 2]];
 
 	uint16_t time_key_data = time_keys[packet_idx * 2 + 1];
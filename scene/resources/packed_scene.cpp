@@ -144,6 +144,51 @@ static Node *_find_node_by_id(Node *p_owner, Node *p_node, int32_t p_id) {
 	return nullptr;
 }
 
+// Sets a property that was saved as one or more NodePaths, converting the paths
+// to the nodes they point at relative to the base node.
+static void _set_deferred_node_path_property(Node *p_base, const StringName &p_property, const Variant &p_value) {
+	if (p_value.get_type() == Variant::ARRAY) {
+		Array paths = p_value;
+
+		bool valid;
+		Array array = p_base->get(p_property, &valid);
+		ERR_FAIL_COND_EDMSG(!valid, vformat("Failed to get property '%s' from node '%s'.", p_property, p_base->get_name()));
+		array = array.duplicate();
+
+		array.resize(paths.size());
+		for (int i = 0; i < array.size(); i++) {
+			array.set(i, p_base->get_node_or_null(paths[i]));
+		}
+		p_base->set(p_property, array);
+	} else if (p_value.get_type() == Variant::DICTIONARY) {
+		Dictionary paths = p_value;
+
+		bool valid;
+		Dictionary dict = p_base->get(p_property, &valid);
+		ERR_FAIL_COND_EDMSG(!valid, vformat("Failed to get property '%s' from node '%s'.", p_property, p_base->get_name()));
+		dict = dict.duplicate();
+		bool convert_key = dict.get_typed_key_builtin() == Variant::OBJECT &&
+				ClassDB::is_parent_class(dict.get_typed_key_class_name(), "Node");
+		bool convert_value = dict.get_typed_value_builtin() == Variant::OBJECT &&
+				ClassDB::is_parent_class(dict.get_typed_value_class_name(), "Node");
+
+		for (const KeyValue<Variant, Variant> &kv : paths) {
+			Variant key = kv.key;
+			if (convert_key) {
+				key = p_base->get_node_or_null(key);
+			}
+			Variant value = kv.value;
+			if (convert_value) {
+				value = p_base->get_node_or_null(value);
+			}
+			dict[key] = value;
+		}
+		p_base->set(p_property, dict);
+	} else {
+		p_base->set(p_property, p_base->get_node_or_null(p_value));
+	}
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -597,46 +642,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 		// Replace properties stored as NodePaths with actual Nodes.
 		Node *base = ObjectDB::get_instance<Node>(dnp.base);
 		ERR_CONTINUE_EDMSG(!base, vformat("Failed to set deferred property '%s' as the base node disappeared.", dnp.property));
-		if (dnp.value.get_type() == Variant::ARRAY) {
-			Array paths = dnp.value;
-
-			bool valid;
-			Array array = base->get(dnp.property, &valid);
-			ERR_CONTINUE_EDMSG(!valid, vformat("Failed to get property '%s' from node '%s'.", dnp.property, base->get_name()));
-			array = array.duplicate();
-
-			array.resize(paths.size());
-			for (int i = 0; i < array.size(); i++) {
-				array.set(i, base->get_node_or_null(paths[i]));
-			}
-			base->set(dnp.property, array);
-		} else if (dnp.value.get_type() == Variant::DICTIONARY) {
-			Dictionary paths = dnp.value;
-
-			bool valid;
-			Dictionary dict = base->get(dnp.property, &valid);
-			ERR_CONTINUE_EDMSG(!valid, vformat("Failed to get property '%s' from node '%s'.", dnp.property, base->get_name()));
-			dict = dict.duplicate();
-			bool convert_key = dict.get_typed_key_builtin() == Variant::OBJECT &&
-					ClassDB::is_parent_class(dict.get_typed_key_class_name(), "Node");
-			bool convert_value = dict.get_typed_value_builtin() == Variant::OBJECT &&
-					ClassDB::is_parent_class(dict.get_typed_value_class_name(), "Node");
-
-			for (const KeyValue<Variant, Variant> &kv : paths) {
-				Variant key = kv.key;
-				if (convert_key) {
-					key = base->get_node_or_null(key);
-				}
-				Variant value = kv.value;
-				if (convert_value) {
-					value = base->get_node_or_null(value);
-				}
-				dict[key] = value;
-			}
-			base->set(dnp.property, dict);
-		} else {
-			base->set(dnp.property, base->get_node_or_null(dnp.value));
-		}
+		_set_deferred_node_path_property(base, dnp.property, dnp.value);
 	}
 
 	for (KeyValue<Ref<Resource>, Ref<Resource>> &E : resources_local_to_scene) {
@@ -703,6 +709,328 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	return ret_nodes[0];
 }
 
+bool SceneState::reset_instance_properties(Node *p_root) const {
+	ERR_FAIL_NULL_V(p_root, false);
+
+	int nc = nodes.size();
+	ERR_FAIL_COND_V(nc == 0, false);
+
+	const StringName *snames = nullptr;
+	int sname_count = names.size();
+	if (sname_count) {
+		snames = &names[0];
+	}
+
+	const Variant *props = nullptr;
+	int prop_count = variants.size();
+	if (prop_count) {
+		props = &variants[0];
+	}
+
+	const NodeData *nd = &nodes[0];
+
+	Node **ret_nodes = (Node **)alloca(sizeof(Node *) * nc);
+
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nd[i];
+
+		Node *node = nullptr;
+		if (i == 0) {
+			node = p_root;
+			if (base_scene_idx >= 0) {
+				// Inherited scene; reset the properties recorded by the base scene first,
+				// the overrides recorded here are applied on top below.
+				Ref<PackedScene> sdata = props[base_scene_idx];
+				ERR_FAIL_COND_V(sdata.is_null(), false);
+				if (!sdata->get_state()->reset_instance_properties(p_root)) {
+					return false;
+				}
+			}
+		} else {
+			Node *parent = nullptr;
+			if (n.parent & FLAG_ID_IS_PATH) {
+				parent = p_root->get_node_or_null(node_paths[n.parent & FLAG_MASK]);
+			} else if ((n.parent & FLAG_MASK) < nc) {
+				parent = ret_nodes[n.parent & FLAG_MASK];
+			}
+			if (parent) {
+				node = parent->_get_child_by_name(snames[n.name]);
+			}
+		}
+
+		ret_nodes[i] = node;
+
+		if (!node) {
+			// A recorded node vanished, so the instance cannot be fully reset.
+			return false;
+		}
+
+		if (i > 0 && n.instance >= 0 && !(n.instance & FLAG_INSTANCE_IS_PLACEHOLDER)) {
+			// Nested scene instance; reset its own recorded state first.
+			Ref<PackedScene> sdata = props[n.instance & FLAG_MASK];
+			if (sdata.is_valid() && !sdata->get_state()->reset_instance_properties(node)) {
+				return false;
+			}
+		}
+
+		int nprop_count = n.properties.size();
+		if (!nprop_count) {
+			continue;
+		}
+		const NodeData::Property *nprops = &n.properties[0];
+
+		for (int j = 0; j < nprop_count; j++) {
+			ERR_FAIL_INDEX_V(nprops[j].value, prop_count, false);
+
+			if (nprops[j].name & FLAG_PATH_PROPERTY_IS_NODE) {
+				uint32_t name_idx = nprops[j].name & (FLAG_PATH_PROPERTY_IS_NODE - 1);
+				ERR_FAIL_UNSIGNED_INDEX_V(name_idx, (uint32_t)sname_count, false);
+				_set_deferred_node_path_property(node, snames[name_idx], props[nprops[j].value]);
+				continue;
+			}
+
+			ERR_FAIL_INDEX_V(nprops[j].name, sname_count, false);
+
+			if (snames[nprops[j].name] == CoreStringName(script)) {
+				// The script is kept as-is; resetting script variables is the caller's
+				// responsibility, as they are not part of the recorded scene state.
+				continue;
+			}
+
+			Variant value = props[nprops[j].value];
+
+			if (value.get_type() == Variant::OBJECT) {
+				Ref<Resource> res = value;
+				if (res.is_valid() && res->is_local_to_scene()) {
+					// The node already owns its per-instance copy from instantiation;
+					// assigning the recorded original would share it across instances.
+					continue;
+				}
+			}
+
+			node->set(snames[nprops[j].name], value);
+		}
+	}
+
+	return true;
+}
+
+bool SceneState::diff_apply(const Ref<SceneState> &p_old_state, Node *p_root) const {
+	ERR_FAIL_COND_V(p_old_state.is_null(), false);
+	ERR_FAIL_NULL_V(p_root, false);
+
+	const SceneState &old_state = **p_old_state;
+
+	// Any structural difference (nodes added, removed, renamed, retyped or
+	// reparented, changed groups or connections) falls back to a full
+	// re-instantiation by the caller; this path only patches property values.
+	int nc = nodes.size();
+	if (nc == 0 || nc != old_state.nodes.size()) {
+		return false;
+	}
+	// Inherited scenes layer their base state underneath; diffing through that
+	// indirection is not supported.
+	if (base_scene_idx >= 0 || old_state.base_scene_idx >= 0) {
+		return false;
+	}
+	if (connections.size() != old_state.connections.size()) {
+		return false;
+	}
+	if (editable_instances != old_state.editable_instances) {
+		return false;
+	}
+
+	const StringName *snames = names.is_empty() ? nullptr : &names[0];
+	const Variant *props = variants.is_empty() ? nullptr : &variants[0];
+	const StringName *old_snames = old_state.names.is_empty() ? nullptr : &old_state.names[0];
+	const Variant *old_props = old_state.variants.is_empty() ? nullptr : &old_state.variants[0];
+
+	// Node references (parent, owner, connection endpoints) are stored either as
+	// a node index or as a path; both encodings must match for the states to be
+	// considered structurally equal.
+	auto node_ref_equal = [&](int p_ref, int p_old_ref) {
+		if ((p_ref & FLAG_ID_IS_PATH) != (p_old_ref & FLAG_ID_IS_PATH)) {
+			return false;
+		}
+		if (p_ref & FLAG_ID_IS_PATH) {
+			return node_paths[p_ref & FLAG_MASK] == old_state.node_paths[p_old_ref & FLAG_MASK];
+		}
+		return p_ref == p_old_ref;
+	};
+
+	for (const ConnectionData &c : connections) {
+		bool found = false;
+		for (const ConnectionData &oc : old_state.connections) {
+			if (node_ref_equal(c.from, oc.from) && node_ref_equal(c.to, oc.to) &&
+					snames[c.signal] == old_snames[oc.signal] && snames[c.method] == old_snames[oc.method] &&
+					c.flags == oc.flags && c.unbinds == oc.unbinds && c.binds.size() == oc.binds.size()) {
+				found = true;
+				for (int i = 0; i < c.binds.size(); i++) {
+					if (props[c.binds[i]] != old_props[oc.binds[i]]) {
+						found = false;
+						break;
+					}
+				}
+			}
+			if (found) {
+				break;
+			}
+		}
+		if (!found) {
+			return false;
+		}
+	}
+
+	struct PropertyWrite {
+		Node *node = nullptr;
+		StringName name;
+		Variant value;
+		bool deferred_node_path = false;
+	};
+	LocalVector<PropertyWrite> writes;
+
+	Node **ret_nodes = (Node **)alloca(sizeof(Node *) * nc);
+
+	// First pass: validate the structure and collect the properties whose
+	// recorded value changed. Nothing is written until the whole diff is known
+	// to be applicable, so a fallback never leaves a half-patched tree.
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nodes[i];
+		const NodeData &on = old_state.nodes[i];
+
+		if (snames[n.name] != old_snames[on.name] || snames[n.type] != old_snames[on.type] || n.index != on.index) {
+			return false;
+		}
+		if (!node_ref_equal(n.parent, on.parent) || !node_ref_equal(n.owner, on.owner)) {
+			return false;
+		}
+		if ((n.instance < 0) != (on.instance < 0)) {
+			return false;
+		}
+		if (n.instance >= 0) {
+			// Both must refer to the same sub-scene (or placeholder path); the
+			// overrides recorded here are diffed like regular properties.
+			if ((n.instance & FLAG_INSTANCE_IS_PLACEHOLDER) != (on.instance & FLAG_INSTANCE_IS_PLACEHOLDER)) {
+				return false;
+			}
+			if (n.instance & FLAG_INSTANCE_IS_PLACEHOLDER) {
+				if (String(props[n.instance & FLAG_MASK]) != String(old_props[on.instance & FLAG_MASK])) {
+					return false;
+				}
+			} else {
+				Ref<PackedScene> sdata = props[n.instance & FLAG_MASK];
+				Ref<PackedScene> old_sdata = old_props[on.instance & FLAG_MASK];
+				if (sdata.is_null() || old_sdata.is_null() || sdata->get_path() != old_sdata->get_path()) {
+					return false;
+				}
+			}
+		}
+		if (n.groups.size() != on.groups.size()) {
+			return false;
+		}
+		for (int j = 0; j < n.groups.size(); j++) {
+			if (snames[n.groups[j]] != old_snames[on.groups[j]]) {
+				return false;
+			}
+		}
+
+		Node *node = nullptr;
+		if (i == 0) {
+			node = p_root;
+		} else {
+			Node *parent = nullptr;
+			if (n.parent & FLAG_ID_IS_PATH) {
+				parent = p_root->get_node_or_null(node_paths[n.parent & FLAG_MASK]);
+			} else if ((n.parent & FLAG_MASK) < nc) {
+				parent = ret_nodes[n.parent & FLAG_MASK];
+			}
+			if (parent) {
+				node = parent->_get_child_by_name(snames[n.name]);
+			}
+		}
+
+		ret_nodes[i] = node;
+
+		if (!node) {
+			// A recorded node vanished from the live tree.
+			return false;
+		}
+
+		// Index the old property list by name so each new property can be
+		// matched up regardless of storage order.
+		HashMap<StringName, int> name_remap;
+		for (int j = 0; j < on.properties.size(); j++) {
+			name_remap[old_snames[on.properties[j].name & FLAG_PROP_NAME_MASK]] = j;
+		}
+		uint32_t old_matched = 0;
+
+		for (int j = 0; j < n.properties.size(); j++) {
+			int flagged_name = n.properties[j].name;
+			StringName prop_name = snames[flagged_name & FLAG_PROP_NAME_MASK];
+			bool deferred = (flagged_name & FLAG_PATH_PROPERTY_IS_NODE) != 0;
+			const Variant &value = props[n.properties[j].value];
+
+			bool changed = true;
+			HashMap<StringName, int>::Iterator O = name_remap.find(prop_name);
+			if (O) {
+				const NodeData::Property &op = on.properties[O->value];
+				if (deferred != bool(op.name & FLAG_PATH_PROPERTY_IS_NODE)) {
+					return false;
+				}
+				const Variant &old_value = old_props[op.value];
+				if (deferred) {
+					changed = value != old_value;
+				} else {
+					changed = PropertyUtils::is_property_value_different(node, old_value, value);
+				}
+				old_matched++;
+			}
+
+			if (!changed) {
+				continue;
+			}
+
+			if (prop_name == CoreStringName(script)) {
+				// A script change swaps the variable set out from under the
+				// node; that needs a full rebuild.
+				return false;
+			}
+			if (!deferred && value.get_type() == Variant::OBJECT) {
+				Ref<Resource> res = value;
+				if (res.is_valid() && res->is_local_to_scene()) {
+					// The node owns a per-instance copy; assigning the recorded
+					// original would share it across instances.
+					return false;
+				}
+			}
+
+			PropertyWrite w;
+			w.node = node;
+			w.name = prop_name;
+			w.value = value;
+			w.deferred_node_path = deferred;
+			writes.push_back(w);
+		}
+
+		if (old_matched != (uint32_t)on.properties.size()) {
+			// A recorded property was removed; restoring its default cheaply is
+			// not possible, so fall back.
+			return false;
+		}
+	}
+
+	// Second pass: bulk-apply the changed values.
+	for (const PropertyWrite &w : writes) {
+		if (w.deferred_node_path) {
+			_set_deferred_node_path_property(w.node, w.name, w.value);
+		} else {
+			w.node->set(w.name, w.value);
+		}
+	}
+
+	return true;
+}
+
 Variant SceneState::make_local_resource(Variant &p_value, const SceneState::NodeData &p_node_data, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_sub_scene, Node *p_node, const StringName p_sname, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_scene, int p_i, Node **p_ret_nodes, SceneState::GenEditState p_edit_state) const {
 	Ref<Resource> res = p_value;
 	if (res.is_null() || !res->is_local_to_scene()) {
@@ -2442,14 +2770,17 @@ Dictionary PackedScene::_get_bundled_scene() const {
 }
 
 Error PackedScene::pack(Node *p_scene) {
+	clear_instance_pool();
 	return state->pack(p_scene);
 }
 
 void PackedScene::clear() {
+	clear_instance_pool();
 	state->clear();
 }
 
 void PackedScene::reload_from_file() {
+	clear_instance_pool();
 	String path = get_path();
 	if (!path.is_resource_file()) {
 		return;
@@ -2498,7 +2829,66 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 	return s;
 }
 
+void PackedScene::set_instance_pool_capacity(int p_capacity) {
+	ERR_FAIL_COND(p_capacity < 0);
+	instance_pool_capacity = p_capacity;
+	while (instance_pool.size() > (uint32_t)instance_pool_capacity) {
+		memdelete(instance_pool[instance_pool.size() - 1]);
+		instance_pool.remove_at(instance_pool.size() - 1);
+	}
+}
+
+int PackedScene::get_instance_pool_capacity() const {
+	return instance_pool_capacity;
+}
+
+Node *PackedScene::instantiate_pooled() {
+	if (!instance_pool.is_empty()) {
+		Node *node = instance_pool[instance_pool.size() - 1];
+		instance_pool.remove_at(instance_pool.size() - 1);
+		return node;
+	}
+
+	return instantiate(GEN_EDIT_STATE_DISABLED);
+}
+
+bool PackedScene::release_pooled_instance(Node *p_instance) {
+	ERR_FAIL_NULL_V(p_instance, false);
+	ERR_FAIL_COND_V_MSG(p_instance->is_inside_tree(), false, "Pooled instances must be removed from the tree before being released.");
+	ERR_FAIL_COND_V_MSG(p_instance->get_parent() != nullptr, false, "Pooled instances must be unparented before being released.");
+
+	if (instance_pool.size() >= (uint32_t)instance_pool_capacity) {
+		return false;
+	}
+
+	// Reset the node tree to the recorded scene state so the next
+	// instantiate_pooled() hands out a pristine instance.
+	if (!state->reset_instance_properties(p_instance)) {
+		return false;
+	}
+
+	instance_pool.push_back(p_instance);
+	return true;
+}
+
+void PackedScene::clear_instance_pool() {
+	for (Node *node : instance_pool) {
+		memdelete(node);
+	}
+	instance_pool.clear();
+}
+
+bool PackedScene::patch_instance(Node *p_instance, const Ref<SceneState> &p_old_state) {
+	ERR_FAIL_NULL_V(p_instance, false);
+	ERR_FAIL_COND_V(p_old_state.is_null(), false);
+
+	return state->diff_apply(p_old_state, p_instance);
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
+	// The pool holds instances of the previous state; they would be reset against
+	// the wrong snapshot, so drop them (also on scene reload and repacking).
+	clear_instance_pool();
 	state = p_by;
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -2507,6 +2897,7 @@ void PackedScene::replace_state(Ref<SceneState> p_by) {
 }
 
 void PackedScene::recreate_state() {
+	clear_instance_pool();
 	state.instantiate();
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -2585,6 +2976,12 @@ void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
+	ClassDB::bind_method(D_METHOD("set_instance_pool_capacity", "capacity"), &PackedScene::set_instance_pool_capacity);
+	ClassDB::bind_method(D_METHOD("get_instance_pool_capacity"), &PackedScene::get_instance_pool_capacity);
+	ClassDB::bind_method(D_METHOD("instantiate_pooled"), &PackedScene::instantiate_pooled);
+	ClassDB::bind_method(D_METHOD("release_pooled_instance", "instance"), &PackedScene::release_pooled_instance);
+	ClassDB::bind_method(D_METHOD("clear_instance_pool"), &PackedScene::clear_instance_pool);
+	ClassDB::bind_method(D_METHOD("patch_instance", "instance", "old_state"), &PackedScene::patch_instance);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
 	ClassDB::bind_method(D_METHOD("get_state"), &PackedScene::get_state);
@@ -2600,3 +2997,7 @@ void PackedScene::_bind_methods() {
 PackedScene::PackedScene() {
 	state.instantiate();
 }
+
+PackedScene::~PackedScene() {
+	clear_instance_pool();
+}
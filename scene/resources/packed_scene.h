@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/templates/local_vector.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -160,6 +161,12 @@ public:
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state) const;
 
+	// Reapplies the recorded property values to an existing instance of this scene,
+	// so it can be reused instead of re-instantiated. Returns false if a recorded
+	// node is missing from the instance.
+	bool reset_instance_properties(Node *p_root) const;
+	bool diff_apply(const Ref<SceneState> &p_old_state, Node *p_root) const;
+
 	Array setup_resources_in_array(Array &array_to_scan, const SceneState::NodeData &n, HashMap<Ref<Resource>, Ref<Resource>> &resources_local_to_sub_scene, Node *node, const StringName sname, HashMap<Ref<Resource>, Ref<Resource>> &resources_local_to_scene, int i, Node **ret_nodes, SceneState::GenEditState p_edit_state) const;
 	Dictionary setup_resources_in_dictionary(Dictionary &p_dictionary_to_scan, const SceneState::NodeData &p_n, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_sub_scene, Node *p_node, const StringName p_sname, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_scene, int p_i, Node **p_ret_nodes, SceneState::GenEditState p_edit_state) const;
 	Variant make_local_resource(Variant &value, const SceneState::NodeData &p_node_data, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_sub_scene, Node *p_node, const StringName p_sname, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_scene, int p_i, Node **p_ret_nodes, SceneState::GenEditState p_edit_state) const;
@@ -247,6 +254,11 @@ class PackedScene : public Resource {
 
 	Ref<SceneState> state;
 
+	// Instances available for reuse through instantiate_pooled(). Entries are kept
+	// outside the tree and are owned by this resource until handed out again.
+	LocalVector<Node *> instance_pool;
+	int instance_pool_capacity = 0;
+
 	void _set_bundled_scene(const Dictionary &p_scene);
 	Dictionary _get_bundled_scene() const;
 
@@ -270,6 +282,14 @@ public:
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
 
+	void set_instance_pool_capacity(int p_capacity);
+	int get_instance_pool_capacity() const;
+	Node *instantiate_pooled();
+	bool release_pooled_instance(Node *p_instance);
+	void clear_instance_pool();
+
+	bool patch_instance(Node *p_instance, const Ref<SceneState> &p_old_state);
+
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
 
@@ -289,6 +309,7 @@ public:
 	Ref<SceneState> get_state() const;
 
 	PackedScene();
+	~PackedScene();
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
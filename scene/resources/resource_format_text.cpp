@@ -557,8 +557,9 @@ Error ResourceLoaderText::load() {
 		MissingResource *missing_resource = nullptr;
 
 		if (res.is_null()) { //not reuse
-			Ref<Resource> cache = ResourceCache::get_ref(path);
-			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && cache.is_valid()) { //only if it doesn't exist
+			// Don't pay for a cache probe (mutex + hash lookup per sub resource) when the cache is ignored anyway.
+			Ref<Resource> cache = cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE ? ResourceCache::get_ref(path) : Ref<Resource>();
+			if (cache.is_valid()) { //only if it doesn't exist
 				//cached, do not assign
 				res = cache;
 			} else {
@@ -42,6 +42,9 @@ SurfaceTool::SimplifyScaleFunc SurfaceTool::simplify_scale_func = nullptr;
 SurfaceTool::GenerateRemapFunc SurfaceTool::generate_remap_func = nullptr;
 SurfaceTool::RemapVertexFunc SurfaceTool::remap_vertex_func = nullptr;
 SurfaceTool::RemapIndexFunc SurfaceTool::remap_index_func = nullptr;
+SurfaceTool::BuildMeshletsBoundFunc SurfaceTool::build_meshlets_bound_func = nullptr;
+SurfaceTool::BuildMeshletsFunc SurfaceTool::build_meshlets_func = nullptr;
+SurfaceTool::ComputeMeshletBoundsFunc SurfaceTool::compute_meshlet_bounds_func = nullptr;
 
 void SurfaceTool::strip_mesh_arrays(PackedVector3Array &r_vertices, PackedInt32Array &r_indices) {
 	ERR_FAIL_COND_MSG(!generate_remap_func || !remap_vertex_func || !remap_index_func, "Meshoptimizer library is not initialized.");
@@ -415,6 +418,14 @@ void SurfaceTool::add_index(int p_index) {
 	index_array.push_back(p_index);
 }
 
+void SurfaceTool::reserve(int p_vertex_count, int p_index_count) {
+	ERR_FAIL_COND(p_vertex_count < 0);
+	ERR_FAIL_COND(p_index_count < 0);
+
+	vertex_array.reserve(p_vertex_count);
+	index_array.reserve(p_index_count);
+}
+
 Array SurfaceTool::commit_to_arrays() {
 	int varr_len = vertex_array.size();
 
@@ -1020,15 +1031,19 @@ void SurfaceTool::create_from_blend_shape(const Ref<Mesh> &p_existing, int p_sur
 void SurfaceTool::append_from(const Ref<Mesh> &p_existing, int p_surface, const Transform3D &p_xform) {
 	ERR_FAIL_COND_MSG(p_existing.is_null(), "First argument in SurfaceTool::append_from() must be a valid object of type Mesh");
 
+	append_from_arrays(p_existing->surface_get_arrays(p_surface), p_existing->surface_get_primitive_type(p_surface), p_xform);
+}
+
+void SurfaceTool::append_from_arrays(const Array &p_arrays, Mesh::PrimitiveType p_primitive, const Transform3D &p_xform) {
 	if (vertex_array.is_empty()) {
-		primitive = p_existing->surface_get_primitive_type(p_surface);
+		primitive = p_primitive;
 		format = 0;
 	}
 
 	uint64_t nformat = 0;
 	LocalVector<Vertex> nvertices;
 	LocalVector<int> nindices;
-	_create_list(p_existing, p_surface, &nvertices, &nindices, nformat);
+	_create_list_from_arrays(p_arrays, &nvertices, &nindices, nformat);
 	format |= nformat;
 
 	for (int j = 0; j < RS::ARRAY_CUSTOM_COUNT; j++) {
@@ -1338,6 +1353,63 @@ Vector<int> SurfaceTool::generate_lod(float p_threshold, int p_target_index_coun
 	return lod;
 }
 
+Dictionary SurfaceTool::generate_meshlets(int p_max_vertices, int p_max_triangles, float p_cone_weight) {
+	Dictionary result;
+
+	ERR_FAIL_NULL_V(build_meshlets_bound_func, result);
+	ERR_FAIL_NULL_V(build_meshlets_func, result);
+	ERR_FAIL_NULL_V(compute_meshlet_bounds_func, result);
+	ERR_FAIL_COND_V(vertex_array.is_empty(), result);
+	ERR_FAIL_COND_V(index_array.is_empty(), result);
+	ERR_FAIL_COND_V(index_array.size() % 3 != 0, result);
+	ERR_FAIL_COND_V(p_max_vertices < 3 || p_max_vertices > 256, result);
+	ERR_FAIL_COND_V(p_max_triangles < 1 || p_max_triangles > 512 || p_max_triangles % 4 != 0, result);
+	ERR_FAIL_COND_V(p_cone_weight < 0.0f || p_cone_weight > 1.0f, result);
+
+	LocalVector<float> vertices; //uses floats
+	vertices.resize(vertex_array.size() * 3);
+	for (uint32_t i = 0; i < vertex_array.size(); i++) {
+		vertices[i * 3 + 0] = vertex_array[i].vertex.x;
+		vertices[i * 3 + 1] = vertex_array[i].vertex.y;
+		vertices[i * 3 + 2] = vertex_array[i].vertex.z;
+	}
+
+	size_t max_meshlets = build_meshlets_bound_func(index_array.size(), p_max_vertices, p_max_triangles);
+	ERR_FAIL_COND_V(max_meshlets == 0, result);
+
+	PackedInt32Array meshlets;
+	meshlets.resize(max_meshlets * 4); // vertex_offset, triangle_offset, vertex_count, triangle_count per meshlet.
+	PackedInt32Array meshlet_vertices;
+	meshlet_vertices.resize(max_meshlets * p_max_vertices);
+	PackedByteArray meshlet_triangles;
+	meshlet_triangles.resize(max_meshlets * p_max_triangles * 3);
+
+	size_t meshlet_count = build_meshlets_func((unsigned int *)meshlets.ptrw(), (unsigned int *)meshlet_vertices.ptrw(), meshlet_triangles.ptrw(), (const unsigned int *)index_array.ptr(), index_array.size(), vertices.ptr(), vertex_array.size(), sizeof(float) * 3, p_max_vertices, p_max_triangles, p_cone_weight);
+	ERR_FAIL_COND_V(meshlet_count == 0, result);
+
+	// Trim the arrays to the data the last meshlet actually uses.
+	{
+		const int32_t *last = meshlets.ptr() + (meshlet_count - 1) * 4;
+		meshlet_vertices.resize(last[0] + last[2]);
+		meshlet_triangles.resize(last[1] + ((last[3] * 3 + 3) & ~3)); // Triangle data is packed with 4-byte alignment.
+		meshlets.resize(meshlet_count * 4);
+	}
+
+	// Cluster culling data: center x/y/z, radius, cone_apex x/y/z, cone_axis x/y/z, cone_cutoff per meshlet.
+	PackedFloat32Array bounds;
+	bounds.resize(meshlet_count * 11);
+	for (size_t i = 0; i < meshlet_count; i++) {
+		const int32_t *m = meshlets.ptr() + i * 4;
+		compute_meshlet_bounds_func((const unsigned int *)meshlet_vertices.ptr() + m[0], meshlet_triangles.ptr() + m[1], m[3], vertices.ptr(), vertex_array.size(), sizeof(float) * 3, bounds.ptrw() + i * 11);
+	}
+
+	result["meshlets"] = meshlets;
+	result["meshlet_vertices"] = meshlet_vertices;
+	result["meshlet_triangles"] = meshlet_triangles;
+	result["bounds"] = bounds;
+	return result;
+}
+
 void SurfaceTool::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_skin_weight_count", "count"), &SurfaceTool::set_skin_weight_count);
 	ClassDB::bind_method(D_METHOD("get_skin_weight_count"), &SurfaceTool::get_skin_weight_count);
@@ -1362,6 +1434,8 @@ void SurfaceTool::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("add_index", "index"), &SurfaceTool::add_index);
 
+	ClassDB::bind_method(D_METHOD("reserve", "vertex_count", "index_count"), &SurfaceTool::reserve, DEFVAL(0));
+
 	ClassDB::bind_method(D_METHOD("index"), &SurfaceTool::index);
 	ClassDB::bind_method(D_METHOD("deindex"), &SurfaceTool::deindex);
 	ClassDB::bind_method(D_METHOD("generate_normals", "flip"), &SurfaceTool::generate_normals, DEFVAL(false));
@@ -1371,6 +1445,7 @@ void SurfaceTool::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_aabb"), &SurfaceTool::get_aabb);
 	ClassDB::bind_method(D_METHOD("generate_lod", "nd_threshold", "target_index_count"), &SurfaceTool::generate_lod, DEFVAL(3));
+	ClassDB::bind_method(D_METHOD("generate_meshlets", "max_vertices", "max_triangles", "cone_weight"), &SurfaceTool::generate_meshlets, DEFVAL(64), DEFVAL(124), DEFVAL(0.0));
 
 	ClassDB::bind_method(D_METHOD("set_material", "material"), &SurfaceTool::set_material);
 	ClassDB::bind_method(D_METHOD("get_primitive_type"), &SurfaceTool::get_primitive_type);
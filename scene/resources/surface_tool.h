@@ -111,6 +111,14 @@ public:
 	static RemapVertexFunc remap_vertex_func;
 	typedef void (*RemapIndexFunc)(unsigned int *destination, const unsigned int *indices, size_t index_count, const unsigned int *remap);
 	static RemapIndexFunc remap_index_func;
+	typedef size_t (*BuildMeshletsBoundFunc)(size_t index_count, size_t max_vertices, size_t max_triangles);
+	static BuildMeshletsBoundFunc build_meshlets_bound_func;
+	// destination is packed meshopt_Meshlet data: vertex_offset, triangle_offset, vertex_count, triangle_count per meshlet.
+	typedef size_t (*BuildMeshletsFunc)(unsigned int *destination, unsigned int *meshlet_vertices, unsigned char *meshlet_triangles, const unsigned int *indices, size_t index_count, const float *vertex_positions, size_t vertex_count, size_t vertex_positions_stride, size_t max_vertices, size_t max_triangles, float cone_weight);
+	static BuildMeshletsFunc build_meshlets_func;
+	// r_bounds receives 11 floats: center x/y/z, radius, cone_apex x/y/z, cone_axis x/y/z, cone_cutoff.
+	typedef void (*ComputeMeshletBoundsFunc)(const unsigned int *meshlet_vertices, const unsigned char *meshlet_triangles, size_t triangle_count, const float *vertex_positions, size_t vertex_count, size_t vertex_positions_stride, float *r_bounds);
+	static ComputeMeshletBoundsFunc compute_meshlet_bounds_func;
 	static void strip_mesh_arrays(PackedVector3Array &r_vertices, PackedInt32Array &r_indices);
 
 private:
@@ -215,6 +223,8 @@ public:
 
 	void add_index(int p_index);
 
+	void reserve(int p_vertex_count, int p_index_count = 0);
+
 	void index();
 	void deindex();
 	void generate_normals(bool p_flip = false);
@@ -223,6 +233,7 @@ public:
 	void optimize_indices_for_cache();
 	AABB get_aabb() const;
 	Vector<int> generate_lod(float p_threshold, int p_target_index_count = 3);
+	Dictionary generate_meshlets(int p_max_vertices = 64, int p_max_triangles = 124, float p_cone_weight = 0.0f);
 
 	void set_material(const Ref<Material> &p_material);
 	Ref<Material> get_material() const;
@@ -240,6 +251,7 @@ public:
 	void create_from(const Ref<Mesh> &p_existing, int p_surface);
 	void create_from_blend_shape(const Ref<Mesh> &p_existing, int p_surface, const String &p_blend_shape_name);
 	void append_from(const Ref<Mesh> &p_existing, int p_surface, const Transform3D &p_xform);
+	void append_from_arrays(const Array &p_arrays, Mesh::PrimitiveType p_primitive, const Transform3D &p_xform);
 	Ref<ArrayMesh> commit(const Ref<ArrayMesh> &p_existing = Ref<ArrayMesh>(), uint64_t p_compress_flags = 0);
 
 	SurfaceTool();
@@ -131,6 +131,20 @@ int AudioDriver::_get_configured_mix_rate() {
 #endif
 }
 
+Thread::Priority AudioDriver::get_thread_priority() const {
+	switch (int(GLOBAL_GET("audio/driver/thread_priority"))) {
+		case 0: {
+			return Thread::PRIORITY_NORMAL;
+		}
+		case 1: {
+			return Thread::PRIORITY_HIGH;
+		}
+		default: {
+			return Thread::PRIORITY_TIME_CRITICAL;
+		}
+	}
+}
+
 AudioDriver::SpeakerMode AudioDriver::get_speaker_mode_by_total_channels(int p_channels) const {
 	switch (p_channels) {
 		case 4:
@@ -214,6 +228,7 @@ void AudioDriverManager::initialize(int p_driver) {
 	GLOBAL_DEF_RST("audio/driver/enable_input", false);
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/driver/mix_rate", PROPERTY_HINT_RANGE, "11025,192000,1,or_greater,suffix:Hz"), DEFAULT_MIX_RATE);
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/driver/mix_rate.web", PROPERTY_HINT_RANGE, "0,192000,1,or_greater,suffix:Hz"), 0); // Safer default output_latency for web (use browser default).
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/driver/thread_priority", PROPERTY_HINT_ENUM, "Normal,High,Time-Critical"), 2);
 
 	int failed_driver = -1;
 
@@ -336,6 +351,8 @@ void AudioServer::_driver_process(int p_frames, int32_t *p_buffer) {
 }
 
 void AudioServer::_mix_step() {
+	ScopedAllocTag alloc_tag(Memory::ALLOC_TAG_AUDIO);
+
 	bool solo_mode = false;
 
 	for (int i = 0; i < buses.size(); i++) {
@@ -390,6 +407,23 @@ void AudioServer::_mix_step() {
 			continue;
 		}
 
+		// Streams scheduled for an absolute output frame stay silent until the block
+		// containing that frame, then mix from an offset within it, so the start is
+		// sample-accurate instead of rounded to block granularity.
+		unsigned int block_offset = 0;
+		if (playback->scheduled_start_frame != 0) {
+			if (playback->scheduled_start_frame >= mix_frames + buffer_size) {
+				// Not due yet. If the playback was stopped or paused in the meantime,
+				// fall through so the fade-out state machine below still runs.
+				if (playback->state.load() == AudioStreamPlaybackListNode::PLAYING) {
+					continue;
+				}
+			} else if (playback->scheduled_start_frame > mix_frames) {
+				block_offset = playback->scheduled_start_frame - mix_frames;
+			}
+			playback->scheduled_start_frame = 0;
+		}
+
 		// If `fading_out` is true, we're in the process of fading out the stream playback.
 		// TODO: Currently this sets the volume of the stream to 0 which creates a linear interpolation between its previous volume and silence.
 		//  A more punchy option for fading out could be to just use the lookahead buffer.
@@ -402,22 +436,27 @@ void AudioServer::_mix_step() {
 			buf[i] = playback->lookahead[i];
 		}
 
+		// Silence the part of the block before a scheduled start.
+		for (unsigned int i = 0; i < block_offset; i++) {
+			buf[LOOKAHEAD_BUFFER_SIZE + i] = AudioFrame(0, 0);
+		}
+
 		// Mix the audio stream.
-		unsigned int mixed_frames = playback->stream_playback->mix(&buf[LOOKAHEAD_BUFFER_SIZE], playback->pitch_scale.get(), buffer_size);
+		unsigned int mixed_frames = playback->stream_playback->mix(&buf[LOOKAHEAD_BUFFER_SIZE + block_offset], playback->pitch_scale.get(), buffer_size - block_offset);
 
 		if (tag_used_audio_streams && playback->stream_playback->is_playing()) {
 			playback->stream_playback->tag_used_streams();
 		}
 
 		// Check to see if the stream has run out of samples.
-		if (mixed_frames != buffer_size) {
+		if (mixed_frames != buffer_size - block_offset) {
 			// We know we have at least the size of our lookahead buffer for fade-out purposes.
 
 			float fadeout_base = 0.94;
 			float fadeout_coefficient = 1;
 			static_assert(LOOKAHEAD_BUFFER_SIZE == 64, "Update fadeout_base and comment here if you change LOOKAHEAD_BUFFER_SIZE.");
 			// 0.94 ^ 64 = 0.01906. There might still be a pop but it'll be way better than if we didn't do this.
-			for (unsigned int idx = mixed_frames; idx < buffer_size; idx++) {
+			for (unsigned int idx = block_offset + mixed_frames; idx < buffer_size; idx++) {
 				fadeout_coefficient *= fadeout_base;
 				buf[idx] *= fadeout_coefficient;
 			}
@@ -539,13 +578,16 @@ void AudioServer::_mix_step() {
 		Bus *bus = buses[i];
 
 		for (int k = 0; k < bus->channels.size(); k++) {
-			if (bus->channels[k].active && !bus->channels[k].used) {
+			if (bus->channels[k].active && !bus->channels[k].used && !bus->channels[k].buffer_clean) {
 				// Buffer was not used, but it's still active, so it must be cleaned.
+				// Remember that it was, so channels that stay quiescent are only zeroed once.
 				AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
 
 				for (uint32_t j = 0; j < buffer_size; j++) {
 					buf[j] = AudioFrame(0, 0);
 				}
+
+				bus->channels.write[k].buffer_clean = true;
 			}
 		}
 
@@ -573,6 +615,9 @@ void AudioServer::_mix_step() {
 						continue;
 					}
 					SWAP(bus->channels.write[k].buffer, temp_buffer.write[k]);
+					// The effect may have produced output (e.g. a reverb tail), so the
+					// buffer can no longer be assumed silent.
+					bus->channels.write[k].buffer_clean = false;
 				}
 
 #ifdef DEBUG_ENABLED
@@ -603,6 +648,18 @@ void AudioServer::_mix_step() {
 				continue;
 			}
 
+			if (!bus->channels[k].used && bus->channels[k].buffer_clean) {
+				// Nothing was mixed in and no effect produced output, so the channel holds
+				// pure silence. Skip the volume/peak scan and the send of zeros; not touching
+				// the target bus also leaves it unmarked, so a quiescent subtree winds down
+				// as a whole instead of each level keeping its send target awake.
+				bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+				if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
+					bus->channels.write[k].active = false;
+				}
+				continue;
+			}
+
 			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
 
 			AudioFrame peak = AudioFrame(0, 0);
@@ -619,18 +676,12 @@ void AudioServer::_mix_step() {
 				}
 			}
 
-			// Apply volume and compute peak.
+			// Apply volume and compute peak. Kept branchless so the loop can vectorize.
 			for (uint32_t j = 0; j < buffer_size; j++) {
 				buf[j] *= volume;
 
-				float l = Math::abs(buf[j].left);
-				if (l > peak.left) {
-					peak.left = l;
-				}
-				float r = Math::abs(buf[j].right);
-				if (r > peak.right) {
-					peak.right = r;
-				}
+				peak.left = MAX(peak.left, Math::abs(buf[j].left));
+				peak.right = MAX(peak.right, Math::abs(buf[j].right));
 			}
 
 			bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.left + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.right + AUDIO_PEAK_OFFSET));
@@ -681,9 +732,10 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 		p_processor_r->set_filter(&filter, /* clear_history= */ is_just_started);
 		p_processor_r->update_coeffs(buffer_size);
 
+		const float inv_buffer_size = 1.0f / buffer_size;
 		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
 			// TODO: Make lerp speed buffer-size-invariant if buffer_size ever becomes a project setting to avoid very small buffer sizes causing pops due to too-fast lerps.
-			float lerp_param = (float)frame_idx / buffer_size;
+			float lerp_param = (float)frame_idx * inv_buffer_size;
 			AudioFrame vol = p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start;
 			AudioFrame mixed = vol * p_source_buf[frame_idx];
 			p_processor_l->process_one_interp(mixed.left);
@@ -691,10 +743,17 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 			p_out_buf[frame_idx] += mixed;
 		}
 
+	} else if (p_vol_start.left == p_vol_final.left && p_vol_start.right == p_vol_final.right) {
+		// Steady-state volume, no ramp needed. This is the common case for every
+		// continuing voice and reduces to a constant-gain loop that vectorizes well.
+		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
+			p_out_buf[frame_idx] += p_vol_final * p_source_buf[frame_idx];
+		}
 	} else {
+		const float inv_buffer_size = 1.0f / buffer_size;
 		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
 			// TODO: Make lerp speed buffer-size-invariant if buffer_size ever becomes a project setting to avoid very small buffer sizes causing pops due to too-fast lerps.
-			float lerp_param = (float)frame_idx / buffer_size;
+			float lerp_param = (float)frame_idx * inv_buffer_size;
 			p_out_buf[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source_buf[frame_idx];
 		}
 	}
@@ -747,9 +806,12 @@ AudioFrame *AudioServer::thread_get_channel_mix_buffer(int p_bus, int p_buffer)
 		buses.write[p_bus]->channels.write[p_buffer].used = true;
 		buses.write[p_bus]->channels.write[p_buffer].active = true;
 		buses.write[p_bus]->channels.write[p_buffer].last_mix_with_audio = mix_frames;
-		for (uint32_t i = 0; i < buffer_size; i++) {
-			data[i] = AudioFrame(0, 0);
+		if (!buses[p_bus]->channels[p_buffer].buffer_clean) {
+			for (uint32_t i = 0; i < buffer_size; i++) {
+				data[i] = AudioFrame(0, 0);
+			}
 		}
+		buses.write[p_bus]->channels.write[p_buffer].buffer_clean = false;
 	}
 
 	return data;
@@ -1222,16 +1284,16 @@ float AudioServer::get_playback_speed_scale() const {
 	return playback_speed_scale;
 }
 
-void AudioServer::start_playback_stream(Ref<AudioStreamPlayback> p_playback, const StringName &p_bus, Vector<AudioFrame> p_volume_db_vector, float p_start_time, float p_pitch_scale) {
+void AudioServer::start_playback_stream(Ref<AudioStreamPlayback> p_playback, const StringName &p_bus, Vector<AudioFrame> p_volume_db_vector, float p_start_time, float p_pitch_scale, uint64_t p_scheduled_start_frame) {
 	ERR_FAIL_COND(p_playback.is_null());
 
 	HashMap<StringName, Vector<AudioFrame>> map;
 	map[p_bus] = p_volume_db_vector;
 
-	start_playback_stream(p_playback, map, p_start_time, p_pitch_scale);
+	start_playback_stream(p_playback, map, p_start_time, p_pitch_scale, 0, 0, p_scheduled_start_frame);
 }
 
-void AudioServer::start_playback_stream(Ref<AudioStreamPlayback> p_playback, const HashMap<StringName, Vector<AudioFrame>> &p_bus_volumes, float p_start_time, float p_pitch_scale, float p_highshelf_gain, float p_attenuation_cutoff_hz) {
+void AudioServer::start_playback_stream(Ref<AudioStreamPlayback> p_playback, const HashMap<StringName, Vector<AudioFrame>> &p_bus_volumes, float p_start_time, float p_pitch_scale, float p_highshelf_gain, float p_attenuation_cutoff_hz, uint64_t p_scheduled_start_frame) {
 	ERR_FAIL_COND(p_playback.is_null());
 
 	AudioStreamPlaybackListNode *playback_node = new AudioStreamPlaybackListNode();
@@ -1267,6 +1329,8 @@ void AudioServer::start_playback_stream(Ref<AudioStreamPlayback> p_playback, con
 		frame = AudioFrame(0, 0);
 	}
 
+	playback_node->scheduled_start_frame = p_scheduled_start_frame;
+
 	playback_node->state.store(AudioStreamPlaybackListNode::PLAYING);
 
 	playback_list.insert(playback_node);
@@ -2001,6 +2065,7 @@ void AudioServer::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_speaker_mode"), &AudioServer::get_speaker_mode);
 	ClassDB::bind_method(D_METHOD("get_mix_rate"), &AudioServer::get_mix_rate);
+	ClassDB::bind_method(D_METHOD("get_mixed_frames"), &AudioServer::get_mixed_frames);
 	ClassDB::bind_method(D_METHOD("get_input_mix_rate"), &AudioServer::get_input_mix_rate);
 
 	ClassDB::bind_method(D_METHOD("get_driver_name"), &AudioServer::get_driver_name);
@@ -33,6 +33,7 @@
 #include "core/math/audio_frame.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
+#include "core/os/thread.h"
 #include "core/templates/safe_list.h"
 #include "core/variant/variant.h"
 #include "servers/audio/audio_effect.h"
@@ -52,10 +53,10 @@ class AudioDriver {
 	uint64_t _last_mix_time = 0;
 	uint64_t _last_mix_frames = 0;
 
-#ifdef DEBUG_ENABLED
+	// Kept in release builds too; the driver-level counters are one clock
+	// read per mix callback and feed Performance.TIME_AUDIO_MIX.
 	SafeNumeric<uint64_t> prof_ticks;
 	SafeNumeric<uint64_t> prof_time;
-#endif
 
 protected:
 	Vector<int32_t> input_buffer;
@@ -69,13 +70,10 @@ protected:
 
 	int _get_configured_mix_rate();
 
-#ifdef DEBUG_ENABLED
+	Thread::Priority get_thread_priority() const;
+
 	_FORCE_INLINE_ void start_counting_ticks() { prof_ticks.set(OS::get_singleton()->get_ticks_usec()); }
 	_FORCE_INLINE_ void stop_counting_ticks() { prof_time.add(OS::get_singleton()->get_ticks_usec() - prof_ticks.get()); }
-#else
-	_FORCE_INLINE_ void start_counting_ticks() {}
-	_FORCE_INLINE_ void stop_counting_ticks() {}
-#endif
 
 public:
 	double get_time_since_last_mix(); //useful for video -> audio sync
@@ -126,10 +124,8 @@ public:
 	unsigned int get_input_position() { return input_position; }
 	unsigned int get_input_size() { return input_size; }
 
-#ifdef DEBUG_ENABLED
 	uint64_t get_profiling_time() const { return prof_time.get(); }
 	void reset_profiling_time() { prof_time.set(0); }
-#endif
 
 	// Samples handling.
 	virtual bool is_stream_registered_as_sample(const Ref<AudioStream> &p_stream) const {
@@ -244,6 +240,9 @@ private:
 		struct Channel {
 			bool used = false;
 			bool active = false;
+			// Whether the buffer is known to hold pure silence, so quiescent
+			// channels are only zeroed once and can skip scanning and sending.
+			bool buffer_clean = false;
 			AudioFrame peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
 			Vector<AudioFrame> buffer;
 			Vector<Ref<AudioEffectInstance>> effect_instances;
@@ -305,6 +304,9 @@ private:
 		AudioStreamPlaybackBusDetails *prev_bus_details = nullptr;
 		// The next few samples are stored here so we have some time to fade audio out if it ends abruptly at the beginning of the next mix.
 		AudioFrame lookahead[LOOKAHEAD_BUFFER_SIZE];
+		// Absolute output frame (see mix_frames) at which this playback should start mixing. Zero starts immediately.
+		// Only read and cleared by the audio thread once the node is in the playback list.
+		uint64_t scheduled_start_frame = 0;
 	};
 
 	SafeList<AudioStreamPlaybackListNode *> playback_list;
@@ -428,9 +430,9 @@ public:
 	float get_playback_speed_scale() const;
 
 	// Convenience method.
-	void start_playback_stream(Ref<AudioStreamPlayback> p_playback, const StringName &p_bus, Vector<AudioFrame> p_volume_db_vector, float p_start_time = 0, float p_pitch_scale = 1);
+	void start_playback_stream(Ref<AudioStreamPlayback> p_playback, const StringName &p_bus, Vector<AudioFrame> p_volume_db_vector, float p_start_time = 0, float p_pitch_scale = 1, uint64_t p_scheduled_start_frame = 0);
 	// Expose all parameters.
-	void start_playback_stream(Ref<AudioStreamPlayback> p_playback, const HashMap<StringName, Vector<AudioFrame>> &p_bus_volumes, float p_start_time = 0, float p_pitch_scale = 1, float p_highshelf_gain = 0, float p_attenuation_cutoff_hz = 0);
+	void start_playback_stream(Ref<AudioStreamPlayback> p_playback, const HashMap<StringName, Vector<AudioFrame>> &p_bus_volumes, float p_start_time = 0, float p_pitch_scale = 1, float p_highshelf_gain = 0, float p_attenuation_cutoff_hz = 0, uint64_t p_scheduled_start_frame = 0);
 	void stop_playback_stream(Ref<AudioStreamPlayback> p_playback);
 
 	void set_playback_bus_exclusive(Ref<AudioStreamPlayback> p_playback, const StringName &p_bus, Vector<AudioFrame> p_volumes);
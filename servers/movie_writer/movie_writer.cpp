@@ -140,6 +140,20 @@ void MovieWriter::begin(const Size2i &p_movie_size, uint32_t p_fps, const String
 	audio_mix_buffer.resize(mix_rate * audio_channels / fps);
 
 	write_begin(actual_movie_size, p_fps, p_base_path);
+
+	encoding_use_thread = false;
+	if (!GDVIRTUAL_IS_OVERRIDDEN(_write_frame)) {
+		for (uint32_t i = 0; i < ENCODING_RING_SIZE; i++) {
+			encoding_ring[i].audio.resize(audio_mix_buffer.size());
+			encoding_slots_available.post();
+		}
+		encoding_ring_write_pos = 0;
+		encoding_ring_read_pos = 0;
+		encoding_thread.start(_encoding_thread_func, this);
+		// On platforms without threads the start is a no-op, which leaves the
+		// synchronous path in add_frame() active.
+		encoding_use_thread = encoding_thread.is_started();
+	}
 }
 
 void MovieWriter::_bind_methods() {
@@ -216,6 +230,19 @@ void MovieWriter::add_frame() {
 	cpu_time += RenderingServer::get_singleton()->get_frame_setup_time_cpu();
 	gpu_time += RenderingServer::get_singleton()->viewport_get_measured_render_time_gpu(main_vp_rid);
 
+	if (encoding_use_thread) {
+		// Hand the frame off to the encoding thread, waiting only when all
+		// ring slots are still being encoded.
+		encoding_slots_available.wait();
+		EncodingSlot &slot = encoding_ring[encoding_ring_write_pos % ENCODING_RING_SIZE];
+		slot.image = vp_tex;
+		AudioDriverDummy::get_dummy_singleton()->mix_audio(mix_rate / fps, slot.audio.ptr());
+		encoding_ring_write_pos++;
+		encoding_frames_pending.increment();
+		encoding_frames_available.post();
+		return;
+	}
+
 	AudioDriverDummy::get_dummy_singleton()->mix_audio(mix_rate / fps, audio_mix_buffer.ptr());
 
 	uint64_t encoding_start_usec = Time::get_singleton()->get_ticks_usec();
@@ -224,7 +251,37 @@ void MovieWriter::add_frame() {
 	encoding_time_usec += encoding_end_usec - encoding_start_usec;
 }
 
+void MovieWriter::_encoding_thread_func(void *p_writer) {
+	static_cast<MovieWriter *>(p_writer)->_run_encoding_thread();
+}
+
+void MovieWriter::_run_encoding_thread() {
+	while (true) {
+		encoding_frames_available.wait();
+		if (encoding_frames_pending.get() == 0) {
+			break; // Woken by end() with nothing left to encode.
+		}
+		EncodingSlot &slot = encoding_ring[encoding_ring_read_pos % ENCODING_RING_SIZE];
+		uint64_t encoding_start_usec = Time::get_singleton()->get_ticks_usec();
+		write_frame(slot.image, slot.audio.ptr());
+		uint64_t encoding_end_usec = Time::get_singleton()->get_ticks_usec();
+		encoding_time_usec += encoding_end_usec - encoding_start_usec;
+		slot.image.unref();
+		encoding_ring_read_pos++;
+		encoding_frames_pending.decrement();
+		encoding_slots_available.post();
+	}
+}
+
 void MovieWriter::end() {
+	if (encoding_use_thread) {
+		// Let the encoding thread drain the remaining frames, then wake it one
+		// last time so it can exit.
+		encoding_frames_available.post();
+		encoding_thread.wait_to_finish();
+		encoding_use_thread = false;
+	}
+
 	uint64_t encoding_start_usec = Time::get_singleton()->get_ticks_usec();
 	write_end();
 	uint64_t encoding_end_usec = Time::get_singleton()->get_ticks_usec();
@@ -31,7 +31,10 @@
 #pragma once
 
 #include "core/io/image.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
 #include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "servers/audio/audio_server.h"
 
 class MovieWriter : public Object {
@@ -49,6 +52,30 @@ class MovieWriter : public Object {
 
 	LocalVector<int32_t> audio_mix_buffer;
 
+	// Pipelined encoding. Captured frames are handed to a dedicated thread
+	// through a small ring of pre-allocated slots, so encoding and file I/O
+	// overlap with rendering of the next frame instead of blocking the main
+	// loop. Script writers keep the synchronous path, as their virtual methods
+	// are not expected to be called from a thread.
+	enum {
+		ENCODING_RING_SIZE = 4
+	};
+	struct EncodingSlot {
+		Ref<Image> image;
+		LocalVector<int32_t> audio;
+	};
+	EncodingSlot encoding_ring[ENCODING_RING_SIZE];
+	Thread encoding_thread;
+	Semaphore encoding_frames_available;
+	Semaphore encoding_slots_available;
+	SafeNumeric<uint32_t> encoding_frames_pending;
+	uint32_t encoding_ring_write_pos = 0;
+	uint32_t encoding_ring_read_pos = 0; // Only touched by the encoding thread.
+	bool encoding_use_thread = false;
+
+	static void _encoding_thread_func(void *p_writer);
+	void _run_encoding_thread();
+
 	enum {
 		MAX_WRITERS = 8
 	};
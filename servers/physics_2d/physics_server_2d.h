@@ -283,6 +283,12 @@ public:
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
 
+	// Bulk capture and restore of the dynamic state of every body in a space,
+	// for rollback resimulation. A snapshot is only valid for restoring while
+	// the set of objects in the space is unchanged.
+	virtual PackedFloat64Array space_snapshot_body_states(RID p_space) const = 0;
+	virtual void space_restore_body_states(RID p_space, const PackedFloat64Array &p_snapshot) = 0;
+
 	//missing space parameters
 
 	/* AREA API */
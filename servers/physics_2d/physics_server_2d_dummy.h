@@ -164,6 +164,9 @@ public:
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const override { return Vector<Vector2>(); }
 	virtual int space_get_contact_count(RID p_space) const override { return 0; }
 
+	virtual PackedFloat64Array space_snapshot_body_states(RID p_space) const override { return PackedFloat64Array(); }
+	virtual void space_restore_body_states(RID p_space, const PackedFloat64Array &p_snapshot) override {}
+
 	/* AREA API */
 
 	virtual RID area_create() override { return RID(); }
@@ -241,6 +241,9 @@ public:
 	EXBIND1RC(Vector<Vector2>, space_get_contacts, RID)
 	EXBIND1RC(int, space_get_contact_count, RID)
 
+	EXBIND1RC(PackedFloat64Array, space_snapshot_body_states, RID)
+	EXBIND2(space_restore_body_states, RID, const PackedFloat64Array &)
+
 	/* AREA API */
 
 	//EXBIND0RID(area);
@@ -128,6 +128,16 @@ public:
 		return physics_server_2d->space_get_contact_count(p_space);
 	}
 
+	virtual PackedFloat64Array space_snapshot_body_states(RID p_space) const override {
+		ERR_FAIL_COND_V(!Thread::is_main_thread(), PackedFloat64Array());
+		return physics_server_2d->space_snapshot_body_states(p_space);
+	}
+
+	virtual void space_restore_body_states(RID p_space, const PackedFloat64Array &p_snapshot) override {
+		ERR_FAIL_COND(!Thread::is_main_thread());
+		physics_server_2d->space_restore_body_states(p_space, p_snapshot);
+	}
+
 	/* AREA API */
 
 	//FUNC0RID(area);
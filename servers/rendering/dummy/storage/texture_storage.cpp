@@ -30,12 +30,17 @@
 
 #include "texture_storage.h"
 
+#include "core/config/project_settings.h"
+
 using namespace RendererDummy;
 
 TextureStorage *TextureStorage::singleton = nullptr;
 
 TextureStorage::TextureStorage() {
 	singleton = this;
+	// Read directly because the dummy rasterizer can be created before
+	// RenderingServer::init() registers the setting's default.
+	retain_data = ProjectSettings::get_singleton()->get_setting("rendering/textures/dummy/retain_data", true);
 }
 
 TextureStorage::~TextureStorage() {
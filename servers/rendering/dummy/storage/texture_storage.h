@@ -43,6 +43,11 @@ private:
 	};
 	mutable RID_PtrOwner<DummyTexture> texture_owner;
 
+	// When false, texture data handed to the dummy renderer is dropped
+	// instead of copied, so headless processes don't keep every texture's
+	// pixels in memory. Controlled by rendering/textures/dummy/retain_data.
+	bool retain_data = true;
+
 public:
 	static TextureStorage *get_singleton() { return singleton; }
 
@@ -82,7 +87,9 @@ public:
 	virtual void texture_2d_initialize(RID p_texture, const Ref<Image> &p_image) override {
 		DummyTexture *t = texture_owner.get_or_null(p_texture);
 		ERR_FAIL_NULL(t);
-		t->image = p_image->duplicate();
+		if (retain_data) {
+			t->image = p_image->duplicate();
+		}
 	}
 	virtual void texture_2d_layered_initialize(RID p_texture, const Vector<Ref<Image>> &p_layers, RS::TextureLayeredType p_layered_type) override {}
 	virtual void texture_3d_initialize(RID p_texture, Image::Format, int p_width, int p_height, int p_depth, bool p_mipmaps, const Vector<Ref<Image>> &p_data) override {}
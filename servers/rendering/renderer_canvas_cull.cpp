@@ -75,8 +75,13 @@ void RendererCanvasCull::_render_canvas_item_tree(RID p_to_render_target, Canvas
 	// transform is normally concatenated with the item global transform.
 	_current_camera_transform = p_transform;
 
-	memset(z_list, 0, z_range * sizeof(RendererCanvasRender::Item *));
-	memset(z_last_list, 0, z_range * sizeof(RendererCanvasRender::Item *));
+	// Entries outside the range used by the previous cull are still null.
+	if (z_used_min <= z_used_max) {
+		memset(&z_list[z_used_min], 0, (z_used_max - z_used_min + 1) * sizeof(RendererCanvasRender::Item *));
+		memset(&z_last_list[z_used_min], 0, (z_used_max - z_used_min + 1) * sizeof(RendererCanvasRender::Item *));
+	}
+	z_used_min = z_range;
+	z_used_max = -1;
 
 	for (int i = 0; i < p_child_item_count; i++) {
 		_cull_canvas_item(p_child_items[i].item, p_transform, p_clip_rect, Color(1, 1, 1, 1), 0, z_list, z_last_list, nullptr, nullptr, false, p_canvas_cull_mask, Point2(), 1, nullptr);
@@ -85,7 +90,7 @@ void RendererCanvasCull::_render_canvas_item_tree(RID p_to_render_target, Canvas
 	RendererCanvasRender::Item *list = nullptr;
 	RendererCanvasRender::Item *list_end = nullptr;
 
-	for (int i = 0; i < z_range; i++) {
+	for (int i = z_used_min; i <= z_used_max; i++) {
 		if (!z_list[i]) {
 			continue;
 		}
@@ -266,24 +271,34 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 		if (ci->commands != nullptr || ci->copy_back_buffer) {
 			ci->final_transform = !ci->use_identity_transform ? p_transform : _current_camera_transform;
 			ci->final_modulate = p_modulate * ci->self_modulate;
-			ci->global_rect_cache = p_global_rect;
-			ci->global_rect_cache.position -= p_clip_rect.position;
-			ci->light_masked = false;
 
-			int zidx = p_z - RS::CANVAS_ITEM_Z_MIN;
+			// A fully transparent item using the built-in material can't produce any
+			// fragments, so don't send it to the renderer at all. Items with a material
+			// are still drawn, as a custom shader is free to ignore the modulate alpha.
+			// Backbuffer copies and canvas groups keep running for their side effects.
+			bool skip_fully_transparent = ci->final_modulate.a <= 0.0f && ci->material.is_null() && !ci->use_parent_material && !ci->copy_back_buffer && ci->canvas_group == nullptr;
+			if (!skip_fully_transparent) {
+				ci->global_rect_cache = p_global_rect;
+				ci->global_rect_cache.position -= p_clip_rect.position;
+				ci->light_masked = false;
 
-			if (r_z_last_list[zidx]) {
-				r_z_last_list[zidx]->next = ci;
-				r_z_last_list[zidx] = ci;
+				int zidx = p_z - RS::CANVAS_ITEM_Z_MIN;
+				z_used_min = MIN(z_used_min, zidx);
+				z_used_max = MAX(z_used_max, zidx);
 
-			} else {
-				r_z_list[zidx] = ci;
-				r_z_last_list[zidx] = ci;
-			}
+				if (r_z_last_list[zidx]) {
+					r_z_last_list[zidx]->next = ci;
+					r_z_last_list[zidx] = ci;
+
+				} else {
+					r_z_list[zidx] = ci;
+					r_z_last_list[zidx] = ci;
+				}
 
-			ci->z_final = p_z;
+				ci->z_final = p_z;
 
-			ci->next = nullptr;
+				ci->next = nullptr;
+			}
 		}
 
 		if (ci->visibility_notifier) {
@@ -441,7 +456,9 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 			}
 
 			child_item_count = ci->ysort_children_count + 1;
-			child_items = (Item **)alloca(child_item_count * sizeof(Item *));
+			// Arena instead of alloca: y-sorted hierarchies can hold thousands
+			// of items, which would risk blowing the stack.
+			child_items = (Item **)cull_arena.alloc(child_item_count * sizeof(Item *));
 
 			ci->ysort_xform = Transform2D();
 			ci->ysort_modulate = Color(1, 1, 1, 1) / ci->modulate;
@@ -494,6 +511,10 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 void RendererCanvasCull::render_canvas(RID p_render_target, Canvas *p_canvas, const Transform2D &p_transform, RendererCanvasRender::Light *p_lights, RendererCanvasRender::Light *p_directional_lights, const Rect2 &p_clip_rect, RenderingServer::CanvasItemTextureFilter p_default_filter, RenderingServer::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_transforms_to_pixel, bool p_snap_2d_vertices_to_pixel, uint32_t canvas_cull_mask, RenderingMethod::RenderInfo *r_render_info) {
 	RENDER_TIMESTAMP("> Render Canvas");
 
+	// All scratch allocations made while culling are dead once the previous
+	// call returned, so the arena blocks can simply be reused.
+	cull_arena.reset();
+
 	sdf_used = false;
 	snapping_2d_transforms_to_pixel = p_snap_2d_transforms_to_pixel;
 
@@ -652,6 +673,18 @@ void RendererCanvasCull::canvas_item_set_transform(RID p_item, const Transform2D
 	canvas_item->xform_curr = p_transform;
 }
 
+void RendererCanvasCull::canvas_item_set_transforms_bulk(const Vector<RID> &p_items, const Vector<Transform2D> &p_transforms) {
+	ERR_FAIL_COND(p_items.size() != p_transforms.size());
+
+	// One command queue message for the whole batch; each entry goes through the
+	// regular setter so the interpolation update list behaves as usual.
+	const RID *items = p_items.ptr();
+	const Transform2D *transforms = p_transforms.ptr();
+	for (int i = 0; i < p_items.size(); i++) {
+		canvas_item_set_transform(items[i], transforms[i]);
+	}
+}
+
 void RendererCanvasCull::canvas_item_set_visibility_layer(RID p_item, uint32_t p_visibility_layer) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
@@ -1662,6 +1695,43 @@ void RendererCanvasCull::canvas_item_add_texture_rect_region(RID p_item, const R
 	}
 }
 
+void RendererCanvasCull::canvas_item_add_texture_rect_region_batch(RID p_item, RID p_texture, const Vector<Rect2> &p_rects, const Vector<Rect2> &p_src_rects, const Color &p_modulate) {
+	ERR_FAIL_COND(p_rects.size() != p_src_rects.size());
+	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
+	ERR_FAIL_NULL(canvas_item);
+
+	const Rect2 *rects = p_rects.ptr();
+	const Rect2 *src_rects = p_src_rects.ptr();
+	for (int i = 0; i < p_rects.size(); i++) {
+		Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
+		ERR_FAIL_NULL(rect);
+		rect->modulate = p_modulate;
+		rect->rect = rects[i];
+
+		rect->texture = p_texture;
+
+		rect->source = src_rects[i];
+		rect->flags = RendererCanvasRender::CANVAS_RECT_REGION;
+
+		if (rect->rect.size.x < 0) {
+			rect->flags |= RendererCanvasRender::CANVAS_RECT_FLIP_H;
+			rect->rect.size.x = -rect->rect.size.x;
+		}
+		if (rect->source.size.x < 0) {
+			rect->flags ^= RendererCanvasRender::CANVAS_RECT_FLIP_H;
+			rect->source.size.x = -rect->source.size.x;
+		}
+		if (rect->rect.size.y < 0) {
+			rect->flags |= RendererCanvasRender::CANVAS_RECT_FLIP_V;
+			rect->rect.size.y = -rect->rect.size.y;
+		}
+		if (rect->source.size.y < 0) {
+			rect->flags ^= RendererCanvasRender::CANVAS_RECT_FLIP_V;
+			rect->source.size.y = -rect->source.size.y;
+		}
+	}
+}
+
 void RendererCanvasCull::canvas_item_add_nine_patch(RID p_item, const Rect2 &p_rect, const Rect2 &p_source, RID p_texture, const Vector2 &p_topleft, const Vector2 &p_bottomright, RS::NinePatchAxisMode p_x_axis_mode, RS::NinePatchAxisMode p_y_axis_mode, bool p_draw_center, const Color &p_modulate) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
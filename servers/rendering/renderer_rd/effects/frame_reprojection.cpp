@@ -0,0 +1,135 @@
+/**************************************************************************/
+/*  frame_reprojection.cpp                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "frame_reprojection.h"
+#include "servers/rendering/renderer_rd/effects/copy_effects.h"
+#include "servers/rendering/renderer_rd/framebuffer_cache_rd.h"
+#include "servers/rendering/renderer_rd/storage_rd/material_storage.h"
+#include "servers/rendering/renderer_rd/storage_rd/texture_storage.h"
+#include "servers/rendering/renderer_rd/uniform_set_cache_rd.h"
+
+using namespace RendererRD;
+
+FrameReprojection::FrameReprojection() {
+	Vector<String> modes;
+	modes.push_back("");
+	reprojection_shader.initialize(modes);
+	shader_version = reprojection_shader.version_create();
+	pipeline = RD::get_singleton()->compute_pipeline_create(reprojection_shader.version_get_shader(shader_version, 0));
+}
+
+FrameReprojection::~FrameReprojection() {
+	reprojection_shader.version_free(shader_version);
+}
+
+bool FrameReprojection::process(Ref<RenderSceneBuffersRD> p_render_buffers) {
+	UniformSetCacheRD *uniform_set_cache = UniformSetCacheRD::get_singleton();
+	ERR_FAIL_NULL_V(uniform_set_cache, false);
+	MaterialStorage *material_storage = MaterialStorage::get_singleton();
+	ERR_FAIL_NULL_V(material_storage, false);
+	TextureStorage *texture_storage = TextureStorage::get_singleton();
+	ERR_FAIL_NULL_V(texture_storage, false);
+	CopyEffects *copy_effects = CopyEffects::get_singleton();
+	ERR_FAIL_NULL_V(copy_effects, false);
+
+	// Stereo rendering needs per-view reprojection and is better served by the
+	// XR runtime's own compositor.
+	if (p_render_buffers->get_view_count() != 1) {
+		return false;
+	}
+
+	if (!p_render_buffers->has_velocity_buffer(false)) {
+		return false;
+	}
+
+	Size2i target_size = p_render_buffers->get_target_size();
+
+	if (!p_render_buffers->has_texture(SNAME("frame_reprojection"), SNAME("history"))) {
+		// History is captured at the end of the next rendered frame; until then
+		// there is nothing to reproject from.
+		p_render_buffers->create_texture(SNAME("frame_reprojection"), SNAME("history"), RD::DATA_FORMAT_R16G16B16A16_SFLOAT, RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_COLOR_ATTACHMENT_BIT, RD::TEXTURE_SAMPLES_1, target_size, 1);
+		p_render_buffers->create_texture(SNAME("frame_reprojection"), SNAME("temp"), RD::DATA_FORMAT_R16G16B16A16_SFLOAT, RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_STORAGE_BIT, RD::TEXTURE_SAMPLES_1, target_size, 1);
+		return false;
+	}
+
+	RID shader = reprojection_shader.version_get_shader(shader_version, 0);
+	ERR_FAIL_COND_V(shader.is_null(), false);
+
+	RID history = p_render_buffers->get_texture(SNAME("frame_reprojection"), SNAME("history"));
+	RID temp = p_render_buffers->get_texture(SNAME("frame_reprojection"), SNAME("temp"));
+	RID velocity = p_render_buffers->get_velocity_buffer(false);
+	RID default_sampler = material_storage->sampler_rd_get_default(RS::CANVAS_ITEM_TEXTURE_FILTER_LINEAR, RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED);
+
+	RD::get_singleton()->draw_command_begin_label("Frame Reprojection");
+
+	FrameReprojectionPushConstant push_constant;
+	memset(&push_constant, 0, sizeof(FrameReprojectionPushConstant));
+	push_constant.resolution[0] = target_size.width;
+	push_constant.resolution[1] = target_size.height;
+	// Half a frame forward from the last rendered frame, which sits halfway
+	// between it and the next one.
+	push_constant.motion_scale = 0.5f;
+
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, pipeline);
+
+	RD::Uniform u_source_color(RD::UNIFORM_TYPE_SAMPLER_WITH_TEXTURE, 0, { default_sampler, history });
+	RD::Uniform u_source_velocity(RD::UNIFORM_TYPE_SAMPLER_WITH_TEXTURE, 1, { default_sampler, velocity });
+	RD::Uniform u_dest_color(RD::UNIFORM_TYPE_IMAGE, 2, { temp });
+
+	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, uniform_set_cache->get_cache(shader, 0, u_source_color, u_source_velocity, u_dest_color), 0);
+	RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(FrameReprojectionPushConstant));
+	RD::get_singleton()->compute_list_dispatch_threads(compute_list, target_size.width, target_size.height, 1);
+	RD::get_singleton()->compute_list_end();
+
+	RID dest_fb = texture_storage->render_target_get_rd_framebuffer(p_render_buffers->get_render_target());
+	copy_effects->copy_to_fb_rect(temp, dest_fb, Rect2i(Point2i(), target_size));
+
+	RD::get_singleton()->draw_command_end_label();
+
+	return true;
+}
+
+void FrameReprojection::store_history(Ref<RenderSceneBuffersRD> p_render_buffers) {
+	if (!p_render_buffers->has_texture(SNAME("frame_reprojection"), SNAME("history"))) {
+		return;
+	}
+
+	TextureStorage *texture_storage = TextureStorage::get_singleton();
+	ERR_FAIL_NULL(texture_storage);
+	CopyEffects *copy_effects = CopyEffects::get_singleton();
+	ERR_FAIL_NULL(copy_effects);
+
+	RID rt_texture = texture_storage->render_target_get_rd_texture(p_render_buffers->get_render_target());
+	RID history = p_render_buffers->get_texture(SNAME("frame_reprojection"), SNAME("history"));
+	RID history_fb = FramebufferCacheRD::get_singleton()->get_cache(history);
+
+	copy_effects->copy_to_fb_rect(rt_texture, history_fb, Rect2i(Point2i(), p_render_buffers->get_target_size()));
+}
@@ -1189,9 +1189,13 @@ void GI::SDFGI::update(RID p_env, const Vector3 &p_world_position) {
 
 	int32_t drag_margin = (cascade_size / SDFGI::PROBE_DIVISOR) / 2;
 
+	uint32_t full_rebuilds = 0;
+
 	for (SDFGI::Cascade &cascade : cascades) {
 		cascade.dirty_regions = Vector3i();
 
+		Vector3i prev_position = cascade.position;
+
 		Vector3 probe_half_size = Vector3(1, 1, 1) * cascade.cell_size * float(cascade_size / SDFGI::PROBE_DIVISOR) * 0.5;
 		probe_half_size = Vector3(0, 0, 0);
 
@@ -1234,6 +1238,18 @@ void GI::SDFGI::update(RID p_env, const Vector3 &p_world_position) {
 				cascade.dirty_regions = SDFGI::Cascade::DIRTY_ALL;
 			}
 		}
+
+		if (cascade.dirty_regions == SDFGI::Cascade::DIRTY_ALL) {
+			if (gi->sdfgi_max_cascade_rebuilds_per_frame > 0 && full_rebuilds >= gi->sdfgi_max_cascade_rebuilds_per_frame) {
+				//rebuild budget for this frame is spent, leave the cascade where it was
+				//so the full re-render is attempted again next frame instead of
+				//voxelizing every cascade in a single frame (e.g. after a teleport)
+				cascade.position = prev_position;
+				cascade.dirty_regions = Vector3i();
+			} else {
+				full_rebuilds++;
+			}
+		}
 	}
 }
 
@@ -3370,6 +3386,7 @@ GI::GI() {
 	sdfgi_ray_count = RS::EnvironmentSDFGIRayCount(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/probe_ray_count")), 0, int32_t(RS::ENV_SDFGI_RAY_COUNT_MAX - 1)));
 	sdfgi_frames_to_converge = RS::EnvironmentSDFGIFramesToConverge(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/frames_to_converge")), 0, int32_t(RS::ENV_SDFGI_CONVERGE_MAX - 1)));
 	sdfgi_frames_to_update_light = RS::EnvironmentSDFGIFramesToUpdateLight(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/frames_to_update_lights")), 0, int32_t(RS::ENV_SDFGI_UPDATE_LIGHT_MAX - 1)));
+	sdfgi_max_cascade_rebuilds_per_frame = uint32_t(MAX(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/max_cascade_rebuilds_per_frame")), 0));
 }
 
 GI::~GI() {
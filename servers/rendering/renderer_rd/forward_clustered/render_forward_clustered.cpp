@@ -317,6 +317,15 @@ void RenderForwardClustered::_render_list_template(RenderingDevice::DrawListID p
 	RID prev_index_array_rd;
 	RID prev_xforms_uniform_set;
 
+	// Consecutive elements often share the same mesh surface (many instances of
+	// one mesh that can't merge into a single draw); cache the vertex array
+	// lookup so only the first of them pays for it.
+	void *prev_mesh_surface = nullptr;
+	uint64_t prev_input_mask = 0;
+	bool prev_motion_vectors = false;
+	RID cached_vertex_array_rd;
+	RD::VertexFormatID cached_vertex_format = -1;
+
 	SceneShaderForwardClustered::ShaderData *shader = nullptr;
 	SceneShaderForwardClustered::ShaderData *prev_shader = nullptr;
 	SceneShaderForwardClustered::ShaderData::PipelineKey pipeline_key;
@@ -498,8 +507,16 @@ void RenderForwardClustered::_render_list_template(RenderingDevice::DrawListID p
 			uint64_t input_mask = shader->get_vertex_input_mask(pipeline_key.version, pipeline_key.color_pass_flags, pipeline_key.ubershader);
 			if (surf->owner->mesh_instance.is_valid()) {
 				mesh_storage->mesh_instance_surface_get_vertex_arrays_and_format(surf->owner->mesh_instance, surf->surface_index, input_mask, pipeline_motion_vectors, vertex_array_rd, vertex_format);
+			} else if (mesh_surface == prev_mesh_surface && input_mask == prev_input_mask && pipeline_motion_vectors == prev_motion_vectors) {
+				vertex_array_rd = cached_vertex_array_rd;
+				vertex_format = cached_vertex_format;
 			} else {
 				mesh_storage->mesh_surface_get_vertex_arrays_and_format(mesh_surface, input_mask, pipeline_motion_vectors, vertex_array_rd, vertex_format);
+				prev_mesh_surface = mesh_surface;
+				prev_input_mask = input_mask;
+				prev_motion_vectors = pipeline_motion_vectors;
+				cached_vertex_array_rd = vertex_array_rd;
+				cached_vertex_format = vertex_format;
 			}
 
 			pipeline_key.vertex_format_id = vertex_format;
@@ -783,6 +800,54 @@ void RenderForwardClustered::SceneState::grow_instance_buffer(RenderListType p_r
 	}
 }
 
+void RenderForwardClustered::_group_repeated_surfaces(RenderListType p_render_list) {
+	if (auto_instance_group_threshold == 0) {
+		return;
+	}
+
+	RenderList *rl = &render_list[p_render_list];
+	uint32_t element_total = rl->elements.size();
+	if (element_total < auto_instance_group_threshold) {
+		return;
+	}
+
+	// The low 16 bits of sort_key1 hold the lod index, the shadow/GI flags and
+	// the depth layer; everything above identifies the surface's geometry and
+	// material, which is what defines an instancing group.
+	const uint64_t group_mask = ~uint64_t(0xFFFF);
+
+	auto_instance_histogram.clear();
+
+	for (uint32_t i = 0; i < element_total; i++) {
+		const GeometryInstanceSurfaceDataCache *surface = rl->elements[i];
+		if (surface->owner->mesh_instance.is_valid() || (surface->owner->flags_cache & INSTANCE_DATA_FLAG_MULTIMESH)) {
+			continue; // Can't be drawn instanced, see _fill_instance_data().
+		}
+		uint64_t group_key = hash_murmur3_one_64(surface->sort.sort_key2, hash_murmur3_one_64(surface->sort.sort_key1 & group_mask));
+		uint32_t *count = auto_instance_histogram.getptr(group_key);
+		if (count != nullptr) {
+			(*count)++;
+		} else {
+			auto_instance_histogram.insert(group_key, 1);
+		}
+	}
+
+	for (uint32_t i = 0; i < element_total; i++) {
+		GeometryInstanceSurfaceDataCache *surface = rl->elements[i];
+		if (surface->owner->mesh_instance.is_valid() || (surface->owner->flags_cache & INSTANCE_DATA_FLAG_MULTIMESH)) {
+			continue;
+		}
+		uint64_t group_key = hash_murmur3_one_64(surface->sort.sort_key2, hash_murmur3_one_64(surface->sort.sort_key1 & group_mask));
+		const uint32_t *count = auto_instance_histogram.getptr(group_key);
+		if (count != nullptr && *count >= auto_instance_group_threshold) {
+			// Trading the front-to-back depth layering of these elements for a
+			// single instanced draw is worth it for groups this large; the depth
+			// layer is recomputed from the camera on the next list build anyway.
+			surface->sort.depth_layer = 0;
+		}
+	}
+}
+
 void RenderForwardClustered::_fill_instance_data(RenderListType p_render_list, int *p_render_info, uint32_t p_offset, int32_t p_max_elements, bool p_update_buffer) {
 	RenderList *rl = &render_list[p_render_list];
 	uint32_t element_total = p_max_elements >= 0 ? uint32_t(p_max_elements) : rl->elements.size();
@@ -1080,7 +1145,12 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 			// LOD
 			if (p_render_data->scene_data->screen_mesh_lod_threshold > 0.0 && mesh_storage->mesh_surface_has_lod(surf->surface)) {
 				uint32_t indices = 0;
-				surf->sort.lod_index = mesh_storage->mesh_surface_get_lod(surf->surface, inst->lod_model_scale * inst->lod_bias, lod_distance * p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, indices);
+				// Hysteresis is only tracked for camera passes; shadow passes use their own thresholds and would pollute the stored level.
+				const bool use_lod_hysteresis = p_render_list != RENDER_LIST_SECONDARY;
+				surf->sort.lod_index = mesh_storage->mesh_surface_get_lod(surf->surface, inst->lod_model_scale * inst->lod_bias, lod_distance * p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, indices, use_lod_hysteresis ? surf->previous_lod_index : -1);
+				if (use_lod_hysteresis) {
+					surf->previous_lod_index = surf->sort.lod_index;
+				}
 				if (p_render_data->render_info) {
 					indices = _indices_to_primitives(surf->primitive, indices);
 					if (p_render_list == RENDER_LIST_OPAQUE) { //opaque
@@ -1866,6 +1936,8 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 	_update_render_base_uniform_set();
 
 	_fill_render_list(RENDER_LIST_OPAQUE, p_render_data, PASS_MODE_COLOR, using_sdfgi, using_sdfgi || using_voxelgi, using_motion_pass);
+	_group_repeated_surfaces(RENDER_LIST_OPAQUE);
+	_group_repeated_surfaces(RENDER_LIST_MOTION);
 	render_list[RENDER_LIST_OPAQUE].sort_by_key();
 	render_list[RENDER_LIST_MOTION].sort_by_key();
 	render_list[RENDER_LIST_ALPHA].sort_by_reverse_depth_and_priority();
@@ -5092,6 +5164,8 @@ RenderForwardClustered::RenderForwardClustered() {
 	_update_shader_quality_settings();
 	_update_global_pipeline_data_requirements_from_project();
 
+	auto_instance_group_threshold = GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/batching/auto_instancing/group_size_threshold", PROPERTY_HINT_RANGE, "0,256,1"), 0);
+
 	taa = memnew(RendererRD::TAA);
 	fsr2_effect = memnew(RendererRD::FSR2Effect);
 	ss_effects = memnew(RendererRD::SSEffects);
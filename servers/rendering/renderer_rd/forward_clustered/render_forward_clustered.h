@@ -526,6 +526,7 @@ private:
 		uint32_t flags = 0;
 		uint32_t surface_index = 0;
 		uint32_t color_pass_inclusion_mask = 0;
+		uint8_t previous_lod_index = 0; // Level selected for the last camera pass, used for LOD hysteresis.
 
 		void *surface = nullptr;
 		RID material_uniform_set;
@@ -724,6 +725,13 @@ private:
 
 	RenderList render_list[RENDER_LIST_MAX];
 
+	// Auto-instancing: groups of identical surfaces above the threshold give up
+	// their depth layer so they sort contiguously and collapse into a single
+	// instanced draw in _fill_instance_data().
+	uint32_t auto_instance_group_threshold = 0;
+	HashMap<uint64_t, uint32_t> auto_instance_histogram;
+	void _group_repeated_surfaces(RenderListType p_render_list);
+
 	virtual void _update_shader_quality_settings() override;
 
 	/* Effects */
@@ -2121,7 +2121,12 @@ void RenderForwardMobile::_fill_render_list(RenderListType p_render_list, const
 
 			if (p_render_data->scene_data->screen_mesh_lod_threshold > 0.0 && mesh_storage->mesh_surface_has_lod(surf->surface)) {
 				uint32_t indices = 0;
-				surf->sort.lod_index = mesh_storage->mesh_surface_get_lod(surf->surface, inst->lod_model_scale * inst->lod_bias, lod_distance * p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, indices);
+				// Hysteresis is only tracked for camera passes; shadow passes use their own thresholds and would pollute the stored level.
+				const bool use_lod_hysteresis = p_render_list != RENDER_LIST_SECONDARY;
+				surf->sort.lod_index = mesh_storage->mesh_surface_get_lod(surf->surface, inst->lod_model_scale * inst->lod_bias, lod_distance * p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, indices, use_lod_hysteresis ? surf->previous_lod_index : -1);
+				if (use_lod_hysteresis) {
+					surf->previous_lod_index = surf->sort.lod_index;
+				}
 				if (p_render_data->render_info) {
 					indices = _indices_to_primitives(surf->primitive, indices);
 					if (p_render_list == RENDER_LIST_OPAQUE) { //opaque
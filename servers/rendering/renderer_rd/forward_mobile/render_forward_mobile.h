@@ -501,6 +501,7 @@ protected:
 		RS::PrimitiveType primitive = RS::PRIMITIVE_MAX;
 		uint32_t flags = 0;
 		uint32_t surface_index = 0;
+		uint8_t previous_lod_index = 0; // Level selected for the last camera pass, used for LOD hysteresis.
 
 		void *surface = nullptr;
 		RID material_uniform_set;
@@ -30,9 +30,12 @@
 
 #pragma once
 
+#include "core/templates/a_hash_map.h"
 #include "servers/rendering/rendering_device.h"
 #include "servers/rendering/rendering_server.h"
 
+#include <atomic>
+
 #define PRINT_PIPELINE_COMPILATION_KEYS 0
 
 template <typename Key, typename CreationClass, typename CreationFunction>
@@ -42,19 +45,28 @@ private:
 	CreationFunction creation_function = nullptr;
 	Mutex *compilations_mutex = nullptr;
 	uint32_t *compilations = nullptr;
-	RBMap<uint32_t, RID> hash_map;
+	AHashMap<uint32_t, RID> hash_map;
 	LocalVector<Pair<uint32_t, RID>> compiled_queue;
 	Mutex compiled_queue_mutex;
+	std::atomic<bool> compiled_queue_pending = false;
 	RBSet<uint32_t> compilation_set;
 	HashMap<uint32_t, WorkerThreadPool::TaskID> compilation_tasks;
 	Mutex local_mutex;
 
 	bool _add_new_pipelines_to_map() {
+		// Checked without taking the queue's mutex. While a pipeline is being compiled in the
+		// background, every draw that misses the map goes through here; a compilation that
+		// finishes right after the check is simply picked up on the next call.
+		if (!compiled_queue_pending.load(std::memory_order_acquire)) {
+			return false;
+		}
+
 		thread_local Vector<uint32_t> hashes_added;
 		hashes_added.clear();
 
 		{
 			MutexLock lock(compiled_queue_mutex);
+			compiled_queue_pending.store(false, std::memory_order_relaxed);
 			for (const Pair<uint32_t, RID> &pair : compiled_queue) {
 				hash_map[pair.first] = pair.second;
 				hashes_added.push_back(pair.first);
@@ -95,6 +107,7 @@ public:
 	void add_compiled_pipeline(uint32_t p_hash, RID p_pipeline) {
 		compiled_queue_mutex.lock();
 		compiled_queue.push_back({ p_hash, p_pipeline });
+		compiled_queue_pending.store(true, std::memory_order_release);
 		compiled_queue_mutex.unlock();
 	}
 
@@ -169,16 +182,16 @@ public:
 
 	// Retrieve a pipeline. It'll return an empty pipeline if it's not available yet, but it'll be guaranteed to succeed if 'wait for compilation' is true and stall as necessary. Source is just an optional number to aid debugging.
 	RID get_pipeline(const Key &p_key, uint32_t p_key_hash, bool p_wait_for_compilation, RS::PipelineSource p_source) {
-		RBMap<uint32_t, RID>::Element *e = hash_map.find(p_key_hash);
+		AHashMap<uint32_t, RID>::Iterator e = hash_map.find(p_key_hash);
 
-		if (e == nullptr) {
+		if (!e) {
 			// Check if there's any new pipelines that need to be added and try again. This method triggers a mutex lock.
 			if (_add_new_pipelines_to_map()) {
 				e = hash_map.find(p_key_hash);
 			}
 		}
 
-		if (e == nullptr) {
+		if (!e) {
 			// Request compilation. The method will ignore the request if it's already being compiled.
 			compile_pipeline(p_key, p_key_hash, p_source, p_wait_for_compilation);
 
@@ -187,8 +200,8 @@ public:
 				_add_new_pipelines_to_map();
 
 				e = hash_map.find(p_key_hash);
-				if (e != nullptr) {
-					return e->value();
+				if (e) {
+					return e->value;
 				} else {
 					// Pipeline could not be compiled due to an internal error. Store an empty RID so compilation is not attempted again.
 					hash_map[p_key_hash] = RID();
@@ -198,7 +211,7 @@ public:
 				return RID();
 			}
 		} else {
-			return e->value();
+			return e->value;
 		}
 	}
 
@@ -914,6 +914,7 @@ void RendererCanvasRenderRD::canvas_render_items(RID p_to_render_target, Item *p
 	}
 
 	texture_info_map.clear();
+	last_texture_info = nullptr;
 	state.instance_data = nullptr;
 	if (state.instance_data_index > 0) {
 		// If there was any remaining instance data, it must be flushed.
@@ -2378,11 +2379,7 @@ void RendererCanvasRenderRD::_record_item_commands(const Item *p_item, RenderTar
 
 				bool has_msdf = bool(rect->flags & CANVAS_RECT_MSDF);
 				TextureState tex_state(rect->texture, texture_filter, rect_repeat, has_msdf, use_linear_colors);
-				TextureInfo *tex_info = texture_info_map.getptr(tex_state);
-				if (!tex_info) {
-					tex_info = &texture_info_map.insert(tex_state, TextureInfo())->value;
-					_prepare_batch_texture_info(rect->texture, tex_state, tex_info);
-				}
+				TextureInfo *tex_info = _get_texture_info(tex_state);
 
 				if (r_current_batch->tex_info != tex_info) {
 					r_current_batch = _new_batch(r_batch_broken);
@@ -2479,11 +2476,7 @@ void RendererCanvasRenderRD::_record_item_commands(const Item *p_item, RenderTar
 				}
 
 				TextureState tex_state(np->texture, texture_filter, texture_repeat, false, use_linear_colors);
-				TextureInfo *tex_info = texture_info_map.getptr(tex_state);
-				if (!tex_info) {
-					tex_info = &texture_info_map.insert(tex_state, TextureInfo())->value;
-					_prepare_batch_texture_info(np->texture, tex_state, tex_info);
-				}
+				TextureInfo *tex_info = _get_texture_info(tex_state);
 
 				if (r_current_batch->tex_info != tex_info) {
 					r_current_batch = _new_batch(r_batch_broken);
@@ -2554,11 +2547,7 @@ void RendererCanvasRenderRD::_record_item_commands(const Item *p_item, RenderTar
 				r_current_batch->flags = 0;
 
 				TextureState tex_state(polygon->texture, texture_filter, texture_repeat, false, use_linear_colors);
-				TextureInfo *tex_info = texture_info_map.getptr(tex_state);
-				if (!tex_info) {
-					tex_info = &texture_info_map.insert(tex_state, TextureInfo())->value;
-					_prepare_batch_texture_info(polygon->texture, tex_state, tex_info);
-				}
+				TextureInfo *tex_info = _get_texture_info(tex_state);
 
 				if (r_current_batch->tex_info != tex_info) {
 					r_current_batch = _new_batch(r_batch_broken);
@@ -2621,11 +2610,7 @@ void RendererCanvasRenderRD::_record_item_commands(const Item *p_item, RenderTar
 				}
 
 				TextureState tex_state(primitive->texture, texture_filter, texture_repeat, false, use_linear_colors);
-				TextureInfo *tex_info = texture_info_map.getptr(tex_state);
-				if (!tex_info) {
-					tex_info = &texture_info_map.insert(tex_state, TextureInfo())->value;
-					_prepare_batch_texture_info(primitive->texture, tex_state, tex_info);
-				}
+				TextureInfo *tex_info = _get_texture_info(tex_state);
 
 				if (r_current_batch->tex_info != tex_info) {
 					r_current_batch = _new_batch(r_batch_broken);
@@ -2687,11 +2672,7 @@ void RendererCanvasRenderRD::_record_item_commands(const Item *p_item, RenderTar
 				if (c->type == Item::Command::TYPE_MESH) {
 					const Item::CommandMesh *m = static_cast<const Item::CommandMesh *>(c);
 					TextureState tex_state(m->texture, texture_filter, texture_repeat, false, use_linear_colors);
-					TextureInfo *tex_info = texture_info_map.getptr(tex_state);
-					if (!tex_info) {
-						tex_info = &texture_info_map.insert(tex_state, TextureInfo())->value;
-						_prepare_batch_texture_info(m->texture, tex_state, tex_info);
-					}
+					TextureInfo *tex_info = _get_texture_info(tex_state);
 					r_current_batch->tex_info = tex_info;
 					instance_data = new_instance_data(*r_current_batch, template_instance);
 
@@ -2714,11 +2695,7 @@ void RendererCanvasRenderRD::_record_item_commands(const Item *p_item, RenderTar
 					}
 
 					TextureState tex_state(mm->texture, texture_filter, texture_repeat, false, use_linear_colors);
-					TextureInfo *tex_info = texture_info_map.getptr(tex_state);
-					if (!tex_info) {
-						tex_info = &texture_info_map.insert(tex_state, TextureInfo())->value;
-						_prepare_batch_texture_info(mm->texture, tex_state, tex_info);
-					}
+					TextureInfo *tex_info = _get_texture_info(tex_state);
 					r_current_batch->tex_info = tex_info;
 					instance_data = new_instance_data(*r_current_batch, template_instance);
 
@@ -2736,11 +2713,7 @@ void RendererCanvasRenderRD::_record_item_commands(const Item *p_item, RenderTar
 
 					const Item::CommandParticles *pt = static_cast<const Item::CommandParticles *>(c);
 					TextureState tex_state(pt->texture, texture_filter, texture_repeat, false, use_linear_colors);
-					TextureInfo *tex_info = texture_info_map.getptr(tex_state);
-					if (!tex_info) {
-						tex_info = &texture_info_map.insert(tex_state, TextureInfo())->value;
-						_prepare_batch_texture_info(pt->texture, tex_state, tex_info);
-					}
+					TextureInfo *tex_info = _get_texture_info(tex_state);
 					r_current_batch->tex_info = tex_info;
 					instance_data = new_instance_data(*r_current_batch, template_instance);
 
@@ -2854,11 +2827,7 @@ void RendererCanvasRenderRD::_record_item_commands(const Item *p_item, RenderTar
 		}
 
 		TextureState tex_state(default_canvas_texture, texture_filter, texture_repeat, false, use_linear_colors);
-		TextureInfo *tex_info = texture_info_map.getptr(tex_state);
-		if (!tex_info) {
-			tex_info = &texture_info_map.insert(tex_state, TextureInfo())->value;
-			_prepare_batch_texture_info(default_canvas_texture, tex_state, tex_info);
-		}
+		TextureInfo *tex_info = _get_texture_info(tex_state);
 
 		if (r_current_batch->tex_info != tex_info) {
 			r_current_batch = _new_batch(r_batch_broken);
@@ -3159,6 +3128,23 @@ RendererCanvasRenderRD::InstanceData *RendererCanvasRenderRD::new_instance_data(
 	return instance_data;
 }
 
+RendererCanvasRenderRD::TextureInfo *RendererCanvasRenderRD::_get_texture_info(TextureState &p_state) {
+	// Runs of commands with the same texture state (e.g. glyphs from one font
+	// atlas) are extremely common, so memoize the last lookup before hashing.
+	if (last_texture_info != nullptr && p_state == last_texture_state) {
+		return last_texture_info;
+	}
+
+	TextureInfo *tex_info = texture_info_map.getptr(p_state);
+	if (!tex_info) {
+		tex_info = &texture_info_map.insert(p_state, TextureInfo())->value;
+		_prepare_batch_texture_info(p_state.texture, p_state, tex_info);
+	}
+	last_texture_state = p_state;
+	last_texture_info = tex_info;
+	return tex_info;
+}
+
 RendererCanvasRenderRD::Batch *RendererCanvasRenderRD::_new_batch(bool &r_batch_broken) {
 	if (state.canvas_instance_batches.is_empty()) {
 		Batch new_batch;
@@ -530,6 +530,9 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 	};
 
 	HashMap<TextureState, TextureInfo, HashMapHasherDefault, HashMapComparatorDefault<TextureState>, PagedAllocator<HashMapElement<TextureState, TextureInfo>>> texture_info_map;
+	// Memo for _get_texture_info(); only valid while recording a frame.
+	TextureState last_texture_state;
+	TextureInfo *last_texture_info = nullptr;
 
 	struct State {
 		//state buffer
@@ -624,6 +627,7 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 	void _record_item_commands(const Item *p_item, RenderTarget p_render_target, const Transform2D &p_base_transform, Item *&r_current_clip, Light *p_lights, bool &r_batch_broken, bool &r_sdf_used, Batch *&r_current_batch);
 	void _render_batch(RD::DrawListID p_draw_list, CanvasShaderData *p_shader_data, RenderingDevice::FramebufferFormatID p_framebuffer_format, Light *p_lights, Batch const *p_batch, RenderingMethod::RenderInfo *r_render_info = nullptr);
 	void _prepare_batch_texture_info(RID p_texture, TextureState &p_state, TextureInfo *p_info);
+	TextureInfo *_get_texture_info(TextureState &p_state);
 
 	// non-UMA
 	InstanceData *new_instance_data(Batch &p_current_batch, const InstanceData &template_instance);
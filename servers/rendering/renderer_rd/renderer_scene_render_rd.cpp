@@ -1421,6 +1421,25 @@ void RendererSceneRenderRD::render_scene(const Ref<RenderSceneBuffers> &p_render
 
 	//calls _pre_opaque_render between depth pre-pass and opaque pass
 	_render_scene(&render_data, clear_color);
+
+	if (frame_reprojection && p_reflection_probe.is_null()) {
+		// Keeps the reprojection history current; does nothing unless
+		// reproject_to_render_target() has allocated it for these buffers.
+		frame_reprojection->store_history(rb);
+	}
+}
+
+bool RendererSceneRenderRD::reproject_to_render_target(const Ref<RenderSceneBuffers> &p_render_buffers) {
+	if (frame_reprojection == nullptr) {
+		return false;
+	}
+
+	Ref<RenderSceneBuffersRD> rb = p_render_buffers;
+	if (rb.is_null()) {
+		return false;
+	}
+
+	return frame_reprojection->process(rb);
 }
 
 void RendererSceneRenderRD::render_material(const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, const PagedArray<RenderGeometryInstance *> &p_instances, RID p_framebuffer, const Rect2i &p_region) {
@@ -1692,6 +1711,9 @@ void RendererSceneRenderRD::init() {
 	luminance = memnew(RendererRD::Luminance(!can_use_storage));
 	smaa = memnew(RendererRD::SMAA);
 	tone_mapper = memnew(RendererRD::ToneMapper(!can_use_storage));
+	if (can_use_storage) {
+		frame_reprojection = memnew(RendererRD::FrameReprojection);
+	}
 	if (can_use_vrs) {
 		vrs = memnew(RendererRD::VRS);
 	}
@@ -1724,6 +1746,9 @@ RendererSceneRenderRD::~RendererSceneRenderRD() {
 	if (smaa) {
 		memdelete(smaa);
 	}
+	if (frame_reprojection) {
+		memdelete(frame_reprojection);
+	}
 	if (tone_mapper) {
 		memdelete(tone_mapper);
 	}
@@ -483,31 +483,57 @@ bool ShaderRD::_load_from_cache(Version *p_version, int p_group) {
 		p_version->variant_data.write[variant_id] = variant_bytes;
 	}
 
+	LocalVector<RID> results;
+	results.resize(variant_count);
+
+	LoadCacheData load_data;
+	load_data.version = p_version;
+	load_data.group = p_group;
+	load_data.results = results.ptr();
+
+	// Creating the driver shaders from the cached bytecode is the expensive
+	// part of a cache hit, so spread it across the worker pool like the
+	// compilation path does.
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ShaderRD::_load_cache_variant, load_data, variant_count, -1, true, SNAME("ShaderCacheLoad"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	bool all_valid = true;
 	for (uint32_t i = 0; i < variant_count; i++) {
 		int variant_id = group_to_variant_map[p_group][i];
 		if (!variants_enabled[variant_id]) {
 			p_version->variants.write[variant_id] = RID();
-			continue;
+		} else if (results[i].is_null()) {
+			all_valid = false;
 		}
-		print_verbose(vformat("Loading cache for shader %s, variant %d", name, i));
-		{
-			RID shader = RD::get_singleton()->shader_create_from_bytecode_with_samplers(p_version->variant_data[variant_id], p_version->variants[variant_id], immutable_samplers);
-			if (shader.is_null()) {
-				for (uint32_t j = 0; j < i; j++) {
-					int variant_free_id = group_to_variant_map[p_group][j];
-					RD::get_singleton()->free_rid(p_version->variants[variant_free_id]);
-				}
-				ERR_FAIL_COND_V(shader.is_null(), false);
-			}
+	}
 
-			p_version->variants.write[variant_id] = shader;
+	if (!all_valid) {
+		for (uint32_t i = 0; i < variant_count; i++) {
+			int variant_id = group_to_variant_map[p_group][i];
+			if (variants_enabled[variant_id] && results[i].is_valid()) {
+				RD::get_singleton()->free_rid(results[i]);
+			}
 		}
+		ERR_FAIL_V(false);
 	}
 
 	p_version->valid = true;
 	return true;
 }
 
+void ShaderRD::_load_cache_variant(uint32_t p_variant, LoadCacheData p_data) {
+	int variant_id = group_to_variant_map[p_data.group][p_variant];
+	if (!variants_enabled[variant_id]) {
+		return;
+	}
+	print_verbose(vformat("Loading cache for shader %s, variant %d", name, p_variant));
+	RID shader = RD::get_singleton()->shader_create_from_bytecode_with_samplers(p_data.version->variant_data[variant_id], p_data.version->variants[variant_id], immutable_samplers);
+	p_data.results[p_variant] = shader;
+	if (shader.is_valid()) {
+		p_data.version->variants.write[variant_id] = shader;
+	}
+}
+
 void ShaderRD::_save_to_cache(Version *p_version, int p_group) {
 	ERR_FAIL_COND(!shader_cache_user_dir_valid);
 	String api_safe_name = String(RD::get_singleton()->get_device_api_name()).validate_filename().to_lower();
@@ -533,7 +559,7 @@ void ShaderRD::_allocate_placeholders(Version *p_version, int p_group) {
 
 // Try to compile all variants for a given group.
 // Will skip variants that are disabled.
-void ShaderRD::_compile_version_start(Version *p_version, int p_group) {
+void ShaderRD::_compile_version_start(Version *p_version, int p_group, bool p_high_priority) {
 	if (!group_enabled[p_group]) {
 		return;
 	}
@@ -552,7 +578,7 @@ void ShaderRD::_compile_version_start(Version *p_version, int p_group) {
 	compile_data.version = p_version;
 	compile_data.group = p_group;
 
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ShaderRD::_compile_variant, compile_data, group_to_variant_map[p_group].size(), -1, true, SNAME("ShaderCompilation"));
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ShaderRD::_compile_variant, compile_data, group_to_variant_map[p_group].size(), -1, p_high_priority, SNAME("ShaderCompilation"));
 	p_version->group_compilation_tasks.write[p_group] = group_task;
 }
 
@@ -639,7 +665,9 @@ void ShaderRD::version_set_code(RID p_version, const HashMap<String, String> &p_
 				_allocate_placeholders(version, i);
 				continue;
 			}
-			_compile_version_start(version, i);
+			// Nothing has requested a variant yet, so this is a speculative warm-up
+			// compile that can wait for idle pool threads.
+			_compile_version_start(version, i, false);
 		}
 		version->initialize_needed = false;
 	}
@@ -676,7 +704,9 @@ void ShaderRD::version_set_compute_code(RID p_version, const HashMap<String, Str
 				_allocate_placeholders(version, i);
 				continue;
 			}
-			_compile_version_start(version, i);
+			// Nothing has requested a variant yet, so this is a speculative warm-up
+			// compile that can wait for idle pool threads.
+			_compile_version_start(version, i, false);
 		}
 		version->initialize_needed = false;
 	}
@@ -695,7 +725,7 @@ bool ShaderRD::version_is_valid(RID p_version) {
 				_allocate_placeholders(version, i);
 				continue;
 			}
-			_compile_version_start(version, i);
+			_compile_version_start(version, i, true);
 		}
 	}
 
@@ -704,6 +734,27 @@ bool ShaderRD::version_is_valid(RID p_version) {
 	return version->valid;
 }
 
+bool ShaderRD::version_is_ready(RID p_version, int p_variant) {
+	ERR_FAIL_INDEX_V(p_variant, variant_defines.size(), false);
+
+	Version *version = version_owner.get_or_null(p_version);
+	ERR_FAIL_NULL_V(version, false);
+
+	MutexLock lock(*version->mutex);
+
+	if (version->dirty) {
+		return false;
+	}
+
+	uint32_t group = variant_to_group[p_variant];
+	WorkerThreadPool::GroupID group_task = version->group_compilation_tasks[group];
+	if (group_task != 0 && !WorkerThreadPool::get_singleton()->is_group_task_completed(group_task)) {
+		return false;
+	}
+
+	return true;
+}
+
 bool ShaderRD::version_free(RID p_version) {
 	if (version_owner.owns(p_version)) {
 		{
@@ -762,7 +813,9 @@ void ShaderRD::enable_group(int p_group) {
 	for (const RID &version_rid : version_owner.get_owned_list()) {
 		Version *version = version_owner.get_or_null(version_rid);
 		version->mutex->lock();
-		_compile_version_start(version, p_group);
+		// Newly enabled groups are compiled ahead of any variant request, so they can
+		// wait for idle pool threads.
+		_compile_version_start(version, p_group, false);
 		version->mutex->unlock();
 	}
 }
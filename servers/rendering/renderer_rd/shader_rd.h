@@ -91,12 +91,20 @@ private:
 		int group = 0;
 	};
 
+	struct LoadCacheData {
+		Version *version = nullptr;
+		int group = 0;
+		RID *results = nullptr;
+	};
+
 	// Vector will have the size of SHADER_STAGE_MAX and unused stages will have empty strings.
 	void _compile_variant(uint32_t p_variant, CompileData p_data);
 
+	void _load_cache_variant(uint32_t p_variant, LoadCacheData p_data);
+
 	void _initialize_version(Version *p_version);
 	void _clear_version(Version *p_version);
-	void _compile_version_start(Version *p_version, int p_group);
+	void _compile_version_start(Version *p_version, int p_group, bool p_high_priority);
 	void _compile_version_end(Version *p_version, int p_group);
 	void _compile_ensure_finished(Version *p_version);
 	void _allocate_placeholders(Version *p_version, int p_group);
@@ -187,12 +195,15 @@ public:
 
 		if (version->dirty) {
 			_initialize_version(version);
+			int requested_group = variant_to_group[p_variant];
 			for (int i = 0; i < group_enabled.size(); i++) {
 				if (!group_enabled[i]) {
 					_allocate_placeholders(version, i);
 					continue;
 				}
-				_compile_version_start(version, i);
+				// The requested variant's group is needed right away, the other groups
+				// are only compiled speculatively and can wait for idle pool threads.
+				_compile_version_start(version, i, i == requested_group);
 			}
 		}
 
@@ -210,6 +221,10 @@ public:
 
 	bool version_is_valid(RID p_version);
 
+	// Returns whether the variant has finished compiling without blocking on it, so callers
+	// can keep using a fallback shader until the real one is ready.
+	bool version_is_ready(RID p_version, int p_variant);
+
 	bool version_free(RID p_version);
 
 	// Enable/disable variants for things that you know won't be used at engine initialization time .
@@ -0,0 +1,36 @@
+#[compute]
+
+#version 450
+
+#VERSION_DEFINES
+
+layout(local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+layout(set = 0, binding = 0) uniform sampler2D source_color;
+layout(set = 0, binding = 1) uniform sampler2D source_velocity;
+layout(rgba16f, set = 0, binding = 2) uniform restrict writeonly image2D dest_color;
+
+layout(push_constant, std430) uniform Params {
+	ivec2 resolution;
+	float motion_scale;
+	float pad;
+}
+params;
+
+void main() {
+	ivec2 pos = ivec2(gl_GlobalInvocationID.xy);
+	if (any(greaterThanEqual(pos, params.resolution))) {
+		return;
+	}
+
+	vec2 uv = (vec2(pos) + 0.5) / vec2(params.resolution);
+
+	// Velocity points from a pixel's current position to its position in the
+	// previous frame. Stepping a fraction of a vector along it finds the color
+	// that will arrive at this pixel that fraction of a frame after the last
+	// rendered one, extrapolating motion forward in time.
+	vec2 velocity = textureLod(source_velocity, uv, 0.0).xy;
+	vec2 uv_source = clamp(uv + velocity * params.motion_scale, vec2(0.0), vec2(1.0));
+
+	imageStore(dest_color, pos, textureLod(source_color, uv_source, 0.0));
+}
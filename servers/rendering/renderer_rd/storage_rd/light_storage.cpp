@@ -542,6 +542,13 @@ void LightStorage::light_instance_mark_visible(RID p_light_instance) {
 	light_instance->last_scene_pass = RendererSceneRenderRD::get_singleton()->get_scene_pass();
 }
 
+void LightStorage::light_instance_mark_shadow_stale(RID p_light_instance) {
+	LightInstance *light_instance = light_instance_owner.get_or_null(p_light_instance);
+	ERR_FAIL_NULL(light_instance);
+
+	light_instance->shadow_cache_stale = true;
+}
+
 /* LIGHT DATA */
 
 void LightStorage::free_light_data() {
@@ -2244,6 +2251,7 @@ bool LightStorage::_shadow_atlas_find_shadow(ShadowAtlas *shadow_atlas, int *p_i
 		int found_free_idx = -1; //found a free one
 		int found_used_idx = -1; //found existing one, must steal it
 		uint64_t min_pass = 0; // pass of the existing one, try to use the least recently used one (LRU fashion)
+		bool min_stale = false; // whether the current victim's cached shadow is stale anyway
 
 		for (int j = 0; j < sc; j++) {
 			if (!sarr[j].owner.is_valid()) {
@@ -2260,9 +2268,12 @@ bool LightStorage::_shadow_atlas_find_shadow(ShadowAtlas *shadow_atlas, int *p_i
 					continue;
 				}
 
-				if (found_used_idx == -1 || sli->last_scene_pass < min_pass) {
+				// Prefer stealing slots whose cached shadow is stale, as those need a full
+				// re-render anyway, so evicting them loses nothing. Break ties by LRU.
+				if (found_used_idx == -1 || (sli->shadow_cache_stale && !min_stale) || (sli->shadow_cache_stale == min_stale && sli->last_scene_pass < min_pass)) {
 					found_used_idx = j;
 					min_pass = sli->last_scene_pass;
+					min_stale = sli->shadow_cache_stale;
 				}
 			}
 		}
@@ -2297,10 +2308,12 @@ bool LightStorage::_shadow_atlas_find_omni_shadows(ShadowAtlas *shadow_atlas, in
 		const ShadowAtlas::Quadrant::Shadow *sarr = shadow_atlas->quadrants[qidx].shadows.ptr();
 
 		int found_idx = -1;
+		uint32_t min_valid = 0; // amount of still-valid cached shadows the currently selected pair would evict
 		uint64_t min_pass = 0; // sum of currently selected spots, try to get the least recently used pair
 
 		for (int j = 0; j < sc - 1; j++) {
 			uint64_t pass = 0;
+			uint32_t valid_count = 0;
 
 			if (sarr[j].owner.is_valid()) {
 				LightInstance *sli = light_instance_owner.get_or_null(sarr[j].owner);
@@ -2315,6 +2328,9 @@ bool LightStorage::_shadow_atlas_find_omni_shadows(ShadowAtlas *shadow_atlas, in
 					continue;
 				}
 				pass += sli->last_scene_pass;
+				if (!sli->shadow_cache_stale) {
+					valid_count++;
+				}
 			}
 
 			if (sarr[j + 1].owner.is_valid()) {
@@ -2330,10 +2346,16 @@ bool LightStorage::_shadow_atlas_find_omni_shadows(ShadowAtlas *shadow_atlas, in
 					continue;
 				}
 				pass += sli->last_scene_pass;
+				if (!sli->shadow_cache_stale) {
+					valid_count++;
+				}
 			}
 
-			if (found_idx == -1 || pass < min_pass) {
+			// Prefer the pair that evicts the fewest still-valid cached shadows
+			// (stale ones need a full re-render anyway), then fall back to LRU.
+			if (found_idx == -1 || valid_count < min_valid || (valid_count == min_valid && pass < min_pass)) {
 				found_idx = j;
+				min_valid = valid_count;
 				min_pass = pass;
 
 				// we found two empty spots, no need to check the rest
@@ -2419,6 +2441,7 @@ bool LightStorage::shadow_atlas_update_light(RID p_atlas, RID p_light_instance,
 
 		if (!should_realloc) {
 			shadow_atlas->quadrants[old_quadrant].shadows.write[old_shadow].version = p_light_version;
+			li->shadow_cache_stale = false; // Either redrawn this pass or already valid.
 			//already existing, see if it should redraw or it's just OK
 			return should_redraw;
 		}
@@ -2471,6 +2494,7 @@ bool LightStorage::shadow_atlas_update_light(RID p_atlas, RID p_light_instance,
 		}
 
 		li->shadow_atlases.insert(p_atlas);
+		li->shadow_cache_stale = false; // The new slot gets rendered this pass.
 
 		//update it in map
 		shadow_atlas->shadow_owners[p_light_instance] = new_key;
@@ -1174,7 +1174,7 @@ bool MaterialStorage::MaterialData::update_parameters_uniform_set(const HashMap<
 		tex_uniform_count += uint32_t(p_texture_uniforms[i].array_size > 0 ? p_texture_uniforms[i].array_size : 1);
 	}
 
-	if ((uint32_t)texture_cache.size() != tex_uniform_count || p_textures_dirty) {
+	if ((uint32_t)texture_cache.size() != tex_uniform_count) {
 		texture_cache.resize(tex_uniform_count);
 		render_target_cache.clear();
 		p_textures_dirty = true;
@@ -1188,7 +1188,22 @@ bool MaterialStorage::MaterialData::update_parameters_uniform_set(const HashMap<
 	}
 
 	if (p_textures_dirty && tex_uniform_count) {
+		// Texture parameters are often re-assigned to the same textures (or marked
+		// dirty by unrelated parameter changes), so re-resolve them first and only
+		// recreate the uniform set when the resolved textures actually changed.
+		Vector<RID> prev_texture_cache;
+		if (uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(uniform_set)) {
+			prev_texture_cache = texture_cache;
+		}
+		render_target_cache.clear();
 		update_textures(p_parameters, p_default_texture_params, p_texture_uniforms, texture_cache.ptrw(), p_use_linear_color, p_3d_material);
+		if (texture_cache == prev_texture_cache) {
+			p_textures_dirty = false;
+		} else if (uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(uniform_set)) {
+			RD::get_singleton()->uniform_set_set_invalidation_callback(uniform_set, nullptr, nullptr);
+			RD::get_singleton()->free_rid(uniform_set);
+			uniform_set = RID();
+		}
 	}
 
 	if (p_ubo_size == 0 && (p_texture_uniforms.is_empty())) {
@@ -1354,8 +1369,8 @@ bool MaterialStorage::free(RID p_rid) {
 
 /* GLOBAL SHADER UNIFORM API */
 
-int32_t MaterialStorage::_global_shader_uniform_allocate(uint32_t p_elements) {
-	int32_t idx = 0;
+int32_t MaterialStorage::_global_shader_uniform_allocate(uint32_t p_elements, int32_t p_from_index) {
+	int32_t idx = p_from_index;
 	while (idx + p_elements <= global_shader_uniforms.buffer_size) {
 		if (global_shader_uniforms.buffer_usage[idx].elements == 0) {
 			bool valid = true;
@@ -1843,7 +1858,33 @@ RID MaterialStorage::global_shader_uniforms_get_storage_buffer() const {
 
 int32_t MaterialStorage::global_shader_parameters_instance_allocate(RID p_instance) {
 	ERR_FAIL_COND_V(global_shader_uniforms.instance_buffer_pos.has(p_instance), -1);
-	int32_t pos = _global_shader_uniform_allocate(ShaderLanguage::MAX_INSTANCE_UNIFORM_INDICES);
+
+	// Instance blocks all have the same size, so freed blocks can be reused directly
+	// instead of scanning the whole buffer for a gap on every allocation.
+	int32_t pos = -1;
+	LocalVector<int32_t> &free_list = global_shader_uniforms.instance_buffer_free_list;
+	while (pos < 0 && !free_list.is_empty()) {
+		int32_t free_pos = free_list[free_list.size() - 1];
+		free_list.remove_at(free_list.size() - 1);
+		if (global_shader_uniforms.buffer_usage[free_pos].elements == 0) {
+			pos = free_pos;
+		}
+		// Otherwise the block was taken by a global variable allocation in the meantime, drop it.
+	}
+
+	if (pos < 0) {
+		// Fresh allocations resume scanning past the last one, since everything before it
+		// is either still in use or tracked by the free list.
+		pos = _global_shader_uniform_allocate(ShaderLanguage::MAX_INSTANCE_UNIFORM_INDICES, global_shader_uniforms.instance_buffer_scan_hint);
+		if (pos < 0) {
+			// Freed global variables can open gaps below the hint, scan the full buffer before giving up.
+			pos = _global_shader_uniform_allocate(ShaderLanguage::MAX_INSTANCE_UNIFORM_INDICES);
+		}
+		if (pos >= 0) {
+			global_shader_uniforms.instance_buffer_scan_hint = pos + ShaderLanguage::MAX_INSTANCE_UNIFORM_INDICES;
+		}
+	}
+
 	global_shader_uniforms.instance_buffer_pos[p_instance] = pos; //save anyway
 	ERR_FAIL_COND_V_MSG(pos < 0, -1, "Too many instances using shader instance variables. Increase buffer size in Project Settings.");
 	global_shader_uniforms.buffer_usage[pos].elements = ShaderLanguage::MAX_INSTANCE_UNIFORM_INDICES;
@@ -1855,6 +1896,7 @@ void MaterialStorage::global_shader_parameters_instance_free(RID p_instance) {
 	int32_t pos = global_shader_uniforms.instance_buffer_pos[p_instance];
 	if (pos >= 0) {
 		global_shader_uniforms.buffer_usage[pos].elements = 0;
+		global_shader_uniforms.instance_buffer_free_list.push_back(pos);
 	}
 	global_shader_uniforms.instance_buffer_pos.erase(p_instance);
 }
@@ -204,9 +204,13 @@ private:
 		bool must_update_buffer_materials = false;
 
 		HashMap<RID, int32_t> instance_buffer_pos;
+		// Freed instance blocks, reusable as-is since they all have the same size.
+		LocalVector<int32_t> instance_buffer_free_list;
+		// Index to resume scanning from for fresh instance block allocations.
+		int32_t instance_buffer_scan_hint = 0;
 	} global_shader_uniforms;
 
-	int32_t _global_shader_uniform_allocate(uint32_t p_elements);
+	int32_t _global_shader_uniform_allocate(uint32_t p_elements, int32_t p_from_index = 0);
 	void _global_shader_uniform_store_in_buffer(int32_t p_index, RS::GlobalShaderParameterType p_type, const Variant &p_value);
 	void _global_shader_uniform_mark_buffer_dirty(int32_t p_index, int32_t p_elements);
 
@@ -1161,6 +1161,28 @@ void MeshStorage::update_mesh_instances() {
 	bool uses_motion_vectors = (RSG::viewport->get_num_viewports_with_motion_vectors() > 0) || (RendererCompositorStorage::get_singleton()->get_num_compositor_effects_with_motion_vectors() > 0);
 	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
 
+	// Instances sharing the same surface and skeleton pose (crowds of identical characters)
+	// produce identical skinned output; skin the first one and copy the result to the rest
+	// instead of redoing the bone math per instance.
+	struct SkinDedupKey {
+		Mesh::Surface *surface = nullptr;
+		RID skeleton;
+		bool operator==(const SkinDedupKey &p_key) const {
+			return surface == p_key.surface && skeleton == p_key.skeleton;
+		}
+		static uint32_t hash(const SkinDedupKey &p_key) {
+			uint32_t h = hash_murmur3_one_64((uint64_t)(uintptr_t)p_key.surface);
+			return hash_fmix32(hash_murmur3_one_64(p_key.skeleton.get_id(), h));
+		}
+	};
+	struct SkinCopy {
+		RID src_buffer;
+		RID dst_buffer;
+		uint32_t size = 0;
+	};
+	HashMap<SkinDedupKey, RID, SkinDedupKey> skin_dedup_sources;
+	LocalVector<SkinCopy> pending_skin_copies;
+
 	while (dirty_mesh_instance_arrays.first()) {
 		MeshInstance *mi = dirty_mesh_instance_arrays.first()->self();
 
@@ -1196,6 +1218,25 @@ void MeshStorage::update_mesh_instances() {
 
 			bool array_is_2d = mi->mesh->surfaces[i]->format & RS::ARRAY_FLAG_USE_2D_VERTICES;
 
+			// Blend weights are per instance and the 2D path mixes in the per-instance
+			// canvas item transform, so only pure 3D bone skinning can be deduplicated.
+			bool can_dedup = sk != nullptr && !sk->use_2d && !array_is_2d && mi->mesh->blend_shape_count == 0 && (mi->mesh->surfaces[i]->format & RS::ARRAY_FORMAT_BONES);
+			if (can_dedup) {
+				SkinDedupKey key;
+				key.surface = mi->mesh->surfaces[i];
+				key.skeleton = mi->skeleton;
+				const RID *src_buffer = skin_dedup_sources.getptr(key);
+				if (src_buffer) {
+					SkinCopy copy;
+					copy.src_buffer = *src_buffer;
+					copy.dst_buffer = mi->surfaces[i].vertex_buffer[mi->surfaces[i].current_buffer];
+					copy.size = mi->mesh->surfaces[i]->vertex_buffer_size;
+					pending_skin_copies.push_back(copy);
+					continue;
+				}
+				skin_dedup_sources.insert(key, mi->surfaces[i].vertex_buffer[mi->surfaces[i].current_buffer]);
+			}
+
 			RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, skeleton_shader.pipeline[array_is_2d ? SkeletonShader::SHADER_MODE_2D : SkeletonShader::SHADER_MODE_3D]);
 
 			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, mi_surface_uniform_set, SkeletonShader::UNIFORM_SET_INSTANCE);
@@ -1257,6 +1298,12 @@ void MeshStorage::update_mesh_instances() {
 	}
 
 	RD::get_singleton()->compute_list_end();
+
+	// Buffer copies can't be recorded inside a compute list; replay the deduplicated
+	// outputs now that the skinning dispatches are done.
+	for (const SkinCopy &copy : pending_skin_copies) {
+		RD::get_singleton()->buffer_copy(copy.src_buffer, copy.dst_buffer, 0, 0, copy.size);
+	}
 }
 
 RD::VertexFormatID MeshStorage::_mesh_surface_generate_vertex_format(uint64_t p_surface_format, uint64_t p_input_mask, bool p_instanced_surface, bool p_input_motion_vectors, uint32_t &r_position_stride) {
@@ -2265,14 +2312,22 @@ void MeshStorage::_update_dirty_multimeshes() {
 					//if there too many dirty regions, or represent the majority of regions, just copy all, else transfer cost piles up too much
 					RD::get_singleton()->buffer_update(multimesh->buffer, buffer_offset * sizeof(float), MIN(visible_region_count * region_size, multimesh->instances * (uint32_t)multimesh->stride_cache * (uint32_t)sizeof(float)), data);
 				} else {
-					//not that many regions? update them all
-					for (uint32_t i = 0; i < visible_region_count; i++) {
-						if (multimesh->data_cache_dirty_regions[i] || multimesh->previous_data_cache_dirty_regions[i]) {
-							uint32_t offset = i * region_size;
-							uint32_t size = multimesh->stride_cache * (uint32_t)multimesh->instances * (uint32_t)sizeof(float);
-							uint32_t region_start_index = multimesh->stride_cache * MULTIMESH_DIRTY_REGION_SIZE * i;
-							RD::get_singleton()->buffer_update(multimesh->buffer, buffer_offset * sizeof(float) + offset, MIN(region_size, size - offset), &data[region_start_index]);
+					//not that many regions? update them, coalescing runs of adjacent dirty regions into a single transfer
+					uint32_t size = multimesh->stride_cache * (uint32_t)multimesh->instances * (uint32_t)sizeof(float);
+					uint32_t i = 0;
+					while (i < visible_region_count) {
+						if (!(multimesh->data_cache_dirty_regions[i] || multimesh->previous_data_cache_dirty_regions[i])) {
+							i++;
+							continue;
+						}
+						uint32_t run_end = i + 1;
+						while (run_end < visible_region_count && (multimesh->data_cache_dirty_regions[run_end] || multimesh->previous_data_cache_dirty_regions[run_end])) {
+							run_end++;
 						}
+						uint32_t offset = i * region_size;
+						uint32_t region_start_index = multimesh->stride_cache * MULTIMESH_DIRTY_REGION_SIZE * i;
+						RD::get_singleton()->buffer_update(multimesh->buffer, buffer_offset * sizeof(float) + offset, MIN((run_end - i) * region_size, size - offset), &data[region_start_index]);
+						i = run_end;
 					}
 				}
 
@@ -2402,6 +2457,38 @@ void MeshStorage::skeleton_bone_set_transform(RID p_skeleton, int p_bone, const
 	_skeleton_make_dirty(skeleton);
 }
 
+void MeshStorage::skeleton_bone_set_transforms(RID p_skeleton, const Vector<Transform3D> &p_transforms) {
+	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
+
+	ERR_FAIL_NULL(skeleton);
+	ERR_FAIL_COND(p_transforms.size() > skeleton->size);
+	ERR_FAIL_COND(skeleton->use_2d);
+
+	const Transform3D *transforms_ptr = p_transforms.ptr();
+	float *dataptr = skeleton->data.ptr();
+
+	for (int i = 0; i < p_transforms.size(); i++) {
+		const Transform3D &t = transforms_ptr[i];
+
+		dataptr[0] = t.basis.rows[0][0];
+		dataptr[1] = t.basis.rows[0][1];
+		dataptr[2] = t.basis.rows[0][2];
+		dataptr[3] = t.origin.x;
+		dataptr[4] = t.basis.rows[1][0];
+		dataptr[5] = t.basis.rows[1][1];
+		dataptr[6] = t.basis.rows[1][2];
+		dataptr[7] = t.origin.y;
+		dataptr[8] = t.basis.rows[2][0];
+		dataptr[9] = t.basis.rows[2][1];
+		dataptr[10] = t.basis.rows[2][2];
+		dataptr[11] = t.origin.z;
+
+		dataptr += 12;
+	}
+
+	_skeleton_make_dirty(skeleton);
+}
+
 Transform3D MeshStorage::skeleton_bone_get_transform(RID p_skeleton, int p_bone) const {
 	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
 
@@ -1426,6 +1426,8 @@ void ParticlesStorage::update_particles() {
 	RENDER_TIMESTAMP("Update GPUParticles");
 	uint32_t frame = RSG::rasterizer->get_frame_number();
 	bool uses_motion_vectors = RSG::viewport->get_num_viewports_with_motion_vectors() > 0 || (RendererCompositorStorage::get_singleton()->get_num_compositor_effects_with_motion_vectors() > 0);
+	thread_local LocalVector<Particles *> copy_pass_list;
+	copy_pass_list.clear();
 	while (particle_update_list.first()) {
 		//use transform feedback to process particles
 
@@ -1604,7 +1606,31 @@ void ParticlesStorage::update_particles() {
 
 		// Copy particles to instance buffer.
 		if (particles->draw_order != RS::PARTICLES_DRAW_ORDER_VIEW_DEPTH && particles->transform_align != RS::PARTICLES_TRANSFORM_ALIGN_Z_BILLBOARD && particles->transform_align != RS::PARTICLES_TRANSFORM_ALIGN_Z_BILLBOARD_Y_TO_VELOCITY) {
-			//does not need view dependent operation, do copy here
+			// Does not need a view dependent operation. The copy dispatches of different
+			// emitters are independent, so they are batched into a single compute list
+			// once all emitters have been processed.
+			copy_pass_list.push_back(particles);
+		}
+
+		particles->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_AABB);
+	}
+
+	if (!copy_pass_list.is_empty()) {
+		RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+
+		for (Particles *particles : copy_pass_list) {
+			int fixed_fps = 0;
+			if (particles->fixed_fps > 0) {
+				fixed_fps = particles->fixed_fps;
+			} else if (particles->trails_enabled && particles->trail_bind_poses.size() > 1) {
+				fixed_fps = 60;
+			}
+
+			int total_amount = particles->amount;
+			if (particles->trails_enabled && particles->trail_bind_poses.size() > 1) {
+				total_amount *= particles->trail_bind_poses.size();
+			}
+
 			ParticlesShader::CopyPushConstant copy_push_constant;
 
 			// Affect 2D only.
@@ -1643,20 +1669,17 @@ void ParticlesStorage::update_particles() {
 			copy_push_constant.lifetime_split = (MIN(int(particles->amount * particles->phase), particles->amount - 1) + 1) % particles->amount;
 			copy_push_constant.lifetime_reverse = particles->draw_order == RS::PARTICLES_DRAW_ORDER_REVERSE_LIFETIME;
 			copy_push_constant.motion_vectors_current_offset = particles->instance_motion_vectors_current_offset;
-
-			RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
 			copy_push_constant.copy_mode_2d = particles->mode == RS::PARTICLES_MODE_2D ? 1 : 0;
+
 			RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, particles_shader.copy_pipelines[particles->userdata_count][ParticlesShader::COPY_MODE_FILL_INSTANCES].get_rid());
 			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_copy_uniform_set, 0);
 			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->trail_bind_pose_uniform_set, 2);
 			RD::get_singleton()->compute_list_set_push_constant(compute_list, &copy_push_constant, sizeof(ParticlesShader::CopyPushConstant));
 
 			RD::get_singleton()->compute_list_dispatch_threads(compute_list, total_amount, 1, 1);
-
-			RD::get_singleton()->compute_list_end();
 		}
 
-		particles->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_AABB);
+		RD::get_singleton()->compute_list_end();
 	}
 }
 
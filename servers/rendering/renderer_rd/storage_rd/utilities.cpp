@@ -193,6 +193,12 @@ AABB Utilities::visibility_notifier_get_aabb(RID p_notifier) const {
 	return vn->aabb;
 }
 
+Callable Utilities::visibility_notifier_get_callback(RID p_notifier, bool p_enter) const {
+	const VisibilityNotifier *vn = visibility_notifier_owner.get_or_null(p_notifier);
+	ERR_FAIL_NULL_V(vn, Callable());
+	return p_enter ? vn->enter_callback : vn->exit_callback;
+}
+
 void Utilities::visibility_notifier_call(RID p_notifier, bool p_enter, bool p_deferred) {
 	VisibilityNotifier *vn = visibility_notifier_owner.get_or_null(p_notifier);
 	ERR_FAIL_NULL(vn);
@@ -88,6 +88,7 @@ public:
 
 	virtual AABB visibility_notifier_get_aabb(RID p_notifier) const override;
 	virtual void visibility_notifier_call(RID p_notifier, bool p_enter, bool p_deferred) override;
+	virtual Callable visibility_notifier_get_callback(RID p_notifier, bool p_enter) const override;
 
 	/* TIMING */
 
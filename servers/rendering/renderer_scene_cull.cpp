@@ -188,6 +188,7 @@ void RendererSceneCull::_instance_pair(Instance *p_A, Instance *p_B) {
 
 		if (geom->can_cast_shadows) {
 			light->make_shadow_dirty();
+			RSG::light_storage->light_instance_mark_shadow_stale(light->instance);
 		}
 
 		if (A->scenario && A->array_index >= 0) {
@@ -313,6 +314,7 @@ void RendererSceneCull::_instance_unpair(Instance *p_A, Instance *p_B) {
 
 		if (geom->can_cast_shadows) {
 			light->make_shadow_dirty();
+			RSG::light_storage->light_instance_mark_shadow_stale(light->instance);
 		}
 
 		if (A->scenario && A->array_index >= 0) {
@@ -941,6 +943,7 @@ void RendererSceneCull::instance_set_layer_mask(RID p_instance, uint32_t p_mask)
 			for (HashSet<RendererSceneCull::Instance *>::Iterator I = geom->lights.begin(); I != geom->lights.end(); ++I) {
 				InstanceLightData *light = static_cast<InstanceLightData *>((*I)->base_data);
 				light->make_shadow_dirty();
+				RSG::light_storage->light_instance_mark_shadow_stale(light->instance);
 			}
 		}
 	}
@@ -996,6 +999,18 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 	_instance_queue_update(instance, true);
 }
 
+void RendererSceneCull::instance_set_transforms_bulk(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+
+	// One command queue message for the whole batch; each entry goes through the
+	// regular setter so dirty tracking and interpolation behave as usual.
+	const RID *instances = p_instances.ptr();
+	const Transform3D *transforms = p_transforms.ptr();
+	for (int i = 0; i < p_instances.size(); i++) {
+		instance_set_transform(instances[i], transforms[i]);
+	}
+}
+
 void RendererSceneCull::instance_attach_object_instance_id(RID p_instance, ObjectID p_id) {
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_NULL(instance);
@@ -1613,6 +1628,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) const {
 		RSG::light_storage->light_instance_set_transform(light->instance, *instance_xform);
 		RSG::light_storage->light_instance_set_aabb(light->instance, instance_xform->xform(p_instance->aabb));
 		light->make_shadow_dirty();
+		RSG::light_storage->light_instance_mark_shadow_stale(light->instance);
 
 		RS::LightBakeMode bake_mode = RSG::light_storage->light_get_bake_mode(p_instance->base);
 		if (RSG::light_storage->light_get_type(p_instance->base) != RS::LIGHT_DIRECTIONAL && bake_mode != light->bake_mode) {
@@ -1703,6 +1719,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) const {
 			for (const Instance *E : geom->lights) {
 				InstanceLightData *light = static_cast<InstanceLightData *>(E->base_data);
 				light->make_shadow_dirty();
+				RSG::light_storage->light_instance_mark_shadow_stale(light->instance);
 			}
 		}
 
@@ -1778,6 +1795,12 @@ void RendererSceneCull::_update_instance(Instance *p_instance) const {
 			case RS::INSTANCE_PARTICLES: {
 				InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(p_instance->base_data);
 				idata.instance_geometry = geom->geometry_instance;
+				if (geom->can_cast_shadows) {
+					idata.flags |= InstanceData::FLAG_GEOM_CAN_CAST_SHADOWS;
+				}
+				if (geom->material_is_animated) {
+					idata.flags |= InstanceData::FLAG_GEOM_MATERIAL_IS_ANIMATED;
+				}
 			} break;
 			case RS::INSTANCE_LIGHT: {
 				InstanceLightData *light_data = static_cast<InstanceLightData *>(p_instance->base_data);
@@ -2183,6 +2206,10 @@ void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_in
 	cull.shadows[p_shadow_index].light_instance = light->instance;
 	cull.shadows[p_shadow_index].caster_mask = RSG::light_storage->light_get_shadow_caster_mask(p_instance->base);
 
+	// Cached windows are only comparable when the light/camera setup they were
+	// derived from is unchanged.
+	bool cascade_cache_usable = directional_distant_cascade_interval > 1 && light->directional_cascade_shadow_index == p_shadow_index && light->directional_cascade_texture_size == texture_size && light->directional_cascade_basis == light_transform.basis;
+
 	for (int i = 0; i < splits; i++) {
 		RENDER_TIMESTAMP("Cull DirectionalLight3D, Split " + itos(i));
 
@@ -2307,6 +2334,33 @@ void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_in
 			y_min_cam = Math::snapped(y_vec.dot(center) - radius - soft_shadow_expand, unit);
 		}
 
+		{
+			// Because the window above is snapped to shadow texels, small camera motion
+			// reproduces it bit-exactly. When that happens, distant cascades can keep
+			// last frame's depth map and matrices, and re-render round-robin every
+			// directional_distant_cascade_interval frames to bound dynamic caster staleness.
+			InstanceLightData::DirectionalCascade &cascade_cache = light->directional_cascades[i];
+
+			bool update = true;
+			if (cascade_cache_usable && i >= (splits + 1) / 2 && cascade_cache.valid && cascade_cache.x_min_cam == x_min_cam && cascade_cache.x_max_cam == x_max_cam && cascade_cache.y_min_cam == y_min_cam && cascade_cache.y_max_cam == y_max_cam) {
+				// Offset by the cascade index so eligible cascades refresh on different frames.
+				update = (RSG::rasterizer->get_frame_number() + i) % directional_distant_cascade_interval == 0;
+			}
+
+			cascade_cache.x_min_cam = x_min_cam;
+			cascade_cache.x_max_cam = x_max_cam;
+			cascade_cache.y_min_cam = y_min_cam;
+			cascade_cache.y_max_cam = y_max_cam;
+			cascade_cache.valid = true;
+
+			cull.shadows[p_shadow_index].cascades[i].update = update;
+			if (!update) {
+				// The stale frustum/projection left in the cascade slot is never read;
+				// culling and shadow setup both skip cascades with update == false.
+				continue;
+			}
+		}
+
 		//now that we know all ranges, we can proceed to make the light frustum planes, for culling octree
 
 		Vector<Plane> light_frustum_planes;
@@ -2350,6 +2404,10 @@ void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_in
 			cull.shadows[p_shadow_index].cascades[i].uv_scale = uv_scale;
 		}
 	}
+
+	light->directional_cascade_basis = light_transform.basis;
+	light->directional_cascade_texture_size = texture_size;
+	light->directional_cascade_shadow_index = p_shadow_index;
 }
 
 bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_screen_mesh_lod_threshold, uint32_t p_visible_layers) {
@@ -2410,21 +2468,23 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 						light_culler->cull_regular_light(instance_shadow_cull_result);
 					}
 
+					uint32_t caster_mask = p_visible_layers & RSG::light_storage->light_get_shadow_caster_mask(p_instance->base);
 					for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
+						// Filter through the dense InstanceData record; the cold Instance is only
+						// touched for its array index and, rarely, a pending mesh instance update.
 						Instance *instance = instance_shadow_cull_result[j];
-						if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask & RSG::light_storage->light_get_shadow_caster_mask(p_instance->base))) {
+						const InstanceData &idata = p_scenario->instance_data[instance->array_index];
+						if (!((1 << (idata.flags & InstanceData::FLAG_BASE_TYPE_MASK)) & RS::INSTANCE_GEOMETRY_MASK) || !(idata.flags & InstanceData::FLAG_GEOM_CAN_CAST_SHADOWS) || !(caster_mask & idata.layer_mask)) {
 							continue;
-						} else {
-							if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-								animated_material_found = true;
-							}
-
-							if (instance->mesh_instance.is_valid()) {
-								RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
-							}
+						}
+						if (idata.flags & InstanceData::FLAG_GEOM_MATERIAL_IS_ANIMATED) {
+							animated_material_found = true;
+						}
+						if (idata.flags & InstanceData::FLAG_USES_MESH_INSTANCE) {
+							RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
 						}
 
-						shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+						shadow_data.instances.push_back(idata.instance_geometry);
 					}
 
 					RSG::mesh_storage->update_mesh_instances();
@@ -2493,20 +2553,23 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 						light_culler->cull_regular_light(instance_shadow_cull_result);
 					}
 
+					uint32_t caster_mask = p_visible_layers & RSG::light_storage->light_get_shadow_caster_mask(p_instance->base);
 					for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
+						// Filter through the dense InstanceData record; the cold Instance is only
+						// touched for its array index and, rarely, a pending mesh instance update.
 						Instance *instance = instance_shadow_cull_result[j];
-						if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask & RSG::light_storage->light_get_shadow_caster_mask(p_instance->base))) {
+						const InstanceData &idata = p_scenario->instance_data[instance->array_index];
+						if (!((1 << (idata.flags & InstanceData::FLAG_BASE_TYPE_MASK)) & RS::INSTANCE_GEOMETRY_MASK) || !(idata.flags & InstanceData::FLAG_GEOM_CAN_CAST_SHADOWS) || !(caster_mask & idata.layer_mask)) {
 							continue;
-						} else {
-							if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-								animated_material_found = true;
-							}
-							if (instance->mesh_instance.is_valid()) {
-								RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
-							}
+						}
+						if (idata.flags & InstanceData::FLAG_GEOM_MATERIAL_IS_ANIMATED) {
+							animated_material_found = true;
+						}
+						if (idata.flags & InstanceData::FLAG_USES_MESH_INSTANCE) {
+							RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
 						}
 
-						shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+						shadow_data.instances.push_back(idata.instance_geometry);
 					}
 
 					RSG::mesh_storage->update_mesh_instances();
@@ -2561,20 +2624,22 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 				light_culler->cull_regular_light(instance_shadow_cull_result);
 			}
 
+			uint32_t caster_mask = p_visible_layers & RSG::light_storage->light_get_shadow_caster_mask(p_instance->base);
 			for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
+				// Filter through the dense InstanceData record; the cold Instance is only
+				// touched for its array index and, rarely, a pending mesh instance update.
 				Instance *instance = instance_shadow_cull_result[j];
-				if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask & RSG::light_storage->light_get_shadow_caster_mask(p_instance->base))) {
+				const InstanceData &idata = p_scenario->instance_data[instance->array_index];
+				if (!((1 << (idata.flags & InstanceData::FLAG_BASE_TYPE_MASK)) & RS::INSTANCE_GEOMETRY_MASK) || !(idata.flags & InstanceData::FLAG_GEOM_CAN_CAST_SHADOWS) || !(caster_mask & idata.layer_mask)) {
 					continue;
-				} else {
-					if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-						animated_material_found = true;
-					}
-
-					if (instance->mesh_instance.is_valid()) {
-						RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
-					}
 				}
-				shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+				if (idata.flags & InstanceData::FLAG_GEOM_MATERIAL_IS_ANIMATED) {
+					animated_material_found = true;
+				}
+				if (idata.flags & InstanceData::FLAG_USES_MESH_INSTANCE) {
+					RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
+				}
+				shadow_data.instances.push_back(idata.instance_geometry);
 			}
 
 			RSG::mesh_storage->update_mesh_instances();
@@ -2589,6 +2654,55 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 	return animated_material_found;
 }
 
+void RendererSceneCull::_camera_get_projection(const Camera *p_camera, Size2 p_viewport_size, Projection &r_projection, bool &r_is_orthogonal, bool &r_is_frustum) {
+	switch (p_camera->type) {
+		case Camera::ORTHOGONAL: {
+			r_projection.set_orthogonal(
+					p_camera->size,
+					p_viewport_size.width / (float)p_viewport_size.height,
+					p_camera->znear,
+					p_camera->zfar,
+					p_camera->vaspect);
+			r_is_orthogonal = true;
+		} break;
+		case Camera::PERSPECTIVE: {
+			r_projection.set_perspective(
+					p_camera->fov,
+					p_viewport_size.width / (float)p_viewport_size.height,
+					p_camera->znear,
+					p_camera->zfar,
+					p_camera->vaspect);
+
+		} break;
+		case Camera::FRUSTUM: {
+			r_projection.set_frustum(
+					p_camera->size,
+					p_viewport_size.width / (float)p_viewport_size.height,
+					p_camera->offset,
+					p_camera->znear,
+					p_camera->zfar,
+					p_camera->vaspect);
+			r_is_frustum = true;
+		} break;
+	}
+}
+
+void RendererSceneCull::render_camera_occlusion_prepare(RID p_camera, RID p_viewport, Size2 p_viewport_size) {
+#ifndef _3D_DISABLED
+	Camera *camera = camera_owner.get_or_null(p_camera);
+	ERR_FAIL_NULL(camera);
+
+	Projection projection;
+	bool is_orthogonal = false;
+	bool is_frustum = false;
+	_camera_get_projection(camera, p_viewport_size, projection, is_orthogonal, is_frustum);
+
+	// TAA jitter is not applied here; the occlusion buffer adds its own jitter on top
+	// and only uses the projection for the viewport rect and near plane.
+	RendererSceneOcclusionCull::get_singleton()->buffer_update_async(p_viewport, camera->transform, projection, is_orthogonal);
+#endif
+}
+
 void RendererSceneCull::render_camera(const Ref<RenderSceneBuffers> &p_render_buffers, RID p_camera, RID p_scenario, RID p_viewport, Size2 p_viewport_size, uint32_t p_jitter_phase_count, float p_screen_mesh_lod_threshold, RID p_shadow_atlas, Ref<XRInterface> &p_xr_interface, RenderInfo *r_render_info) {
 #ifndef _3D_DISABLED
 
@@ -2624,36 +2738,7 @@ void RendererSceneCull::render_camera(const Ref<RenderSceneBuffers> &p_render_bu
 		bool is_orthogonal = false;
 		bool is_frustum = false;
 
-		switch (camera->type) {
-			case Camera::ORTHOGONAL: {
-				projection.set_orthogonal(
-						camera->size,
-						p_viewport_size.width / (float)p_viewport_size.height,
-						camera->znear,
-						camera->zfar,
-						camera->vaspect);
-				is_orthogonal = true;
-			} break;
-			case Camera::PERSPECTIVE: {
-				projection.set_perspective(
-						camera->fov,
-						p_viewport_size.width / (float)p_viewport_size.height,
-						camera->znear,
-						camera->zfar,
-						camera->vaspect);
-
-			} break;
-			case Camera::FRUSTUM: {
-				projection.set_frustum(
-						camera->size,
-						p_viewport_size.width / (float)p_viewport_size.height,
-						camera->offset,
-						camera->znear,
-						camera->zfar,
-						camera->vaspect);
-				is_frustum = true;
-			} break;
-		}
+		_camera_get_projection(camera, p_viewport_size, projection, is_orthogonal, is_frustum);
 
 		camera_data.set_camera(transform, projection, is_orthogonal, is_frustum, vaspect, jitter, taa_frame_count, camera->visible_layers);
 #ifndef XR_DISABLED
@@ -2702,6 +2787,8 @@ void RendererSceneCull::render_camera(const Ref<RenderSceneBuffers> &p_render_bu
 
 	RENDER_TIMESTAMP("Update Occlusion Buffer")
 	// For now just cull on the first camera
+	// If render_camera_occlusion_prepare() dispatched this update already, this waits
+	// for it instead of updating again.
 	RendererSceneOcclusionCull::get_singleton()->buffer_update(p_viewport, camera_data.main_transform, camera_data.main_projection, camera_data.is_orthogonal);
 
 	_render_scene(&camera_data, p_render_buffers, environment, camera->attributes, compositor, camera->visible_layers, p_scenario, p_viewport, p_shadow_atlas, RID(), -1, p_screen_mesh_lod_threshold, true, r_render_info);
@@ -2709,11 +2796,19 @@ void RendererSceneCull::render_camera(const Ref<RenderSceneBuffers> &p_render_bu
 }
 
 void RendererSceneCull::_visibility_cull_threaded(uint32_t p_thread, VisibilityCullData *cull_data) {
-	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
-	uint32_t bin_from = p_thread * cull_data->cull_count / total_threads;
-	uint32_t bin_to = (p_thread + 1 == total_threads) ? cull_data->cull_count : ((p_thread + 1) * cull_data->cull_count / total_threads);
-
-	_visibility_cull(*cull_data, cull_data->cull_offset + bin_from, cull_data->cull_offset + bin_to);
+	// Same dynamic chunk claiming as _scene_cull_threaded(). Per-instance cost is
+	// very uneven here: instances whose dependency parent is hidden early out,
+	// while the rest do full distance and fade evaluation. With dense content
+	// (e.g. vegetation under HLOD parents) a fixed per-thread split leaves most
+	// threads idle behind whichever one drew the expensive region of the bin.
+	while (true) {
+		uint32_t bin_from = visibility_cull_chunk_cursor.fetch_add(VISIBILITY_CULL_CHUNK_SIZE, std::memory_order_relaxed);
+		if (bin_from >= cull_data->cull_count) {
+			break;
+		}
+		uint32_t bin_to = MIN(bin_from + (uint32_t)VISIBILITY_CULL_CHUNK_SIZE, cull_data->cull_count);
+		_visibility_cull(*cull_data, cull_data->cull_offset + bin_from, cull_data->cull_offset + bin_to);
+	}
 }
 
 void RendererSceneCull::_visibility_cull(const VisibilityCullData &cull_data, uint64_t p_from, uint64_t p_to) {
@@ -2806,11 +2901,19 @@ bool RendererSceneCull::_visibility_parent_check(const CullData &p_cull_data, co
 
 void RendererSceneCull::_scene_cull_threaded(uint32_t p_thread, CullData *cull_data) {
 	uint32_t cull_total = cull_data->scenario->instance_data.size();
-	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
-	uint32_t cull_from = p_thread * cull_total / total_threads;
-	uint32_t cull_to = (p_thread + 1 == total_threads) ? cull_total : ((p_thread + 1) * cull_total / total_threads);
 
-	_scene_cull(*cull_data, scene_cull_result_threads[p_thread], cull_from, cull_to);
+	// Claim fixed-size chunks through the shared cursor instead of a static
+	// per-thread split. Instance cost varies wildly across the array (lights and
+	// probes pair, geometry appends, hidden instances are nearly free), so
+	// dynamic claiming is what lets the cull scale with core count.
+	while (true) {
+		uint32_t cull_from = scene_cull_chunk_cursor.fetch_add(SCENE_CULL_CHUNK_SIZE, std::memory_order_relaxed);
+		if (cull_from >= cull_total) {
+			break;
+		}
+		uint32_t cull_to = MIN(cull_from + (uint32_t)SCENE_CULL_CHUNK_SIZE, cull_total);
+		_scene_cull(*cull_data, scene_cull_result_threads[p_thread], cull_from, cull_to);
+	}
 }
 
 void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cull_result, uint64_t p_from, uint64_t p_to) {
@@ -2826,7 +2929,19 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 	float z_near = cull_data.camera_matrix->get_z_near();
 	bool is_orthogonal = cull_data.camera_matrix->is_orthogonal();
 
+	// Main-frustum results are precomputed one chunk at a time in a vectorizable
+	// batch (see InstanceBounds::in_frustum_batch()). Both callers hand out ranges
+	// starting at multiples of SCENE_CULL_CHUNK_SIZE and the chunk size divides
+	// the instance AABB page size, so each batch reads a contiguous run of bounds.
+	uint8_t frustum_results[SCENE_CULL_CHUNK_SIZE];
+	uint64_t frustum_batch_next = p_from;
+
 	for (uint64_t i = p_from; i < p_to; i++) {
+		if (i == frustum_batch_next) {
+			InstanceBounds::in_frustum_batch(cull_data.cull->frustum, &cull_data.scenario->instance_aabbs[i], MIN(p_to - i, (uint64_t)SCENE_CULL_CHUNK_SIZE), frustum_results);
+			frustum_batch_next += SCENE_CULL_CHUNK_SIZE;
+		}
+
 		bool mesh_visible = false;
 
 		InstanceData &idata = cull_data.scenario->instance_data[i];
@@ -2836,13 +2951,14 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 #define HIDDEN_BY_VISIBILITY_CHECKS (visibility_flags == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE || visibility_flags == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN)
 #define LAYER_CHECK (cull_data.visible_layers & idata.layer_mask)
 #define IN_FRUSTUM(f) (cull_data.scenario->instance_aabbs[i].in_frustum(f))
+#define IN_MAIN_FRUSTUM (frustum_results[(i - p_from) & (SCENE_CULL_CHUNK_SIZE - 1)] != 0)
 #define VIS_RANGE_CHECK ((idata.visibility_index == -1) || _visibility_range_check<false>(cull_data.scenario->instance_visibility[idata.visibility_index], cull_data.cam_transform.origin, cull_data.visibility_viewport_mask) == 0)
 #define VIS_PARENT_CHECK (_visibility_parent_check(cull_data, idata))
 #define VIS_CHECK (visibility_check < 0 ? (visibility_check = (visibility_flags != InstanceData::FLAG_VISIBILITY_DEPENDENCY_NEEDS_CHECK || (VIS_RANGE_CHECK && VIS_PARENT_CHECK))) : visibility_check)
 #define OCCLUSION_CULLED (cull_data.occlusion_buffer != nullptr && (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_OCCLUSION_CULLING) == 0 && cull_data.occlusion_buffer->is_occluded(cull_data.scenario->instance_aabbs[i].bounds, cull_data.cam_transform.origin, inv_cam_transform, *cull_data.camera_matrix, z_near, is_orthogonal, cull_data.scenario->instance_data[i].occlusion_timeout))
 
 		if (!HIDDEN_BY_VISIBILITY_CHECKS) {
-			if ((LAYER_CHECK && IN_FRUSTUM(cull_data.cull->frustum) && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
+			if ((LAYER_CHECK && IN_MAIN_FRUSTUM && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
 				uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 				if (base_type == RS::INSTANCE_LIGHT) {
 					cull_result.lights.push_back(idata.instance);
@@ -3046,6 +3162,9 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 					continue;
 				}
 				for (uint32_t k = 0; k < cull_data.cull->shadows[j].cascade_count; k++) {
+					if (!cull_data.cull->shadows[j].cascades[k].update) {
+						continue;
+					}
 					if (IN_FRUSTUM(cull_data.cull->shadows[j].cascades[k].frustum) && VIS_CHECK) {
 						uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 
@@ -3061,6 +3180,7 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 #undef HIDDEN_BY_VISIBILITY_CHECKS
 #undef LAYER_CHECK
 #undef IN_FRUSTUM
+#undef IN_MAIN_FRUSTUM
 #undef VIS_RANGE_CHECK
 #undef VIS_PARENT_CHECK
 #undef VIS_CHECK
@@ -3139,6 +3259,7 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 			}
 
 			if (visibility_cull_data.cull_count > thread_cull_threshold) {
+				visibility_cull_chunk_cursor.store(0, std::memory_order_relaxed);
 				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererSceneCull::_visibility_cull_threaded, &visibility_cull_data, WorkerThreadPool::get_singleton()->get_thread_count(), -1, true, SNAME("VisibilityCullInstances"));
 				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 			} else {
@@ -3246,6 +3367,8 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 				thread.clear();
 			}
 
+			scene_cull_chunk_cursor.store(0, std::memory_order_relaxed);
+
 			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererSceneCull::_scene_cull_threaded, &cull_data, scene_cull_result_threads.size(), -1, true, SNAME("RenderCullInstances"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
@@ -3285,6 +3408,11 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 		for (uint32_t i = 0; i < cull.shadow_count; i++) {
 			for (uint32_t j = 0; j < cull.shadows[i].cascade_count; j++) {
 				const Cull::Shadow::Cascade &c = cull.shadows[i].cascades[j];
+				if (!c.update) {
+					// Keep last frame's depth map together with last frame's matrices,
+					// so sampling stays self-consistent for the skipped cascade.
+					continue;
+				}
 				//			print_line("shadow " + itos(i) + " cascade " + itos(j) + " elements: " + itos(c.cull_result.size()));
 				RSG::light_storage->light_instance_set_shadow_transform(cull.shadows[i].light_instance, c.projection, c.transform, c.zfar, c.split, j, c.shadow_texel_size, c.bias_scale, c.range_begin, c.uv_scale);
 				if (max_shadows_used == MAX_UPDATE_SHADOWS) {
@@ -3415,11 +3543,13 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 				RENDER_TIMESTAMP("> Render Light3D " + itos(i));
 				if (_light_instance_update_shadow(ins, p_camera_data->main_transform, p_camera_data->main_projection, p_camera_data->is_orthogonal, p_camera_data->vaspect, p_shadow_atlas, scenario, p_screen_mesh_lod_threshold, p_visible_layers)) {
 					light->make_shadow_dirty();
+					RSG::light_storage->light_instance_mark_shadow_stale(light->instance);
 				}
 				RENDER_TIMESTAMP("< Render Light3D " + itos(i));
 			} else {
 				if (redraw) {
 					light->make_shadow_dirty();
+					RSG::light_storage->light_instance_mark_shadow_stale(light->instance);
 				}
 			}
 		}
@@ -4106,6 +4236,7 @@ void RendererSceneCull::_update_dirty_instance(Instance *p_instance) const {
 				for (const Instance *E : geom->lights) {
 					InstanceLightData *light = static_cast<InstanceLightData *>(E->base_data);
 					light->make_shadow_dirty();
+					RSG::light_storage->light_instance_mark_shadow_stale(light->instance);
 				}
 
 				geom->can_cast_shadows = can_cast_shadows;
@@ -4113,6 +4244,22 @@ void RendererSceneCull::_update_dirty_instance(Instance *p_instance) const {
 
 			geom->material_is_animated = is_animated;
 
+			if (p_instance->scenario && p_instance->array_index != -1) {
+				// Keep the dense cull record in sync; the shadow cull loops read
+				// these flags instead of chasing base_data.
+				InstanceData &idata = p_instance->scenario->instance_data[p_instance->array_index];
+				if (geom->can_cast_shadows) {
+					idata.flags |= InstanceData::FLAG_GEOM_CAN_CAST_SHADOWS;
+				} else {
+					idata.flags &= ~InstanceData::FLAG_GEOM_CAN_CAST_SHADOWS;
+				}
+				if (geom->material_is_animated) {
+					idata.flags |= InstanceData::FLAG_GEOM_MATERIAL_IS_ANIMATED;
+				} else {
+					idata.flags &= ~InstanceData::FLAG_GEOM_MATERIAL_IS_ANIMATED;
+				}
+			}
+
 			if (p_instance->instance_uniforms.materials_finish(p_instance->self)) {
 				geom->geometry_instance->set_instance_shader_uniforms_offset(p_instance->instance_uniforms.location());
 			}
@@ -4223,7 +4370,22 @@ TypedArray<Image> RendererSceneCull::bake_render_uv2(RID p_base, const TypedArra
 	return scene_render->bake_render_uv2(p_base, p_material_overrides, p_image_size);
 }
 
+void RendererSceneCull::_flush_visibility_notifier_callbacks(const Array &p_callbacks) {
+	for (int i = 0; i < p_callbacks.size(); i++) {
+		Callable callback = p_callbacks[i];
+		if (callback.is_valid()) {
+			callback.call();
+		}
+	}
+}
+
 void RendererSceneCull::update_visibility_notifiers() {
+	// The visible notifier list only holds notifiers that changed state or are
+	// still on screen, so this is already a diff pass. When running threaded,
+	// collect the callbacks of every transition and deliver them through a single
+	// deferred flush; one message per frame instead of one per notifier.
+	Array batched_callbacks;
+
 	SelfList<InstanceVisibilityNotifierData> *E = visible_notifier_list.first();
 	while (E) {
 		SelfList<InstanceVisibilityNotifierData> *N = E->next();
@@ -4232,17 +4394,37 @@ void RendererSceneCull::update_visibility_notifiers() {
 		if (visibility_notifier->just_visible) {
 			visibility_notifier->just_visible = false;
 
-			RSG::utilities->visibility_notifier_call(visibility_notifier->base, true, RSG::threaded);
+			if (RSG::threaded) {
+				Callable callback = RSG::utilities->visibility_notifier_get_callback(visibility_notifier->base, true);
+				if (callback.is_valid()) {
+					batched_callbacks.push_back(callback);
+				}
+			} else {
+				RSG::utilities->visibility_notifier_call(visibility_notifier->base, true, false);
+			}
 		} else {
 			if (visibility_notifier->visible_in_frame != RSG::rasterizer->get_frame_number()) {
 				visible_notifier_list.remove(E);
 
-				RSG::utilities->visibility_notifier_call(visibility_notifier->base, false, RSG::threaded);
+				if (RSG::threaded) {
+					Callable callback = RSG::utilities->visibility_notifier_get_callback(visibility_notifier->base, false);
+					if (callback.is_valid()) {
+						batched_callbacks.push_back(callback);
+					}
+				} else {
+					RSG::utilities->visibility_notifier_call(visibility_notifier->base, false, false);
+				}
 			}
 		}
 
 		E = N;
 	}
+
+	if (!batched_callbacks.is_empty()) {
+		// The callbacks hold ObjectIDs, so notifiers freed before the flush runs
+		// are skipped safely by the message queue.
+		callable_mp_static(&RendererSceneCull::_flush_visibility_notifier_callbacks).call_deferred(batched_callbacks);
+	}
 }
 
 /*******************************/
@@ -4306,6 +4488,8 @@ RendererSceneCull::RendererSceneCull() {
 	bool tighter_caster_culling = GLOBAL_DEF("rendering/lights_and_shadows/tighter_shadow_caster_culling", true);
 	light_culler->set_caster_culling_active(tighter_caster_culling);
 	light_culler->set_light_culling_active(tighter_caster_culling);
+
+	directional_distant_cascade_interval = GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/lights_and_shadows/directional_shadow/distant_cascade_update_interval", PROPERTY_HINT_RANGE, "1,8,1"), 1);
 }
 
 RendererSceneCull::~RendererSceneCull() {
@@ -46,6 +46,8 @@
 #include "servers/rendering/rendering_server_globals.h"
 #include "servers/rendering/storage/utilities.h"
 
+#include <atomic>
+
 class RenderingLightCuller;
 
 class RendererSceneCull : public RenderingMethod {
@@ -248,6 +250,31 @@ public:
 
 			return true;
 		}
+
+		// Batch variant of in_frustum() over a contiguous run of bounds. Written
+		// branch-free across instances so the compiler can auto-vectorize the
+		// inner loops; per-instance early outs would defeat that and save little,
+		// as each plane test is only a handful of multiply-adds. Explicit
+		// intrinsics are deliberately avoided to stay portable across ISAs and
+		// real_t widths.
+		static void in_frustum_batch(const Frustum &p_frustum, const InstanceBounds *p_bounds, uint32_t p_count, uint8_t *r_results) {
+			for (uint32_t j = 0; j < p_count; j++) {
+				r_results[j] = 1;
+			}
+
+			for (uint32_t i = 0; i < p_frustum.plane_count; i++) {
+				const Plane &p = p_frustum.planes_ptr[i];
+				uint32_t sign_x = p_frustum.plane_signs_ptr[i].signs[0];
+				uint32_t sign_y = p_frustum.plane_signs_ptr[i].signs[1];
+				uint32_t sign_z = p_frustum.plane_signs_ptr[i].signs[2];
+
+				for (uint32_t j = 0; j < p_count; j++) {
+					const real_t *b = p_bounds[j].bounds;
+					real_t dist = p.normal.x * b[sign_x] + p.normal.y * b[sign_y] + p.normal.z * b[sign_z] - p.d;
+					r_results[j] &= uint8_t(dist < 0.0);
+				}
+			}
+		}
 	};
 
 	struct InstanceVisibilityNotifierData;
@@ -275,6 +302,8 @@ public:
 			FLAG_VISIBILITY_DEPENDENCY_FADE_CHILDREN = (1 << 22),
 			FLAG_GEOM_PROJECTOR_SOFTSHADOW_DIRTY = (1 << 23),
 			FLAG_IGNORE_ALL_CULLING = (1 << 24),
+			FLAG_GEOM_CAN_CAST_SHADOWS = (1 << 25), // Mirrors InstanceGeometryData::can_cast_shadows.
+			FLAG_GEOM_MATERIAL_IS_ANIMATED = (1 << 26), // Mirrors InstanceGeometryData::material_is_animated.
 		};
 
 		uint32_t flags = 0;
@@ -402,6 +431,11 @@ public:
 		RS::InstanceType base_type;
 		RID base;
 
+		// Index of this instance's dense cull record in Scenario::instance_data /
+		// instance_aabbs, or -1 while unpaired. Kept at the front of the struct so
+		// cull-phase loops that only need the dense record don't drag in the rest.
+		int32_t array_index = -1;
+
 		RID skeleton;
 		RID material_override;
 		RID material_overlay;
@@ -446,7 +480,6 @@ public:
 		RID self;
 		//scenario stuff
 		DynamicBVH::ID indexer_id;
-		int32_t array_index = -1;
 		int32_t visibility_index = -1;
 		float visibility_range_begin = 0.0f;
 		float visibility_range_end = 0.0f;
@@ -704,6 +737,22 @@ public:
 		uint32_t max_sdfgi_cascade = 2;
 		uint32_t cull_mask = 0xFFFFFFFF;
 
+		// Cached per-cascade shadow windows from the previous frame. Because the
+		// windows are snapped to shadow texels, an unchanged camera/light setup
+		// reproduces them bit-exactly, which lets distant cascades skip re-rendering.
+		struct DirectionalCascade {
+			real_t x_min_cam = 0.0;
+			real_t x_max_cam = 0.0;
+			real_t y_min_cam = 0.0;
+			real_t y_max_cam = 0.0;
+			bool valid = false;
+		};
+
+		DirectionalCascade directional_cascades[RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES];
+		Basis directional_cascade_basis;
+		real_t directional_cascade_texture_size = 0.0;
+		int directional_cascade_shadow_index = -1;
+
 	private:
 		// Instead of a single dirty flag, we maintain a count
 		// so that we can detect lights that are being made dirty
@@ -1002,6 +1051,19 @@ public:
 	InstanceCullResult scene_cull_result;
 	LocalVector<InstanceCullResult> scene_cull_result_threads;
 
+	// Shared cursor used by the threaded cull to hand out instance chunks, so
+	// workers that land on cheap, mostly-culled regions of the instance array
+	// keep claiming work until the whole range is consumed.
+	std::atomic<uint32_t> scene_cull_chunk_cursor;
+
+	// Equivalent cursor for the visibility range cull, reset per dependency bin.
+	std::atomic<uint32_t> visibility_cull_chunk_cursor;
+
+	enum {
+		SCENE_CULL_CHUNK_SIZE = 512,
+		VISIBILITY_CULL_CHUNK_SIZE = 256,
+	};
+
 	RendererSceneRender::RenderShadowData render_shadow_data[MAX_UPDATE_SHADOWS];
 	uint32_t max_shadows_used = 0;
 
@@ -1010,6 +1072,10 @@ public:
 
 	uint32_t thread_cull_threshold = 200;
 
+	// Distant directional cascades whose snapped shadow window is unchanged are
+	// re-rendered every N frames instead of every frame (1 = always update).
+	uint32_t directional_distant_cascade_interval = 1;
+
 	mutable RID_Owner<Instance, true> instance_owner{ 65536, 4194304 };
 
 	uint32_t geometry_instance_pair_mask = 0; // used in traditional forward, unnecessary on clustered
@@ -1025,6 +1091,7 @@ public:
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask);
 	virtual void instance_set_pivot_data(RID p_instance, float p_sorting_offset, bool p_use_aabb_center);
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform);
+	virtual void instance_set_transforms_bulk(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms);
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id);
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight);
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material);
@@ -1097,6 +1164,8 @@ public:
 				real_t bias_scale;
 				real_t range_begin;
 				Vector2 uv_scale;
+				// When false, the cascade keeps last frame's depth and matrices instead of re-rendering.
+				bool update = true;
 
 			} cascades[RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES]; //max 4 cascades
 			uint32_t cascade_count;
@@ -1157,6 +1226,8 @@ public:
 	void render_empty_scene(const Ref<RenderSceneBuffers> &p_render_buffers, RID p_scenario, RID p_shadow_atlas);
 
 	void render_camera(const Ref<RenderSceneBuffers> &p_render_buffers, RID p_camera, RID p_scenario, RID p_viewport, Size2 p_viewport_size, uint32_t p_jitter_phase_count, float p_screen_mesh_lod_threshold, RID p_shadow_atlas, Ref<XRInterface> &p_xr_interface, RenderingMethod::RenderInfo *r_render_info = nullptr);
+	void render_camera_occlusion_prepare(RID p_camera, RID p_viewport, Size2 p_viewport_size);
+	static void _camera_get_projection(const Camera *p_camera, Size2 p_viewport_size, Projection &r_projection, bool &r_is_orthogonal, bool &r_is_frustum);
 	void update_dirty_instances() const;
 
 	void render_particle_colliders();
@@ -1383,6 +1454,7 @@ public:
 	/* Render Buffers */
 
 	PASS0R(Ref<RenderSceneBuffers>, render_buffers_create)
+	PASS1R(bool, reproject_to_render_target, const Ref<RenderSceneBuffers> &)
 	PASS1(gi_set_use_half_resolution, bool)
 
 	/* Misc */
@@ -1399,6 +1471,7 @@ public:
 
 	void set_scene_render(RendererSceneRender *p_scene_render);
 
+	static void _flush_visibility_notifier_callbacks(const Array &p_callbacks);
 	virtual void update_visibility_notifiers();
 
 	/* INTERPOLATION */
@@ -288,6 +288,25 @@ void RendererViewport::_configure_3d_render_buffers(Viewport *p_viewport) {
 	}
 }
 
+void RendererViewport::_update_occlusion_buffer_size(Viewport *p_viewport) {
+#ifndef _3D_DISABLED
+	if (!p_viewport->occlusion_buffer_dirty) {
+		return;
+	}
+
+	float aspect = p_viewport->size.aspect();
+	int max_size = occlusion_rays_per_thread * WorkerThreadPool::get_singleton()->get_thread_count();
+
+	int viewport_size = p_viewport->size.width * p_viewport->size.height;
+	max_size = CLAMP(max_size, viewport_size / (32 * 32), viewport_size / (2 * 2)); // At least one depth pixel for every 16x16 region. At most one depth pixel for every 2x2 region.
+
+	float height = Math::sqrt(max_size / aspect);
+	Size2i new_size = Size2i(height * aspect, height);
+	RendererSceneOcclusionCull::get_singleton()->buffer_set_size(p_viewport->self, new_size);
+	p_viewport->occlusion_buffer_dirty = false;
+#endif // _3D_DISABLED
+}
+
 void RendererViewport::_draw_3d(Viewport *p_viewport) {
 #ifndef _3D_DISABLED
 	RENDER_TIMESTAMP("> Render 3D Scene");
@@ -300,18 +319,7 @@ void RendererViewport::_draw_3d(Viewport *p_viewport) {
 #endif // XR_DISABLED
 
 	if (p_viewport->use_occlusion_culling) {
-		if (p_viewport->occlusion_buffer_dirty) {
-			float aspect = p_viewport->size.aspect();
-			int max_size = occlusion_rays_per_thread * WorkerThreadPool::get_singleton()->get_thread_count();
-
-			int viewport_size = p_viewport->size.width * p_viewport->size.height;
-			max_size = CLAMP(max_size, viewport_size / (32 * 32), viewport_size / (2 * 2)); // At least one depth pixel for every 16x16 region. At most one depth pixel for every 2x2 region.
-
-			float height = Math::sqrt(max_size / aspect);
-			Size2i new_size = Size2i(height * aspect, height);
-			RendererSceneOcclusionCull::get_singleton()->buffer_set_size(p_viewport->self, new_size);
-			p_viewport->occlusion_buffer_dirty = false;
-		}
+		_update_occlusion_buffer_size(p_viewport);
 	}
 
 	float screen_mesh_lod_threshold = p_viewport->mesh_lod_threshold / float(p_viewport->size.width);
@@ -381,7 +389,18 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 		if (force_clear_render_target) {
 			RSG::texture_storage->render_target_do_clear_request(p_viewport->render_target);
 		}
-		_draw_3d(p_viewport);
+
+		bool frame_generated = false;
+		if (p_viewport->use_frame_generation && p_viewport->render_buffers.is_valid() && (RSG::rasterizer->get_frame_number() & 1)) {
+			// On alternate frames, extrapolate the last rendered 3D frame along
+			// its motion vectors instead of rendering the scene. 2D is still
+			// drawn on top at full rate below. Falls back to a full render when
+			// the renderer doesn't support it or no history exists yet.
+			frame_generated = RSG::scene->reproject_to_render_target(p_viewport->render_buffers);
+		}
+		if (!frame_generated) {
+			_draw_3d(p_viewport);
+		}
 	}
 
 	if (can_draw_2d) {
@@ -820,6 +839,31 @@ void RendererViewport::draw_viewports(bool p_swap_buffers) {
 		}
 	}
 
+#ifndef _3D_DISABLED
+	// Kick off occlusion buffer updates for every viewport that will render 3D before
+	// drawing any of them. The raycasts run on worker threads, so the update for one
+	// viewport overlaps with culling and command recording for the previous ones;
+	// render_camera() waits for its own viewport's update before culling against it.
+	for (int i = 0; i < sorted_active_viewports.size(); i++) {
+		Viewport *vp = sorted_active_viewports[i];
+
+		if (vp->last_pass != draw_viewports_pass || vp->disable_3d || !vp->use_occlusion_culling) {
+			continue;
+		}
+#ifndef XR_DISABLED
+		if (vp->use_xr) {
+			continue; // XR view transforms are only fresh right before drawing.
+		}
+#endif // XR_DISABLED
+		if (!RSG::scene->is_camera(vp->camera)) {
+			continue;
+		}
+
+		_update_occlusion_buffer_size(vp);
+		RSG::scene->render_camera_occlusion_prepare(vp->camera, vp->self, vp->internal_size);
+	}
+#endif // _3D_DISABLED
+
 	int vertices_drawn = 0;
 	int objects_drawn = 0;
 	int draw_calls_used = 0;
@@ -1075,7 +1119,7 @@ void RendererViewport::_viewport_set_size(Viewport *p_viewport, int p_width, int
 }
 
 bool RendererViewport::_viewport_requires_motion_vectors(Viewport *p_viewport) {
-	return p_viewport->use_taa ||
+	return p_viewport->use_taa || p_viewport->use_frame_generation ||
 			RS::scaling_3d_mode_type(p_viewport->scaling_3d_mode) == RS::VIEWPORT_SCALING_3D_TYPE_TEMPORAL ||
 			p_viewport->debug_draw == RenderingServer::VIEWPORT_DEBUG_DRAW_MOTION_VECTORS || p_viewport->force_motion_vectors;
 }
@@ -1416,6 +1460,25 @@ void RendererViewport::viewport_set_use_taa(RID p_viewport, bool p_use_taa) {
 	_configure_3d_render_buffers(viewport);
 }
 
+void RendererViewport::viewport_set_use_frame_generation(RID p_viewport, bool p_enable) {
+	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
+	ERR_FAIL_NULL(viewport);
+
+	if (viewport->use_frame_generation == p_enable) {
+		return;
+	}
+
+	bool motion_vectors_before = _viewport_requires_motion_vectors(viewport);
+	viewport->use_frame_generation = p_enable;
+
+	bool motion_vectors_after = _viewport_requires_motion_vectors(viewport);
+	if (motion_vectors_before != motion_vectors_after) {
+		num_viewports_with_motion_vectors += motion_vectors_after ? 1 : -1;
+	}
+
+	_configure_3d_render_buffers(viewport);
+}
+
 void RendererViewport::viewport_set_use_debanding(RID p_viewport, bool p_use_debanding) {
 	Viewport *viewport = viewport_owner.get_or_null(p_viewport);
 	ERR_FAIL_NULL(viewport);
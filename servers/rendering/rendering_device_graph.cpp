@@ -38,6 +38,10 @@
 // Prints the total number of bytes used for draw lists in a frame.
 #define PRINT_DRAW_LIST_STATS 0
 
+// Draw lists with more instruction data than this will be recorded as secondary command buffers on
+// background threads, as long as the frame still has unused secondary command buffers available.
+#define SECONDARY_COMMAND_BUFFER_INSTRUCTION_DATA_THRESHOLD 16384
+
 RenderingDeviceGraph::RenderingDeviceGraph() {
 	driver_honors_barriers = false;
 	driver_clears_with_copy_engine = false;
@@ -974,6 +978,7 @@ void RenderingDeviceGraph::_add_draw_list_begin(FramebufferCache *p_framebuffer_
 	}
 
 	draw_instruction_list.split_cmd_buffer = p_split_cmd_buffer;
+	draw_instruction_list.uses_subpasses = false;
 
 #if defined(DEBUG_ENABLED) || defined(DEV_ENABLED)
 	draw_instruction_list.breadcrumb = p_breadcrumb;
@@ -1955,6 +1960,7 @@ void RenderingDeviceGraph::add_draw_list_next_subpass(RDD::CommandBufferType p_c
 	DrawListNextSubpassInstruction *instruction = reinterpret_cast<DrawListNextSubpassInstruction *>(_allocate_draw_list_instruction(sizeof(DrawListNextSubpassInstruction)));
 	instruction->type = DrawListInstruction::TYPE_NEXT_SUBPASS;
 	instruction->command_buffer_type = p_command_buffer_type;
+	draw_instruction_list.uses_subpasses = true;
 }
 
 void RenderingDeviceGraph::add_draw_list_set_blend_constants(const Color &p_color) {
@@ -2024,6 +2030,31 @@ void RenderingDeviceGraph::add_draw_list_usages(VectorView<ResourceTracker *> p_
 
 void RenderingDeviceGraph::add_draw_list_end() {
 	FramebufferCache *framebuffer_cache = draw_instruction_list.framebuffer_cache;
+	RDD::CommandBufferType command_buffer_type = RDD::COMMAND_BUFFER_TYPE_PRIMARY;
+	uint32_t &secondary_buffers_used = frames[frame].secondary_command_buffers_used;
+	bool use_secondary_buffer = draw_instruction_list.data.size() > SECONDARY_COMMAND_BUFFER_INSTRUCTION_DATA_THRESHOLD;
+
+	// Secondary command buffers must specify the render pass when they start recording, so draw
+	// lists that create their render pass lazily from a framebuffer cache, as well as draw lists
+	// that switch subpasses, are always recorded on the main thread.
+	use_secondary_buffer = use_secondary_buffer && framebuffer_cache == nullptr && !draw_instruction_list.uses_subpasses;
+
+	if (use_secondary_buffer && secondary_buffers_used < frames[frame].secondary_command_buffers.size()) {
+		// Copy the instruction data and hand off recording of the draw list to a background thread.
+		SecondaryCommandBuffer &secondary = frames[frame].secondary_command_buffers[secondary_buffers_used];
+		secondary.render_pass = draw_instruction_list.render_pass;
+		secondary.framebuffer = draw_instruction_list.framebuffer;
+		secondary.instruction_data.resize(draw_instruction_list.data.size());
+		memcpy(secondary.instruction_data.ptr(), draw_instruction_list.data.ptr(), draw_instruction_list.data.size());
+		secondary.task = WorkerThreadPool::get_singleton()->add_template_task(this, &RenderingDeviceGraph::_run_secondary_command_buffer_task, &secondary, true, "SecondaryCommandBufferRecording");
+		secondary_buffers_used++;
+
+		// Replace the instruction list with a single instruction that executes the secondary command buffer.
+		draw_instruction_list.data.clear();
+		add_draw_list_execute_commands(secondary.command_buffer);
+		command_buffer_type = RDD::COMMAND_BUFFER_TYPE_SECONDARY;
+	}
+
 	int32_t command_index;
 	uint32_t clear_values_size = sizeof(RDD::RenderPassClearValue) * draw_instruction_list.attachment_clear_values.size();
 	uint32_t trackers_count = framebuffer_cache != nullptr ? framebuffer_cache->trackers.size() : 0;
@@ -2037,7 +2068,7 @@ void RenderingDeviceGraph::add_draw_list_end() {
 	command->render_pass = draw_instruction_list.render_pass;
 	command->framebuffer = draw_instruction_list.framebuffer;
 	command->instruction_data_size = instruction_data_size;
-	command->command_buffer_type = RDD::COMMAND_BUFFER_TYPE_PRIMARY;
+	command->command_buffer_type = command_buffer_type;
 	command->region = draw_instruction_list.region;
 #if defined(DEBUG_ENABLED) || defined(DEV_ENABLED)
 	command->breadcrumb = draw_instruction_list.breadcrumb;
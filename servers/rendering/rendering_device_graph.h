@@ -271,6 +271,7 @@ private:
 		uint32_t breadcrumb;
 #endif
 		bool split_cmd_buffer = false;
+		bool uses_subpasses = false;
 	};
 
 	struct RecordedCommandSort {
@@ -90,6 +90,38 @@ PackedInt64Array RenderingServer::_instances_cull_ray_bind(const Vector3 &p_from
 	return to_int_array(ids);
 }
 
+void RenderingServer::_instance_set_transforms_bulk_bind(const TypedArray<RID> &p_instances, const TypedArray<Transform3D> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+	int count = p_instances.size();
+	Vector<RID> instances;
+	Vector<Transform3D> transforms;
+	instances.resize(count);
+	transforms.resize(count);
+	RID *instances_w = instances.ptrw();
+	Transform3D *transforms_w = transforms.ptrw();
+	for (int i = 0; i < count; i++) {
+		instances_w[i] = p_instances[i];
+		transforms_w[i] = p_transforms[i];
+	}
+	instance_set_transforms_bulk(instances, transforms);
+}
+
+void RenderingServer::_canvas_item_set_transforms_bulk_bind(const TypedArray<RID> &p_items, const TypedArray<Transform2D> &p_transforms) {
+	ERR_FAIL_COND(p_items.size() != p_transforms.size());
+	int count = p_items.size();
+	Vector<RID> items;
+	Vector<Transform2D> transforms;
+	items.resize(count);
+	transforms.resize(count);
+	RID *items_w = items.ptrw();
+	Transform2D *transforms_w = transforms.ptrw();
+	for (int i = 0; i < count; i++) {
+		items_w[i] = p_items[i];
+		transforms_w[i] = p_transforms[i];
+	}
+	canvas_item_set_transforms_bulk(items, transforms);
+}
+
 PackedInt64Array RenderingServer::_instances_cull_convex_bind(const TypedArray<Plane> &p_convex, RID p_scenario) const {
 	Vector<Plane> planes;
 	for (int i = 0; i < p_convex.size(); ++i) {
@@ -2929,6 +2961,7 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("viewport_set_use_hdr_2d", "viewport", "enabled"), &RenderingServer::viewport_set_use_hdr_2d);
 	ClassDB::bind_method(D_METHOD("viewport_set_screen_space_aa", "viewport", "mode"), &RenderingServer::viewport_set_screen_space_aa);
 	ClassDB::bind_method(D_METHOD("viewport_set_use_taa", "viewport", "enable"), &RenderingServer::viewport_set_use_taa);
+	ClassDB::bind_method(D_METHOD("viewport_set_use_frame_generation", "viewport", "enable"), &RenderingServer::viewport_set_use_frame_generation);
 	ClassDB::bind_method(D_METHOD("viewport_set_use_debanding", "viewport", "enable"), &RenderingServer::viewport_set_use_debanding);
 	ClassDB::bind_method(D_METHOD("viewport_set_use_occlusion_culling", "viewport", "enable"), &RenderingServer::viewport_set_use_occlusion_culling);
 	ClassDB::bind_method(D_METHOD("viewport_set_occlusion_rays_per_thread", "rays_per_thread"), &RenderingServer::viewport_set_occlusion_rays_per_thread);
@@ -3246,6 +3279,7 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("instance_set_layer_mask", "instance", "mask"), &RenderingServer::instance_set_layer_mask);
 	ClassDB::bind_method(D_METHOD("instance_set_pivot_data", "instance", "sorting_offset", "use_aabb_center"), &RenderingServer::instance_set_pivot_data);
 	ClassDB::bind_method(D_METHOD("instance_set_transform", "instance", "transform"), &RenderingServer::instance_set_transform);
+	ClassDB::bind_method(D_METHOD("instance_set_transforms_bulk", "instances", "transforms"), &RenderingServer::_instance_set_transforms_bulk_bind);
 	ClassDB::bind_method(D_METHOD("instance_attach_object_instance_id", "instance", "id"), &RenderingServer::instance_attach_object_instance_id);
 	ClassDB::bind_method(D_METHOD("instance_set_blend_shape_weight", "instance", "shape", "weight"), &RenderingServer::instance_set_blend_shape_weight);
 	ClassDB::bind_method(D_METHOD("instance_set_surface_override_material", "instance", "surface", "material"), &RenderingServer::instance_set_surface_override_material);
@@ -3350,6 +3384,7 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("canvas_item_set_light_mask", "item", "mask"), &RenderingServer::canvas_item_set_light_mask);
 	ClassDB::bind_method(D_METHOD("canvas_item_set_visibility_layer", "item", "visibility_layer"), &RenderingServer::canvas_item_set_visibility_layer);
 	ClassDB::bind_method(D_METHOD("canvas_item_set_transform", "item", "transform"), &RenderingServer::canvas_item_set_transform);
+	ClassDB::bind_method(D_METHOD("canvas_item_set_transforms_bulk", "items", "transforms"), &RenderingServer::_canvas_item_set_transforms_bulk_bind);
 	ClassDB::bind_method(D_METHOD("canvas_item_set_clip", "item", "clip"), &RenderingServer::canvas_item_set_clip);
 	ClassDB::bind_method(D_METHOD("canvas_item_set_distance_field_mode", "item", "enabled"), &RenderingServer::canvas_item_set_distance_field_mode);
 	ClassDB::bind_method(D_METHOD("canvas_item_set_custom_rect", "item", "use_custom_rect", "rect"), &RenderingServer::canvas_item_set_custom_rect, DEFVAL(Rect2()));
@@ -3539,6 +3574,9 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("request_frame_drawn_callback", "callable"), &RenderingServer::request_frame_drawn_callback);
 	ClassDB::bind_method(D_METHOD("has_changed"), &RenderingServer::has_changed);
 	ClassDB::bind_method(D_METHOD("get_rendering_info", "info"), &RenderingServer::get_rendering_info);
+	ClassDB::bind_method(D_METHOD("set_texture_memory_budget", "size_bytes"), &RenderingServer::set_texture_memory_budget);
+	ClassDB::bind_method(D_METHOD("get_texture_memory_budget"), &RenderingServer::get_texture_memory_budget);
+	ClassDB::bind_method(D_METHOD("get_texture_memory_pressure"), &RenderingServer::get_texture_memory_pressure);
 	ClassDB::bind_method(D_METHOD("get_video_adapter_name"), &RenderingServer::get_video_adapter_name);
 	ClassDB::bind_method(D_METHOD("get_video_adapter_vendor"), &RenderingServer::get_video_adapter_vendor);
 	ClassDB::bind_method(D_METHOD("get_video_adapter_type"), &RenderingServer::get_video_adapter_type);
@@ -3666,6 +3704,21 @@ void RenderingServer::set_render_loop_enabled(bool p_enabled) {
 	render_loop_enabled = p_enabled;
 }
 
+void RenderingServer::set_texture_memory_budget(uint64_t p_size_bytes) {
+	texture_memory_budget = p_size_bytes;
+}
+
+uint64_t RenderingServer::get_texture_memory_budget() const {
+	return texture_memory_budget;
+}
+
+double RenderingServer::get_texture_memory_pressure() {
+	if (texture_memory_budget == 0) {
+		return 0.0;
+	}
+	return double(get_rendering_info(RENDERING_INFO_TEXTURE_MEM_USED)) / double(texture_memory_budget);
+}
+
 RenderingServer::RenderingServer() {
 	//ERR_FAIL_COND(singleton);
 
@@ -3693,6 +3746,11 @@ void RenderingServer::init() {
 
 	GLOBAL_DEF("rendering/textures/lossless_compression/force_png", false);
 
+	GLOBAL_DEF_RST("rendering/textures/dummy/retain_data", true);
+
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/textures/memory_budget_mb", PROPERTY_HINT_RANGE, "0,16384,1,or_greater"), 0);
+	texture_memory_budget = uint64_t(int(GLOBAL_GET("rendering/textures/memory_budget_mb"))) * 1024 * 1024;
+
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/textures/webp_compression/compression_method", PROPERTY_HINT_RANGE, "0,6,1"), 2);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/textures/webp_compression/lossless_compression_factor", PROPERTY_HINT_RANGE, "0,100,1"), 25);
 
@@ -3823,6 +3881,7 @@ void RenderingServer::init() {
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/global_illumination/sdfgi/probe_ray_count", PROPERTY_HINT_ENUM, "8 (Fastest),16,32,64,96,128 (Slowest)"), 1);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/global_illumination/sdfgi/frames_to_converge", PROPERTY_HINT_ENUM, "5 (Less Latency but Lower Quality),10,15,20,25,30 (More Latency but Higher Quality)"), 5);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/global_illumination/sdfgi/frames_to_update_lights", PROPERTY_HINT_ENUM, "1 (Slower),2,4,8,16 (Faster)"), 2);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/global_illumination/sdfgi/max_cascade_rebuilds_per_frame", PROPERTY_HINT_RANGE, "0,8,1"), 1);
 
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/environment/volumetric_fog/volume_size", PROPERTY_HINT_RANGE, "16,512,1"), 64);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/environment/volumetric_fog/volume_depth", PROPERTY_HINT_RANGE, "16,512,1"), 64);
@@ -67,6 +67,8 @@ void RenderingServerDefault::request_frame_drawn_callback(const Callable &p_call
 }
 
 void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
+	ScopedAllocTag alloc_tag(Memory::ALLOC_TAG_RENDERING);
+
 	GodotProfileZoneGroupedFirst(_profile_zone, "rasterizer->begin_frame");
 	RSG::rasterizer->begin_frame(frame_step);
 
@@ -153,6 +155,25 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 		}
 
 		frame_profile = new_profile;
+
+#if defined(GODOT_USE_TRACY) || defined(GODOT_USE_PERFETTO)
+		// Feed the resolved per-pass GPU times to the external profiler, so
+		// on-device triage doesn't need the editor's visual profiler attached.
+		// Plot names must outlive the profiler session, so they are interned.
+		static HashMap<String, CharString> gpu_plot_names;
+		for (int i = 0; i < frame_profile.size() - 1; i++) {
+			const String &name = frame_profile[i].name;
+			if (name.is_empty() || name[0] == '<' || name[0] == '>') {
+				continue;
+			}
+
+			CharString *plot_name = gpu_plot_names.getptr(name);
+			if (!plot_name) {
+				plot_name = &gpu_plot_names.insert(name, ("GPU " + name).utf8())->value;
+			}
+			GodotProfilePlot(plot_name->get_data(), frame_profile[i + 1].gpu_msec - frame_profile[i].gpu_msec);
+		}
+#endif
 	}
 
 	frame_profile_frame = RSG::utilities->get_captured_timestamps_frame();
@@ -250,6 +271,12 @@ void RenderingServerDefault::_init() {
 	RSG::fog = RSG::rasterizer->get_fog();
 	RSG::canvas_render = RSG::rasterizer->get_canvas();
 	sr->set_scene_render(RSG::rasterizer->get_scene());
+
+#if defined(GODOT_USE_TRACY) || defined(GODOT_USE_PERFETTO)
+	// Profiler builds always capture GPU timestamps, so per-pass timings show
+	// up in the external profiler without enabling the visual profiler.
+	RSG::utilities->capturing_timestamps = true;
+#endif
 }
 
 void RenderingServerDefault::_finish() {
@@ -408,11 +435,18 @@ void RenderingServerDefault::_thread_exit() {
 void RenderingServerDefault::_thread_loop() {
 	DisplayServer::get_singleton()->gl_window_make_current(DisplayServer::MAIN_WINDOW_ID); // Move GL to this thread.
 
+	// The pump task occupies this worker for the whole session, so bumping the
+	// priority doesn't affect regular pool tasks; restore it before the worker
+	// returns to the pool.
+	Thread::set_priority(Thread::PRIORITY_HIGH);
+
 	while (!exit) {
 		WorkerThreadPool::get_singleton()->yield();
 		command_queue.flush_all();
 	}
 
+	Thread::set_priority(Thread::PRIORITY_NORMAL);
+
 	DisplayServer::get_singleton()->release_rendering_thread();
 }
 
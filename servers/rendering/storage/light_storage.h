@@ -96,6 +96,9 @@ public:
 	virtual void light_instance_set_aabb(RID p_light_instance, const AABB &p_aabb) = 0;
 	virtual void light_instance_set_shadow_transform(RID p_light_instance, const Projection &p_projection, const Transform3D &p_transform, float p_far, float p_split, int p_pass, float p_shadow_texel_size, float p_bias_scale = 1.0, float p_range_begin = 0, const Vector2 &p_uv_scale = Vector2()) = 0;
 	virtual void light_instance_mark_visible(RID p_light_instance) = 0;
+	// Tells the shadow atlas that the cached shadow for this light will be re-rendered before it is
+	// sampled again, so its slot may be evicted ahead of slots with still-valid cached contents.
+	virtual void light_instance_mark_shadow_stale(RID p_light_instance) = 0;
 	virtual bool light_instances_can_render_shadow_cube() const {
 		return true;
 	}
@@ -458,17 +458,23 @@ void RendererMeshStorage::update_interpolation_frame(bool p_process) {
 
 				bool use_lerp = mmi->quality == 0;
 
+				if (use_lerp) {
+					// In lerp quality every component (transform, color and custom data)
+					// is plain lerped, so the whole packed buffer can be interpolated
+					// in one flat pass that the compiler can vectorize.
+					TransformInterpolator::interpolate_float_array(pf_prev, pf_curr, pf_int, (int64_t)num * mmi->_stride, f);
+
+					_multimesh_set_buffer(rid, mmi->_data_interpolated);
+					continue;
+				}
+
 				// Temporary transform (needed for swizzling).
 				Transform3D tp, tc, tr; // (transform prev, curr and result)
 
 				// Test for cache friendliness versus doing branchless.
 				for (int n = 0; n < num; n++) {
 					// Transform.
-					if (use_lerp) {
-						for (int i = 0; i < mmi->_vf_size_xform; i++) {
-							pf_int[i] = Math::lerp(pf_prev[i], pf_curr[i], f);
-						}
-					} else {
+					{
 						// Silly swizzling, this will slow things down.
 						// No idea why it is using this format...
 						// ... maybe due to the shader.
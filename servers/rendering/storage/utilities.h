@@ -143,6 +143,9 @@ public:
 
 	virtual AABB visibility_notifier_get_aabb(RID p_notifier) const = 0;
 	virtual void visibility_notifier_call(RID p_notifier, bool p_enter, bool p_deferred) = 0;
+	// Returns the enter or exit callback without calling it, so callers can batch
+	// deliveries of many notifier transitions into a single deferred flush.
+	virtual Callable visibility_notifier_get_callback(RID p_notifier, bool p_enter) const { return Callable(); }
 
 	/* TIMING */
 
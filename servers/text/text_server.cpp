@@ -373,6 +373,7 @@ void TextServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("font_render_glyph", "font_rid", "size", "index"), &TextServer::font_render_glyph);
 
 	ClassDB::bind_method(D_METHOD("font_draw_glyph", "font_rid", "canvas", "size", "pos", "index", "color", "oversampling"), &TextServer::font_draw_glyph, DEFVAL(Color(1, 1, 1)), DEFVAL(0.0));
+	ClassDB::bind_method(D_METHOD("font_draw_glyphs", "font_rid", "canvas", "size", "positions", "indices", "color", "oversampling"), &TextServer::font_draw_glyphs, DEFVAL(Color(1, 1, 1)), DEFVAL(0.0));
 	ClassDB::bind_method(D_METHOD("font_draw_glyph_outline", "font_rid", "canvas", "size", "outline_size", "pos", "index", "color", "oversampling"), &TextServer::font_draw_glyph_outline, DEFVAL(Color(1, 1, 1)), DEFVAL(0.0));
 
 	ClassDB::bind_method(D_METHOD("font_is_language_supported", "font_rid", "language"), &TextServer::font_is_language_supported);
@@ -1732,6 +1733,13 @@ PackedInt32Array TextServer::string_get_character_breaks(const String &p_string,
 	return ret;
 }
 
+void TextServer::font_draw_glyphs(const RID &p_font, const RID &p_canvas, int64_t p_size, const PackedVector2Array &p_positions, const PackedInt64Array &p_indices, const Color &p_color, float p_oversampling) const {
+	ERR_FAIL_COND(p_positions.size() != p_indices.size());
+	for (int i = 0; i < p_positions.size(); i++) {
+		font_draw_glyph(p_font, p_canvas, p_size, p_positions[i], p_indices[i], p_color, p_oversampling);
+	}
+}
+
 void TextServer::shaped_text_draw(const RID &p_shaped, const RID &p_canvas, const Vector2 &p_pos, double p_clip_l, double p_clip_r, const Color &p_color, float p_oversampling) const {
 	TextServer::Orientation orientation = shaped_text_get_orientation(p_shaped);
 	bool hex_codes = shaped_text_get_preserve_control(p_shaped) || shaped_text_get_preserve_invalid(p_shaped);
@@ -1747,12 +1755,34 @@ void TextServer::shaped_text_draw(const RID &p_shaped, const RID &p_canvas, cons
 	int v_size = shaped_text_get_glyph_count(p_shaped);
 	const Glyph *glyphs = shaped_text_get_glyphs(p_shaped);
 
+	// Glyphs sharing a font and size are handed to the backend as a single run, so it can batch glyphs drawn from the same cache texture.
+	RID run_font;
+	int run_size = 0;
+	PackedVector2Array run_positions;
+	PackedInt64Array run_indices;
+	auto flush_run = [&]() {
+		if (!run_positions.is_empty()) {
+			font_draw_glyphs(run_font, p_canvas, run_size, run_positions, run_indices, p_color, p_oversampling);
+			run_positions.clear();
+			run_indices.clear();
+		}
+	};
+	auto add_to_run = [&](const Glyph &p_glyph, const Vector2 &p_glyph_pos) {
+		if (p_glyph.font_rid != run_font || p_glyph.font_size != run_size) {
+			flush_run();
+			run_font = p_glyph.font_rid;
+			run_size = p_glyph.font_size;
+		}
+		run_positions.push_back(p_glyph_pos);
+		run_indices.push_back(p_glyph.index);
+	};
+
 	Vector2 ofs;
 	// Draw RTL ellipsis string when needed.
 	if (rtl && ellipsis_pos >= 0) {
 		for (int i = ellipsis_gl_size - 1; i >= 0; i--) {
 			for (int j = 0; j < ellipsis_glyphs[i].repeat; j++) {
-				font_draw_glyph(ellipsis_glyphs[i].font_rid, p_canvas, ellipsis_glyphs[i].font_size, ofs + p_pos + Vector2(ellipsis_glyphs[i].x_off, ellipsis_glyphs[i].y_off), ellipsis_glyphs[i].index, p_color, p_oversampling);
+				add_to_run(ellipsis_glyphs[i], ofs + p_pos + Vector2(ellipsis_glyphs[i].x_off, ellipsis_glyphs[i].y_off));
 				if (orientation == ORIENTATION_HORIZONTAL) {
 					ofs.x += ellipsis_glyphs[i].advance;
 				} else {
@@ -1779,10 +1809,12 @@ void TextServer::shaped_text_draw(const RID &p_shaped, const RID &p_canvas, cons
 				// Clip right / bottom.
 				if (orientation == ORIENTATION_HORIZONTAL) {
 					if (ofs.x + glyphs[i].advance > p_clip_r) {
+						flush_run();
 						return;
 					}
 				} else {
 					if (ofs.y + glyphs[i].advance > p_clip_r) {
+						flush_run();
 						return;
 					}
 				}
@@ -1803,8 +1835,9 @@ void TextServer::shaped_text_draw(const RID &p_shaped, const RID &p_canvas, cons
 			}
 
 			if (glyphs[i].font_rid != RID()) {
-				font_draw_glyph(glyphs[i].font_rid, p_canvas, glyphs[i].font_size, ofs + p_pos + Vector2(glyphs[i].x_off, glyphs[i].y_off), glyphs[i].index, p_color, p_oversampling);
+				add_to_run(glyphs[i], ofs + p_pos + Vector2(glyphs[i].x_off, glyphs[i].y_off));
 			} else if (hex_codes && ((glyphs[i].flags & GRAPHEME_IS_VIRTUAL) != GRAPHEME_IS_VIRTUAL) && ((glyphs[i].flags & GRAPHEME_IS_EMBEDDED_OBJECT) != GRAPHEME_IS_EMBEDDED_OBJECT)) {
+				flush_run(); // Keep the hex code box in draw order.
 				TextServer::draw_hex_code_box(p_canvas, glyphs[i].font_size, ofs + p_pos + Vector2(glyphs[i].x_off, glyphs[i].y_off), glyphs[i].index, p_color);
 			}
 			if (orientation == ORIENTATION_HORIZONTAL) {
@@ -1818,7 +1851,7 @@ void TextServer::shaped_text_draw(const RID &p_shaped, const RID &p_canvas, cons
 	if (!rtl && ellipsis_pos >= 0) {
 		for (int i = 0; i < ellipsis_gl_size; i++) {
 			for (int j = 0; j < ellipsis_glyphs[i].repeat; j++) {
-				font_draw_glyph(ellipsis_glyphs[i].font_rid, p_canvas, ellipsis_glyphs[i].font_size, ofs + p_pos + Vector2(ellipsis_glyphs[i].x_off, ellipsis_glyphs[i].y_off), ellipsis_glyphs[i].index, p_color, p_oversampling);
+				add_to_run(ellipsis_glyphs[i], ofs + p_pos + Vector2(ellipsis_glyphs[i].x_off, ellipsis_glyphs[i].y_off));
 				if (orientation == ORIENTATION_HORIZONTAL) {
 					ofs.x += ellipsis_glyphs[i].advance;
 				} else {
@@ -1827,6 +1860,7 @@ void TextServer::shaped_text_draw(const RID &p_shaped, const RID &p_canvas, cons
 			}
 		}
 	}
+	flush_run();
 }
 
 void TextServer::shaped_text_draw_outline(const RID &p_shaped, const RID &p_canvas, const Vector2 &p_pos, double p_clip_l, double p_clip_r, int64_t p_outline_size, const Color &p_color, float p_oversampling) const {
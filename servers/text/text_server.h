@@ -428,6 +428,7 @@ public:
 	virtual void font_render_glyph(const RID &p_font_rid, const Vector2i &p_size, int64_t p_index) = 0;
 
 	virtual void font_draw_glyph(const RID &p_font, const RID &p_canvas, int64_t p_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color = Color(1, 1, 1), float p_oversampling = 0.0) const = 0;
+	virtual void font_draw_glyphs(const RID &p_font, const RID &p_canvas, int64_t p_size, const PackedVector2Array &p_positions, const PackedInt64Array &p_indices, const Color &p_color = Color(1, 1, 1), float p_oversampling = 0.0) const;
 	virtual void font_draw_glyph_outline(const RID &p_font, const RID &p_canvas, int64_t p_size, int64_t p_outline_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color = Color(1, 1, 1), float p_oversampling = 0.0) const = 0;
 
 	virtual bool font_is_language_supported(const RID &p_font_rid, const String &p_language) const = 0;
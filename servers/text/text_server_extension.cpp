@@ -213,6 +213,7 @@ void TextServerExtension::_bind_methods() {
 	GDVIRTUAL_BIND(_font_render_glyph, "font_rid", "size", "index");
 
 	GDVIRTUAL_BIND(_font_draw_glyph, "font_rid", "canvas", "size", "pos", "index", "color", "oversampling");
+	GDVIRTUAL_BIND(_font_draw_glyphs, "font_rid", "canvas", "size", "positions", "indices", "color", "oversampling");
 	GDVIRTUAL_BIND(_font_draw_glyph_outline, "font_rid", "canvas", "size", "outline_size", "pos", "index", "color", "oversampling");
 #ifndef DISABLE_DEPRECATED
 	GDVIRTUAL_BIND_COMPAT(_font_draw_glyph_bind_compat_104872, "font_rid", "canvas", "size", "pos", "index", "color");
@@ -1025,6 +1026,12 @@ void TextServerExtension::font_draw_glyph(const RID &p_font_rid, const RID &p_ca
 #endif
 }
 
+void TextServerExtension::font_draw_glyphs(const RID &p_font_rid, const RID &p_canvas, int64_t p_size, const PackedVector2Array &p_positions, const PackedInt64Array &p_indices, const Color &p_color, float p_oversampling) const {
+	if (!GDVIRTUAL_CALL(_font_draw_glyphs, p_font_rid, p_canvas, p_size, p_positions, p_indices, p_color, p_oversampling)) {
+		TextServer::font_draw_glyphs(p_font_rid, p_canvas, p_size, p_positions, p_indices, p_color, p_oversampling);
+	}
+}
+
 void TextServerExtension::font_draw_glyph_outline(const RID &p_font_rid, const RID &p_canvas, int64_t p_size, int64_t p_outline_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color, float p_oversampling) const {
 	GDVIRTUAL_CALL(_font_draw_glyph_outline, p_font_rid, p_canvas, p_size, p_outline_size, p_pos, p_index, p_color, p_oversampling);
 #ifndef DISABLE_DEPRECATED
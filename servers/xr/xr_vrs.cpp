@@ -123,7 +123,69 @@ RID XRVRS::make_vrs_texture(const Size2 &p_target_size, const PackedVector2Array
 	// For our standard VRS extension on Vulkan this means a maximum of 8x8.
 	// For the density map extension this scales depending on the max texel size.
 
-	if (target_size != vrs_sizei || eye_foci != p_eye_foci || vrs_dirty) {
+	Size2 region_ratio = Size2(1.0, 1.0);
+	Point2i region_offset;
+	if (vrs_render_region != Rect2i()) {
+		region_ratio = (Size2)vrs_render_region.size / p_target_size;
+		region_offset = (Point2)vrs_render_region.position / p_target_size * vrs_sizei;
+	}
+
+	// Quantize the focus points to density-map texels. With eye tracking the foci move
+	// every frame, but while they stay within the same texel the map doesn't change.
+	uint32_t view_count = MIN((uint32_t)p_eye_foci.size(), (uint32_t)RendererSceneRender::MAX_RENDER_VIEWS);
+	LocalVector<Vector2i> new_view_centers;
+	new_view_centers.resize(view_count);
+	for (uint32_t i = 0; i < view_count; i++) {
+		new_view_centers[i].x = int(vrs_size.x * (p_eye_foci[i].x + 1.0) * region_ratio.x * 0.5) + region_offset.x;
+		new_view_centers[i].y = int(vrs_size.y * (-p_eye_foci[i].y + 1.0) * region_ratio.y * 0.5) + region_offset.y;
+	}
+
+	bool cache_reusable = vrs_texture.is_valid() && target_size == Size2i(vrs_sizei) && view_centers.size() == new_view_centers.size();
+	if (cache_reusable && !vrs_dirty) {
+		bool unchanged = true;
+		for (uint32_t i = 0; i < view_count; i++) {
+			if (view_centers[i] != new_view_centers[i]) {
+				unchanged = false;
+				break;
+			}
+		}
+		if (unchanged) {
+			return vrs_texture;
+		}
+	}
+
+	target_size = vrs_sizei;
+	view_centers = new_view_centers;
+
+	Vector<Ref<Image>> images;
+	for (uint32_t i = 0; i < view_count; i++) {
+		PackedByteArray data;
+		data.resize(vrs_sizei.x * vrs_sizei.y * 2);
+		uint8_t *data_ptr = data.ptrw();
+
+		const Vector2i &view_center = view_centers[i];
+
+		int d = 0;
+		for (int y = 0; y < vrs_sizei.y; y++) {
+			for (int x = 0; x < vrs_sizei.x; x++) {
+				// Generate a density map that represents the distance to the view focus point. While this leaves the opportunities
+				// offered by the density map being different in each direction currently unused, it was found to give better tile
+				// distribution on hardware that supports the feature natively. This area is open to improvements in the future.
+				Vector2 offset = Vector2(x - view_center.x, y - view_center.y) / region_ratio;
+				real_t density = MAX(offset.length() - min_radius, 0.0) / outer_radius;
+				data_ptr[d++] = CLAMP(255.0 * density, 0, 255);
+				data_ptr[d++] = CLAMP(255.0 * density, 0, 255);
+			}
+		}
+		images.push_back(Image::create_from_data(vrs_sizei.x, vrs_sizei.y, false, Image::FORMAT_RG8, data));
+	}
+
+	if (cache_reusable) {
+		// Same size and view count; refresh the existing texture instead of churning RIDs every time the gaze moves.
+		for (int i = 0; i < images.size(); i++) {
+			RS::get_singleton()->texture_2d_update(vrs_texture, images[i], i);
+		}
+	} else {
 		// Out with the old.
 		if (vrs_texture.is_valid()) {
 			RS::get_singleton()->free_rid(vrs_texture);
@@ -131,49 +193,14 @@ RID XRVRS::make_vrs_texture(const Size2 &p_target_size, const PackedVector2Array
 		}
 
 		// In with the new.
-		Vector<Ref<Image>> images;
-		target_size = vrs_sizei;
-		eye_foci = p_eye_foci;
-
-		Size2 region_ratio = Size2(1.0, 1.0);
-		Point2i region_offset;
-		if (vrs_render_region != Rect2i()) {
-			region_ratio = (Size2)vrs_render_region.size / p_target_size;
-			region_offset = (Point2)vrs_render_region.position / p_target_size * vrs_sizei;
-		}
-
-		for (int i = 0; i < eye_foci.size() && i < RendererSceneRender::MAX_RENDER_VIEWS; i++) {
-			PackedByteArray data;
-			data.resize(vrs_sizei.x * vrs_sizei.y * 2);
-			uint8_t *data_ptr = data.ptrw();
-
-			Vector2i view_center;
-			view_center.x = int(vrs_size.x * (eye_foci[i].x + 1.0) * region_ratio.x * 0.5) + region_offset.x;
-			view_center.y = int(vrs_size.y * (-eye_foci[i].y + 1.0) * region_ratio.y * 0.5) + region_offset.y;
-
-			int d = 0;
-			for (int y = 0; y < vrs_sizei.y; y++) {
-				for (int x = 0; x < vrs_sizei.x; x++) {
-					// Generate a density map that represents the distance to the view focus point. While this leaves the opportunities
-					// offered by the density map being different in each direction currently unused, it was found to give better tile
-					// distribution on hardware that supports the feature natively. This area is open to improvements in the future.
-					Vector2 offset = Vector2(x - view_center.x, y - view_center.y) / region_ratio;
-					real_t density = MAX(offset.length() - min_radius, 0.0) / outer_radius;
-					data_ptr[d++] = CLAMP(255.0 * density, 0, 255);
-					data_ptr[d++] = CLAMP(255.0 * density, 0, 255);
-				}
-			}
-			images.push_back(Image::create_from_data(vrs_sizei.x, vrs_sizei.y, false, Image::FORMAT_RG8, data));
-		}
-
 		if (images.size() == 1) {
 			vrs_texture = RS::get_singleton()->texture_2d_create(images[0]);
 		} else {
 			vrs_texture = RS::get_singleton()->texture_2d_layered_create(images, RS::TEXTURE_LAYERED_2D_ARRAY);
 		}
-
-		vrs_dirty = false;
 	}
 
+	vrs_dirty = false;
+
 	return vrs_texture;
 }
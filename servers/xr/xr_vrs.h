@@ -32,6 +32,7 @@
 
 #include "core/object/class_db.h"
 #include "core/object/object.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rid.h"
 #include "core/variant/variant.h"
 
@@ -48,7 +49,9 @@ private:
 
 	RID vrs_texture;
 	Size2i target_size;
-	PackedVector2Array eye_foci;
+	// Focus points quantized to density-map texels; while these don't move by at
+	// least one texel, the generated map stays identical and is reused as-is.
+	LocalVector<Vector2i> view_centers;
 
 protected:
 	static void _bind_methods();
@@ -0,0 +1,119 @@
+/**************************************************************************/
+/*  benchmark_core.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/string/string_name.h"
+#include "core/templates/a_hash_map.h"
+#include "core/templates/hash_map.h"
+#include "core/variant/variant.h"
+
+#include "tests/benchmark/benchmark_macros.h"
+
+namespace TestBenchmark {
+
+TEST_SUITE("[Benchmark]") {
+
+TEST_CASE("Variant::callp" * doctest::skip()) {
+	Variant str = String("Hello, benchmark world!");
+	StringName method = "length";
+
+	measure("variant_callp_string_length", [&](uint64_t p_iterations) {
+		for (uint64_t i = 0; i < p_iterations; i++) {
+			Variant ret;
+			Callable::CallError err;
+			str.callp(method, nullptr, 0, ret, err);
+			do_not_optimize(ret);
+		}
+	});
+}
+
+TEST_CASE("StringName interning" * doctest::skip()) {
+	String hot = "theme_override_font_sizes/font_size";
+
+	measure("string_name_intern_existing", [&](uint64_t p_iterations) {
+		StringName warm(hot); // Keep the name alive so lookups always hit.
+		for (uint64_t i = 0; i < p_iterations; i++) {
+			StringName sn(hot);
+			do_not_optimize(sn);
+		}
+	});
+}
+
+TEST_CASE("HashMap and AHashMap probes" * doctest::skip()) {
+	const uint32_t entry_count = 10000;
+	HashMap<int, int> hash_map;
+	AHashMap<int, int> a_hash_map;
+	for (uint32_t i = 0; i < entry_count; i++) {
+		hash_map.insert(i * 7, i);
+		a_hash_map.insert(i * 7, i);
+	}
+
+	measure("hash_map_lookup_hit", [&](uint64_t p_iterations) {
+		for (uint64_t i = 0; i < p_iterations; i++) {
+			int *value = hash_map.getptr(int((i % entry_count) * 7));
+			do_not_optimize(value);
+		}
+	});
+
+	measure("a_hash_map_lookup_hit", [&](uint64_t p_iterations) {
+		for (uint64_t i = 0; i < p_iterations; i++) {
+			int *value = a_hash_map.getptr(int((i % entry_count) * 7));
+			do_not_optimize(value);
+		}
+	});
+}
+
+TEST_CASE("CowData copy and detach" * doctest::skip()) {
+	Vector<int> source;
+	source.resize(4096);
+	for (int i = 0; i < source.size(); i++) {
+		source.write[i] = i;
+	}
+
+	measure("cow_data_shared_copy", [&](uint64_t p_iterations) {
+		for (uint64_t i = 0; i < p_iterations; i++) {
+			Vector<int> copy = source;
+			do_not_optimize(copy);
+		}
+	});
+
+	measure("cow_data_detach_4096", [&](uint64_t p_iterations) {
+		for (uint64_t i = 0; i < p_iterations; i++) {
+			Vector<int> copy = source;
+			copy.write[0] = int(i); // Forces the copy-on-write detach.
+			do_not_optimize(copy);
+		}
+	});
+}
+
+} // TEST_SUITE("[Benchmark]")
+
+} // namespace TestBenchmark
@@ -0,0 +1,87 @@
+/**************************************************************************/
+/*  benchmark_macros.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/os.h"
+#include "core/string/print_string.h"
+
+#include "tests/test_macros.h"
+
+// Minimal microbenchmark harness. Benchmarks are regular doctest test cases
+// tagged [Benchmark] and marked skip, so correctness runs don't pay for them.
+// Run them explicitly with:
+//   godot --test --test-case="*[Benchmark]*" --no-skip
+//
+// Each measurement prints one pipe-separated line:
+//   BENCHMARK|<name>|<iterations>|<ns_per_iteration>
+// which CI can extract and diff against tracked baselines.
+
+namespace TestBenchmark {
+
+// Keeps the compiler from discarding the benchmarked expression.
+template <typename T>
+_FORCE_INLINE_ void do_not_optimize(const T &p_value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+	volatile const void *volatile unused = &p_value;
+	(void)unused;
+#else
+	asm volatile("" : : "r,m"(p_value) : "memory");
+#endif
+}
+
+// Calls `p_func(iteration_count)` with geometrically growing counts until the
+// timed run is long enough to be stable, then reports nanoseconds per
+// iteration. `p_func` must loop exactly `iteration_count` times.
+template <typename F>
+void measure(const String &p_name, F p_func) {
+	const uint64_t min_run_usec = 100000; // 100 ms measured run.
+	const uint64_t max_iterations = uint64_t(1) << 28;
+
+	p_func(uint64_t(8)); // Warmup.
+
+	uint64_t iterations = 64;
+	uint64_t elapsed_usec = 0;
+	while (true) {
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		p_func(iterations);
+		elapsed_usec = OS::get_singleton()->get_ticks_usec() - begin;
+		if (elapsed_usec >= min_run_usec || iterations >= max_iterations) {
+			break;
+		}
+		// Aim past the target run time so the final doubling isn't wasted.
+		iterations *= (elapsed_usec < min_run_usec / 8) ? 8 : 2;
+	}
+
+	double ns_per_iteration = (double)elapsed_usec * 1000.0 / (double)iterations;
+	print_line(vformat("BENCHMARK|%s|%d|%.2f", p_name, (int64_t)iterations, ns_per_iteration));
+}
+
+} // namespace TestBenchmark
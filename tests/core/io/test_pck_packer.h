@@ -116,4 +116,30 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+TEST_CASE("[PCKPacker] Pack a PCK file with a compressed file") {
+	const String base_dir = OS::get_singleton()->get_executable_path().get_base_dir();
+	const String source_path = base_dir.path_join("../icon.svg");
+
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_compressed.pck");
+	CHECK_MESSAGE(
+			pck_packer.pck_start(output_pck_path) == OK,
+			"Starting a PCK file should return an OK error code.");
+	CHECK_MESSAGE(
+			pck_packer.add_file("icon.svg", source_path, false, true) == OK,
+			"Adding a compressed file to the PCK should return an OK error code.");
+	CHECK_MESSAGE(
+			pck_packer.flush() == OK,
+			"Flushing the PCK should return an OK error code.");
+
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(output_pck_path, FileAccess::READ, &err);
+	CHECK_MESSAGE(
+			err == OK,
+			"The generated PCK file with a compressed file should be opened successfully.");
+	CHECK_MESSAGE(
+			f->get_length() < FileAccess::get_size(source_path),
+			"The generated PCK file should be smaller than the uncompressed source file.");
+}
 } // namespace TestPCKPacker
@@ -84,6 +84,30 @@ TEST_CASE("[AStar3D] ABCX path") {
 	CHECK(path[3] == ABCX::C);
 }
 
+TEST_CASE("[AStar3D] ABCX multi-target paths") {
+	ABCX abcx;
+	PackedInt64Array to_ids;
+	to_ids.push_back(ABCX::C);
+	to_ids.push_back(ABCX::X);
+	TypedArray<PackedInt64Array> paths = abcx.get_id_paths(ABCX::X, to_ids);
+	REQUIRE(paths.size() == 2);
+	PackedInt64Array to_c = paths[0];
+	REQUIRE(to_c.size() == 4);
+	CHECK(to_c[0] == ABCX::X);
+	CHECK(to_c[1] == ABCX::A);
+	CHECK(to_c[2] == ABCX::B);
+	CHECK(to_c[3] == ABCX::C);
+	PackedInt64Array to_self = paths[1];
+	REQUIRE(to_self.size() == 1);
+	CHECK(to_self[0] == ABCX::X);
+
+	// An unreachable target yields an empty path.
+	abcx.set_point_disabled(ABCX::A);
+	paths = abcx.get_id_paths(ABCX::X, to_ids);
+	REQUIRE(paths.size() == 2);
+	CHECK(PackedInt64Array(paths[0]).size() == 0);
+}
+
 TEST_CASE("[AStar3D] Add/Remove") {
 	AStar3D a;
 
@@ -0,0 +1,119 @@
+/**************************************************************************/
+/*  test_typed_signal.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/typed_signal.h"
+#include "tests/test_macros.h"
+
+// Declared in global namespace because of GDCLASS macro warning (Windows):
+// "Unqualified friend declaration referring to type outside of the nearest enclosing namespace
+// is a Microsoft extension; add a nested name specifier".
+class _TestTypedSignalReceiver : public Object {
+	GDCLASS(_TestTypedSignalReceiver, Object);
+
+public:
+	int call_count = 0;
+	int last_value = 0;
+	String last_text;
+	TypedSignal<int, const String &> *disconnect_from = nullptr;
+
+	void on_value(int p_value, const String &p_text) {
+		call_count++;
+		last_value = p_value;
+		last_text = p_text;
+		if (disconnect_from != nullptr) {
+			disconnect_from->disconnect(this, &_TestTypedSignalReceiver::on_value);
+		}
+	}
+
+	void on_value_other(int p_value, const String &p_text) {
+		call_count++;
+	}
+};
+
+namespace TestTypedSignal {
+
+TEST_CASE("[TypedSignal] Connect, emit and disconnect") {
+	TypedSignal<int, const String &> sig;
+	_TestTypedSignalReceiver *receiver = memnew(_TestTypedSignalReceiver);
+
+	CHECK(!sig.has_connections());
+	sig.connect(receiver, &_TestTypedSignalReceiver::on_value);
+	CHECK(sig.has_connections());
+	CHECK(sig.is_connected(receiver, &_TestTypedSignalReceiver::on_value));
+	CHECK(!sig.is_connected(receiver, &_TestTypedSignalReceiver::on_value_other));
+
+	sig.emit(42, "hello");
+	CHECK(receiver->call_count == 1);
+	CHECK(receiver->last_value == 42);
+	CHECK(receiver->last_text == "hello");
+
+	sig.disconnect(receiver, &_TestTypedSignalReceiver::on_value);
+	CHECK(!sig.has_connections());
+	sig.emit(7, "ignored");
+	CHECK(receiver->call_count == 1);
+
+	memdelete(receiver);
+}
+
+TEST_CASE("[TypedSignal] Freed target is skipped") {
+	TypedSignal<int, const String &> sig;
+	_TestTypedSignalReceiver *first = memnew(_TestTypedSignalReceiver);
+	_TestTypedSignalReceiver *second = memnew(_TestTypedSignalReceiver);
+
+	sig.connect(first, &_TestTypedSignalReceiver::on_value);
+	sig.connect(second, &_TestTypedSignalReceiver::on_value);
+
+	memdelete(first);
+	sig.emit(1, "still emitting");
+	CHECK(second->call_count == 1);
+
+	memdelete(second);
+}
+
+TEST_CASE("[TypedSignal] Disconnect from within a handler") {
+	TypedSignal<int, const String &> sig;
+	_TestTypedSignalReceiver *receiver = memnew(_TestTypedSignalReceiver);
+
+	sig.connect(receiver, &_TestTypedSignalReceiver::on_value);
+	receiver->disconnect_from = &sig;
+
+	sig.emit(1, "once");
+	CHECK(receiver->call_count == 1);
+	CHECK(!sig.is_connected(receiver, &_TestTypedSignalReceiver::on_value));
+
+	sig.emit(2, "never");
+	CHECK(receiver->call_count == 1);
+
+	memdelete(receiver);
+}
+
+} // namespace TestTypedSignal
@@ -40,11 +40,16 @@ class _TestUndoRedoObject : public Object {
 	GDCLASS(_TestUndoRedoObject, Object);
 	int property_value = 0;
 
+	PackedFloat32Array data_value;
+
 protected:
 	static void _bind_methods() {
 		ClassDB::bind_method(D_METHOD("set_property", "property"), &_TestUndoRedoObject::set_property);
 		ClassDB::bind_method(D_METHOD("get_property"), &_TestUndoRedoObject::get_property);
 		ADD_PROPERTY(PropertyInfo(Variant::INT, "property"), "set_property", "get_property");
+		ClassDB::bind_method(D_METHOD("set_data", "data"), &_TestUndoRedoObject::set_data);
+		ClassDB::bind_method(D_METHOD("get_data"), &_TestUndoRedoObject::get_data);
+		ADD_PROPERTY(PropertyInfo(Variant::PACKED_FLOAT32_ARRAY, "data"), "set_data", "get_data");
 	}
 
 public:
@@ -52,6 +57,8 @@ public:
 	int get_property() const { return property_value; }
 	void add_to_property(int value) { property_value += value; }
 	void subtract_from_property(int value) { property_value -= value; }
+	void set_data(const PackedFloat32Array &value) { data_value = value; }
+	PackedFloat32Array get_data() const { return data_value; }
 };
 
 namespace TestUndoRedo {
@@ -196,4 +203,39 @@ TEST_CASE("[UndoRedo] Merge Method UndoRedo") {
 	memdelete(undo_redo);
 }
 
+TEST_CASE("[UndoRedo] Compressed Packed Array Property UndoRedo") {
+	GDREGISTER_CLASS(_TestUndoRedoObject);
+	UndoRedo *undo_redo = memnew(UndoRedo());
+
+	_TestUndoRedoObject *test_object = memnew(_TestUndoRedoObject());
+
+	// Large enough (> 256 KiB) for the snapshots to be stored compressed.
+	PackedFloat32Array old_data;
+	old_data.resize(100000);
+	old_data.fill(1.0f);
+	test_object->set_data(old_data);
+
+	PackedFloat32Array new_data;
+	new_data.resize(100000);
+	new_data.fill(2.0f);
+
+	undo_redo->create_action("Set Data");
+	undo_redo->add_do_property(test_object, "data", new_data);
+	undo_redo->add_undo_property(test_object, "data", test_object->get_data());
+	undo_redo->commit_action();
+
+	CHECK(test_object->get_data() == new_data);
+
+	undo_redo->undo();
+
+	CHECK(test_object->get_data() == old_data);
+
+	undo_redo->redo();
+
+	CHECK(test_object->get_data() == new_data);
+
+	memdelete(test_object);
+	memdelete(undo_redo);
+}
+
 } //namespace TestUndoRedo
@@ -873,6 +873,19 @@ TEST_CASE("[String] sprintf") {
 	output = format.sprintf(args, &error);
 	REQUIRE(error == false);
 	CHECK(output == String("fish % frog"));
+
+	// No placeholders.
+	format = "fish frog";
+	args.clear();
+	output = format.sprintf(args, &error);
+	REQUIRE(error == false);
+	CHECK(output == String("fish frog"));
+
+	// No placeholders with arguments.
+	args.push_back("cheese");
+	output = format.sprintf(args, &error);
+	REQUIRE(error);
+	CHECK(output == "not all arguments converted during string formatting");
 	///// Ints
 
 	// Int
@@ -333,6 +333,33 @@ TEST_CASE("[CommandQueue] Test Queue Basics with WorkerThreadPool sync.") {
 	test_command_queue_basic(true);
 }
 
+TEST_CASE("[CommandQueue] Test batched submission") {
+	struct Counter {
+		int count = 0;
+		void add(int p_amount) { count += p_amount; }
+	} counter;
+
+	CommandQueueMT queue;
+
+	queue.begin_batch();
+	for (int i = 0; i < 100; i++) {
+		queue.push(&counter, &Counter::add, 1);
+	}
+	queue.flush_all();
+	CHECK_MESSAGE(counter.count == 0,
+			"Staged commands should not be visible to the consumer before end_batch.");
+
+	queue.end_batch();
+	queue.flush_all();
+	CHECK_MESSAGE(counter.count == 100,
+			"All staged commands should execute after end_batch.");
+
+	// A batch mixed with direct pushes keeps working afterwards.
+	queue.push(&counter, &Counter::add, 1);
+	queue.flush_all();
+	CHECK(counter.count == 101);
+}
+
 TEST_CASE("[CommandQueue] Test Queue Wrapping to same spot.") {
 	const char *COMMAND_QUEUE_SETTING = "memory/limits/command_queue/multithreading_queue_size_kb";
 	ProjectSettings::get_singleton()->set_setting(COMMAND_QUEUE_SETTING, 1);
@@ -115,6 +115,24 @@ TEST_CASE("[RID] 'get_local_index'") {
 	CHECK(RID::from_uint64(4'294'967'297).get_local_index() == 1);
 }
 
+TEST_CASE("[RID_Owner] Bulk allocation") {
+	RID_Owner<int, true> rid_owner;
+
+	RID rids[128];
+	CHECK(rid_owner.allocate_rids(128, rids) == 128);
+
+	for (uint32_t i = 0; i < 128; i++) {
+		CHECK(rids[i].is_valid());
+		rid_owner.initialize_rid(rids[i], int(i));
+	}
+	for (uint32_t i = 0; i < 128; i++) {
+		int *value = rid_owner.get_or_null(rids[i]);
+		REQUIRE(value != nullptr);
+		CHECK(*value == int(i));
+		rid_owner.free(rids[i]);
+	}
+}
+
 #ifdef THREADS_ENABLED
 // This case would let sanitizers realize data races.
 // Additionally, on purely weakly ordered architectures, it would detect synchronization issues
@@ -121,6 +121,31 @@ TEST_CASE("[Dictionary] get_key_at_index()") {
 	CHECK(int(val) == 3);
 }
 
+TEST_CASE("[Dictionary] next()") {
+	Dictionary map;
+	CHECK(map.next(nullptr) == nullptr);
+	map[1] = "one";
+	map[2] = "two";
+	map[3] = "three";
+	const Variant *key = map.next(nullptr);
+	REQUIRE(key != nullptr);
+	CHECK(int(*key) == 1);
+	key = map.next(key);
+	REQUIRE(key != nullptr);
+	CHECK(int(*key) == 2);
+	// Mutating mid-iteration must not confuse the cursor.
+	map.erase(3);
+	map[4] = "four";
+	key = map.next(key);
+	REQUIRE(key != nullptr);
+	CHECK(int(*key) == 4);
+	CHECK(map.next(key) == nullptr);
+	// Restarting is always possible.
+	key = map.next(nullptr);
+	REQUIRE(key != nullptr);
+	CHECK(int(*key) == 1);
+}
+
 TEST_CASE("[Dictionary] getptr()") {
 	Dictionary map;
 	map[1] = 3;
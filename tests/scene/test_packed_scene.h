@@ -215,6 +215,95 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instance Pool Reuse And Reset") {
+	// Create a scene to pack, with a non-default property value.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	scene->set_process_priority(5);
+
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	scene->add_child(child);
+	child->set_owner(scene);
+	child->set_process_priority(7);
+
+	// Pack the scene.
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// With the default capacity of 0, instances are not accepted into the pool.
+	Node *instance = packed_scene.instantiate();
+	CHECK(instance != nullptr);
+	CHECK_FALSE(packed_scene.release_pooled_instance(instance));
+
+	packed_scene.set_instance_pool_capacity(1);
+
+	// Modify the instance, then release it to the pool.
+	instance->set_process_priority(99);
+	instance->get_child(0)->set_process_priority(99);
+	CHECK(packed_scene.release_pooled_instance(instance));
+
+	// The pooled instance is handed out again, reset to the recorded state.
+	Node *reused = packed_scene.instantiate_pooled();
+	CHECK(reused == instance);
+	CHECK(reused->get_process_priority() == 5);
+	CHECK(reused->get_child(0)->get_process_priority() == 7);
+
+	// An instance missing a recorded node is rejected.
+	memdelete(reused->get_child(0));
+	CHECK_FALSE(packed_scene.release_pooled_instance(reused));
+
+	memdelete(scene);
+	memdelete(reused);
+}
+
+TEST_CASE("[PackedScene] Patch Instance With Changed Properties") {
+	// Pack the original version of the scene.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	scene->set_process_priority(5);
+
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	scene->add_child(child);
+	child->set_owner(scene);
+	child->set_process_priority(7);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	Ref<SceneState> old_state = packed_scene->get_state();
+
+	Node *instance = packed_scene->instantiate();
+	CHECK(instance != nullptr);
+
+	// Pack a new version with only property changes; patching applies them in place.
+	child->set_process_priority(9);
+	Ref<PackedScene> new_scene;
+	new_scene.instantiate();
+	new_scene->pack(scene);
+
+	CHECK(new_scene->patch_instance(instance, old_state));
+	CHECK(instance->get_process_priority() == 5);
+	CHECK(instance->get_child(0)->get_process_priority() == 9);
+
+	// A structural change (added node) refuses to patch and leaves the instance alone.
+	Node *extra = memnew(Node);
+	extra->set_name("Extra");
+	scene->add_child(extra);
+	extra->set_owner(scene);
+
+	Ref<PackedScene> structural_scene;
+	structural_scene.instantiate();
+	structural_scene->pack(scene);
+
+	CHECK_FALSE(structural_scene->patch_instance(instance, old_state));
+	CHECK(instance->get_child_count() == 1);
+
+	memdelete(instance);
+	memdelete(scene);
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
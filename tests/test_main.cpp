@@ -39,6 +39,7 @@
 #include "editor/settings/editor_settings.h"
 #endif // TOOLS_ENABLED
 
+#include "tests/benchmark/benchmark_core.h"
 #include "tests/core/config/test_project_settings.h"
 #include "tests/core/input/test_input_event.h"
 #include "tests/core/input/test_input_event_key.h"
@@ -90,6 +91,7 @@
 #include "tests/core/object/test_class_db.h"
 #include "tests/core/object/test_method_bind.h"
 #include "tests/core/object/test_object.h"
+#include "tests/core/object/test_typed_signal.h"
 #include "tests/core/object/test_undo_redo.h"
 #include "tests/core/os/test_os.h"
 #include "tests/core/string/test_fuzzy_search.h"